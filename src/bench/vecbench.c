@@ -0,0 +1,356 @@
+/*
+ * =======================================================================
+ *
+ * Benchmark of the batched vector math in vector.c against the
+ * scalar functions from shared.c. Built with "make vecbench",
+ * it isn't part of the game module.
+ *
+ * =======================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vector.h"
+
+/* shared.c prints through this */
+void
+Com_Printf(const char *msg, ...)
+{
+	va_list argptr;
+
+	va_start(argptr, msg);
+	vprintf(msg, argptr);
+	va_end(argptr);
+}
+
+static void *
+VecBench_Alloc(size_t size)
+{
+	void *p;
+
+	p = calloc(1, size);
+
+	if (!p)
+	{
+		fprintf(stderr, "Couldn't allocate %u bytes\n", (unsigned int)size);
+		exit(1);
+	}
+
+	return p;
+}
+
+static float
+VecBench_Rand(randk_stream_t *rs, float scale)
+{
+	return ((randk_stream(rs) & 0xffffff) / (float)0xffffff * 2 - 1) * scale;
+}
+
+static double
+VecBench_Diff(const float *a, const float *b, int n)
+{
+	double d, maxdiff;
+	int i;
+
+	maxdiff = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		d = fabs((double)a[i] - b[i]);
+
+		if (d > maxdiff)
+		{
+			maxdiff = d;
+		}
+	}
+
+	return maxdiff;
+}
+
+static void
+VecBench_Report(const char *name, long long scalar, long long batched,
+		int n, double maxdiff)
+{
+	printf("%-10s %8.3f %8.3f  x%5.2f  %g\n", name,
+			1000.0 * scalar / n, 1000.0 * batched / n,
+			batched ? (double)scalar / batched : 0, maxdiff);
+}
+
+/*
+ * vecbench [count] [iterations]
+ *
+ * Compares the batched vector functions against the
+ * scalar ones called in a loop, for speed and for the
+ * largest difference between their results.
+ */
+int
+main(int argc, char **argv)
+{
+	float (*m)[3][4], (*mout1)[3][4], (*mout2)[3][4];
+	vec3_t *a, *b, *out1, *out2, *out3, *out4, *out5, *out6;
+	float *f1, *f2;
+	int *s1, *s2;
+	long long start, scalar, batched;
+	randk_stream_t rs;
+	cplane_t plane;
+	int i, j, k, count, iterations, n;
+	size_t size;
+
+	count = (argc > 1) ? (int)strtol(argv[1], NULL, 10) : 1024;
+	iterations = (argc > 2) ? (int)strtol(argv[2], NULL, 10) : 1000;
+
+	if ((count <= 0) || (iterations <= 0))
+	{
+		printf("Usage: vecbench [count] [iterations]\n");
+		return 1;
+	}
+
+	size = count * sizeof(vec3_t);
+	a = VecBench_Alloc(size);
+	b = VecBench_Alloc(size);
+	out1 = VecBench_Alloc(size);
+	out2 = VecBench_Alloc(size);
+	out3 = VecBench_Alloc(size);
+	out4 = VecBench_Alloc(size);
+	out5 = VecBench_Alloc(size);
+	out6 = VecBench_Alloc(size);
+	f1 = VecBench_Alloc(count * sizeof(float));
+	f2 = VecBench_Alloc(count * sizeof(float));
+	s1 = VecBench_Alloc(count * sizeof(int));
+	s2 = VecBench_Alloc(count * sizeof(int));
+	m = VecBench_Alloc(count * sizeof(*m));
+	mout1 = VecBench_Alloc(count * sizeof(*m));
+	mout2 = VecBench_Alloc(count * sizeof(*m));
+
+	/* fixed seed, runs are comparable */
+	randk_stream_seed(&rs, 1, 0);
+
+	for (i = 0; i < count; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			a[i][j] = VecBench_Rand(&rs, 4096);
+			b[i][j] = VecBench_Rand(&rs, 360);
+		}
+
+		for (j = 0; j < 3; j++)
+		{
+			for (k = 0; k < 4; k++)
+			{
+				m[i][j][k] = VecBench_Rand(&rs, 1);
+			}
+		}
+	}
+
+	VectorSet(plane.normal, 0.48, -0.6, 0.64);
+	plane.dist = 100;
+	plane.type = 5; /* not axial */
+	plane.signbits = 2;
+
+	n = count * iterations;
+
+	printf("%i vectors, %i iterations, %s\n", count,
+			iterations, VectorArrayImpl());
+	printf("           scalar    batch (ns/vector)  max diff\n");
+
+	/* VectorMA */
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			VectorMA(a[i], 0.5f, b[i], out1[i]);
+		}
+	}
+
+	scalar = Q_Microseconds() - start;
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		VectorMAArray((const vec3_t *)a, 0.5f, (const vec3_t *)b, out2, count);
+	}
+
+	batched = Q_Microseconds() - start;
+	VecBench_Report("VectorMA", scalar, batched, n,
+			VecBench_Diff(out1[0], out2[0], count * 3));
+
+	/* DotProduct */
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			f1[i] = DotProduct(a[i], b[i]);
+		}
+	}
+
+	scalar = Q_Microseconds() - start;
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		DotProductArray((const vec3_t *)a, (const vec3_t *)b, f2, count);
+	}
+
+	batched = Q_Microseconds() - start;
+	VecBench_Report("DotProduct", scalar, batched, n,
+			VecBench_Diff(f1, f2, count));
+
+	/* VectorNormalize, both include the copy */
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		memcpy(out1, a, size);
+
+		for (i = 0; i < count; i++)
+		{
+			f1[i] = VectorNormalize(out1[i]);
+		}
+	}
+
+	scalar = Q_Microseconds() - start;
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		memcpy(out2, a, size);
+		VectorNormalizeArray(out2, f2, count);
+	}
+
+	batched = Q_Microseconds() - start;
+	VecBench_Report("Normalize", scalar, batched, n,
+			VecBench_Diff(out1[0], out2[0], count * 3));
+
+	/* AngleVectors */
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			AngleVectors(b[i], out1[i], out2[i], out3[i]);
+		}
+	}
+
+	scalar = Q_Microseconds() - start;
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		AngleVectorsArray((const vec3_t *)b, out4, out5, out6, count);
+	}
+
+	batched = Q_Microseconds() - start;
+	VecBench_Report("AngleVecs", scalar, batched, n,
+			fmax(fmax(VecBench_Diff(out1[0], out4[0], count * 3),
+					VecBench_Diff(out2[0], out5[0], count * 3)),
+				VecBench_Diff(out3[0], out6[0], count * 3)));
+
+	/* RotatePointAroundVector */
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			RotatePointAroundVector(out1[i], plane.normal, a[i], 33);
+		}
+	}
+
+	scalar = Q_Microseconds() - start;
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		RotatePointsAroundVector(out2, plane.normal, (const vec3_t *)a,
+				count, 33);
+	}
+
+	batched = Q_Microseconds() - start;
+	VecBench_Report("Rotate", scalar, batched, n,
+			VecBench_Diff(out1[0], out2[0], count * 3));
+
+	/* R_ConcatTransforms */
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			R_ConcatTransforms((const float (*)[4])m[0],
+					(const float (*)[4])m[i], mout1[i]);
+		}
+	}
+
+	scalar = Q_Microseconds() - start;
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		R_ConcatTransformsArray((const float (*)[4])m[0],
+				(const float (*)[3][4])m, mout2, count);
+	}
+
+	batched = Q_Microseconds() - start;
+	VecBench_Report("Concat", scalar, batched, n,
+			VecBench_Diff(mout1[0][0], mout2[0][0], count * 12));
+
+	/* BoxOnPlaneSide, a are the mins and out3 the maxs */
+	for (i = 0; i < count; i++)
+	{
+		for (k = 0; k < 3; k++)
+		{
+			out3[i][k] = a[i][k] + fabs(b[i][k]);
+		}
+	}
+
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		for (i = 0; i < count; i++)
+		{
+			s1[i] = BoxOnPlaneSide2(a[i], out3[i], &plane);
+		}
+	}
+
+	scalar = Q_Microseconds() - start;
+	start = Q_Microseconds();
+
+	for (j = 0; j < iterations; j++)
+	{
+		BoxOnPlaneSideArray((const vec3_t *)a, (const vec3_t *)out3, &plane,
+				s2, count);
+	}
+
+	batched = Q_Microseconds() - start;
+
+	for (i = 0, k = 0; i < count; i++)
+	{
+		k += (s1[i] != s2[i]);
+	}
+
+	VecBench_Report("BoxOnPlane", scalar, batched, n, k);
+
+	free(a);
+	free(b);
+	free(out1);
+	free(out2);
+	free(out3);
+	free(out4);
+	free(out5);
+	free(out6);
+	free(f1);
+	free(f2);
+	free(s1);
+	free(s2);
+	free(m);
+	free(mout1);
+	free(mout2);
+
+	return 0;
+}
@@ -0,0 +1,568 @@
+/*
+ * =======================================================================
+ *
+ * Batched vector math. These work on arrays of vectors and do
+ * four of them at a time with SSE2 or NEON, the remainder and
+ * builds without SIMD use the scalar functions from shared.c.
+ * The instruction set is chosen at build time, NO_SIMD forces
+ * the scalar code. None of the game's hot loops work on arrays
+ * of vectors, so this is only built into vecbench.
+ *
+ * A single vec3_t is too small to gain anything from SIMD, the
+ * loads and shuffles cost more than the three multiplications.
+ * That's why the single vector functions stay scalar.
+ *
+ * =======================================================================
+ */
+
+#include "vector.h"
+
+#if !defined(NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define USE_SSE2
+#include <emmintrin.h>
+#elif !defined(NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#define USE_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(USE_SSE2)
+
+typedef __m128 vf4_t;
+typedef __m128i vi4_t;
+
+#define VF4_LOAD(p) _mm_loadu_ps(p)
+#define VF4_STORE(p, v) _mm_storeu_ps(p, v)
+#define VF4_SET(f) _mm_set1_ps(f)
+#define VF4_ADD(a, b) _mm_add_ps(a, b)
+#define VF4_SUB(a, b) _mm_sub_ps(a, b)
+#define VF4_MUL(a, b) _mm_mul_ps(a, b)
+#define VF4_DIV(a, b) _mm_div_ps(a, b)
+#define VF4_SQRT(a) _mm_sqrt_ps(a)
+#define VF4_XOR(a, b) _mm_xor_ps(a, b)
+#define VF4_AND(a, b) _mm_and_ps(a, b)
+#define VF4_ANDNOT(a, b) _mm_andnot_ps(a, b) /* ~a & b */
+#define VF4_SELECT(m, a, b) _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define VF4_CMPGE(a, b) _mm_cmpge_ps(a, b)
+#define VF4_CMPLT(a, b) _mm_cmplt_ps(a, b)
+#define VF4_CMPNEQ(a, b) _mm_cmpneq_ps(a, b)
+#define VF4_TOINT(a) _mm_cvttps_epi32(a)
+#define VF4_ASINT(a) _mm_castps_si128(a)
+
+#define VI4_SET(i) _mm_set1_epi32(i)
+#define VI4_STORE(p, v) _mm_storeu_si128((__m128i *)(p), v)
+#define VI4_ADD(a, b) _mm_add_epi32(a, b)
+#define VI4_SUB(a, b) _mm_sub_epi32(a, b)
+#define VI4_AND(a, b) _mm_and_si128(a, b)
+#define VI4_OR(a, b) _mm_or_si128(a, b)
+#define VI4_ANDNOT(a, b) _mm_andnot_si128(a, b) /* ~a & b */
+#define VI4_SHL(a, n) _mm_slli_epi32(a, n)
+#define VI4_CMPEQ(a, b) _mm_cmpeq_epi32(a, b)
+#define VI4_TOFLOAT(a) _mm_cvtepi32_ps(a)
+#define VI4_ASFLOAT(a) _mm_castsi128_ps(a)
+
+/*
+ * Loads four vec3_t and transposes them, so x holds
+ * the four x components and so on.
+ */
+static void
+VF4_Load3(const float *p, vf4_t *x, vf4_t *y, vf4_t *z)
+{
+	vf4_t a, b, c, t0, t1;
+
+	a = _mm_loadu_ps(p);     /* x0 y0 z0 x1 */
+	b = _mm_loadu_ps(p + 4); /* y1 z1 x2 y2 */
+	c = _mm_loadu_ps(p + 8); /* z2 x3 y3 z3 */
+
+	t0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+	*x = _mm_shuffle_ps(a, t0, _MM_SHUFFLE(2, 0, 3, 0));
+
+	t0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+	t1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+	*y = _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+
+	t0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+	t1 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+	*z = _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+static void
+VF4_Store3(float *p, vf4_t x, vf4_t y, vf4_t z)
+{
+	vf4_t t0, t1;
+
+	t0 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+	t1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+	_mm_storeu_ps(p, _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)));
+
+	t0 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+	t1 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+	_mm_storeu_ps(p + 4, _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)));
+
+	t0 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+	t1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+	_mm_storeu_ps(p + 8, _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+#elif defined(USE_NEON)
+
+typedef float32x4_t vf4_t;
+typedef int32x4_t vi4_t;
+
+#define F2U(a) vreinterpretq_u32_f32(a)
+#define U2F(a) vreinterpretq_f32_u32(a)
+
+#define VF4_LOAD(p) vld1q_f32(p)
+#define VF4_STORE(p, v) vst1q_f32(p, v)
+#define VF4_SET(f) vdupq_n_f32(f)
+#define VF4_ADD(a, b) vaddq_f32(a, b)
+#define VF4_SUB(a, b) vsubq_f32(a, b)
+#define VF4_MUL(a, b) vmulq_f32(a, b)
+#define VF4_DIV(a, b) vdivq_f32(a, b)
+#define VF4_SQRT(a) vsqrtq_f32(a)
+#define VF4_XOR(a, b) U2F(veorq_u32(F2U(a), F2U(b)))
+#define VF4_AND(a, b) U2F(vandq_u32(F2U(a), F2U(b)))
+#define VF4_ANDNOT(a, b) U2F(vbicq_u32(F2U(b), F2U(a))) /* ~a & b */
+#define VF4_SELECT(m, a, b) vbslq_f32(F2U(m), a, b)
+#define VF4_CMPGE(a, b) U2F(vcgeq_f32(a, b))
+#define VF4_CMPLT(a, b) U2F(vcltq_f32(a, b))
+#define VF4_CMPNEQ(a, b) U2F(vmvnq_u32(vceqq_f32(a, b)))
+#define VF4_TOINT(a) vcvtq_s32_f32(a)
+#define VF4_ASINT(a) vreinterpretq_s32_f32(a)
+
+#define VI4_SET(i) vdupq_n_s32(i)
+#define VI4_STORE(p, v) vst1q_s32(p, v)
+#define VI4_ADD(a, b) vaddq_s32(a, b)
+#define VI4_SUB(a, b) vsubq_s32(a, b)
+#define VI4_AND(a, b) vandq_s32(a, b)
+#define VI4_OR(a, b) vorrq_s32(a, b)
+#define VI4_ANDNOT(a, b) vbicq_s32(b, a) /* ~a & b */
+#define VI4_SHL(a, n) vshlq_n_s32(a, n)
+#define VI4_CMPEQ(a, b) vreinterpretq_s32_u32(vceqq_s32(a, b))
+#define VI4_TOFLOAT(a) vcvtq_f32_s32(a)
+#define VI4_ASFLOAT(a) vreinterpretq_f32_s32(a)
+
+static void
+VF4_Load3(const float *p, vf4_t *x, vf4_t *y, vf4_t *z)
+{
+	float32x4x3_t v;
+
+	v = vld3q_f32(p);
+	*x = v.val[0];
+	*y = v.val[1];
+	*z = v.val[2];
+}
+
+static void
+VF4_Store3(float *p, vf4_t x, vf4_t y, vf4_t z)
+{
+	float32x4x3_t v;
+
+	v.val[0] = x;
+	v.val[1] = y;
+	v.val[2] = z;
+	vst3q_f32(p, v);
+}
+
+#endif
+
+#if defined(USE_SSE2) || defined(USE_NEON)
+#define USE_SIMD
+
+/*
+ * Sine and cosine of four angles in radians, the
+ * Cephes single precision polynomials. The error
+ * is below 2e-7 for angles up to a few thousand.
+ */
+static void
+VF4_SinCos(vf4_t x, vf4_t *s, vf4_t *c)
+{
+	vf4_t signsin, signcos, y, z, ys, yc, polymask;
+	vi4_t j, jc;
+
+	/* work on |x|, the sign is put back at the end */
+	signsin = VF4_AND(x, VI4_ASFLOAT(VI4_SET((int)0x80000000)));
+	x = VF4_ANDNOT(VI4_ASFLOAT(VI4_SET((int)0x80000000)), x);
+
+	/* octant, rounded up to an even one */
+	j = VF4_TOINT(VF4_MUL(x, VF4_SET(1.27323954473516f))); /* 4 / pi */
+	j = VI4_AND(VI4_ADD(j, VI4_SET(1)), VI4_SET(~1));
+	y = VI4_TOFLOAT(j);
+
+	signsin = VF4_XOR(signsin, VI4_ASFLOAT(VI4_SHL(VI4_AND(j, VI4_SET(4)), 29)));
+	jc = VI4_SUB(j, VI4_SET(2));
+	signcos = VI4_ASFLOAT(VI4_SHL(VI4_ANDNOT(jc, VI4_SET(4)), 29));
+	polymask = VI4_ASFLOAT(VI4_CMPEQ(VI4_AND(j, VI4_SET(2)), VI4_SET(0)));
+
+	/* extended precision modular arithmetic */
+	x = VF4_SUB(x, VF4_MUL(y, VF4_SET(0.78515625f)));
+	x = VF4_SUB(x, VF4_MUL(y, VF4_SET(2.4187564849853515625e-4f)));
+	x = VF4_SUB(x, VF4_MUL(y, VF4_SET(3.77489497744594108e-8f)));
+
+	z = VF4_MUL(x, x);
+
+	yc = VF4_MUL(VF4_SET(2.443315711809948e-5f), z);
+	yc = VF4_MUL(VF4_ADD(yc, VF4_SET(-1.388731625493765e-3f)), z);
+	yc = VF4_MUL(VF4_ADD(yc, VF4_SET(4.166664568298827e-2f)), z);
+	yc = VF4_MUL(yc, z);
+	yc = VF4_SUB(yc, VF4_MUL(z, VF4_SET(0.5f)));
+	yc = VF4_ADD(yc, VF4_SET(1.0f));
+
+	ys = VF4_MUL(VF4_SET(-1.9515295891e-4f), z);
+	ys = VF4_MUL(VF4_ADD(ys, VF4_SET(8.3321608736e-3f)), z);
+	ys = VF4_MUL(VF4_ADD(ys, VF4_SET(-1.6666654611e-1f)), z);
+	ys = VF4_ADD(VF4_MUL(ys, x), x);
+
+	*s = VF4_XOR(VF4_SELECT(polymask, ys, yc), signsin);
+	*c = VF4_XOR(VF4_SELECT(polymask, yc, ys), signcos);
+}
+
+#endif
+
+/* ============================================================================ */
+
+const char *
+VectorArrayImpl(void)
+{
+#if defined(USE_SSE2)
+	return "SSE2";
+#elif defined(USE_NEON)
+	return "NEON";
+#else
+	return "scalar";
+#endif
+}
+
+/*
+ * out[i] = a[i] + scale * b[i]
+ */
+void
+VectorMAArray(const vec3_t *a, float scale, const vec3_t *b, vec3_t *out,
+		int count)
+{
+	int i;
+
+#ifdef USE_SIMD
+	const float *pa, *pb;
+	float *po;
+	vf4_t s;
+	int n;
+
+	/* the components don't interact, treat them as a flat array */
+	pa = a[0];
+	pb = b[0];
+	po = out[0];
+	n = count * 3;
+	s = VF4_SET(scale);
+
+	for (i = 0; i + 4 <= n; i += 4)
+	{
+		VF4_STORE(po + i,
+				VF4_ADD(VF4_LOAD(pa + i), VF4_MUL(s, VF4_LOAD(pb + i))));
+	}
+
+	for ( ; i < n; i++)
+	{
+		po[i] = pa[i] + scale * pb[i];
+	}
+#else
+	for (i = 0; i < count; i++)
+	{
+		VectorMA(a[i], scale, b[i], out[i]);
+	}
+#endif
+}
+
+void
+DotProductArray(const vec3_t *a, const vec3_t *b, vec_t *out, int count)
+{
+	int i = 0;
+
+#ifdef USE_SIMD
+	vf4_t ax, ay, az, bx, by, bz;
+
+	for ( ; i + 4 <= count; i += 4)
+	{
+		VF4_Load3(a[i], &ax, &ay, &az);
+		VF4_Load3(b[i], &bx, &by, &bz);
+
+		VF4_STORE(out + i, VF4_ADD(VF4_ADD(VF4_MUL(ax, bx),
+						VF4_MUL(ay, by)), VF4_MUL(az, bz)));
+	}
+#endif
+
+	for ( ; i < count; i++)
+	{
+		out[i] = DotProduct(a[i], b[i]);
+	}
+}
+
+/*
+ * Normalizes count vectors in place, their lengths
+ * are stored in lengths unless that's NULL.
+ */
+void
+VectorNormalizeArray(vec3_t *v, vec_t *lengths, int count)
+{
+	int i = 0;
+	vec_t length;
+
+#ifdef USE_SIMD
+	vf4_t x, y, z, len, ilen, zero, one;
+
+	zero = VF4_SET(0);
+	one = VF4_SET(1);
+
+	for ( ; i + 4 <= count; i += 4)
+	{
+		VF4_Load3(v[i], &x, &y, &z);
+
+		len = VF4_SQRT(VF4_ADD(VF4_ADD(VF4_MUL(x, x), VF4_MUL(y, y)),
+					VF4_MUL(z, z)));
+
+		/* zero length vectors are left alone */
+		ilen = VF4_SELECT(VF4_CMPNEQ(len, zero), VF4_DIV(one, len), one);
+
+		VF4_Store3(v[i], VF4_MUL(x, ilen), VF4_MUL(y, ilen),
+				VF4_MUL(z, ilen));
+
+		if (lengths)
+		{
+			VF4_STORE(lengths + i, len);
+		}
+	}
+#endif
+
+	for ( ; i < count; i++)
+	{
+		length = VectorNormalize(v[i]);
+
+		if (lengths)
+		{
+			lengths[i] = length;
+		}
+	}
+}
+
+/*
+ * Like AngleVectors() for count angles. Any of
+ * forward, right and up may be NULL.
+ */
+void
+AngleVectorsArray(const vec3_t *angles, vec3_t *forward, vec3_t *right,
+		vec3_t *up, int count)
+{
+	int i = 0;
+
+#ifdef USE_SIMD
+	vf4_t p, y, r, sp, cp, sy, cy, sr, cr, torad, srsp, crsp;
+
+	torad = VF4_SET((float)(M_PI * 2 / 360));
+
+	for ( ; i + 4 <= count; i += 4)
+	{
+		VF4_Load3(angles[i], &p, &y, &r);
+
+		VF4_SinCos(VF4_MUL(p, torad), &sp, &cp);
+		VF4_SinCos(VF4_MUL(y, torad), &sy, &cy);
+		VF4_SinCos(VF4_MUL(r, torad), &sr, &cr);
+
+		if (forward)
+		{
+			VF4_Store3(forward[i], VF4_MUL(cp, cy), VF4_MUL(cp, sy),
+					VF4_SUB(VF4_SET(0), sp));
+		}
+
+		if (right)
+		{
+			srsp = VF4_MUL(sr, sp);
+
+			VF4_Store3(right[i],
+					VF4_ADD(VF4_MUL(VF4_SUB(VF4_SET(0), srsp), cy),
+						VF4_MUL(cr, sy)),
+					VF4_SUB(VF4_MUL(VF4_SUB(VF4_SET(0), srsp), sy),
+						VF4_MUL(cr, cy)),
+					VF4_MUL(VF4_SUB(VF4_SET(0), sr), cp));
+		}
+
+		if (up)
+		{
+			crsp = VF4_MUL(cr, sp);
+
+			VF4_Store3(up[i],
+					VF4_ADD(VF4_MUL(crsp, cy), VF4_MUL(sr, sy)),
+					VF4_SUB(VF4_MUL(crsp, sy), VF4_MUL(sr, cy)),
+					VF4_MUL(cr, cp));
+		}
+	}
+#endif
+
+	for ( ; i < count; i++)
+	{
+		AngleVectors(angles[i], forward ? forward[i] : NULL,
+				right ? right[i] : NULL, up ? up[i] : NULL);
+	}
+}
+
+/*
+ * Like RotatePointAroundVector() for count points,
+ * all around the same axis by the same angle.
+ */
+void
+RotatePointsAroundVector(vec3_t *dst, const vec3_t dir, const vec3_t *points,
+		int count, float degrees)
+{
+	static const vec3_t axis[3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+	vec3_t col[3];
+	int i;
+
+	/* rotating the unit vectors gives the
+	   columns of the rotation matrix */
+	for (i = 0; i < 3; i++)
+	{
+		RotatePointAroundVector(col[i], dir, axis[i], degrees);
+	}
+
+	i = 0;
+
+#ifdef USE_SIMD
+	{
+		vf4_t m[3][3], x, y, z;
+		int j, k;
+
+		for (j = 0; j < 3; j++)
+		{
+			for (k = 0; k < 3; k++)
+			{
+				m[j][k] = VF4_SET(col[k][j]);
+			}
+		}
+
+		for ( ; i + 4 <= count; i += 4)
+		{
+			VF4_Load3(points[i], &x, &y, &z);
+
+			VF4_Store3(dst[i],
+					VF4_ADD(VF4_ADD(VF4_MUL(m[0][0], x), VF4_MUL(m[0][1], y)),
+						VF4_MUL(m[0][2], z)),
+					VF4_ADD(VF4_ADD(VF4_MUL(m[1][0], x), VF4_MUL(m[1][1], y)),
+						VF4_MUL(m[1][2], z)),
+					VF4_ADD(VF4_ADD(VF4_MUL(m[2][0], x), VF4_MUL(m[2][1], y)),
+						VF4_MUL(m[2][2], z)));
+		}
+	}
+#endif
+
+	for ( ; i < count; i++)
+	{
+		vec3_t p;
+
+		VectorCopy(points[i], p);
+
+		dst[i][0] = col[0][0] * p[0] + col[1][0] * p[1] + col[2][0] * p[2];
+		dst[i][1] = col[0][1] * p[0] + col[1][1] * p[1] + col[2][1] * p[2];
+		dst[i][2] = col[0][2] * p[0] + col[1][2] * p[1] + col[2][2] * p[2];
+	}
+}
+
+/*
+ * out[i] = in1 * in2[i], e.g. a parent transform
+ * applied to many children. A row of a 3x4 matrix
+ * fits exactly into one SIMD register.
+ */
+void
+R_ConcatTransformsArray(const float in1[3][4], const float (*in2)[3][4],
+		float (*out)[3][4], int count)
+{
+	int i;
+
+#ifdef USE_SIMD
+	vf4_t m[3][4], r0, r1, r2;
+	float t[4];
+	int j;
+
+	for (j = 0; j < 3; j++)
+	{
+		m[j][0] = VF4_SET(in1[j][0]);
+		m[j][1] = VF4_SET(in1[j][1]);
+		m[j][2] = VF4_SET(in1[j][2]);
+
+		/* the translation only goes into the last column */
+		t[0] = t[1] = t[2] = 0;
+		t[3] = in1[j][3];
+		m[j][3] = VF4_LOAD(t);
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		r0 = VF4_LOAD(in2[i][0]);
+		r1 = VF4_LOAD(in2[i][1]);
+		r2 = VF4_LOAD(in2[i][2]);
+
+		for (j = 0; j < 3; j++)
+		{
+			VF4_STORE(out[i][j], VF4_ADD(VF4_ADD(VF4_ADD(
+									VF4_MUL(m[j][0], r0),
+									VF4_MUL(m[j][1], r1)),
+								VF4_MUL(m[j][2], r2)), m[j][3]));
+		}
+	}
+#else
+	for (i = 0; i < count; i++)
+	{
+		R_ConcatTransforms(in1, in2[i], out[i]);
+	}
+#endif
+}
+
+/*
+ * Like BoxOnPlaneSide2() for count boxes
+ * against one plane. Returns 1, 2, or 1 + 2
+ * in sides.
+ */
+void
+BoxOnPlaneSideArray(const vec3_t *mins, const vec3_t *maxs,
+		const struct cplane_s *p, int *sides, int count)
+{
+	int i = 0;
+
+#ifdef USE_SIMD
+	vf4_t minx, miny, minz, maxx, maxy, maxz;
+	vf4_t nx, ny, nz, dist, d1, d2;
+	vi4_t s;
+
+	nx = VF4_SET(p->normal[0]);
+	ny = VF4_SET(p->normal[1]);
+	nz = VF4_SET(p->normal[2]);
+	dist = VF4_SET(p->dist);
+
+	for ( ; i + 4 <= count; i += 4)
+	{
+		VF4_Load3(mins[i], &minx, &miny, &minz);
+		VF4_Load3(maxs[i], &maxx, &maxy, &maxz);
+
+		/* the nearest and farthest corner are
+		   the same for all boxes */
+		d1 = VF4_ADD(VF4_ADD(
+					VF4_MUL(nx, (p->normal[0] < 0) ? minx : maxx),
+					VF4_MUL(ny, (p->normal[1] < 0) ? miny : maxy)),
+				VF4_MUL(nz, (p->normal[2] < 0) ? minz : maxz));
+		d2 = VF4_ADD(VF4_ADD(
+					VF4_MUL(nx, (p->normal[0] < 0) ? maxx : minx),
+					VF4_MUL(ny, (p->normal[1] < 0) ? maxy : miny)),
+				VF4_MUL(nz, (p->normal[2] < 0) ? maxz : minz));
+
+		s = VI4_OR(VI4_AND(VF4_ASINT(VF4_CMPGE(VF4_SUB(d1, dist), VF4_SET(0))),
+					VI4_SET(1)),
+				VI4_AND(VF4_ASINT(VF4_CMPLT(VF4_SUB(d2, dist), VF4_SET(0))),
+					VI4_SET(2)));
+
+		VI4_STORE(sides + i, s);
+	}
+#endif
+
+	for ( ; i < count; i++)
+	{
+		sides[i] = BoxOnPlaneSide2(mins[i], maxs[i], p);
+	}
+}
@@ -0,0 +1,29 @@
+/*
+ * =======================================================================
+ *
+ * Batched vector math, see vector.c. Only
+ * used by vecbench, not by the game.
+ *
+ * =======================================================================
+ */
+
+#ifndef XATRIX_BENCH_VECTOR_H
+#define XATRIX_BENCH_VECTOR_H
+
+#include "../header/shared.h"
+
+const char *VectorArrayImpl(void);
+void VectorMAArray(const vec3_t *a, float scale, const vec3_t *b, vec3_t *out,
+		int count);
+void DotProductArray(const vec3_t *a, const vec3_t *b, vec_t *out, int count);
+void VectorNormalizeArray(vec3_t *v, vec_t *lengths, int count);
+void AngleVectorsArray(const vec3_t *angles, vec3_t *forward, vec3_t *right,
+		vec3_t *up, int count);
+void RotatePointsAroundVector(vec3_t *dst, const vec3_t dir,
+		const vec3_t *points, int count, float degrees);
+void R_ConcatTransformsArray(const float in1[3][4], const float (*in2)[3][4],
+		float (*out)[3][4], int count);
+void BoxOnPlaneSideArray(const vec3_t *mins, const vec3_t *maxs,
+		const struct cplane_s *p, int *sides, int count);
+
+#endif /* XATRIX_BENCH_VECTOR_H */
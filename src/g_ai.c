@@ -101,7 +101,7 @@ ai_stand(edict_t *self, float dist)
 		M_walkmove(self, self->s.angles[YAW], dist);
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
 		if (self->enemy)
 		{
@@ -109,10 +109,10 @@ ai_stand(edict_t *self, float dist)
 			self->ideal_yaw = vectoyaw(v);
 
 			if ((self->s.angles[YAW] != self->ideal_yaw) &&
-				self->monsterinfo.aiflags & AI_TEMP_STAND_GROUND)
+				G_MonsterInfo(self)->aiflags & AI_TEMP_STAND_GROUND)
 			{
-				self->monsterinfo.aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
-				self->monsterinfo.run(self);
+				G_EnsureMonsterInfo(self)->aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+				G_MonsterInfo(self)->run(self);
 			}
 
 			M_ChangeYaw(self);
@@ -131,23 +131,23 @@ ai_stand(edict_t *self, float dist)
 		return;
 	}
 
-	if (level.time > self->monsterinfo.pausetime)
+	if (level.time > G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.walk(self);
+		G_MonsterInfo(self)->walk(self);
 		return;
 	}
 
-	if (!(self->spawnflags & 1) && (self->monsterinfo.idle) &&
-		(level.time > self->monsterinfo.idle_time))
+	if (!(self->spawnflags & 1) && (G_MonsterInfo(self)->idle) &&
+		(level.time > G_MonsterInfo(self)->idle_time))
 	{
-		if (self->monsterinfo.idle_time)
+		if (G_MonsterInfo(self)->idle_time)
 		{
-			self->monsterinfo.idle(self);
-			self->monsterinfo.idle_time = level.time + 15 + random() * 15;
+			G_MonsterInfo(self)->idle(self);
+			G_EnsureMonsterInfo(self)->idle_time = level.time + 15 + G_Random(RAND_AI) * 15;
 		}
 		else
 		{
-			self->monsterinfo.idle_time = level.time + random() * 15;
+			G_EnsureMonsterInfo(self)->idle_time = level.time + G_Random(RAND_AI) * 15;
 		}
 	}
 }
@@ -171,16 +171,16 @@ ai_walk(edict_t *self, float dist)
 		return;
 	}
 
-	if ((self->monsterinfo.search) && (level.time > self->monsterinfo.idle_time))
+	if ((G_MonsterInfo(self)->search) && (level.time > G_MonsterInfo(self)->idle_time))
 	{
-		if (self->monsterinfo.idle_time)
+		if (G_MonsterInfo(self)->idle_time)
 		{
-			self->monsterinfo.search(self);
-			self->monsterinfo.idle_time = level.time + 15 + random() * 15;
+			G_MonsterInfo(self)->search(self);
+			G_EnsureMonsterInfo(self)->idle_time = level.time + 15 + G_Random(RAND_AI) * 15;
 		}
 		else
 		{
-			self->monsterinfo.idle_time = level.time + random() * 15;
+			G_EnsureMonsterInfo(self)->idle_time = level.time + G_Random(RAND_AI) * 15;
 		}
 	}
 }
@@ -324,7 +324,7 @@ visible(const edict_t *self, const edict_t *other)
 	spot1[2] += self->viewheight;
 	VectorCopy(other->s.origin, spot2);
 	spot2[2] += other->viewheight;
-	trace = gi.trace(spot1, vec3_origin, vec3_origin, spot2, self, MASK_OPAQUE);
+	trace = G_Trace(spot1, vec3_origin, vec3_origin, spot2, self, MASK_OPAQUE);
 
 	if (trace.fraction == 1.0)
 	{
@@ -377,13 +377,13 @@ HuntTarget(edict_t *self)
 
 	self->goalentity = self->enemy;
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.stand(self);
+		G_MonsterInfo(self)->stand(self);
 	}
 	else
 	{
-		self->monsterinfo.run(self);
+		G_MonsterInfo(self)->run(self);
 	}
 
 	if(visible(self, self->enemy))
@@ -398,7 +398,7 @@ HuntTarget(edict_t *self)
 	self->ideal_yaw = vectoyaw(vec);
 
 	/* wait a while before first attack */
-	if (!(self->monsterinfo.aiflags & AI_STAND_GROUND))
+	if (!(G_MonsterInfo(self)->aiflags & AI_STAND_GROUND))
 	{
 		AttackFinished(self, 1);
 	}
@@ -425,8 +425,8 @@ FoundTarget(edict_t *self)
 
 	self->show_hostile = level.time + 1; /* wake up other monsters */
 
-	VectorCopy(self->enemy->s.origin, self->monsterinfo.last_sighting);
-	self->monsterinfo.trail_time = level.time;
+	VectorCopy(self->enemy->s.origin, G_EnsureMonsterInfo(self)->last_sighting);
+	G_EnsureMonsterInfo(self)->trail_time = level.time;
 
 	if (!self->combattarget)
 	{
@@ -451,15 +451,15 @@ FoundTarget(edict_t *self)
 
 	/* clear out our combattarget, these are a one shot deal */
 	self->combattarget = NULL;
-	self->monsterinfo.aiflags |= AI_COMBAT_POINT;
-	self->monsterinfo.pausetime = 0;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_COMBAT_POINT;
+	G_EnsureMonsterInfo(self)->pausetime = 0;
 
 	/* clear the targetname, that point is ours! */
 	combatpoint->targetname = NULL;
 	self->goalentity = self->movetarget = combatpoint;
 
 	/* run for it */
-	self->monsterinfo.run(self);
+	G_MonsterInfo(self)->run(self);
 }
 
 /*
@@ -485,13 +485,13 @@ FindTarget(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_GOOD_GUY)
+	if (G_MonsterInfo(self)->aiflags & AI_GOOD_GUY)
 	{
 		return false;
 	}
 
 	/* if we're going to a combat point, just proceed */
-	if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+	if (G_MonsterInfo(self)->aiflags & AI_COMBAT_POINT)
 	{
 		return false;
 	}
@@ -611,7 +611,7 @@ FindTarget(edict_t *self)
 
 		if (strcmp(self->enemy->classname, "player_noise") != 0)
 		{
-			self->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_SOUND_TARGET;
 
 			if (!self->enemy->client)
 			{
@@ -638,7 +638,7 @@ FindTarget(edict_t *self)
 		}
 		else
 		{
-			if (!gi.inPHS(self->s.origin, client->s.origin))
+			if (!G_InPHS(self->s.origin, client->s.origin))
 			{
 				return false;
 			}
@@ -665,17 +665,17 @@ FindTarget(edict_t *self)
 		M_ChangeYaw(self);
 
 		/* hunt the sound for a bit; hopefully find the real player */
-		self->monsterinfo.aiflags |= AI_SOUND_TARGET;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_SOUND_TARGET;
 		self->enemy = client;
 	}
 
 	/* got one */
 	FoundTarget(self);
 
-	if (!(self->monsterinfo.aiflags & AI_SOUND_TARGET) &&
-		(self->monsterinfo.sight))
+	if (!(G_MonsterInfo(self)->aiflags & AI_SOUND_TARGET) &&
+		(G_MonsterInfo(self)->sight))
 	{
-		self->monsterinfo.sight(self, self->enemy);
+		G_MonsterInfo(self)->sight(self, self->enemy);
 	}
 
 	return true;
@@ -725,7 +725,7 @@ M_CheckAttack(edict_t *self)
 		VectorCopy(self->enemy->s.origin, spot2);
 		spot2[2] += self->enemy->viewheight;
 
-		tr = gi.trace(spot1, NULL, NULL, spot2, self,
+		tr = G_Trace(spot1, NULL, NULL, spot2, self,
 				CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_SLIME |
 				CONTENTS_LAVA | CONTENTS_WINDOW);
 
@@ -740,30 +740,30 @@ M_CheckAttack(edict_t *self)
 	if (enemy_range == RANGE_MELEE)
 	{
 		/* don't always melee in easy mode */
-		if ((skill->value == SKILL_EASY) && (randk() & 3))
+		if ((skill->value == SKILL_EASY) && (G_RandInt(RAND_AI) & 3))
 		{
 			return false;
 		}
 
-		if (self->monsterinfo.melee)
+		if (G_MonsterInfo(self)->melee)
 		{
-			self->monsterinfo.attack_state = AS_MELEE;
+			G_EnsureMonsterInfo(self)->attack_state = AS_MELEE;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_MISSILE;
+			G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
 		}
 
 		return true;
 	}
 
 	/* missile attack */
-	if (!self->monsterinfo.attack)
+	if (!G_MonsterInfo(self)->attack)
 	{
 		return false;
 	}
 
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < G_MonsterInfo(self)->attack_finished)
 	{
 		return false;
 	}
@@ -773,7 +773,7 @@ M_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -799,22 +799,22 @@ M_CheckAttack(edict_t *self)
 		chance *= 2;
 	}
 
-	if (random() < chance)
+	if (G_Random(RAND_AI) < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2 * random();
+		G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
+		G_EnsureMonsterInfo(self)->attack_finished = level.time + 2 * G_Random(RAND_AI);
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
-		if (random() < 0.3)
+		if (G_Random(RAND_AI) < 0.3)
 		{
-			self->monsterinfo.attack_state = AS_SLIDING;
+			G_EnsureMonsterInfo(self)->attack_state = AS_SLIDING;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			G_EnsureMonsterInfo(self)->attack_state = AS_STRAIGHT;
 		}
 	}
 
@@ -838,10 +838,10 @@ ai_run_melee(edict_t *self)
 
 	if (FacingIdeal(self))
 	{
-		if (self->monsterinfo.melee)
+		if (G_MonsterInfo(self)->melee)
 		{
-			self->monsterinfo.melee(self);
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			G_MonsterInfo(self)->melee(self);
+			G_EnsureMonsterInfo(self)->attack_state = AS_STRAIGHT;
 		}
 	}
 }
@@ -863,9 +863,9 @@ ai_run_missile(edict_t *self)
 
 	if (FacingIdeal(self))
 	{
-		if (self->monsterinfo.attack) {
-			self->monsterinfo.attack(self);
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+		if (G_MonsterInfo(self)->attack) {
+			G_MonsterInfo(self)->attack(self);
+			G_EnsureMonsterInfo(self)->attack_state = AS_STRAIGHT;
 		}
 	}
 }
@@ -887,7 +887,7 @@ ai_run_slide(edict_t *self, float distance)
 	self->ideal_yaw = enemy_yaw;
 	M_ChangeYaw(self);
 
-	if (self->monsterinfo.lefty)
+	if (G_MonsterInfo(self)->lefty)
 	{
 		ofs = 90;
 	}
@@ -901,7 +901,7 @@ ai_run_slide(edict_t *self, float distance)
 		return;
 	}
 
-	self->monsterinfo.lefty = 1 - self->monsterinfo.lefty;
+	G_EnsureMonsterInfo(self)->lefty = 1 - G_MonsterInfo(self)->lefty;
 	M_walkmove(self, self->ideal_yaw - ofs, distance);
 }
 
@@ -910,7 +910,7 @@ ai_run_slide(edict_t *self, float distance)
  * attack or do something else
  */
 static qboolean
-hesDeadJim(const edict_t *self)
+hesDeadJim(edict_t *self)
 {
 	const edict_t *enemy = self->enemy;
 
@@ -919,7 +919,7 @@ hesDeadJim(const edict_t *self)
 		return true;
 	}
 
-	if (self->monsterinfo.aiflags & AI_MEDIC)
+	if (G_MonsterInfo(self)->aiflags & AI_MEDIC)
 	{
 		return (enemy->health > 0);
 	}
@@ -929,7 +929,7 @@ hesDeadJim(const edict_t *self)
 		return true;
 	}
 
-	if (self->monsterinfo.aiflags & AI_BRUTAL)
+	if (G_MonsterInfo(self)->aiflags & AI_BRUTAL)
 	{
 		return (enemy->health <= -80);
 	}
@@ -953,12 +953,12 @@ ai_checkattack(edict_t *self, float dist)
 	   to the combat point w/o firing */
 	if (self->goalentity)
 	{
-		if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+		if (G_MonsterInfo(self)->aiflags & AI_COMBAT_POINT)
 		{
 			return false;
 		}
 
-		if ((self->monsterinfo.aiflags & AI_SOUND_TARGET) && !visible(self, self->goalentity))
+		if ((G_MonsterInfo(self)->aiflags & AI_SOUND_TARGET) && !visible(self, self->goalentity))
 		{
 			if ((level.time - self->enemy->last_sound_time) > 5.0)
 			{
@@ -974,11 +974,11 @@ ai_checkattack(edict_t *self, float dist)
 					}
 				}
 
-				self->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+				G_EnsureMonsterInfo(self)->aiflags &= ~AI_SOUND_TARGET;
 
-				if (self->monsterinfo.aiflags & AI_TEMP_STAND_GROUND)
+				if (G_MonsterInfo(self)->aiflags & AI_TEMP_STAND_GROUND)
 				{
-					self->monsterinfo.aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+					G_EnsureMonsterInfo(self)->aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
 				}
 			}
 			else
@@ -995,7 +995,7 @@ ai_checkattack(edict_t *self, float dist)
 	if (hesDeadJim(self))
 	{
 		self->enemy = NULL;
-		self->monsterinfo.aiflags &= ~AI_MEDIC;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_MEDIC;
 
 		if (self->oldenemy && (self->oldenemy->health > 0))
 		{
@@ -1008,7 +1008,7 @@ ai_checkattack(edict_t *self, float dist)
 			if (self->movetarget)
 			{
 				self->goalentity = self->movetarget;
-				self->monsterinfo.walk(self);
+				G_MonsterInfo(self)->walk(self);
 			}
 			else
 			{
@@ -1016,8 +1016,8 @@ ai_checkattack(edict_t *self, float dist)
 				   will just revert to walking with no target and
 				   the monsters will wonder around aimlessly trying
 				   to hunt the world entity */
-				self->monsterinfo.pausetime = level.time + 100000000;
-				self->monsterinfo.stand(self);
+				G_EnsureMonsterInfo(self)->pausetime = level.time + 100000000;
+				G_MonsterInfo(self)->stand(self);
 			}
 
 			return true;
@@ -1031,11 +1031,11 @@ ai_checkattack(edict_t *self, float dist)
 
 	if (enemy_vis)
 	{
-		self->monsterinfo.search_time = level.time + 5;
-		VectorCopy(self->enemy->s.origin, self->monsterinfo.last_sighting);
+		G_EnsureMonsterInfo(self)->search_time = level.time + 5;
+		VectorCopy(self->enemy->s.origin, G_EnsureMonsterInfo(self)->last_sighting);
 	}
 
-	if (coop && coop->value && (self->monsterinfo.search_time < level.time))
+	if (coop && coop->value && (G_MonsterInfo(self)->search_time < level.time))
 	{
 		if (FindTarget(self))
 		{
@@ -1051,13 +1051,13 @@ ai_checkattack(edict_t *self, float dist)
 		enemy_yaw = vectoyaw(temp);
 	}
 
-	if (self->monsterinfo.attack_state == AS_MISSILE)
+	if (G_MonsterInfo(self)->attack_state == AS_MISSILE)
 	{
 		ai_run_missile(self);
 		return true;
 	}
 
-	if (self->monsterinfo.attack_state == AS_MELEE)
+	if (G_MonsterInfo(self)->attack_state == AS_MELEE)
 	{
 		ai_run_melee(self);
 		return true;
@@ -1070,7 +1070,7 @@ ai_checkattack(edict_t *self, float dist)
 		return false;
 	}
 
-	return self->monsterinfo.checkattack(self);
+	return G_MonsterInfo(self)->checkattack(self);
 }
 
 /*
@@ -1096,13 +1096,13 @@ ai_run(edict_t *self, float dist)
 	}
 
 	/* if we're going to a combat point, just proceed */
-	if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+	if (G_MonsterInfo(self)->aiflags & AI_COMBAT_POINT)
 	{
 		M_MoveToGoal(self, dist);
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_SOUND_TARGET)
+	if (G_MonsterInfo(self)->aiflags & AI_SOUND_TARGET)
 	{
 		/* Special case: Some projectiles like grenades or rockets are
 		   classified as an enemy. When they explode they generate a
@@ -1117,8 +1117,8 @@ ai_run(edict_t *self, float dist)
 
 			if (VectorLength(v) < 64)
 			{
-				self->monsterinfo.aiflags |= (AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
-				self->monsterinfo.stand(self);
+				G_EnsureMonsterInfo(self)->aiflags |= (AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+				G_MonsterInfo(self)->stand(self);
 				return;
 			}
 		}
@@ -1136,7 +1136,7 @@ ai_run(edict_t *self, float dist)
 		return;
 	}
 
-	if (self->monsterinfo.attack_state == AS_SLIDING)
+	if (G_MonsterInfo(self)->attack_state == AS_SLIDING)
 	{
 		ai_run_slide(self, dist);
 		return;
@@ -1145,17 +1145,17 @@ ai_run(edict_t *self, float dist)
 	if (enemy_vis)
 	{
 		M_MoveToGoal(self, dist);
-		self->monsterinfo.aiflags &= ~AI_LOST_SIGHT;
-		VectorCopy(self->enemy->s.origin, self->monsterinfo.last_sighting);
-		self->monsterinfo.trail_time = level.time;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_LOST_SIGHT;
+		VectorCopy(self->enemy->s.origin, G_EnsureMonsterInfo(self)->last_sighting);
+		G_EnsureMonsterInfo(self)->trail_time = level.time;
 		return;
 	}
 
-	if ((self->monsterinfo.search_time) &&
-		(level.time > (self->monsterinfo.search_time + 20)))
+	if ((G_MonsterInfo(self)->search_time) &&
+		(level.time > (G_MonsterInfo(self)->search_time + 20)))
 	{
 		M_MoveToGoal(self, dist);
-		self->monsterinfo.search_time = 0;
+		G_EnsureMonsterInfo(self)->search_time = 0;
 		return;
 	}
 
@@ -1172,32 +1172,32 @@ ai_run(edict_t *self, float dist)
 
 	new = false;
 
-	if (!(self->monsterinfo.aiflags & AI_LOST_SIGHT))
+	if (!(G_MonsterInfo(self)->aiflags & AI_LOST_SIGHT))
 	{
 		/* just lost sight of the player, decide where to go first */
-		self->monsterinfo.aiflags |= (AI_LOST_SIGHT | AI_PURSUIT_LAST_SEEN);
-		self->monsterinfo.aiflags &= ~(AI_PURSUE_NEXT | AI_PURSUE_TEMP);
+		G_EnsureMonsterInfo(self)->aiflags |= (AI_LOST_SIGHT | AI_PURSUIT_LAST_SEEN);
+		G_EnsureMonsterInfo(self)->aiflags &= ~(AI_PURSUE_NEXT | AI_PURSUE_TEMP);
 		new = true;
 	}
 
-	if (self->monsterinfo.aiflags & AI_PURSUE_NEXT)
+	if (G_MonsterInfo(self)->aiflags & AI_PURSUE_NEXT)
 	{
-		self->monsterinfo.aiflags &= ~AI_PURSUE_NEXT;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_PURSUE_NEXT;
 
 		/* give ourself more time since we got this far */
-		self->monsterinfo.search_time = level.time + 5;
+		G_EnsureMonsterInfo(self)->search_time = level.time + 5;
 
-		if (self->monsterinfo.aiflags & AI_PURSUE_TEMP)
+		if (G_MonsterInfo(self)->aiflags & AI_PURSUE_TEMP)
 		{
-			self->monsterinfo.aiflags &= ~AI_PURSUE_TEMP;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_PURSUE_TEMP;
 			marker = NULL;
-			VectorCopy(self->monsterinfo.saved_goal,
-					self->monsterinfo.last_sighting);
+			VectorCopy(G_MonsterInfo(self)->saved_goal,
+					G_EnsureMonsterInfo(self)->last_sighting);
 			new = true;
 		}
-		else if (self->monsterinfo.aiflags & AI_PURSUIT_LAST_SEEN)
+		else if (G_MonsterInfo(self)->aiflags & AI_PURSUIT_LAST_SEEN)
 		{
-			self->monsterinfo.aiflags &= ~AI_PURSUIT_LAST_SEEN;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_PURSUIT_LAST_SEEN;
 			marker = PlayerTrail_PickFirst(self);
 		}
 		else
@@ -1207,27 +1207,27 @@ ai_run(edict_t *self, float dist)
 
 		if (marker)
 		{
-			VectorCopy(marker->s.origin, self->monsterinfo.last_sighting);
-			self->monsterinfo.trail_time = marker->timestamp;
+			VectorCopy(marker->s.origin, G_EnsureMonsterInfo(self)->last_sighting);
+			G_EnsureMonsterInfo(self)->trail_time = marker->timestamp;
 			self->s.angles[YAW] = self->ideal_yaw = marker->s.angles[YAW];
 			new = true;
 		}
 	}
 
-	VectorSubtract(self->s.origin, self->monsterinfo.last_sighting, v);
+	VectorSubtract(self->s.origin, G_MonsterInfo(self)->last_sighting, v);
 	d1 = VectorLength(v);
 
 	if (d1 <= dist)
 	{
-		self->monsterinfo.aiflags |= AI_PURSUE_NEXT;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_PURSUE_NEXT;
 		dist = d1;
 	}
 
-	VectorCopy(self->monsterinfo.last_sighting, self->goalentity->s.origin);
+	VectorCopy(G_MonsterInfo(self)->last_sighting, self->goalentity->s.origin);
 
 	if (new)
 	{
-		tr = gi.trace(self->s.origin, self->mins, self->maxs, self->monsterinfo.last_sighting,
+		tr = G_Trace(self->s.origin, self->mins, self->maxs, G_MonsterInfo(self)->last_sighting,
 				self, MASK_PLAYERSOLID);
 
 		if (tr.fraction < 1)
@@ -1241,13 +1241,13 @@ ai_run(edict_t *self, float dist)
 
 			VectorSet(v, d2, -16, 0);
 			G_ProjectSource(self->s.origin, v, v_forward, v_right, left_target);
-			tr = gi.trace(self->s.origin, self->mins, self->maxs, left_target,
+			tr = G_Trace(self->s.origin, self->mins, self->maxs, left_target,
 					self, MASK_PLAYERSOLID);
 			left = tr.fraction;
 
 			VectorSet(v, d2, 16, 0);
 			G_ProjectSource(self->s.origin, v, v_forward, v_right, right_target);
-			tr = gi.trace(self->s.origin, self->mins, self->maxs, right_target,
+			tr = G_Trace(self->s.origin, self->mins, self->maxs, right_target,
 					self, MASK_PLAYERSOLID);
 			right = tr.fraction;
 
@@ -1262,11 +1262,11 @@ ai_run(edict_t *self, float dist)
 							left_target);
 				}
 
-				VectorCopy(self->monsterinfo.last_sighting,
-						self->monsterinfo.saved_goal);
-				self->monsterinfo.aiflags |= AI_PURSUE_TEMP;
+				VectorCopy(G_MonsterInfo(self)->last_sighting,
+						G_EnsureMonsterInfo(self)->saved_goal);
+				G_EnsureMonsterInfo(self)->aiflags |= AI_PURSUE_TEMP;
 				VectorCopy(left_target, self->goalentity->s.origin);
-				VectorCopy(left_target, self->monsterinfo.last_sighting);
+				VectorCopy(left_target, G_EnsureMonsterInfo(self)->last_sighting);
 				VectorSubtract(self->goalentity->s.origin, self->s.origin, v);
 				self->s.angles[YAW] = self->ideal_yaw = vectoyaw(v);
 			}
@@ -1279,10 +1279,10 @@ ai_run(edict_t *self, float dist)
 							v_right, right_target);
 				}
 
-				VectorCopy(self->monsterinfo.last_sighting, self->monsterinfo.saved_goal);
-				self->monsterinfo.aiflags |= AI_PURSUE_TEMP;
+				VectorCopy(G_MonsterInfo(self)->last_sighting, G_EnsureMonsterInfo(self)->saved_goal);
+				G_EnsureMonsterInfo(self)->aiflags |= AI_PURSUE_TEMP;
 				VectorCopy(right_target, self->goalentity->s.origin);
-				VectorCopy(right_target, self->monsterinfo.last_sighting);
+				VectorCopy(right_target, G_EnsureMonsterInfo(self)->last_sighting);
 				VectorSubtract(self->goalentity->s.origin, self->s.origin, v);
 				self->s.angles[YAW] = self->ideal_yaw = vectoyaw(v);
 			}
@@ -0,0 +1,445 @@
+/*
+ * =======================================================================
+ *
+ * Call site statistics for the expensive engine calls. While
+ * g_callstats is set, G_Trace(), G_PointContents(), G_BoxEdicts(),
+ * G_InPVS(), G_InPHS() and G_LinkEntity() count and time every
+ * call by the __FILE__ and __LINE__ of the caller. Otherwise the
+ * macros in local.h go straight to the engine, which costs a
+ * single test of callstats_active.
+ *
+ * A frame runs from one G_RunFrame() to the next, so it includes
+ * the client commands and ClientThink() calls in between.
+ *
+ * =======================================================================
+ */
+
+#include "header/local.h"
+
+#define CALLSITE_HASH 1024 /* must be a power of two */
+#define MAX_CALLSITES 768
+
+typedef struct
+{
+	const char *file;
+	int line;
+	enginecall_t call;
+
+	unsigned int calls;
+	long long nsec;
+
+	/* the running frame */
+	unsigned int framecalls;
+	long long framensec;
+
+	/* the most expensive frame */
+	unsigned int peakcalls;
+	long long peaknsec;
+} callsite_t;
+
+static const char *callnames[CALL_NUM] = {
+	"trace",
+	"pointcontents",
+	"boxedicts",
+	"inpvs",
+	"inphs",
+	"linkentity"
+};
+
+qboolean callstats_active;
+
+static callsite_t callsites[MAX_CALLSITES];
+static short callhash[CALLSITE_HASH]; /* index + 1, 0 is free */
+static int numcallsites;
+static int callframes;
+static unsigned int calldropped;
+
+/*
+ * __FILE__ is a string literal, so the pointer is
+ * good enough as a key. Returns NULL if full.
+ */
+static callsite_t *
+CallSite_Find(const char *file, int line, enginecall_t call)
+{
+	callsite_t *site;
+	unsigned int h;
+	int i;
+
+	h = (unsigned int)(((size_t)file >> 3) ^ ((unsigned int)line * 2654435761u)) ^ call;
+
+	for (i = 0; i < CALLSITE_HASH; i++)
+	{
+		h &= CALLSITE_HASH - 1;
+
+		if (!callhash[h])
+		{
+			break;
+		}
+
+		site = &callsites[callhash[h] - 1];
+
+		if ((site->file == file) && (site->line == line) && (site->call == call))
+		{
+			return site;
+		}
+
+		h++;
+	}
+
+	if ((i == CALLSITE_HASH) || (numcallsites == MAX_CALLSITES))
+	{
+		calldropped++;
+		return NULL;
+	}
+
+	site = &callsites[numcallsites++];
+	site->file = file;
+	site->line = line;
+	site->call = call;
+	callhash[h] = numcallsites;
+
+	return site;
+}
+
+static void
+CallSite_Add(const char *file, int line, enginecall_t call, long long start)
+{
+	callsite_t *site;
+	long long nsec;
+
+	nsec = Q_Nanoseconds() - start;
+	site = CallSite_Find(file, line, call);
+
+	if (!site)
+	{
+		return;
+	}
+
+	site->calls++;
+	site->nsec += nsec;
+	site->framecalls++;
+	site->framensec += nsec;
+}
+
+/* ====================================================================== */
+
+trace_t
+G_TraceAt(const char *file, int line, const vec3_t start, const vec3_t mins,
+		const vec3_t maxs, const vec3_t end, const edict_t *passent,
+		int contentmask)
+{
+	long long t;
+	trace_t tr;
+
+	if (flightrec_active)
+	{
+		G_FlightTrace(file, line, passent);
+	}
+
+	if (!callstats_active)
+	{
+		return gi.trace(start, mins, maxs, end, passent, contentmask);
+	}
+
+	t = Q_Nanoseconds();
+	tr = gi.trace(start, mins, maxs, end, passent, contentmask);
+	CallSite_Add(file, line, CALL_TRACE, t);
+
+	return tr;
+}
+
+int
+G_PointContentsAt(const char *file, int line, const vec3_t point)
+{
+	long long t;
+	int contents;
+
+	t = Q_Nanoseconds();
+	contents = gi.pointcontents(point);
+	CallSite_Add(file, line, CALL_POINTCONTENTS, t);
+
+	return contents;
+}
+
+int
+G_BoxEdictsAt(const char *file, int line, const vec3_t mins,
+		const vec3_t maxs, edict_t **list, int maxcount, int areatype)
+{
+	long long t;
+	int num;
+
+	t = Q_Nanoseconds();
+	num = gi.BoxEdicts(mins, maxs, list, maxcount, areatype);
+	CallSite_Add(file, line, CALL_BOXEDICTS, t);
+
+	return num;
+}
+
+qboolean
+G_InPVSAt(const char *file, int line, vec3_t p1, vec3_t p2)
+{
+	long long t;
+	qboolean visible;
+
+	t = Q_Nanoseconds();
+	visible = gi.inPVS(p1, p2);
+	CallSite_Add(file, line, CALL_INPVS, t);
+
+	return visible;
+}
+
+qboolean
+G_InPHSAt(const char *file, int line, vec3_t p1, vec3_t p2)
+{
+	long long t;
+	qboolean audible;
+
+	t = Q_Nanoseconds();
+	audible = gi.inPHS(p1, p2);
+	CallSite_Add(file, line, CALL_INPHS, t);
+
+	return audible;
+}
+
+void
+G_LinkEntityAt(const char *file, int line, edict_t *ent)
+{
+	long long t;
+
+	t = Q_Nanoseconds();
+	gi.linkentity(ent);
+	CallSite_Add(file, line, CALL_LINKENTITY, t);
+}
+
+/* ====================================================================== */
+
+/*
+ * Closes the previous frame and picks up
+ * changes to g_callstats. Called at the
+ * start of every server frame.
+ */
+void
+G_CallStatsBeginFrame(void)
+{
+	callsite_t *site;
+	int i;
+
+	if (callstats_active)
+	{
+		callframes++;
+
+		for (i = 0, site = callsites; i < numcallsites; i++, site++)
+		{
+			if (site->framecalls > site->peakcalls)
+			{
+				site->peakcalls = site->framecalls;
+			}
+
+			if (site->framensec > site->peaknsec)
+			{
+				site->peaknsec = site->framensec;
+			}
+
+			site->framecalls = 0;
+			site->framensec = 0;
+		}
+	}
+
+	callstats_active = g_callstats->value != 0;
+}
+
+static void
+CallStats_Reset(void)
+{
+	memset(callsites, 0, sizeof(callsites));
+	memset(callhash, 0, sizeof(callhash));
+	numcallsites = 0;
+	callframes = 0;
+	calldropped = 0;
+}
+
+/* The path below src/, __FILE__ may be absolute. */
+const char *
+G_CallSiteName(const char *file)
+{
+	const char *s, *name;
+
+	name = file;
+
+	for (s = file; (s = strstr(s, "src/")) != NULL; s += 4)
+	{
+		name = s + 4;
+	}
+
+	return name;
+}
+
+static int
+CallStats_Compare(const void *a, const void *b)
+{
+	const callsite_t *sa, *sb;
+
+	sa = &callsites[*(const int *)a];
+	sb = &callsites[*(const int *)b];
+
+	if (sa->nsec != sb->nsec)
+	{
+		return (sa->nsec < sb->nsec) ? 1 : -1;
+	}
+
+	return (sa->calls < sb->calls) - (sa->calls > sb->calls);
+}
+
+/* Indices of all call sites, most expensive first. */
+static int
+CallStats_Sort(int *order)
+{
+	int i;
+
+	for (i = 0; i < numcallsites; i++)
+	{
+		order[i] = i;
+	}
+
+	qsort(order, numcallsites, sizeof(order[0]), CallStats_Compare);
+
+	return numcallsites;
+}
+
+static void
+CallStats_WriteCSV(const char *file)
+{
+	int order[MAX_CALLSITES];
+	char name[MAX_OSPATH];
+	callsite_t *site;
+	cvar_t *game;
+	FILE *f;
+	int i, num;
+
+	game = gi.cvar("game", "", 0);
+
+	Com_sprintf(name, sizeof(name), "%s/%s.csv",
+			*game->string ? game->string : GAMEVERSION, file);
+
+	f = Q_fopen(name, "w");
+
+	if (!f)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", name);
+		return;
+	}
+
+	fprintf(f, "file,line,call,calls,usec,frames,peak_calls,peak_usec\n");
+
+	num = CallStats_Sort(order);
+
+	for (i = 0; i < num; i++)
+	{
+		site = &callsites[order[i]];
+
+		fprintf(f, "%s,%i,%s,%u,%.1f,%i,%u,%.1f\n",
+				G_CallSiteName(site->file), site->line,
+				callnames[site->call], site->calls, site->nsec / 1000.0,
+				callframes, site->peakcalls, site->peaknsec / 1000.0);
+	}
+
+	fclose(f);
+
+	gi.cprintf(NULL, PRINT_HIGH, "Wrote %i call sites to %s\n", num, name);
+}
+
+static void
+CallStats_Print(int count)
+{
+	unsigned int calls[CALL_NUM];
+	long long nsec[CALL_NUM];
+	int order[MAX_CALLSITES];
+	char site_name[64];
+	callsite_t *site;
+	int i, num, frames;
+
+	frames = callframes ? callframes : 1;
+
+	memset(calls, 0, sizeof(calls));
+	memset(nsec, 0, sizeof(nsec));
+
+	num = CallStats_Sort(order);
+
+	gi.cprintf(NULL, PRINT_HIGH, "%-28s %-13s %9s %8s %6s %9s %7s\n",
+			"site", "call", "calls", "/frame", "peak", "msec", "usec/c");
+
+	for (i = 0; i < num; i++)
+	{
+		site = &callsites[order[i]];
+
+		calls[site->call] += site->calls;
+		nsec[site->call] += site->nsec;
+
+		if (i >= count)
+		{
+			continue;
+		}
+
+		Com_sprintf(site_name, sizeof(site_name), "%s:%i",
+				G_CallSiteName(site->file), site->line);
+
+		gi.cprintf(NULL, PRINT_HIGH, "%-28.28s %-13s %9u %8.2f %6u %9.2f %7.2f\n",
+				site_name, callnames[site->call], site->calls,
+				(float)site->calls / frames, site->peakcalls,
+				site->nsec / 1000000.0,
+				site->calls ? site->nsec / 1000.0 / site->calls : 0);
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+
+	for (i = 0; i < CALL_NUM; i++)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "%-28s %-13s %9u %8.2f %6s %9.2f %7.2f\n",
+				"total", callnames[i], calls[i], (float)calls[i] / frames, "",
+				nsec[i] / 1000000.0, calls[i] ? nsec[i] / 1000.0 / calls[i] : 0);
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i call sites over %i frames",
+			numcallsites, callframes);
+
+	if (calldropped)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, ", %u calls not recorded", calldropped);
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "%s\n",
+			callstats_active ? "" : " (g_callstats is 0)");
+}
+
+/*
+ * sv callstats [count]
+ * sv callstats reset
+ * sv callstats csv <file>
+ */
+void
+SVCmd_CallStats_f(void)
+{
+	const char *arg;
+
+	arg = gi.argv(2);
+
+	if (Q_stricmp(arg, "reset") == 0)
+	{
+		CallStats_Reset();
+		gi.cprintf(NULL, PRINT_HIGH, "Call statistics reset.\n");
+	}
+	else if (Q_stricmp(arg, "csv") == 0)
+	{
+		if (gi.argc() < 4)
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "Usage: sv callstats csv <file>\n");
+			return;
+		}
+
+		CallStats_WriteCSV(gi.argv(3));
+	}
+	else
+	{
+		CallStats_Print(*arg ? (int)strtol(arg, NULL, 10) : 30);
+	}
+}
@@ -66,7 +66,7 @@ UpdateChaseCam(edict_t *ent)
 		o[2] += 16;
 	}
 
-	trace = gi.trace(ownerv, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
+	trace = G_Trace(ownerv, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
 
 	VectorCopy(trace.endpos, goal);
 
@@ -75,7 +75,7 @@ UpdateChaseCam(edict_t *ent)
 	/* pad for floors and ceilings */
 	VectorCopy(goal, o);
 	o[2] += 6;
-	trace = gi.trace(goal, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
+	trace = G_Trace(goal, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
 
 	if (trace.fraction < 1)
 	{
@@ -85,7 +85,7 @@ UpdateChaseCam(edict_t *ent)
 
 	VectorCopy(goal, o);
 	o[2] -= 6;
-	trace = gi.trace(goal, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
+	trace = G_Trace(goal, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
 
 	if (trace.fraction < 1)
 	{
@@ -124,7 +124,7 @@ UpdateChaseCam(edict_t *ent)
 
 	ent->viewheight = 0;
 	ent->client->ps.pmove.pm_flags |= PMF_NO_PREDICTION;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 void
@@ -241,6 +241,6 @@ GetChaseTarget(edict_t *ent)
 		}
 	}
 
-	gi.centerprintf(ent, "No other players to chase.");
+	G_CenterPrintf(ent, "No other players to chase.");
 }
 
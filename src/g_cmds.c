@@ -24,6 +24,8 @@
  * =======================================================================
  */
 
+#include <ctype.h>
+
 #include "header/local.h"
 #include "monster/misc/player.h"
 
@@ -239,7 +241,7 @@ Cmd_Give_f(edict_t *ent)
 
 	if ((deathmatch->value || coop->value) && !sv_cheats->value)
 	{
-		gi.cprintf(ent, PRINT_HIGH,
+		G_CPrintf(ent, PRINT_HIGH,
 				"You must run the server with '+set cheats 1' to enable this command.\n");
 		return;
 	}
@@ -327,19 +329,19 @@ Cmd_Give_f(edict_t *ent)
 	{
 		const gitem_armor_t *info;
 
-		it = FindItem("Jacket Armor");
+		it = ITEM_BY_ID(IT_ARMOR_JACKET);
 		if (it)
 		{
 			ent->client->pers.inventory[ITEM_INDEX(it)] = 0;
 		}
 
-		it = FindItem("Combat Armor");
+		it = ITEM_BY_ID(IT_ARMOR_COMBAT);
 		if (it)
 		{
 			ent->client->pers.inventory[ITEM_INDEX(it)] = 0;
 		}
 
-		it = FindItem("Body Armor");
+		it = ITEM_BY_ID(IT_ARMOR_BODY);
 		if (it)
 		{
 			info = (gitem_armor_t *)it->info;
@@ -354,7 +356,7 @@ Cmd_Give_f(edict_t *ent)
 
 	if (give_all || (Q_stricmp(name, "Power Shield") == 0))
 	{
-		it = FindItem("Power Shield");
+		it = ITEM_BY_ID(IT_POWER_SHIELD);
 		if (it)
 		{
 			it_ent = G_Spawn();
@@ -405,14 +407,14 @@ Cmd_Give_f(edict_t *ent)
 
 		if (!it)
 		{
-			gi.cprintf(ent, PRINT_HIGH, "unknown item\n");
+			G_CPrintf(ent, PRINT_HIGH, "unknown item\n");
 			return;
 		}
 	}
 
 	if (!it->pickup)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "non-pickup item\n");
+		G_CPrintf(ent, PRINT_HIGH, "non-pickup item\n");
 		return;
 	}
 
@@ -458,7 +460,7 @@ Cmd_God_f(edict_t *ent)
 
 	if ((deathmatch->value || coop->value) && !sv_cheats->value)
 	{
-		gi.cprintf(ent, PRINT_HIGH,
+		G_CPrintf(ent, PRINT_HIGH,
 				"You must run the server with '+set cheats 1' to enable this command.\n");
 		return;
 	}
@@ -474,7 +476,7 @@ Cmd_God_f(edict_t *ent)
 		msg = "godmode ON\n";
 	}
 
-	gi.cprintf(ent, PRINT_HIGH, msg);
+	G_CPrintf(ent, PRINT_HIGH, msg);
 }
 
 /*
@@ -492,7 +494,7 @@ Cmd_Notarget_f(edict_t *ent)
 
 	if ((deathmatch->value || coop->value) && !sv_cheats->value)
 	{
-		gi.cprintf(ent, PRINT_HIGH,
+		G_CPrintf(ent, PRINT_HIGH,
 				"You must run the server with '+set cheats 1' to enable this command.\n");
 		return;
 	}
@@ -508,7 +510,7 @@ Cmd_Notarget_f(edict_t *ent)
 		msg = "notarget ON\n";
 	}
 
-	gi.cprintf(ent, PRINT_HIGH, msg);
+	G_CPrintf(ent, PRINT_HIGH, msg);
 }
 
 /*
@@ -526,7 +528,7 @@ Cmd_Noclip_f(edict_t *ent)
 
 	if ((deathmatch->value || coop->value) && !sv_cheats->value)
 	{
-		gi.cprintf(ent, PRINT_HIGH,
+		G_CPrintf(ent, PRINT_HIGH,
 				"You must run the server with '+set cheats 1' to enable this command.\n");
 		return;
 	}
@@ -542,7 +544,7 @@ Cmd_Noclip_f(edict_t *ent)
 		msg = "noclip ON\n";
 	}
 
-	gi.cprintf(ent, PRINT_HIGH, msg);
+	G_CPrintf(ent, PRINT_HIGH, msg);
 }
 
 /*
@@ -565,13 +567,13 @@ Cmd_Use_f(edict_t *ent)
 
 	if (!it)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "unknown item: %s\n", s);
+		G_CPrintf(ent, PRINT_HIGH, "unknown item: %s\n", s);
 		return;
 	}
 
 	if (!it->use)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Item is not usable.\n");
+		G_CPrintf(ent, PRINT_HIGH, "Item is not usable.\n");
 		return;
 	}
 
@@ -581,29 +583,29 @@ Cmd_Use_f(edict_t *ent)
 	{
 		if (strcmp(it->pickup_name, "HyperBlaster") == 0)
 		{
-			it = FindItem("Ionripper");
+			it = ITEM_BY_ID(IT_WEAPON_BOOMER);
 			index = ITEM_INDEX(it);
 
 			if (!ent->client->pers.inventory[index])
 			{
-				gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
+				G_CPrintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
 				return;
 			}
 		}
 		else if (strcmp(it->pickup_name, "Railgun") == 0)
 		{
-			it = FindItem("Phalanx");
+			it = ITEM_BY_ID(IT_WEAPON_PHALANX);
 			index = ITEM_INDEX(it);
 
 			if (!ent->client->pers.inventory[index])
 			{
-				gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
+				G_CPrintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
 				return;
 			}
 		}
 		else
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
+			G_CPrintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
 			return;
 		}
 	}
@@ -631,13 +633,13 @@ Cmd_Drop_f(edict_t *ent)
 
 	if (!it)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "unknown item: %s\n", s);
+		G_CPrintf(ent, PRINT_HIGH, "unknown item: %s\n", s);
 		return;
 	}
 
 	if (!it->drop)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Item is not dropable.\n");
+		G_CPrintf(ent, PRINT_HIGH, "Item is not dropable.\n");
 		return;
 	}
 
@@ -647,29 +649,29 @@ Cmd_Drop_f(edict_t *ent)
 	{
 		if (strcmp(it->pickup_name, "HyperBlaster") == 0)
 		{
-			it = FindItem("Ionripper");
+			it = ITEM_BY_ID(IT_WEAPON_BOOMER);
 			index = ITEM_INDEX(it);
 
 			if (!ent->client->pers.inventory[index])
 			{
-				gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
+				G_CPrintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
 				return;
 			}
 		}
 		else if (strcmp(it->pickup_name, "Railgun") == 0)
 		{
-			it = FindItem("Phalanx");
+			it = ITEM_BY_ID(IT_WEAPON_PHALANX);
 			index = ITEM_INDEX(it);
 
 			if (!ent->client->pers.inventory[index])
 			{
-				gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
+				G_CPrintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
 				return;
 			}
 		}
 		else
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
+			G_CPrintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
 			return;
 		}
 	}
@@ -704,7 +706,7 @@ Cmd_Score_f(edict_t *ent)
 
 	ent->client->showscores = true;
 	DeathmatchScoreboardMessage(ent, ent->enemy);
-	gi.unicast(ent, true);
+	G_Unicast(ent, true);
 }
 
 /*
@@ -737,7 +739,7 @@ Cmd_Help_f(edict_t *ent)
 	ent->client->showhelp = true;
 	ent->client->pers.helpchanged = 0;
 	HelpComputerMessage(ent);
-	gi.unicast(ent, true);
+	G_Unicast(ent, true);
 }
 
 static void
@@ -764,7 +766,7 @@ Cmd_Inven_f(edict_t *ent)
 	cl->showinventory = true;
 
 	InventoryMessage(ent);
-	gi.unicast(ent, true);
+	G_Unicast(ent, true);
 }
 
 static void
@@ -781,7 +783,7 @@ Cmd_InvUse_f(edict_t *ent)
 
 	if (ent->client->pers.selected_item == -1)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "No item to use.\n");
+		G_CPrintf(ent, PRINT_HIGH, "No item to use.\n");
 		return;
 	}
 
@@ -789,7 +791,7 @@ Cmd_InvUse_f(edict_t *ent)
 
 	if (!it->use)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Item is not usable.\n");
+		G_CPrintf(ent, PRINT_HIGH, "Item is not usable.\n");
 		return;
 	}
 
@@ -979,7 +981,7 @@ Cmd_InvDrop_f(edict_t *ent)
 
 	if (ent->client->pers.selected_item == -1)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "No item to drop.\n");
+		G_CPrintf(ent, PRINT_HIGH, "No item to drop.\n");
 		return;
 	}
 
@@ -987,7 +989,7 @@ Cmd_InvDrop_f(edict_t *ent)
 
 	if (!it->drop)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Item is not dropable.\n");
+		G_CPrintf(ent, PRINT_HIGH, "Item is not dropable.\n");
 		return;
 	}
 
@@ -1103,7 +1105,7 @@ Cmd_Players_f(edict_t *ent)
 		Q_strlcat(large, small, sizeof(large));
 	}
 
-	gi.cprintf(ent, PRINT_HIGH, "%s\n%i players\n", large, count);
+	G_CPrintf(ent, PRINT_HIGH, "%s\n%i players\n", large, count);
 }
 
 static void
@@ -1134,28 +1136,28 @@ Cmd_Wave_f(edict_t *ent)
 	switch (i)
 	{
 		case 0:
-			gi.cprintf(ent, PRINT_HIGH, "flipoff\n");
+			G_CPrintf(ent, PRINT_HIGH, "flipoff\n");
 			ent->s.frame = FRAME_flip01 - 1;
 			ent->client->anim_end = FRAME_flip12;
 			break;
 		case 1:
-			gi.cprintf(ent, PRINT_HIGH, "salute\n");
+			G_CPrintf(ent, PRINT_HIGH, "salute\n");
 			ent->s.frame = FRAME_salute01 - 1;
 			ent->client->anim_end = FRAME_salute11;
 			break;
 		case 2:
-			gi.cprintf(ent, PRINT_HIGH, "taunt\n");
+			G_CPrintf(ent, PRINT_HIGH, "taunt\n");
 			ent->s.frame = FRAME_taunt01 - 1;
 			ent->client->anim_end = FRAME_taunt17;
 			break;
 		case 3:
-			gi.cprintf(ent, PRINT_HIGH, "wave\n");
+			G_CPrintf(ent, PRINT_HIGH, "wave\n");
 			ent->s.frame = FRAME_wave01 - 1;
 			ent->client->anim_end = FRAME_wave11;
 			break;
 		case 4:
 		default:
-			gi.cprintf(ent, PRINT_HIGH, "point\n");
+			G_CPrintf(ent, PRINT_HIGH, "point\n");
 			ent->s.frame = FRAME_point01 - 1;
 			ent->client->anim_end = FRAME_point12;
 			break;
@@ -1199,7 +1201,7 @@ flooded(edict_t *ent)
 
 	if (level.time < cl->flood_locktill)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "You can't talk for %d more seconds\n",
+		G_CPrintf(ent, PRINT_HIGH, "You can't talk for %d more seconds\n",
 			(int)(cl->flood_locktill - level.time));
 
 		return true;
@@ -1217,7 +1219,7 @@ flooded(edict_t *ent)
 	{
 		cl->flood_locktill = level.time + flood_waitdelay->value;
 
-		gi.cprintf(ent, PRINT_CHAT,
+		G_CPrintf(ent, PRINT_CHAT,
 			"Flood protection: You can't talk for %d seconds.\n",
 			(int)flood_waitdelay->value);
 
@@ -1322,7 +1324,7 @@ Cmd_Say_f(edict_t *ent, qboolean team, qboolean arg0)
 			}
 		}
 
-		gi.cprintf(other, PRINT_CHAT, "%s", text);
+		G_CPrintf(other, PRINT_CHAT, "%s", text);
 	}
 }
 
@@ -1364,14 +1366,14 @@ Cmd_PlayerList_f(edict_t *ent)
 		if ((text_len + strlen(st_text)) > (sizeof(text) - 50))
 		{
 			snprintf(text + text_len, sizeof(text) - text_len, "And more...\n");
-			gi.cprintf(ent, PRINT_HIGH, "%s", text);
+			G_CPrintf(ent, PRINT_HIGH, "%s", text);
 			return;
 		}
 
 		Q_strlcat(text, st_text, sizeof(text));
 	}
 
-	gi.cprintf(ent, PRINT_HIGH, "%s", text);
+	G_CPrintf(ent, PRINT_HIGH, "%s", text);
 }
 
 static void
@@ -1384,13 +1386,13 @@ Cmd_Teleport_f(edict_t *ent)
 
 	if ((deathmatch->value || coop->value) && !sv_cheats->value)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "You must run the server with '+set cheats 1' to enable this command.\n");
+		G_CPrintf(ent, PRINT_HIGH, "You must run the server with '+set cheats 1' to enable this command.\n");
 		return;
 	}
 
 	if (gi.argc() != 4)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Usage: teleport x y z\n");
+		G_CPrintf(ent, PRINT_HIGH, "Usage: teleport x y z\n");
 		return;
 	}
 
@@ -1421,7 +1423,7 @@ Cmd_Teleport_f(edict_t *ent)
 	KillBox(ent);
 
 	/* And link it back in. */
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 static void
@@ -1429,13 +1431,13 @@ Cmd_ListEntities_f(edict_t *ent)
 {
 	if ((deathmatch->value || coop->value) && !sv_cheats->value)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "You must run the server with '+set cheats 1' to enable this command.\n");
+		G_CPrintf(ent, PRINT_HIGH, "You must run the server with '+set cheats 1' to enable this command.\n");
 		return;
 	}
 
 	if (gi.argc() < 2)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Usage: listentities <all|ammo|items|keys|monsters|weapons>\n");
+		G_CPrintf(ent, PRINT_HIGH, "Usage: listentities <all|ammo|items|keys|monsters|weapons>\n");
 		return;
 	}
 
@@ -1477,7 +1479,7 @@ Cmd_ListEntities_f(edict_t *ent)
 		}
 		else
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Usage: listentities <all|ammo|items|keys|monsters|weapons>\n");
+			G_CPrintf(ent, PRINT_HIGH, "Usage: listentities <all|ammo|items|keys|monsters|weapons>\n");
 		}
 	}
 
@@ -1703,7 +1705,7 @@ Cmd_CycleWeap_f(edict_t *ent)
 	num_weaps = gi.argc();
 	if (num_weaps <= 1)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Usage: cycleweap classname1 classname2 .. classnameN\n");
+		G_CPrintf(ent, PRINT_HIGH, "Usage: cycleweap classname1 classname2 .. classnameN\n");
 		return;
 	}
 
@@ -1713,7 +1715,7 @@ Cmd_CycleWeap_f(edict_t *ent)
 	cl = ent->client;
 	if (cl->pers.inventory[ITEM_INDEX(weap)] <= 0)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", weap->pickup_name);
+		G_CPrintf(ent, PRINT_HIGH, "Out of item: %s\n", weap->pickup_name);
 		return;
 	}
 
@@ -1816,7 +1818,7 @@ Cmd_PrefWeap_f(edict_t *ent)
 
 	if (gi.argc() <= 1)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Usage: prefweap classname1 classname2 .. classnameN\n");
+		G_CPrintf(ent, PRINT_HIGH, "Usage: prefweap classname1 classname2 .. classnameN\n");
 		return;
 	}
 
@@ -1825,7 +1827,7 @@ Cmd_PrefWeap_f(edict_t *ent)
 	{
 		if (ent->client->pers.inventory[ITEM_INDEX(weap)] <= 0)
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", weap->pickup_name);
+			G_CPrintf(ent, PRINT_HIGH, "Out of item: %s\n", weap->pickup_name);
 		}
 		else
 		{
@@ -1834,161 +1836,324 @@ Cmd_PrefWeap_f(edict_t *ent)
 	}
 }
 
-void
-ClientCommand(edict_t *ent)
+static void
+Cmd_SayAll_f(edict_t *ent)
 {
-	const char *cmd;
+	Cmd_Say_f(ent, false, false);
+}
 
-	if (!ent)
-	{
-		return;
-	}
+static void
+Cmd_SayTeam_f(edict_t *ent)
+{
+	Cmd_Say_f(ent, true, false);
+}
 
-	if (!ent->client)
-	{
-		return; /* not fully in game yet */
-	}
+static void
+Cmd_InvNext_f(edict_t *ent)
+{
+	SelectNext(ent, -1);
+}
 
-	cmd = gi.argv(0);
+static void
+Cmd_InvPrev_f(edict_t *ent)
+{
+	SelectPrev(ent, -1);
+}
 
-	if (Q_stricmp(cmd, "players") == 0)
-	{
-		Cmd_Players_f(ent);
-		return;
-	}
+static void
+Cmd_InvNextW_f(edict_t *ent)
+{
+	SelectNext(ent, IT_WEAPON);
+}
 
-	if (Q_stricmp(cmd, "say") == 0)
-	{
-		Cmd_Say_f(ent, false, false);
-		return;
-	}
+static void
+Cmd_InvPrevW_f(edict_t *ent)
+{
+	SelectPrev(ent, IT_WEAPON);
+}
+
+static void
+Cmd_InvNextP_f(edict_t *ent)
+{
+	SelectNext(ent, IT_POWERUP);
+}
+
+static void
+Cmd_InvPrevP_f(edict_t *ent)
+{
+	SelectPrev(ent, IT_POWERUP);
+}
+
+/*
+ * Client commands are rate limited with a token bucket per
+ * client and command class. Commands that format and send
+ * large strings get a small budget, binds that are pressed
+ * in quick succession a large one. Dropped commands are
+ * only counted, "sv cmdstats" prints the counters.
+ */
+typedef enum
+{
+	CMDCLASS_INFO,
+	CMDCLASS_ACTION,
+	CMDCLASS_CHAT,
+	CMDCLASS_NUM
+} cmdclass_t;
+
+typedef struct
+{
+	float rate;  /* tokens per second */
+	float burst; /* bucket size */
+	const char *name;
+} cmdlimit_t;
+
+static const cmdlimit_t cmd_limits[CMDCLASS_NUM] = {
+	[CMDCLASS_INFO] = {2, 5, "info"},
+	[CMDCLASS_ACTION] = {20, 40, "action"},
+	[CMDCLASS_CHAT] = {5, 10, "chat"}
+};
+
+#define CMDF_INTERMISSION 1 /* allowed during intermission */
+
+typedef struct
+{
+	const char *name;
+	void (*func)(edict_t *ent);
+	cmdclass_t class;
+	int flags;
+} clientcmd_t;
+
+static const clientcmd_t clientcmds[] = {
+	{"players", Cmd_Players_f, CMDCLASS_INFO, CMDF_INTERMISSION},
+	{"say", Cmd_SayAll_f, CMDCLASS_CHAT, CMDF_INTERMISSION},
+	{"say_team", Cmd_SayTeam_f, CMDCLASS_CHAT, CMDF_INTERMISSION},
+	{"score", Cmd_Score_f, CMDCLASS_INFO, CMDF_INTERMISSION},
+	{"help", Cmd_Help_f, CMDCLASS_INFO, CMDF_INTERMISSION},
+	{"use", Cmd_Use_f, CMDCLASS_ACTION, 0},
+	{"drop", Cmd_Drop_f, CMDCLASS_ACTION, 0},
+	{"give", Cmd_Give_f, CMDCLASS_ACTION, 0},
+	{"god", Cmd_God_f, CMDCLASS_ACTION, 0},
+	{"notarget", Cmd_Notarget_f, CMDCLASS_ACTION, 0},
+	{"noclip", Cmd_Noclip_f, CMDCLASS_ACTION, 0},
+	{"inven", Cmd_Inven_f, CMDCLASS_INFO, 0},
+	{"invnext", Cmd_InvNext_f, CMDCLASS_ACTION, 0},
+	{"invprev", Cmd_InvPrev_f, CMDCLASS_ACTION, 0},
+	{"invnextw", Cmd_InvNextW_f, CMDCLASS_ACTION, 0},
+	{"invprevw", Cmd_InvPrevW_f, CMDCLASS_ACTION, 0},
+	{"invnextp", Cmd_InvNextP_f, CMDCLASS_ACTION, 0},
+	{"invprevp", Cmd_InvPrevP_f, CMDCLASS_ACTION, 0},
+	{"invuse", Cmd_InvUse_f, CMDCLASS_ACTION, 0},
+	{"invdrop", Cmd_InvDrop_f, CMDCLASS_ACTION, 0},
+	{"weapprev", Cmd_WeapPrev_f, CMDCLASS_ACTION, 0},
+	{"weapnext", Cmd_WeapNext_f, CMDCLASS_ACTION, 0},
+	{"weaplast", Cmd_WeapLast_f, CMDCLASS_ACTION, 0},
+	{"kill", Cmd_Kill_f, CMDCLASS_ACTION, 0},
+	{"putaway", Cmd_PutAway_f, CMDCLASS_ACTION, 0},
+	{"wave", Cmd_Wave_f, CMDCLASS_ACTION, 0},
+	{"playerlist", Cmd_PlayerList_f, CMDCLASS_INFO, 0},
+	{"teleport", Cmd_Teleport_f, CMDCLASS_ACTION, 0},
+	{"listentities", Cmd_ListEntities_f, CMDCLASS_INFO, 0},
+	{"cycleweap", Cmd_CycleWeap_f, CMDCLASS_ACTION, 0},
+	{"prefweap", Cmd_PrefWeap_f, CMDCLASS_ACTION, 0}
+};
+
+#define CMD_HASH_SIZE 64 /* power of two, > 2 * ARRLEN(clientcmds) */
+
+static byte clientcmd_hash[CMD_HASH_SIZE]; /* index + 1, 0 is empty */
+
+typedef struct
+{
+	float tokens[CMDCLASS_NUM];
+	float last;
+	int dropped[CMDCLASS_NUM];
+} cmdbucket_t;
+
+static cmdbucket_t cmd_buckets[MAX_CLIENTS];
+
+static unsigned int
+CmdHash(const char *name)
+{
+	unsigned int hash = 2166136261u;
 
-	if (Q_stricmp(cmd, "say_team") == 0)
+	while (*name)
 	{
-		Cmd_Say_f(ent, true, false);
-		return;
+		hash ^= (byte)tolower((byte)*name++);
+		hash *= 16777619u;
 	}
 
-	if (Q_stricmp(cmd, "score") == 0)
+	return hash & (CMD_HASH_SIZE - 1);
+}
+
+static const clientcmd_t *
+FindClientCommand(const char *name)
+{
+	unsigned int h;
+	int i;
+
+	if (!clientcmd_hash[CmdHash(clientcmds[0].name)])
 	{
-		Cmd_Score_f(ent);
-		return;
+		for (i = 0; i < ARRLEN(clientcmds); i++)
+		{
+			for (h = CmdHash(clientcmds[i].name); clientcmd_hash[h];
+				 h = (h + 1) & (CMD_HASH_SIZE - 1))
+			{
+			}
+
+			clientcmd_hash[h] = i + 1;
+		}
 	}
 
-	if (Q_stricmp(cmd, "help") == 0)
+	for (h = CmdHash(name); clientcmd_hash[h]; h = (h + 1) & (CMD_HASH_SIZE - 1))
 	{
-		Cmd_Help_f(ent);
-		return;
+		if (!Q_stricmp(clientcmds[clientcmd_hash[h] - 1].name, name))
+		{
+			return &clientcmds[clientcmd_hash[h] - 1];
+		}
 	}
 
-	if (level.intermissiontime)
+	return NULL;
+}
+
+void
+G_ResetCommandLimits(edict_t *ent)
+{
+	cmdbucket_t *b;
+	int i;
+
+	if (!ent)
 	{
 		return;
 	}
 
-	if (Q_stricmp(cmd, "use") == 0)
-	{
-		Cmd_Use_f(ent);
-	}
-	else if (Q_stricmp(cmd, "drop") == 0)
-	{
-		Cmd_Drop_f(ent);
-	}
-	else if (Q_stricmp(cmd, "give") == 0)
-	{
-		Cmd_Give_f(ent);
-	}
-	else if (Q_stricmp(cmd, "god") == 0)
-	{
-		Cmd_God_f(ent);
-	}
-	else if (Q_stricmp(cmd, "notarget") == 0)
-	{
-		Cmd_Notarget_f(ent);
-	}
-	else if (Q_stricmp(cmd, "noclip") == 0)
-	{
-		Cmd_Noclip_f(ent);
-	}
-	else if (Q_stricmp(cmd, "inven") == 0)
-	{
-		Cmd_Inven_f(ent);
-	}
-	else if (Q_stricmp(cmd, "invnext") == 0)
-	{
-		SelectNext(ent, -1);
-	}
-	else if (Q_stricmp(cmd, "invprev") == 0)
-	{
-		SelectPrev(ent, -1);
-	}
-	else if (Q_stricmp(cmd, "invnextw") == 0)
-	{
-		SelectNext(ent, IT_WEAPON);
-	}
-	else if (Q_stricmp(cmd, "invprevw") == 0)
-	{
-		SelectPrev(ent, IT_WEAPON);
-	}
-	else if (Q_stricmp(cmd, "invnextp") == 0)
-	{
-		SelectNext(ent, IT_POWERUP);
-	}
-	else if (Q_stricmp(cmd, "invprevp") == 0)
-	{
-		SelectPrev(ent, IT_POWERUP);
-	}
-	else if (Q_stricmp(cmd, "invuse") == 0)
-	{
-		Cmd_InvUse_f(ent);
-	}
-	else if (Q_stricmp(cmd, "invdrop") == 0)
-	{
-		Cmd_InvDrop_f(ent);
-	}
-	else if (Q_stricmp(cmd, "weapprev") == 0)
+	b = &cmd_buckets[(ent - g_edicts - 1) & (MAX_CLIENTS - 1)];
+
+	for (i = 0; i < CMDCLASS_NUM; i++)
 	{
-		Cmd_WeapPrev_f(ent);
+		b->tokens[i] = cmd_limits[i].burst;
+		b->dropped[i] = 0;
 	}
-	else if (Q_stricmp(cmd, "weapnext") == 0)
+
+	b->last = level.time;
+}
+
+/*
+ * Takes a token from the bucket of the given class,
+ * returns false if the command has to be dropped.
+ */
+static qboolean
+CheckCommandLimit(edict_t *ent, cmdclass_t class)
+{
+	cmdbucket_t *b;
+	float dt;
+	int i;
+
+	if (!g_cmd_ratelimit->value)
 	{
-		Cmd_WeapNext_f(ent);
+		return true;
 	}
-	else if (Q_stricmp(cmd, "weaplast") == 0)
+
+	b = &cmd_buckets[(ent - g_edicts - 1) & (MAX_CLIENTS - 1)];
+
+	/* level.time starts over on every map */
+	dt = level.time - b->last;
+
+	if (dt < 0)
 	{
-		Cmd_WeapLast_f(ent);
+		dt = 0;
 	}
-	else if (Q_stricmp(cmd, "kill") == 0)
+
+	if (dt > 0)
 	{
-		Cmd_Kill_f(ent);
+		for (i = 0; i < CMDCLASS_NUM; i++)
+		{
+			b->tokens[i] += dt * cmd_limits[i].rate;
+
+			if (b->tokens[i] > cmd_limits[i].burst)
+			{
+				b->tokens[i] = cmd_limits[i].burst;
+			}
+		}
 	}
-	else if (Q_stricmp(cmd, "putaway") == 0)
+
+	b->last = level.time;
+
+	if (b->tokens[class] < 1)
 	{
-		Cmd_PutAway_f(ent);
+		b->dropped[class]++;
+		return false;
 	}
-	else if (Q_stricmp(cmd, "wave") == 0)
+
+	b->tokens[class] -= 1;
+
+	return true;
+}
+
+void
+SVCmd_CmdStats_f(void)
+{
+	cmdbucket_t *b;
+	edict_t *ent;
+	int i, j;
+
+	gi.cprintf(NULL, PRINT_HIGH, "num name             %-8s%-8s%-8s\n",
+			cmd_limits[CMDCLASS_INFO].name, cmd_limits[CMDCLASS_ACTION].name,
+			cmd_limits[CMDCLASS_CHAT].name);
+
+	for (i = 0; i < game.maxclients; i++)
 	{
-		Cmd_Wave_f(ent);
+		ent = g_edicts + 1 + i;
+
+		if (!ent->inuse || !ent->client)
+		{
+			continue;
+		}
+
+		b = &cmd_buckets[i & (MAX_CLIENTS - 1)];
+
+		gi.cprintf(NULL, PRINT_HIGH, "%3i %-16.16s", i, ent->client->pers.netname);
+
+		for (j = 0; j < CMDCLASS_NUM; j++)
+		{
+			gi.cprintf(NULL, PRINT_HIGH, " %-7i", b->dropped[j]);
+		}
+
+		gi.cprintf(NULL, PRINT_HIGH, "\n");
 	}
-	else if (Q_stricmp(cmd, "playerlist") == 0)
+}
+
+void
+ClientCommand(edict_t *ent)
+{
+	const clientcmd_t *c;
+	const char *cmd;
+
+	if (!ent)
 	{
-		Cmd_PlayerList_f(ent);
+		return;
 	}
-	else if (Q_stricmp(cmd, "teleport") == 0)
+
+	if (!ent->client)
 	{
-		Cmd_Teleport_f(ent);
+		return; /* not fully in game yet */
 	}
-	else if (Q_stricmp(cmd, "listentities") == 0)
+
+	G_RecordCommand(ent);
+
+	cmd = gi.argv(0);
+	c = FindClientCommand(cmd);
+
+	if (level.intermissiontime && !(c && (c->flags & CMDF_INTERMISSION)))
 	{
-		Cmd_ListEntities_f(ent);
+		return;
 	}
-	else if (Q_stricmp(cmd, "cycleweap") == 0)
+
+	if (!CheckCommandLimit(ent, c ? c->class : CMDCLASS_CHAT))
 	{
-		Cmd_CycleWeap_f(ent);
+		return;
 	}
-	else if (Q_stricmp(cmd, "prefweap") == 0)
+
+	if (c)
 	{
-		Cmd_PrefWeap_f(ent);
+		c->func(ent);
 	}
 	else /* anything that doesn't match a command will be a chat */
 	{
@@ -47,7 +47,7 @@ CanDamage(edict_t *targ, edict_t *inflictor)
 	{
 		VectorAdd(targ->absmin, targ->absmax, dest);
 		VectorScale(dest, 0.5, dest);
-		trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin,
+		trace = G_Trace(inflictor->s.origin, vec3_origin, vec3_origin,
 				dest, inflictor, MASK_SOLID);
 
 		if (trace.fraction == 1.0)
@@ -63,7 +63,7 @@ CanDamage(edict_t *targ, edict_t *inflictor)
 		return false;
 	}
 
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin,
+	trace = G_Trace(inflictor->s.origin, vec3_origin, vec3_origin,
 			targ->s.origin, inflictor, MASK_SOLID);
 
 	if (trace.fraction == 1.0)
@@ -74,7 +74,7 @@ CanDamage(edict_t *targ, edict_t *inflictor)
 	VectorCopy(targ->s.origin, dest);
 	dest[0] += 15.0;
 	dest[1] += 15.0;
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin,
+	trace = G_Trace(inflictor->s.origin, vec3_origin, vec3_origin,
 			dest, inflictor, MASK_SOLID);
 
 	if (trace.fraction == 1.0)
@@ -85,7 +85,7 @@ CanDamage(edict_t *targ, edict_t *inflictor)
 	VectorCopy(targ->s.origin, dest);
 	dest[0] += 15.0;
 	dest[1] -= 15.0;
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin,
+	trace = G_Trace(inflictor->s.origin, vec3_origin, vec3_origin,
 			dest, inflictor, MASK_SOLID);
 
 	if (trace.fraction == 1.0)
@@ -96,7 +96,7 @@ CanDamage(edict_t *targ, edict_t *inflictor)
 	VectorCopy(targ->s.origin, dest);
 	dest[0] -= 15.0;
 	dest[1] += 15.0;
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin,
+	trace = G_Trace(inflictor->s.origin, vec3_origin, vec3_origin,
 			dest, inflictor, MASK_SOLID);
 
 	if (trace.fraction == 1.0)
@@ -107,7 +107,7 @@ CanDamage(edict_t *targ, edict_t *inflictor)
 	VectorCopy(targ->s.origin, dest);
 	dest[0] -= 15.0;
 	dest[1] -= 15.0;
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin,
+	trace = G_Trace(inflictor->s.origin, vec3_origin, vec3_origin,
 			dest, inflictor, MASK_SOLID);
 
 	if (trace.fraction == 1.0)
@@ -131,13 +131,14 @@ Killed(edict_t *targ, edict_t *inflictor, edict_t *attacker,
 
 	if ((targ->svflags & SVF_MONSTER) && (targ->deadflag != DEAD_DEAD))
 	{
-		if (!(targ->monsterinfo.aiflags & AI_GOOD_GUY))
+		if (!(G_MonsterInfo(targ)->aiflags & AI_GOOD_GUY))
 		{
 			level.killed_monsters++;
 
 			if (coop->value && attacker->client)
 			{
 				attacker->client->resp.score++;
+				InvalidateScoreboard();
 			}
 
 			/* medics won't heal monsters that they kill themselves */
@@ -153,7 +154,9 @@ Killed(edict_t *targ, edict_t *inflictor, edict_t *attacker,
 		(targ->movetype == MOVETYPE_NONE))
 	{
 		/* doors, triggers, etc */
+		G_SpanBegin("die", targ);
 		targ->die(targ, inflictor, attacker, damage, point);
+		G_SpanEnd();
 		return;
 	}
 
@@ -163,17 +166,19 @@ Killed(edict_t *targ, edict_t *inflictor, edict_t *attacker,
 		monster_death_use(targ);
 	}
 
+	G_SpanBegin("die", targ);
 	targ->die(targ, inflictor, attacker, damage, point);
+	G_SpanEnd();
 }
 
 static void
 SpawnDamage(int type, const vec3_t origin, const vec3_t normal)
 {
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(type);
-	gi.WritePosition(origin);
-	gi.WriteDir(normal);
-	gi.multicast(origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(type);
+	G_WritePosition(origin);
+	G_WriteDir(normal);
+	G_Multicast(origin, MULTICAST_PVS);
 }
 
 /*
@@ -235,14 +240,14 @@ CheckPowerArmor(edict_t *ent, const vec3_t point, const vec3_t normal,
 
 		if (power_armor_type != POWER_ARMOR_NONE)
 		{
-			index = ITEM_INDEX(FindItem("Cells"));
+			index = IT_AMMO_CELLS;
 			power = client->pers.inventory[index];
 		}
 	}
 	else if (ent->svflags & SVF_MONSTER)
 	{
-		power_armor_type = ent->monsterinfo.power_armor_type;
-		power = ent->monsterinfo.power_armor_power;
+		power_armor_type = G_MonsterInfo(ent)->power_armor_type;
+		power = G_MonsterInfo(ent)->power_armor_power;
 		index = 0;
 	}
 	else
@@ -311,7 +316,7 @@ CheckPowerArmor(edict_t *ent, const vec3_t point, const vec3_t normal,
 	}
 	else
 	{
-		ent->monsterinfo.power_armor_power -= power_used;
+		G_EnsureMonsterInfo(ent)->power_armor_power -= power_used;
 	}
 
 	return save;
@@ -407,9 +412,9 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 	/* if we are a good guy monster and our attacker is a player
 	   or another good guy, do not get mad at them */
-	if (targ->monsterinfo.aiflags & AI_GOOD_GUY)
+	if (G_MonsterInfo(targ)->aiflags & AI_GOOD_GUY)
 	{
-		if (attacker->client || (attacker->monsterinfo.aiflags & AI_GOOD_GUY))
+		if (attacker->client || (G_MonsterInfo(attacker)->aiflags & AI_GOOD_GUY))
 		{
 			return;
 		}
@@ -419,7 +424,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 	   them because he's good and we're not */
 	if (attacker->client)
 	{
-		targ->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+		G_EnsureMonsterInfo(targ)->aiflags &= ~AI_SOUND_TARGET;
 
 		/* this can only happen in coop (both new and old
 		   enemies are clients) only switch if can't see the
@@ -437,7 +442,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 		targ->enemy = attacker;
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(G_MonsterInfo(targ)->aiflags & AI_DUCKED))
 		{
 			FoundTarget(targ);
 		}
@@ -463,7 +468,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 		targ->enemy = attacker;
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(G_MonsterInfo(targ)->aiflags & AI_DUCKED))
 		{
 			FoundTarget(targ);
 		}
@@ -478,7 +483,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 		targ->enemy = attacker;
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(G_MonsterInfo(targ)->aiflags & AI_DUCKED))
 		{
 			FoundTarget(targ);
 		}
@@ -493,7 +498,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 		targ->enemy = attacker->enemy;
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(G_MonsterInfo(targ)->aiflags & AI_DUCKED))
 		{
 			FoundTarget(targ);
 		}
@@ -540,6 +545,10 @@ T_Damage(edict_t *targ, edict_t *inflictor, edict_t *attacker, vec3_t dir,
 		return;
 	}
 
+	/* knockback, pain and death change the target */
+	G_MarkEdictDirty(targ);
+	G_FlightEvent(FLIGHT_DAMAGE, targ, attacker, damage);
+
 	/* friendly fire avoidance. If enabled you can't
 	   hurt teammates (but you can hurt yourself)
 	   knockback still occurs */
@@ -624,8 +633,7 @@ T_Damage(edict_t *targ, edict_t *inflictor, edict_t *attacker, vec3_t dir,
 	{
 		if (targ->pain_debounce_time < level.time)
 		{
-			gi.sound(targ, CHAN_ITEM, gi.soundindex(
-							"items/protect4.wav"), 1, ATTN_NORM, 0);
+			gi.sound(targ, CHAN_ITEM, G_SoundIndex(SND_PROTECT4), 1, ATTN_NORM, 0);
 			targ->pain_debounce_time = level.time + 2;
 		}
 
@@ -679,9 +687,11 @@ T_Damage(edict_t *targ, edict_t *inflictor, edict_t *attacker, vec3_t dir,
 	{
 		M_ReactToDamage(targ, attacker);
 
-		if (!(targ->monsterinfo.aiflags & (AI_DUCKED|AI_IGNORE_PAIN)) && (take))
+		if (!(G_MonsterInfo(targ)->aiflags & (AI_DUCKED|AI_IGNORE_PAIN)) && (take))
 		{
+			G_SpanBegin("pain", targ);
 			targ->pain(targ, attacker, knockback, take);
+			G_SpanEnd();
 
 			/* nightmare mode monsters don't go into pain frames often */
 			if (skill->value == SKILL_HARDPLUS)
@@ -694,14 +704,18 @@ T_Damage(edict_t *targ, edict_t *inflictor, edict_t *attacker, vec3_t dir,
 	{
 		if (!(targ->flags & FL_GODMODE) && (take))
 		{
+			G_SpanBegin("pain", targ);
 			targ->pain(targ, attacker, knockback, take);
+			G_SpanEnd();
 		}
 	}
 	else if (take)
 	{
 		if (targ->pain)
 		{
+			G_SpanBegin("pain", targ);
 			targ->pain(targ, attacker, knockback, take);
+			G_SpanEnd();
 		}
 	}
 
@@ -732,6 +746,8 @@ T_RadiusDamage(edict_t *inflictor, edict_t *attacker, float damage,
 		return;
 	}
 
+	G_SpanBegin("T_RadiusDamage", inflictor);
+
 	while ((ent = findradius(ent, inflictor->s.origin, radius)) != NULL)
 	{
 		if (ent == ignore)
@@ -765,4 +781,6 @@ T_RadiusDamage(edict_t *inflictor, edict_t *attacker, float damage,
 			}
 		}
 	}
+
+	G_SpanEnd();
 }
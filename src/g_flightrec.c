@@ -0,0 +1,282 @@
+/*
+ * =======================================================================
+ *
+ * Flight recorder for slow frames. While g_flightrec is set, thinks,
+ * touches, spawns, frees, damage and traces are recorded into a ring
+ * buffer. When G_RunFrame() takes longer than g_flightrec milliseconds
+ * the last g_flightrec_frames frames are written to a text file in
+ * the game directory, so rare spikes can be looked at afterwards.
+ *
+ * Events only keep pointers to the classnames. The ring is cleared
+ * whenever the level memory is freed.
+ *
+ * =======================================================================
+ */
+
+#include "header/local.h"
+
+#define FLIGHT_EVENTS 65536 /* must be a power of two */
+
+typedef struct
+{
+	long long time;
+	const char *classname;
+	const char *otherclass; /* the call site file for traces */
+	int frame;
+	int value;
+	short type;
+	short ent;
+	short other;
+} flightevent_t;
+
+static const char *flightnames[] = {
+	"frame",
+	"think",
+	"touch",
+	"spawn",
+	"free",
+	"damage",
+	"trace"
+};
+
+qboolean flightrec_active;
+
+static struct
+{
+	flightevent_t *events;
+	unsigned int head; /* events ever recorded, wraps */
+	unsigned int tail; /* oldest valid event */
+
+	unsigned int frameevent;
+	long long framestart;
+	int nextdump; /* no overlapping dumps */
+} flight;
+
+static void
+Flight_Add(flighttype_t type, const edict_t *ent, const edict_t *other,
+		const char *otherclass, int value)
+{
+	flightevent_t *ev;
+
+	ev = &flight.events[flight.head & (FLIGHT_EVENTS - 1)];
+
+	ev->time = Q_Nanoseconds();
+	ev->frame = level.framenum;
+	ev->type = type;
+	ev->value = value;
+	ev->ent = ent ? ent - g_edicts : -1;
+	ev->classname = ent ? ent->classname : NULL;
+	ev->other = other ? other - g_edicts : -1;
+	ev->otherclass = other ? other->classname : otherclass;
+
+	flight.head++;
+
+	if (flight.head - flight.tail > FLIGHT_EVENTS)
+	{
+		flight.tail = flight.head - FLIGHT_EVENTS;
+	}
+}
+
+/*
+ * Use G_FlightEvent(), it only
+ * calls here while recording.
+ */
+void
+G_FlightRecord(flighttype_t type, const edict_t *ent, const edict_t *other,
+		int value)
+{
+	Flight_Add(type, ent, other, NULL, value);
+}
+
+void
+G_FlightTrace(const char *file, int line, const edict_t *passent)
+{
+	Flight_Add(FLIGHT_TRACE, passent, NULL, file, line);
+}
+
+/* Called when the level memory is freed. */
+void
+G_FlightClear(void)
+{
+	flight.tail = flight.head;
+	flight.nextdump = 0;
+}
+
+void
+G_ShutdownFlight(void)
+{
+	free(flight.events);
+	memset(&flight, 0, sizeof(flight));
+	flightrec_active = false;
+}
+
+/* ====================================================================== */
+
+static const char *
+Flight_Class(const char *classname)
+{
+	return classname ? classname : "-";
+}
+
+static void
+Flight_WriteEvent(FILE *f, const flightevent_t *ev, long long start)
+{
+	fprintf(f, "%9.3f %-6s", (ev->time - start) / 1000000.0,
+			flightnames[ev->type]);
+
+	switch (ev->type)
+	{
+		case FLIGHT_TOUCH:
+			fprintf(f, " %i %s by %i %s\n", ev->ent, Flight_Class(ev->classname),
+					ev->other, Flight_Class(ev->otherclass));
+			break;
+		case FLIGHT_SPAWN:
+			fprintf(f, " %i by %i %s\n", ev->ent, ev->other,
+					Flight_Class(ev->otherclass));
+			break;
+		case FLIGHT_DAMAGE:
+			fprintf(f, " %i %s by %i %s, %i\n", ev->ent,
+					Flight_Class(ev->classname), ev->other,
+					Flight_Class(ev->otherclass), ev->value);
+			break;
+		case FLIGHT_TRACE:
+			fprintf(f, " %s:%i passent %i %s\n", G_CallSiteName(ev->otherclass),
+					ev->value, ev->ent, Flight_Class(ev->classname));
+			break;
+		default:
+			fprintf(f, " %i %s\n", ev->ent, Flight_Class(ev->classname));
+			break;
+	}
+}
+
+static void
+Flight_Dump(long long nsec)
+{
+	char name[MAX_OSPATH];
+	const flightevent_t *ev;
+	unsigned int i, start;
+	long long windowstart;
+	cvar_t *game;
+	int frames;
+	FILE *f;
+
+	frames = (g_flightrec_frames->value > 0) ? (int)g_flightrec_frames->value : 1;
+
+	/* back to the marker of the first frame to write */
+	for (start = flight.head; start != flight.tail; )
+	{
+		start--;
+
+		if ((flight.events[start & (FLIGHT_EVENTS - 1)].type == FLIGHT_FRAME) &&
+			(--frames == 0))
+		{
+			break;
+		}
+	}
+
+	game = gi.cvar("game", "", 0);
+
+	Com_sprintf(name, sizeof(name), "%s/slowframe_%s_%i.txt",
+			*game->string ? game->string : GAMEVERSION, level.mapname,
+			level.framenum);
+
+	f = Q_fopen(name, "w");
+
+	if (!f)
+	{
+		gi.dprintf("Couldn't write flight recorder to %s\n", name);
+		return;
+	}
+
+	fprintf(f, "# frame %i on %s took %lld.%03lld ms, threshold %g ms\n",
+			level.framenum, level.mapname, nsec / 1000000, (nsec / 1000) % 1000,
+			g_flightrec->value);
+	fprintf(f, "# %u events, times in ms since the first one\n",
+			flight.head - start);
+
+	windowstart = flight.events[start & (FLIGHT_EVENTS - 1)].time;
+
+	for (i = start; i != flight.head; i++)
+	{
+		ev = &flight.events[i & (FLIGHT_EVENTS - 1)];
+
+		if (ev->type == FLIGHT_FRAME)
+		{
+			fprintf(f, "\n--- frame %i, G_RunFrame %.3f ms\n", ev->frame,
+					ev->value / 1000.0);
+			continue;
+		}
+
+		Flight_WriteEvent(f, ev, windowstart);
+	}
+
+	fclose(f);
+
+	gi.dprintf("Frame %i took %lld ms, wrote the flight recorder to %s\n",
+			level.framenum, nsec / 1000000, name);
+}
+
+/*
+ * Starts or stops recording as g_flightrec says
+ * and marks the start of a frame. Called at the
+ * start of G_RunFrame().
+ */
+void
+G_FlightBeginFrame(void)
+{
+	flightrec_active = g_flightrec->value > 0;
+
+	if (!flightrec_active)
+	{
+		return;
+	}
+
+	if (!flight.events)
+	{
+		/* plain malloc(), survives the level */
+		flight.events = malloc(FLIGHT_EVENTS * sizeof(*flight.events));
+
+		if (!flight.events)
+		{
+			gi.dprintf("Couldn't allocate the flight recorder\n");
+			gi.cvar_forceset("g_flightrec", "0");
+			flightrec_active = false;
+			return;
+		}
+	}
+
+	flight.frameevent = flight.head;
+	flight.framestart = Q_Nanoseconds();
+
+	Flight_Add(FLIGHT_FRAME, NULL, NULL, NULL, 0);
+}
+
+/*
+ * Stores the frame time in the marker and
+ * writes the ring out if it was too slow.
+ */
+void
+G_FlightEndFrame(void)
+{
+	long long nsec;
+
+	if (!flightrec_active)
+	{
+		return;
+	}
+
+	nsec = Q_Nanoseconds() - flight.framestart;
+
+	if (flight.head - flight.frameevent < FLIGHT_EVENTS)
+	{
+		flight.events[flight.frameevent & (FLIGHT_EVENTS - 1)].value =
+			(int)(nsec / 1000);
+	}
+
+	if ((nsec > g_flightrec->value * 1000000) &&
+		(level.framenum >= flight.nextdump))
+	{
+		Flight_Dump(nsec);
+		flight.nextdump = level.framenum + (int)g_flightrec_frames->value;
+	}
+}
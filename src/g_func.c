@@ -62,9 +62,9 @@ Move_Done(edict_t *ent)
 
    VectorClear(ent->velocity);
 
-	if (ent->moveinfo.endfunc)
+	if (G_MoveInfo(ent)->endfunc)
 	{
-	   ent->moveinfo.endfunc(ent);
+	   G_MoveInfo(ent)->endfunc(ent);
 	}
 }
 
@@ -76,14 +76,14 @@ Move_Final(edict_t *ent)
 		return;
 	}
 
-	if (ent->moveinfo.remaining_distance == 0)
+	if (G_MoveInfo(ent)->remaining_distance == 0)
 	{
 		Move_Done(ent);
 		return;
 	}
 
-	VectorScale(ent->moveinfo.dir,
-			ent->moveinfo.remaining_distance / FRAMETIME,
+	VectorScale(G_MoveInfo(ent)->dir,
+			G_MoveInfo(ent)->remaining_distance / FRAMETIME,
 			ent->velocity);
 
 	ent->think = Move_Done;
@@ -100,16 +100,16 @@ Move_Begin(edict_t *ent)
 		return;
 	}
 
-	if ((ent->moveinfo.speed * FRAMETIME) >= ent->moveinfo.remaining_distance)
+	if ((G_MoveInfo(ent)->speed * FRAMETIME) >= G_MoveInfo(ent)->remaining_distance)
 	{
 		Move_Final(ent);
 		return;
 	}
 
-	VectorScale(ent->moveinfo.dir, ent->moveinfo.speed, ent->velocity);
-	frames = floor((ent->moveinfo.remaining_distance /
-			 ent->moveinfo.speed) / FRAMETIME);
-	ent->moveinfo.remaining_distance -= frames * ent->moveinfo.speed * FRAMETIME;
+	VectorScale(G_MoveInfo(ent)->dir, G_MoveInfo(ent)->speed, ent->velocity);
+	frames = floor((G_MoveInfo(ent)->remaining_distance /
+			 G_MoveInfo(ent)->speed) / FRAMETIME);
+	G_EnsureMoveInfo(ent)->remaining_distance -= frames * G_MoveInfo(ent)->speed * FRAMETIME;
 	ent->nextthink = level.time + (frames * FRAMETIME);
 	ent->think = Move_Final;
 }
@@ -117,20 +117,22 @@ Move_Begin(edict_t *ent)
 void Think_AccelMove(edict_t *ent);
 
 void
-Move_Calc(edict_t *ent, vec3_t dest, void (*func)(edict_t *))
+Move_Calc(edict_t *ent, const vec3_t dest, void (*func)(edict_t *))
 {
 	if (!ent || !func)
 	{
 		return;
 	}
 
+	G_MarkEdictDirty(ent);
+
 	VectorClear(ent->velocity);
-	VectorSubtract(dest, ent->s.origin, ent->moveinfo.dir);
-	ent->moveinfo.remaining_distance = VectorNormalize(ent->moveinfo.dir);
-	ent->moveinfo.endfunc = func;
+	VectorSubtract(dest, ent->s.origin, G_EnsureMoveInfo(ent)->dir);
+	G_EnsureMoveInfo(ent)->remaining_distance = VectorNormalize(G_EnsureMoveInfo(ent)->dir);
+	G_EnsureMoveInfo(ent)->endfunc = func;
 
-	if ((ent->moveinfo.speed == ent->moveinfo.accel) &&
-		(ent->moveinfo.speed == ent->moveinfo.decel))
+	if ((G_MoveInfo(ent)->speed == G_MoveInfo(ent)->accel) &&
+		(G_MoveInfo(ent)->speed == G_MoveInfo(ent)->decel))
 	{
 		if (level.current_entity ==
 			((ent->flags & FL_TEAMSLAVE) ? ent->teammaster : ent))
@@ -146,7 +148,7 @@ Move_Calc(edict_t *ent, vec3_t dest, void (*func)(edict_t *))
 	else
 	{
 		/* accelerative */
-		ent->moveinfo.current_speed = 0;
+		G_EnsureMoveInfo(ent)->current_speed = 0;
 		ent->think = Think_AccelMove;
 		ent->nextthink = level.time + FRAMETIME;
 	}
@@ -166,9 +168,9 @@ AngleMove_Done(edict_t *ent)
 
 	VectorClear(ent->avelocity);
 
-	if (ent->moveinfo.endfunc)
+	if (G_MoveInfo(ent)->endfunc)
 	{
-		ent->moveinfo.endfunc(ent);
+		G_MoveInfo(ent)->endfunc(ent);
 	}
 }
 
@@ -182,13 +184,13 @@ AngleMove_Final(edict_t *ent)
 		return;
 	}
 
-	if (ent->moveinfo.state == STATE_UP)
+	if (G_MoveInfo(ent)->state == STATE_UP)
 	{
-		VectorSubtract(ent->moveinfo.end_angles, ent->s.angles, move);
+		VectorSubtract(G_MoveInfo(ent)->end_angles, ent->s.angles, move);
 	}
 	else
 	{
-		VectorSubtract(ent->moveinfo.start_angles, ent->s.angles, move);
+		VectorSubtract(G_MoveInfo(ent)->start_angles, ent->s.angles, move);
 	}
 
 	if (VectorCompare(move, vec3_origin))
@@ -217,20 +219,20 @@ AngleMove_Begin(edict_t *ent)
 	}
 
 	/* set destdelta to the vector needed to move */
-	if (ent->moveinfo.state == STATE_UP)
+	if (G_MoveInfo(ent)->state == STATE_UP)
 	{
-		VectorSubtract(ent->moveinfo.end_angles, ent->s.angles, destdelta);
+		VectorSubtract(G_MoveInfo(ent)->end_angles, ent->s.angles, destdelta);
 	}
 	else
 	{
-		VectorSubtract(ent->moveinfo.start_angles, ent->s.angles, destdelta);
+		VectorSubtract(G_MoveInfo(ent)->start_angles, ent->s.angles, destdelta);
 	}
 
 	/* calculate length of vector */
 	len = VectorLength(destdelta);
 
 	/* divide by speed to get time to reach dest */
-	traveltime = len / ent->moveinfo.speed;
+	traveltime = len / G_MoveInfo(ent)->speed;
 
 	if (traveltime < FRAMETIME)
 	{
@@ -256,8 +258,10 @@ AngleMove_Calc(edict_t *ent, void (*func)(edict_t *))
 		return;
 	}
 
+	G_MarkEdictDirty(ent);
+
 	VectorClear(ent->avelocity);
-	ent->moveinfo.endfunc = func;
+	G_EnsureMoveInfo(ent)->endfunc = func;
 
 	if (level.current_entity ==
 		((ent->flags & FL_TEAMSLAVE) ? ent->teammaster : ent))
@@ -416,23 +420,23 @@ Think_AccelMove(edict_t *ent)
 		return;
 	}
 
-	ent->moveinfo.remaining_distance -= ent->moveinfo.current_speed;
+	G_EnsureMoveInfo(ent)->remaining_distance -= G_MoveInfo(ent)->current_speed;
 
-	if (ent->moveinfo.current_speed == 0) /* starting or blocked */
+	if (G_MoveInfo(ent)->current_speed == 0) /* starting or blocked */
 	{
-		plat_CalcAcceleratedMove(&ent->moveinfo);
+		plat_CalcAcceleratedMove(G_EnsureMoveInfo(ent));
 	}
 
-	plat_Accelerate(&ent->moveinfo);
+	plat_Accelerate(G_EnsureMoveInfo(ent));
 
 	/* will the entire move complete on next frame? */
-	if (ent->moveinfo.remaining_distance <= ent->moveinfo.current_speed)
+	if (G_MoveInfo(ent)->remaining_distance <= G_MoveInfo(ent)->current_speed)
 	{
 		Move_Final(ent);
 		return;
 	}
 
-	VectorScale(ent->moveinfo.dir, ent->moveinfo.current_speed * 10,
+	VectorScale(G_MoveInfo(ent)->dir, G_MoveInfo(ent)->current_speed * 10,
 			ent->velocity);
 	ent->nextthink = level.time + FRAMETIME;
 	ent->think = Think_AccelMove;
@@ -451,16 +455,16 @@ plat_hit_top(edict_t *ent)
 
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_end)
+		if (G_MoveInfo(ent)->sound_end)
 		{
 			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					ent->moveinfo.sound_end, 1, ATTN_STATIC, 0);
+					G_MoveInfo(ent)->sound_end, 1, ATTN_STATIC, 0);
 		}
 
 		ent->s.sound = 0;
 	}
 
-	ent->moveinfo.state = STATE_TOP;
+	G_EnsureMoveInfo(ent)->state = STATE_TOP;
 
 	ent->think = plat_go_down;
 	ent->nextthink = level.time + 3;
@@ -477,16 +481,16 @@ plat_hit_bottom(edict_t *ent)
 
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_end)
+		if (G_MoveInfo(ent)->sound_end)
 		{
-			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo.sound_end,
+			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, G_MoveInfo(ent)->sound_end,
 					1, ATTN_STATIC, 0);
 		}
 
 		ent->s.sound = 0;
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
+	G_EnsureMoveInfo(ent)->state = STATE_BOTTOM;
 }
 
 void
@@ -499,17 +503,17 @@ plat_go_down(edict_t *ent)
 
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_start)
+		if (G_MoveInfo(ent)->sound_start)
 		{
-			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo.sound_start,
+			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, G_MoveInfo(ent)->sound_start,
 					1, ATTN_STATIC, 0);
 		}
 
-		ent->s.sound = ent->moveinfo.sound_middle;
+		ent->s.sound = G_MoveInfo(ent)->sound_middle;
 	}
 
-	ent->moveinfo.state = STATE_DOWN;
-	Move_Calc(ent, ent->moveinfo.end_origin, plat_hit_bottom);
+	G_EnsureMoveInfo(ent)->state = STATE_DOWN;
+	Move_Calc(ent, G_MoveInfo(ent)->end_origin, plat_hit_bottom);
 }
 
 void
@@ -522,17 +526,17 @@ plat_go_up(edict_t *ent)
 
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_start)
+		if (G_MoveInfo(ent)->sound_start)
 		{
 			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					ent->moveinfo.sound_start, 1, ATTN_STATIC, 0);
+					G_MoveInfo(ent)->sound_start, 1, ATTN_STATIC, 0);
 		}
 
-		ent->s.sound = ent->moveinfo.sound_middle;
+		ent->s.sound = G_MoveInfo(ent)->sound_middle;
 	}
 
-	ent->moveinfo.state = STATE_UP;
-	Move_Calc(ent, ent->moveinfo.start_origin, plat_hit_top);
+	G_EnsureMoveInfo(ent)->state = STATE_UP;
+	Move_Calc(ent, G_MoveInfo(ent)->start_origin, plat_hit_top);
 }
 
 void
@@ -563,11 +567,11 @@ plat_blocked(edict_t *self, edict_t *other)
 	T_Damage(other, self, self, vec3_origin, other->s.origin,
 			vec3_origin, self->dmg, 1, 0, MOD_CRUSH);
 
-	if (self->moveinfo.state == STATE_UP)
+	if (G_MoveInfo(self)->state == STATE_UP)
 	{
 		plat_go_down(self);
 	}
-	else if (self->moveinfo.state == STATE_DOWN)
+	else if (G_MoveInfo(self)->state == STATE_DOWN)
 	{
 		plat_go_up(self);
 	}
@@ -592,8 +596,8 @@ Use_Plat(edict_t *ent, edict_t *other /* unused */, edict_t *activator /* unused
 void
 wait_and_change_think(edict_t* ent)
 {
-	void (*afterwaitfunc)(edict_t *) = ent->moveinfo.endfunc;
-	ent->moveinfo.endfunc = NULL;
+	void (*afterwaitfunc)(edict_t *) = G_MoveInfo(ent)->endfunc;
+	G_EnsureMoveInfo(ent)->endfunc = NULL;
 
 	if (afterwaitfunc)
 	{
@@ -615,7 +619,9 @@ wait_and_change(edict_t* ent, void (*afterwaitfunc)(edict_t *))
 	{
 		if(ent->nextthink == 0)
 		{
-			ent->moveinfo.endfunc = afterwaitfunc;
+			G_MarkEdictDirty(ent);
+
+			G_EnsureMoveInfo(ent)->endfunc = afterwaitfunc;
 			ent->think = wait_and_change_think;
 			ent->nextthink = level.time + waittime;
 		}
@@ -648,12 +654,13 @@ Touch_Plat_Center(edict_t *ent, edict_t *other, const cplane_t *plane /* unused
 
 	ent = ent->enemy; /* now point at the plat, not the trigger */
 
-	if (ent->moveinfo.state == STATE_BOTTOM)
+	if (G_MoveInfo(ent)->state == STATE_BOTTOM)
 	{
 		wait_and_change(ent, plat_go_up);
 	}
-	else if (ent->moveinfo.state == STATE_TOP)
+	else if (G_MoveInfo(ent)->state == STATE_TOP)
 	{
+		G_MarkEdictDirty(ent);
 		ent->nextthink = level.time + 1; /* the player is still on the plat, so delay going down */
 	}
 }
@@ -705,7 +712,7 @@ plat_spawn_inside_trigger(edict_t *ent)
 	VectorCopy(tmin, trigger->mins);
 	VectorCopy(tmax, trigger->maxs);
 
-	gi.linkentity(trigger);
+	G_LinkEntity(trigger);
 }
 
 /*
@@ -804,27 +811,27 @@ SP_func_plat(edict_t *ent)
 
 	if (ent->targetname)
 	{
-		ent->moveinfo.state = STATE_UP;
+		G_EnsureMoveInfo(ent)->state = STATE_UP;
 	}
 	else
 	{
 		VectorCopy(ent->pos2, ent->s.origin);
-		gi.linkentity(ent);
-		ent->moveinfo.state = STATE_BOTTOM;
+		G_LinkEntity(ent);
+		G_EnsureMoveInfo(ent)->state = STATE_BOTTOM;
 	}
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.end_angles);
+	G_EnsureMoveInfo(ent)->speed = ent->speed;
+	G_EnsureMoveInfo(ent)->accel = ent->accel;
+	G_EnsureMoveInfo(ent)->decel = ent->decel;
+	G_EnsureMoveInfo(ent)->wait = ent->wait;
+	VectorCopy(ent->pos1, G_EnsureMoveInfo(ent)->start_origin);
+	VectorCopy(ent->s.angles, G_EnsureMoveInfo(ent)->start_angles);
+	VectorCopy(ent->pos2, G_EnsureMoveInfo(ent)->end_origin);
+	VectorCopy(ent->s.angles, G_EnsureMoveInfo(ent)->end_angles);
 
-	ent->moveinfo.sound_start = gi.soundindex("plats/pt1_strt.wav");
-	ent->moveinfo.sound_middle = gi.soundindex("plats/pt1_mid.wav");
-	ent->moveinfo.sound_end = gi.soundindex("plats/pt1_end.wav");
+	G_EnsureMoveInfo(ent)->sound_start = gi.soundindex("plats/pt1_strt.wav");
+	G_EnsureMoveInfo(ent)->sound_middle = gi.soundindex("plats/pt1_mid.wav");
+	G_EnsureMoveInfo(ent)->sound_end = gi.soundindex("plats/pt1_end.wav");
 }
 
 /* ==================================================================== */
@@ -887,7 +894,7 @@ rotating_use(edict_t *self, edict_t *other /* unused */, edict_t *activator /* u
 	}
 	else
 	{
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = G_MoveInfo(self)->sound_middle;
 		VectorScale(self->movedir, self->speed, self->avelocity);
 
 		if (self->spawnflags & 16)
@@ -968,7 +975,7 @@ SP_func_rotating(edict_t *ent)
 	}
 
 	gi.setmodel(ent, ent->model);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ==================================================================== */
@@ -1005,7 +1012,7 @@ button_done(edict_t *self)
 		return;
 	}
 
-	self->moveinfo.state = STATE_BOTTOM;
+	G_EnsureMoveInfo(self)->state = STATE_BOTTOM;
 	self->s.effects &= ~EF_ANIM23;
 	self->s.effects |= EF_ANIM01;
 }
@@ -1018,9 +1025,9 @@ button_return(edict_t *self)
 		return;
 	}
 
-	self->moveinfo.state = STATE_DOWN;
+	G_EnsureMoveInfo(self)->state = STATE_DOWN;
 
-	Move_Calc(self, self->moveinfo.start_origin, button_done);
+	Move_Calc(self, G_MoveInfo(self)->start_origin, button_done);
 
 	self->s.frame = 0;
 
@@ -1039,16 +1046,16 @@ button_wait(edict_t *self)
 		return;
 	}
 
-	self->moveinfo.state = STATE_TOP;
+	G_EnsureMoveInfo(self)->state = STATE_TOP;
 	self->s.effects &= ~EF_ANIM01;
 	self->s.effects |= EF_ANIM23;
 
 	G_UseTargets(self, self->activator);
 	self->s.frame = 1;
 
-	if (self->moveinfo.wait >= 0)
+	if (G_MoveInfo(self)->wait >= 0)
 	{
-		self->nextthink = level.time + self->moveinfo.wait;
+		self->nextthink = level.time + G_MoveInfo(self)->wait;
 		self->think = button_return;
 	}
 }
@@ -1061,21 +1068,21 @@ button_fire(edict_t *self)
 		return;
 	}
 
-	if ((self->moveinfo.state == STATE_UP) ||
-		(self->moveinfo.state == STATE_TOP))
+	if ((G_MoveInfo(self)->state == STATE_UP) ||
+		(G_MoveInfo(self)->state == STATE_TOP))
 	{
 		return;
 	}
 
-	self->moveinfo.state = STATE_UP;
+	G_EnsureMoveInfo(self)->state = STATE_UP;
 
-	if (self->moveinfo.sound_start && !(self->flags & FL_TEAMSLAVE))
+	if (G_MoveInfo(self)->sound_start && !(self->flags & FL_TEAMSLAVE))
 	{
-		gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_start,
+		gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, G_MoveInfo(self)->sound_start,
 				1, ATTN_STATIC, 0);
 	}
 
-	Move_Calc(self, self->moveinfo.end_origin, button_wait);
+	Move_Calc(self, G_MoveInfo(self)->end_origin, button_wait);
 }
 
 void
@@ -1145,7 +1152,7 @@ SP_func_button(edict_t *ent)
 
 	if (ent->sounds != 1)
 	{
-		ent->moveinfo.sound_start = gi.soundindex("switches/butn2.wav");
+		G_EnsureMoveInfo(ent)->sound_start = gi.soundindex("switches/butn2.wav");
 	}
 
 	if (!ent->speed)
@@ -1195,18 +1202,18 @@ SP_func_button(edict_t *ent)
 		ent->touch = button_touch;
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
+	G_EnsureMoveInfo(ent)->state = STATE_BOTTOM;
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.end_angles);
+	G_EnsureMoveInfo(ent)->speed = ent->speed;
+	G_EnsureMoveInfo(ent)->accel = ent->accel;
+	G_EnsureMoveInfo(ent)->decel = ent->decel;
+	G_EnsureMoveInfo(ent)->wait = ent->wait;
+	VectorCopy(ent->pos1, G_EnsureMoveInfo(ent)->start_origin);
+	VectorCopy(ent->s.angles, G_EnsureMoveInfo(ent)->start_angles);
+	VectorCopy(ent->pos2, G_EnsureMoveInfo(ent)->end_origin);
+	VectorCopy(ent->s.angles, G_EnsureMoveInfo(ent)->end_angles);
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ==================================================================== */
@@ -1279,27 +1286,27 @@ door_hit_top(edict_t *self)
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_end)
+		if (G_MoveInfo(self)->sound_end)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_end, 1,
+					G_MoveInfo(self)->sound_end, 1,
 					ATTN_STATIC, 0);
 		}
 
 		self->s.sound = 0;
 	}
 
-	self->moveinfo.state = STATE_TOP;
+	G_EnsureMoveInfo(self)->state = STATE_TOP;
 
 	if (self->spawnflags & DOOR_TOGGLE)
 	{
 		return;
 	}
 
-	if (self->moveinfo.wait >= 0)
+	if (G_MoveInfo(self)->wait >= 0)
 	{
 		self->think = door_go_down;
-		self->nextthink = level.time + self->moveinfo.wait;
+		self->nextthink = level.time + G_MoveInfo(self)->wait;
 	}
 }
 
@@ -1314,17 +1321,17 @@ door_hit_bottom(edict_t *self)
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_end)
+		if (G_MoveInfo(self)->sound_end)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_end, 1,
+					G_MoveInfo(self)->sound_end, 1,
 					ATTN_STATIC, 0);
 		}
 
 		self->s.sound = 0;
 	}
 
-	self->moveinfo.state = STATE_BOTTOM;
+	G_EnsureMoveInfo(self)->state = STATE_BOTTOM;
 	door_use_areaportals(self, false);
 }
 
@@ -1338,14 +1345,14 @@ door_go_down(edict_t *self)
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
+		if (G_MoveInfo(self)->sound_start)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_start, 1,
+					G_MoveInfo(self)->sound_start, 1,
 					ATTN_STATIC, 0);
 		}
 
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = G_MoveInfo(self)->sound_middle;
 	}
 
 	if (self->max_health)
@@ -1354,11 +1361,11 @@ door_go_down(edict_t *self)
 		self->health = self->max_health;
 	}
 
-	self->moveinfo.state = STATE_DOWN;
+	G_EnsureMoveInfo(self)->state = STATE_DOWN;
 
 	if (strcmp(self->classname, "func_door") == 0)
 	{
-		Move_Calc(self, self->moveinfo.start_origin, door_hit_bottom);
+		Move_Calc(self, G_MoveInfo(self)->start_origin, door_hit_bottom);
 	}
 	else if (strcmp(self->classname, "func_door_rotating") == 0)
 	{
@@ -1374,17 +1381,18 @@ door_go_up(edict_t *self, edict_t *activator)
 		return;
 	}
 
-	if (self->moveinfo.state == STATE_UP)
+	if (G_MoveInfo(self)->state == STATE_UP)
 	{
 		return; /* already going up */
 	}
 
-	if (self->moveinfo.state == STATE_TOP)
+	if (G_MoveInfo(self)->state == STATE_TOP)
 	{
 		/* reset top wait time */
-		if (self->moveinfo.wait >= 0)
+		if (G_MoveInfo(self)->wait >= 0)
 		{
-			self->nextthink = level.time + self->moveinfo.wait;
+			G_MarkEdictDirty(self);
+			self->nextthink = level.time + G_MoveInfo(self)->wait;
 		}
 
 		return;
@@ -1392,21 +1400,21 @@ door_go_up(edict_t *self, edict_t *activator)
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
+		if (G_MoveInfo(self)->sound_start)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_start, 1,
+					G_MoveInfo(self)->sound_start, 1,
 					ATTN_STATIC, 0);
 		}
 
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = G_MoveInfo(self)->sound_middle;
 	}
 
-	self->moveinfo.state = STATE_UP;
+	G_EnsureMoveInfo(self)->state = STATE_UP;
 
 	if (strcmp(self->classname, "func_door") == 0)
 	{
-		Move_Calc(self, self->moveinfo.end_origin, door_hit_top);
+		Move_Calc(self, G_MoveInfo(self)->end_origin, door_hit_top);
 	}
 	else if (strcmp(self->classname, "func_door_rotating") == 0)
 	{
@@ -1434,8 +1442,8 @@ door_use(edict_t *self, edict_t *other /* unused */, edict_t *activator)
 
 	if (self->spawnflags & DOOR_TOGGLE)
 	{
-		if ((self->moveinfo.state == STATE_UP) ||
-			(self->moveinfo.state == STATE_TOP))
+		if ((G_MoveInfo(self)->state == STATE_UP) ||
+			(G_MoveInfo(self)->state == STATE_TOP))
 		{
 			/* trigger all paired doors */
 			for (ent = self; ent; ent = ent->teamchain)
@@ -1514,11 +1522,11 @@ Think_CalcMoveSpeed(edict_t *self)
 	}
 
 	/* find the smallest distance any member of the team will be moving */
-	min = fabs(self->moveinfo.distance);
+	min = fabs(G_MoveInfo(self)->distance);
 
 	for (ent = self->teamchain; ent; ent = ent->teamchain)
 	{
-		dist = fabs(ent->moveinfo.distance);
+		dist = fabs(G_MoveInfo(ent)->distance);
 
 		if (dist < min)
 		{
@@ -1526,33 +1534,33 @@ Think_CalcMoveSpeed(edict_t *self)
 		}
 	}
 
-	time = min / self->moveinfo.speed;
+	time = min / G_MoveInfo(self)->speed;
 
 	/* adjust speeds so they will all complete at the same time */
 	for (ent = self; ent; ent = ent->teamchain)
 	{
-		newspeed = fabs(ent->moveinfo.distance) / time;
-		ratio = newspeed / ent->moveinfo.speed;
+		newspeed = fabs(G_MoveInfo(ent)->distance) / time;
+		ratio = newspeed / G_MoveInfo(ent)->speed;
 
-		if (ent->moveinfo.accel == ent->moveinfo.speed)
+		if (G_MoveInfo(ent)->accel == G_MoveInfo(ent)->speed)
 		{
-			ent->moveinfo.accel = newspeed;
+			G_EnsureMoveInfo(ent)->accel = newspeed;
 		}
 		else
 		{
-			ent->moveinfo.accel *= ratio;
+			G_EnsureMoveInfo(ent)->accel *= ratio;
 		}
 
-		if (ent->moveinfo.decel == ent->moveinfo.speed)
+		if (G_MoveInfo(ent)->decel == G_MoveInfo(ent)->speed)
 		{
-			ent->moveinfo.decel = newspeed;
+			G_EnsureMoveInfo(ent)->decel = newspeed;
 		}
 		else
 		{
-			ent->moveinfo.decel *= ratio;
+			G_EnsureMoveInfo(ent)->decel *= ratio;
 		}
 
-		ent->moveinfo.speed = newspeed;
+		G_EnsureMoveInfo(ent)->speed = newspeed;
 	}
 }
 
@@ -1594,7 +1602,7 @@ Think_SpawnDoorTrigger(edict_t *ent)
 	other->solid = SOLID_TRIGGER;
 	other->movetype = MOVETYPE_NONE;
 	other->touch = Touch_DoorTrigger;
-	gi.linkentity(other);
+	G_LinkEntity(other);
 
 	if (ent->spawnflags & DOOR_START_OPEN)
 	{
@@ -1642,9 +1650,9 @@ door_blocked(edict_t *self, edict_t *other)
 	/* if a door has a negative wait, it would never
 	   come back if blocked, so let it just squash the
 	   object to death real fast */
-	if (self->moveinfo.wait >= 0)
+	if (G_MoveInfo(self)->wait >= 0)
 	{
-		if (self->moveinfo.state == STATE_DOWN)
+		if (G_MoveInfo(self)->state == STATE_DOWN)
 		{
 			for (ent = self->teammaster; ent; ent = ent->teamchain)
 			{
@@ -1701,7 +1709,7 @@ door_touch(edict_t *self, edict_t *other, const cplane_t *plane /* unused */, co
 
 	self->touch_debounce_time = level.time + 5.0;
 
-	gi.centerprintf(other, "%s", self->message);
+	G_CenterPrintf(other, "%s", self->message);
 	gi.sound(other, CHAN_AUTO, gi.soundindex("misc/talk1.wav"), 1, ATTN_NORM, 0);
 }
 
@@ -1717,9 +1725,9 @@ SP_func_door(edict_t *ent)
 
 	if (ent->sounds != 1)
 	{
-		ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-		ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-		ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+		G_EnsureMoveInfo(ent)->sound_start = gi.soundindex("doors/dr1_strt.wav");
+		G_EnsureMoveInfo(ent)->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+		G_EnsureMoveInfo(ent)->sound_end = gi.soundindex("doors/dr1_end.wav");
 	}
 
 	G_SetMovedir(ent->s.angles, ent->movedir);
@@ -1770,10 +1778,10 @@ SP_func_door(edict_t *ent)
 	abs_movedir[0] = fabs(ent->movedir[0]);
 	abs_movedir[1] = fabs(ent->movedir[1]);
 	abs_movedir[2] = fabs(ent->movedir[2]);
-	ent->moveinfo.distance = abs_movedir[0] * ent->size[0] + abs_movedir[1] *
+	G_EnsureMoveInfo(ent)->distance = abs_movedir[0] * ent->size[0] + abs_movedir[1] *
 							 ent->size[1] + abs_movedir[2] * ent->size[2] -
 							 st.lip;
-	VectorMA(ent->pos1, ent->moveinfo.distance, ent->movedir, ent->pos2);
+	VectorMA(ent->pos1, G_MoveInfo(ent)->distance, ent->movedir, ent->pos2);
 
 	/* if it starts open, switch the positions */
 	if (ent->spawnflags & DOOR_START_OPEN)
@@ -1783,7 +1791,7 @@ SP_func_door(edict_t *ent)
 		VectorCopy(ent->s.origin, ent->pos1);
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
+	G_EnsureMoveInfo(ent)->state = STATE_BOTTOM;
 
 	if (ent->health)
 	{
@@ -1797,14 +1805,14 @@ SP_func_door(edict_t *ent)
 		ent->touch = door_touch;
 	}
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.end_angles);
+	G_EnsureMoveInfo(ent)->speed = ent->speed;
+	G_EnsureMoveInfo(ent)->accel = ent->accel;
+	G_EnsureMoveInfo(ent)->decel = ent->decel;
+	G_EnsureMoveInfo(ent)->wait = ent->wait;
+	VectorCopy(ent->pos1, G_EnsureMoveInfo(ent)->start_origin);
+	VectorCopy(ent->s.angles, G_EnsureMoveInfo(ent)->start_angles);
+	VectorCopy(ent->pos2, G_EnsureMoveInfo(ent)->end_origin);
+	VectorCopy(ent->s.angles, G_EnsureMoveInfo(ent)->end_angles);
 
 	if (ent->spawnflags & 16)
 	{
@@ -1822,7 +1830,7 @@ SP_func_door(edict_t *ent)
 		ent->teammaster = ent;
 	}
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	ent->nextthink = level.time + FRAMETIME;
 
@@ -1909,7 +1917,7 @@ SP_func_door_rotating(edict_t *ent)
 
 	VectorCopy(ent->s.angles, ent->pos1);
 	VectorMA(ent->s.angles, st.distance, ent->movedir, ent->pos2);
-	ent->moveinfo.distance = st.distance;
+	G_EnsureMoveInfo(ent)->distance = st.distance;
 
 	ent->movetype = MOVETYPE_PUSH;
 	ent->solid = SOLID_BSP;
@@ -1945,9 +1953,9 @@ SP_func_door_rotating(edict_t *ent)
 
 	if (ent->sounds != 1)
 	{
-		ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-		ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-		ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+		G_EnsureMoveInfo(ent)->sound_start = gi.soundindex("doors/dr1_strt.wav");
+		G_EnsureMoveInfo(ent)->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+		G_EnsureMoveInfo(ent)->sound_end = gi.soundindex("doors/dr1_end.wav");
 	}
 
 	/* if it starts open, switch the positions */
@@ -1972,15 +1980,15 @@ SP_func_door_rotating(edict_t *ent)
 		ent->touch = door_touch;
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy(ent->s.origin, ent->moveinfo.start_origin);
-	VectorCopy(ent->pos1, ent->moveinfo.start_angles);
-	VectorCopy(ent->s.origin, ent->moveinfo.end_origin);
-	VectorCopy(ent->pos2, ent->moveinfo.end_angles);
+	G_EnsureMoveInfo(ent)->state = STATE_BOTTOM;
+	G_EnsureMoveInfo(ent)->speed = ent->speed;
+	G_EnsureMoveInfo(ent)->accel = ent->accel;
+	G_EnsureMoveInfo(ent)->decel = ent->decel;
+	G_EnsureMoveInfo(ent)->wait = ent->wait;
+	VectorCopy(ent->s.origin, G_EnsureMoveInfo(ent)->start_origin);
+	VectorCopy(ent->pos1, G_EnsureMoveInfo(ent)->start_angles);
+	VectorCopy(ent->s.origin, G_EnsureMoveInfo(ent)->end_origin);
+	VectorCopy(ent->pos2, G_EnsureMoveInfo(ent)->end_angles);
 
 	if (ent->spawnflags & 16)
 	{
@@ -1993,7 +2001,7 @@ SP_func_door_rotating(edict_t *ent)
 		ent->teammaster = ent;
 	}
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	ent->nextthink = level.time + FRAMETIME;
 
@@ -2049,8 +2057,8 @@ SP_func_water(edict_t *self)
 
 		case 1: /* water */
 		case 2: /* lava */
-			self->moveinfo.sound_start = gi.soundindex("world/mov_watr.wav");
-			self->moveinfo.sound_end = gi.soundindex("world/stp_watr.wav");
+			G_EnsureMoveInfo(self)->sound_start = gi.soundindex("world/mov_watr.wav");
+			G_EnsureMoveInfo(self)->sound_end = gi.soundindex("world/stp_watr.wav");
 			break;
 	}
 
@@ -2059,10 +2067,10 @@ SP_func_water(edict_t *self)
 	abs_movedir[0] = fabs(self->movedir[0]);
 	abs_movedir[1] = fabs(self->movedir[1]);
 	abs_movedir[2] = fabs(self->movedir[2]);
-	self->moveinfo.distance = abs_movedir[0] * self->size[0] + abs_movedir[1] *
+	G_EnsureMoveInfo(self)->distance = abs_movedir[0] * self->size[0] + abs_movedir[1] *
 							  self->size[1] + abs_movedir[2] * self->size[2] -
 							  st.lip;
-	VectorMA(self->pos1, self->moveinfo.distance, self->movedir, self->pos2);
+	VectorMA(self->pos1, G_MoveInfo(self)->distance, self->movedir, self->pos2);
 
 	/* if it starts open, switch the positions */
 	if (self->spawnflags & DOOR_START_OPEN)
@@ -2072,26 +2080,26 @@ SP_func_water(edict_t *self)
 		VectorCopy(self->s.origin, self->pos1);
 	}
 
-	VectorCopy(self->pos1, self->moveinfo.start_origin);
-	VectorCopy(self->s.angles, self->moveinfo.start_angles);
-	VectorCopy(self->pos2, self->moveinfo.end_origin);
-	VectorCopy(self->s.angles, self->moveinfo.end_angles);
+	VectorCopy(self->pos1, G_EnsureMoveInfo(self)->start_origin);
+	VectorCopy(self->s.angles, G_EnsureMoveInfo(self)->start_angles);
+	VectorCopy(self->pos2, G_EnsureMoveInfo(self)->end_origin);
+	VectorCopy(self->s.angles, G_EnsureMoveInfo(self)->end_angles);
 
-	self->moveinfo.state = STATE_BOTTOM;
+	G_EnsureMoveInfo(self)->state = STATE_BOTTOM;
 
 	if (!self->speed)
 	{
 		self->speed = 25;
 	}
 
-	self->moveinfo.accel = self->moveinfo.decel = self->moveinfo.speed = self->speed;
+	G_EnsureMoveInfo(self)->accel = G_EnsureMoveInfo(self)->decel = G_EnsureMoveInfo(self)->speed = self->speed;
 
 	if (!self->wait)
 	{
 		self->wait = -1;
 	}
 
-	self->moveinfo.wait = self->wait;
+	G_EnsureMoveInfo(self)->wait = self->wait;
 
 	self->use = door_use;
 
@@ -2102,7 +2110,7 @@ SP_func_water(edict_t *self)
 
 	self->classname = "func_door";
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ==================================================================== */
@@ -2196,11 +2204,11 @@ train_wait(edict_t *self)
 		}
 	}
 
-	if (self->moveinfo.wait)
+	if (G_MoveInfo(self)->wait)
 	{
-		if (self->moveinfo.wait > 0)
+		if (G_MoveInfo(self)->wait > 0)
 		{
-			self->nextthink = level.time + self->moveinfo.wait;
+			self->nextthink = level.time + G_MoveInfo(self)->wait;
 			self->think = train_next;
 		}
 		else if (self->spawnflags & TRAIN_TOGGLE)
@@ -2213,10 +2221,10 @@ train_wait(edict_t *self)
 
 		if (!(self->flags & FL_TEAMSLAVE))
 		{
-			if (self->moveinfo.sound_end)
+			if (G_MoveInfo(self)->sound_end)
 			{
 				gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-						self->moveinfo.sound_end, 1,
+						G_MoveInfo(self)->sound_end, 1,
 						ATTN_STATIC, 0);
 			}
 
@@ -2274,29 +2282,29 @@ again:
 		VectorSubtract(ent->s.origin, self->mins, self->s.origin);
 		VectorCopy(self->s.origin, self->s.old_origin);
 		self->s.event = EV_OTHER_TELEPORT;
-		gi.linkentity(self);
+		G_LinkEntity(self);
 		goto again;
 	}
 
-	self->moveinfo.wait = ent->wait;
+	G_EnsureMoveInfo(self)->wait = ent->wait;
 	self->target_ent = ent;
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
+		if (G_MoveInfo(self)->sound_start)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_start, 1,
+					G_MoveInfo(self)->sound_start, 1,
 					ATTN_STATIC, 0);
 		}
 
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = G_MoveInfo(self)->sound_middle;
 	}
 
 	VectorSubtract(ent->s.origin, self->mins, dest);
-	self->moveinfo.state = STATE_TOP;
-	VectorCopy(self->s.origin, self->moveinfo.start_origin);
-	VectorCopy(dest, self->moveinfo.end_origin);
+	G_EnsureMoveInfo(self)->state = STATE_TOP;
+	VectorCopy(self->s.origin, G_EnsureMoveInfo(self)->start_origin);
+	VectorCopy(dest, G_EnsureMoveInfo(self)->end_origin);
 	Move_Calc(self, dest, train_wait);
 	self->spawnflags |= TRAIN_START_ON;
 }
@@ -2315,9 +2323,9 @@ train_resume(edict_t *self)
 	ent = self->target_ent;
 
 	VectorSubtract(ent->s.origin, self->mins, dest);
-	self->moveinfo.state = STATE_TOP;
-	VectorCopy(self->s.origin, self->moveinfo.start_origin);
-	VectorCopy(dest, self->moveinfo.end_origin);
+	G_EnsureMoveInfo(self)->state = STATE_TOP;
+	VectorCopy(self->s.origin, G_EnsureMoveInfo(self)->start_origin);
+	VectorCopy(dest, G_EnsureMoveInfo(self)->end_origin);
 	Move_Calc(self, dest, train_wait);
 	self->spawnflags |= TRAIN_START_ON;
 }
@@ -2349,7 +2357,7 @@ func_train_find(edict_t *self)
 	self->target = ent->target;
 
 	VectorSubtract(ent->s.origin, self->mins, self->s.origin);
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	/* if not triggered, start immediately */
 	if (!self->targetname)
@@ -2429,7 +2437,7 @@ SP_func_train(edict_t *self)
 
 	if (st.noise)
 	{
-		self->moveinfo.sound_middle = gi.soundindex(st.noise);
+		G_EnsureMoveInfo(self)->sound_middle = gi.soundindex(st.noise);
 	}
 
 	if (!self->speed)
@@ -2437,12 +2445,12 @@ SP_func_train(edict_t *self)
 		self->speed = 100;
 	}
 
-	self->moveinfo.speed = self->speed;
-	self->moveinfo.accel = self->moveinfo.decel = self->moveinfo.speed;
+	G_EnsureMoveInfo(self)->speed = self->speed;
+	G_EnsureMoveInfo(self)->accel = G_EnsureMoveInfo(self)->decel = G_EnsureMoveInfo(self)->speed;
 
 	self->use = train_use;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	if (self->target)
 	{
@@ -2696,7 +2704,7 @@ SP_func_conveyor(edict_t *self)
 
 	gi.setmodel(self, self->model);
 	self->solid = SOLID_BSP;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ==================================================================== */
@@ -2902,9 +2910,9 @@ SP_func_door_secret(edict_t *ent)
 		return;
 	}
 
-	ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-	ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-	ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+	G_EnsureMoveInfo(ent)->sound_start = gi.soundindex("doors/dr1_strt.wav");
+	G_EnsureMoveInfo(ent)->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+	G_EnsureMoveInfo(ent)->sound_end = gi.soundindex("doors/dr1_end.wav");
 
 	ent->movetype = MOVETYPE_PUSH;
 	ent->solid = SOLID_BSP;
@@ -2930,7 +2938,7 @@ SP_func_door_secret(edict_t *ent)
 		ent->wait = 5;
 	}
 
-	ent->moveinfo.accel = ent->moveinfo.decel = ent->moveinfo.speed = 50;
+	G_EnsureMoveInfo(ent)->accel = G_EnsureMoveInfo(ent)->decel = G_EnsureMoveInfo(ent)->speed = 50;
 
 	/* calculate positions */
 	AngleVectors(ent->s.angles, forward, right, up);
@@ -2973,7 +2981,7 @@ SP_func_door_secret(edict_t *ent)
 
 	ent->classname = "func_door";
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ==================================================================== */
@@ -3040,7 +3048,7 @@ rotating_light_alarm(edict_t *self)
 	else
 	{
 		gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-				self->moveinfo.sound_start, 1,
+				G_MoveInfo(self)->sound_start, 1,
 				ATTN_STATIC, 0);
 		self->nextthink = level.time + 1;
 	}
@@ -3056,13 +3064,13 @@ rotating_light_killed(edict_t *self, edict_t *inflictor /* unused */,
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_WELDING_SPARKS);
-	gi.WriteByte(30);
-	gi.WritePosition(self->s.origin);
-	gi.WriteDir(vec3_origin);
-	gi.WriteByte(0xe0 + (randk() & 7));
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_WELDING_SPARKS);
+	G_WriteByte(30);
+	G_WritePosition(self->s.origin);
+	G_WriteDir(vec3_origin);
+	G_WriteByte(0xe0 + (G_RandInt(RAND_EFFECT) & 7));
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	self->s.effects &= ~EF_SPINNINGLIGHTS;
 	self->use = NULL;
@@ -3145,10 +3153,10 @@ SP_rotating_light(edict_t *self)
 
 	if (self->spawnflags & 2)
 	{
-		self->moveinfo.sound_start = gi.soundindex("misc/alarm.wav");
+		G_EnsureMoveInfo(self)->sound_start = gi.soundindex("misc/alarm.wav");
 	}
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /*
@@ -3173,13 +3181,13 @@ object_repair_fx(edict_t *ent)
 	}
 	else
 	{
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_WELDING_SPARKS);
-		gi.WriteByte(10);
-		gi.WritePosition(ent->s.origin);
-		gi.WriteDir(vec3_origin);
-		gi.WriteByte(0xe0 + (randk() & 7));
-		gi.multicast(ent->s.origin, MULTICAST_PVS);
+		G_WriteByte(svc_temp_entity);
+		G_WriteByte(TE_WELDING_SPARKS);
+		G_WriteByte(10);
+		G_WritePosition(ent->s.origin);
+		G_WriteDir(vec3_origin);
+		G_WriteByte(0xe0 + (G_RandInt(RAND_EFFECT) & 7));
+		G_Multicast(ent->s.origin, MULTICAST_PVS);
 	}
 }
 
@@ -3213,13 +3221,13 @@ object_repair_sparks(edict_t *ent)
 
 	ent->nextthink = level.time + ent->delay;
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_WELDING_SPARKS);
-	gi.WriteByte(10);
-	gi.WritePosition(ent->s.origin);
-	gi.WriteDir(vec3_origin);
-	gi.WriteByte(0xe0 + (randk() & 7));
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_WELDING_SPARKS);
+	G_WriteByte(10);
+	G_WritePosition(ent->s.origin);
+	G_WriteDir(vec3_origin);
+	G_WriteByte(0xe0 + (G_RandInt(RAND_EFFECT) & 7));
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 }
 
 void
@@ -3242,6 +3250,6 @@ SP_object_repair(edict_t *ent)
 		ent->delay = 1.0;
 	}
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
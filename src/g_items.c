@@ -24,6 +24,8 @@
  * =======================================================================
  */
 
+#include <ctype.h>
+
 #include "header/local.h"
 
 #define HEALTH_IGNORE_MAX 1
@@ -71,29 +73,79 @@ GetWeaponAmmoIndex(const gitem_t *weap)
 	return 0;
 }
 
-gitem_t *
-FindItemByClassname(const char *classname)
+/*
+ * Items are looked up by name from console
+ * commands and entity spawning. To avoid
+ * scanning the whole itemlist each time,
+ * the names are hashed by InitItems().
+ */
+#define ITEM_HASH_SIZE 128 /* power of 2, > 2 * IT_TOTAL */
+
+static byte item_hash_classname[ITEM_HASH_SIZE];
+static byte item_hash_pickup[ITEM_HASH_SIZE];
+
+static unsigned int
+ItemHashName(const char *name)
 {
-	int i;
-	gitem_t *it;
+	unsigned int hash = 2166136261u;
 
-	if (!classname)
+	/* case insensitive FNV-1a */
+	while (*name)
 	{
-		return NULL;
+		hash ^= (byte)tolower((byte)*name);
+		hash *= 16777619u;
+		name++;
+	}
+
+	return hash & (ITEM_HASH_SIZE - 1);
+}
+
+static const char *
+ItemHashKey(const byte *table, int index)
+{
+	if (table == item_hash_classname)
+	{
+		return itemlist[index].classname;
 	}
 
-	it = itemlist;
+	return itemlist[index].pickup_name;
+}
+
+static void
+ItemHashInsert(byte *table, int index)
+{
+	const char *name;
+	unsigned int h;
 
-	for (i = 0; i < itemlist_len; i++, it++)
+	name = ItemHashKey(table, index);
+
+	if (!name)
+	{
+		return;
+	}
+
+	for (h = ItemHashName(name); table[h]; h = (h + 1) & (ITEM_HASH_SIZE - 1))
 	{
-		if (!it->classname)
+		/* keep the first item with that name */
+		if (!Q_stricmp(ItemHashKey(table, table[h]), name))
 		{
-			continue;
+			return;
 		}
+	}
+
+	table[h] = index;
+}
 
-		if (!Q_stricmp(it->classname, classname))
+static gitem_t *
+ItemHashFind(const byte *table, const char *name)
+{
+	unsigned int h;
+
+	for (h = ItemHashName(name); table[h]; h = (h + 1) & (ITEM_HASH_SIZE - 1))
+	{
+		if (!Q_stricmp(ItemHashKey(table, table[h]), name))
 		{
-			return it;
+			return &itemlist[table[h]];
 		}
 	}
 
@@ -101,32 +153,25 @@ FindItemByClassname(const char *classname)
 }
 
 gitem_t *
-FindItem(const char *pickup_name)
+FindItemByClassname(const char *classname)
 {
-	int i;
-	gitem_t *it;
-
-	if (!pickup_name)
+	if (!classname)
 	{
 		return NULL;
 	}
 
-	it = itemlist;
+	return ItemHashFind(item_hash_classname, classname);
+}
 
-	for (i = 0; i < itemlist_len; i++, it++)
+gitem_t *
+FindItem(const char *pickup_name)
+{
+	if (!pickup_name)
 	{
-		if (!it->pickup_name)
-		{
-			continue;
-		}
-
-		if (!Q_stricmp(it->pickup_name, pickup_name))
-		{
-			return it;
-		}
+		return NULL;
 	}
 
-	return NULL;
+	return ItemHashFind(item_hash_pickup, pickup_name);
 }
 
 /* ====================================================================== */
@@ -151,7 +196,7 @@ DoRespawn(edict_t *ent)
 		{
 		}
 
-		choice = count ? randk() % count : 0;
+		choice = count ? G_RandInt(RAND_SPAWN) % count : 0;
 
 		for (count = 0, ent = master; count < choice; ent = ent->chain, count++)
 		{
@@ -165,7 +210,7 @@ DoRespawn(edict_t *ent)
 
 	ent->svflags &= ~SVF_NOCLIENT;
 	ent->solid = SOLID_TRIGGER;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	/* send an effect */
 	ent->s.event = EV_ITEM_RESPAWN;
@@ -184,7 +229,7 @@ SetRespawn(edict_t *ent, float delay)
 	ent->solid = SOLID_NOT;
 	ent->nextthink = level.time + delay;
 	ent->think = DoRespawn;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ====================================================================== */
@@ -320,7 +365,7 @@ Pickup_Bandolier(edict_t *ent, edict_t *other)
 		other->client->pers.max_magslug = 75;
 	}
 
-	item = FindItem("Bullets");
+	item = ITEM_BY_ID(IT_AMMO_BULLETS);
 
 	if (item)
 	{
@@ -335,7 +380,7 @@ Pickup_Bandolier(edict_t *ent, edict_t *other)
 		}
 	}
 
-	item = FindItem("Shells");
+	item = ITEM_BY_ID(IT_AMMO_SHELLS);
 
 	if (item)
 	{
@@ -404,7 +449,7 @@ Pickup_Pack(edict_t *ent, edict_t *other)
 		other->client->pers.max_magslug = 100;
 	}
 
-	item = FindItem("Bullets");
+	item = ITEM_BY_ID(IT_AMMO_BULLETS);
 
 	if (item)
 	{
@@ -419,7 +464,7 @@ Pickup_Pack(edict_t *ent, edict_t *other)
 		}
 	}
 
-	item = FindItem("Shells");
+	item = ITEM_BY_ID(IT_AMMO_SHELLS);
 
 	if (item)
 	{
@@ -434,7 +479,7 @@ Pickup_Pack(edict_t *ent, edict_t *other)
 		}
 	}
 
-	item = FindItem("Cells");
+	item = ITEM_BY_ID(IT_AMMO_CELLS);
 
 	if (item)
 	{
@@ -449,7 +494,7 @@ Pickup_Pack(edict_t *ent, edict_t *other)
 		}
 	}
 
-	item = FindItem("Grenades");
+	item = ITEM_BY_ID(IT_AMMO_GRENADES);
 
 	if (item)
 	{
@@ -464,7 +509,7 @@ Pickup_Pack(edict_t *ent, edict_t *other)
 		}
 	}
 
-	item = FindItem("Rockets");
+	item = ITEM_BY_ID(IT_AMMO_ROCKETS);
 
 	if (item)
 	{
@@ -479,7 +524,7 @@ Pickup_Pack(edict_t *ent, edict_t *other)
 		}
 	}
 
-	item = FindItem("Slugs");
+	item = ITEM_BY_ID(IT_AMMO_SLUGS);
 
 	if (item)
 	{
@@ -494,7 +539,7 @@ Pickup_Pack(edict_t *ent, edict_t *other)
 		}
 	}
 
-	item = FindItem("Mag Slug");
+	item = ITEM_BY_ID(IT_AMMO_MAGSLUG);
 
 	if (item)
 	{
@@ -551,7 +596,7 @@ Use_Quad(edict_t *ent, const gitem_t *item)
 		ent->client->quad_framenum = level.framenum + timeout;
 	}
 
-	gi.sound(ent, CHAN_ITEM, gi.soundindex("items/damage.wav"), 1, ATTN_NORM, 0);
+	gi.sound(ent, CHAN_ITEM, G_SoundIndex(SND_DAMAGE), 1, ATTN_NORM, 0);
 }
 
 /* ===================================================================== */
@@ -588,7 +633,7 @@ Use_QuadFire(edict_t *ent, const gitem_t *item)
 		ent->client->quadfire_framenum = level.framenum + timeout;
 	}
 
-	gi.sound(ent, CHAN_ITEM, gi.soundindex("items/quadfire1.wav"), 1, ATTN_NORM, 0);
+	gi.sound(ent, CHAN_ITEM, G_SoundIndex(SND_QUADFIRE1), 1, ATTN_NORM, 0);
 }
 
 /* ====================================================================== */
@@ -659,7 +704,7 @@ Use_Invulnerability(edict_t *ent, const gitem_t *item)
 		ent->client->invincible_framenum = level.framenum + 300;
 	}
 
-	gi.sound(ent, CHAN_ITEM, gi.soundindex("items/protect.wav"), 1, ATTN_NORM, 0);
+	gi.sound(ent, CHAN_ITEM, G_SoundIndex(SND_PROTECT), 1, ATTN_NORM, 0);
 }
 
 /* ====================================================================== */
@@ -823,7 +868,7 @@ Pickup_Ammo(edict_t *ent, edict_t *other)
 	{
 		if ((other->client->pers.weapon != ent->item) &&
 			(!deathmatch->value ||
-			 (other->client->pers.weapon == FindItem("blaster"))))
+			 (other->client->pers.weapon == ITEM_BY_ID(IT_WEAPON_BLASTER))))
 		{
 			other->client->newweapon = ent->item;
 		}
@@ -866,7 +911,7 @@ Drop_Ammo(edict_t *ent, const gitem_t *item)
 		(item->tag == AMMO_GRENADES) &&
 		(ent->client->pers.inventory[index] - dropped->count <= 0))
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Can't drop current weapon\n");
+		G_CPrintf(ent, PRINT_HIGH, "Can't drop current weapon\n");
 		G_FreeEdict(dropped);
 		return;
 	}
@@ -1127,24 +1172,22 @@ Use_PowerArmor(edict_t *ent, const gitem_t *item)
 	if (ent->flags & FL_POWER_ARMOR)
 	{
 		ent->flags &= ~FL_POWER_ARMOR;
-		gi.sound(ent, CHAN_AUTO, gi.soundindex(
-						"misc/power2.wav"), 1, ATTN_NORM, 0);
+		gi.sound(ent, CHAN_AUTO, G_SoundIndex(SND_POWER2), 1, ATTN_NORM, 0);
 	}
 	else
 	{
 		int index;
 
-		index = ITEM_INDEX(FindItem("cells"));
+		index = IT_AMMO_CELLS;
 
 		if (!ent->client->pers.inventory[index])
 		{
-			gi.cprintf(ent, PRINT_HIGH, "No cells for power armor.\n");
+			G_CPrintf(ent, PRINT_HIGH, "No cells for power armor.\n");
 			return;
 		}
 
 		ent->flags |= FL_POWER_ARMOR;
-		gi.sound(ent, CHAN_AUTO, gi.soundindex(
-						"misc/power1.wav"), 1, ATTN_NORM, 0);
+		gi.sound(ent, CHAN_AUTO, G_SoundIndex(SND_POWER1), 1, ATTN_NORM, 0);
 	}
 }
 
@@ -1250,23 +1293,19 @@ Touch_Item(edict_t *ent, edict_t *other, const cplane_t *plane /* unused */,
 		{
 			if (ent->count == 2)
 			{
-				gi.sound(other, CHAN_ITEM, gi.soundindex(
-								"items/s_health.wav"), 1, ATTN_NORM, 0);
+				gi.sound(other, CHAN_ITEM, G_SoundIndex(SND_S_HEALTH), 1, ATTN_NORM, 0);
 			}
 			else if (ent->count == 10)
 			{
-				gi.sound(other, CHAN_ITEM, gi.soundindex(
-								"items/n_health.wav"), 1, ATTN_NORM, 0);
+				gi.sound(other, CHAN_ITEM, G_SoundIndex(SND_N_HEALTH), 1, ATTN_NORM, 0);
 			}
 			else if (ent->count == 25)
 			{
-				gi.sound(other, CHAN_ITEM, gi.soundindex(
-								"items/l_health.wav"), 1, ATTN_NORM, 0);
+				gi.sound(other, CHAN_ITEM, G_SoundIndex(SND_L_HEALTH), 1, ATTN_NORM, 0);
 			}
 			else
 			{
-				gi.sound(other, CHAN_ITEM, gi.soundindex(
-								"items/m_health.wav"), 1, ATTN_NORM, 0);
+				gi.sound(other, CHAN_ITEM, G_SoundIndex(SND_M_HEALTH), 1, ATTN_NORM, 0);
 			}
 		}
 		else if (ent->item->pickup_sound)
@@ -1390,13 +1429,13 @@ Drop_Item(edict_t *ent, const gitem_t *item)
 	dropped->s.effects = item->world_model_flags;
 	dropped->s.renderfx = RF_GLOW;
 
-	if (frandk() > 0.5)
+	if (G_Random(RAND_SPAWN) > 0.5)
 	{
-		dropped->s.angles[1] += frandk()*45;
+		dropped->s.angles[1] += G_Random(RAND_SPAWN)*45;
 	}
 	else
 	{
-		dropped->s.angles[1] -= frandk()*45;
+		dropped->s.angles[1] -= G_Random(RAND_SPAWN)*45;
 	}
 
 	VectorSet(dropped->mins, -16, -16, -16);
@@ -1416,7 +1455,7 @@ Drop_Item(edict_t *ent, const gitem_t *item)
 		VectorSet(offset, 24, 0, -16);
 		G_ProjectSource(ent->s.origin, offset, forward, right,
 				dropped->s.origin);
-		trace = gi.trace(ent->s.origin, dropped->mins, dropped->maxs,
+		trace = G_Trace(ent->s.origin, dropped->mins, dropped->maxs,
 				dropped->s.origin, ent, CONTENTS_SOLID);
 		VectorCopy(trace.endpos, dropped->s.origin);
 	}
@@ -1432,7 +1471,7 @@ Drop_Item(edict_t *ent, const gitem_t *item)
 	dropped->think = drop_make_touchable;
 	dropped->nextthink = level.time + 1;
 
-	gi.linkentity(dropped);
+	G_LinkEntity(dropped);
 
 	return dropped;
 }
@@ -1459,7 +1498,7 @@ Use_Item(edict_t *ent, edict_t *other /* unused */, edict_t *activator /* unused
 		ent->touch = Touch_Item;
 	}
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ====================================================================== */
@@ -1497,7 +1536,7 @@ droptofloor(edict_t *ent)
 	v = tv(0, 0, -128);
 	VectorAdd(ent->s.origin, v, dest);
 
-	tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, dest, ent, MASK_SOLID);
+	tr = G_Trace(ent->s.origin, ent->mins, ent->maxs, dest, ent, MASK_SOLID);
 
 	if (tr.startsolid)
 	{
@@ -1548,7 +1587,7 @@ droptofloor(edict_t *ent)
 		ent->use = Use_Item;
 	}
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -1758,7 +1797,7 @@ SpawnItem(edict_t *ent, gitem_t *item)
 /* ====================================================================== */
 
 gitem_t itemlist[] = {
-	{
+	[IT_NULL] = {
 		NULL
 	},
 
@@ -1766,7 +1805,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_armor_body (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_ARMOR_BODY] = {
 		"item_armor_body",
 		Pickup_Armor,
 		NULL,
@@ -1790,7 +1829,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_armor_combat (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_ARMOR_COMBAT] = {
 		"item_armor_combat",
 		Pickup_Armor,
 		NULL,
@@ -1814,7 +1853,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_armor_jacket (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_ARMOR_JACKET] = {
 		"item_armor_jacket",
 		Pickup_Armor,
 		NULL,
@@ -1838,7 +1877,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_armor_shard (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_ARMOR_SHARD] = {
 		"item_armor_shard",
 		Pickup_Armor,
 		NULL,
@@ -1862,7 +1901,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_power_screen (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_POWER_SCREEN] = {
 		"item_power_screen",
 		Pickup_PowerArmor,
 		Use_PowerArmor,
@@ -1886,7 +1925,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_power_shield (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_POWER_SHIELD] = {
 		"item_power_shield",
 		Pickup_PowerArmor,
 		Use_PowerArmor,
@@ -1911,7 +1950,7 @@ gitem_t itemlist[] = {
 	 * weapon_blaster (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 * always owned, never in the world
 	 */
-	{
+	[IT_WEAPON_BLASTER] = {
 		"weapon_blaster",
 		NULL,
 		Use_Weapon,
@@ -1935,7 +1974,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_shotgun (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_SHOTGUN] = {
 		"weapon_shotgun",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -1959,7 +1998,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_supershotgun (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_SUPERSHOTGUN] = {
 		"weapon_supershotgun",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -1983,7 +2022,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_machinegun (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_MACHINEGUN] = {
 		"weapon_machinegun",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -2007,7 +2046,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_chaingun (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_CHAINGUN] = {
 		"weapon_chaingun",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -2031,7 +2070,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED ammo_grenades (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_AMMO_GRENADES] = {
 		"ammo_grenades",
 		Pickup_Ammo,
 		Use_Weapon,
@@ -2055,7 +2094,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED ammo_trap (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_AMMO_TRAP] = {
 		"ammo_trap",
 		Pickup_Ammo,
 		Use_Weapon,
@@ -2080,7 +2119,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_grenadelauncher (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_GRENADELAUNCHER] = {
 		"weapon_grenadelauncher",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -2104,7 +2143,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_rocketlauncher (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_ROCKETLAUNCHER] = {
 		"weapon_rocketlauncher",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -2128,7 +2167,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_hyperblaster (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_HYPERBLASTER] = {
 		"weapon_hyperblaster",
 		Pickup_Weapon,
 		Use_Weapon2,
@@ -2152,7 +2191,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_boomer (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_BOOMER] = {
 		"weapon_boomer",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -2176,7 +2215,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_railgun (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_RAILGUN] = {
 		"weapon_railgun",
 		Pickup_Weapon,
 		Use_Weapon2,
@@ -2201,7 +2240,7 @@ gitem_t itemlist[] = {
 	 * QUAKED weapon_phalanx (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
 
-	{
+	[IT_WEAPON_PHALANX] = {
 		"weapon_phalanx",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -2225,7 +2264,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED weapon_bfg (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_WEAPON_BFG] = {
 		"weapon_bfg",
 		Pickup_Weapon,
 		Use_Weapon,
@@ -2249,7 +2288,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED ammo_shells (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_AMMO_SHELLS] = {
 		"ammo_shells",
 		Pickup_Ammo,
 		NULL,
@@ -2273,7 +2312,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED ammo_bullets (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_AMMO_BULLETS] = {
 		"ammo_bullets",
 		Pickup_Ammo,
 		NULL,
@@ -2297,7 +2336,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED ammo_cells (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_AMMO_CELLS] = {
 		"ammo_cells",
 		Pickup_Ammo,
 		NULL,
@@ -2321,7 +2360,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED ammo_rockets (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_AMMO_ROCKETS] = {
 		"ammo_rockets",
 		Pickup_Ammo,
 		NULL,
@@ -2345,7 +2384,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED ammo_slugs (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_AMMO_SLUGS] = {
 		"ammo_slugs",
 		Pickup_Ammo,
 		NULL,
@@ -2369,7 +2408,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED ammo_magslug (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_AMMO_MAGSLUG] = {
 		"ammo_magslug",
 		Pickup_Ammo,
 		NULL,
@@ -2393,7 +2432,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_quad (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_QUAD] = {
 		"item_quad",
 		Pickup_Powerup,
 		Use_Quad,
@@ -2417,7 +2456,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_quadfire (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_QUADFIRE] = {
 		"item_quadfire",
 		Pickup_Powerup,
 		Use_QuadFire,
@@ -2442,7 +2481,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_invulnerability (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_INVULNERABILITY] = {
 		"item_invulnerability",
 		Pickup_Powerup,
 		Use_Invulnerability,
@@ -2466,7 +2505,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_silencer (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_SILENCER] = {
 		"item_silencer",
 		Pickup_Powerup,
 		Use_Silencer,
@@ -2490,7 +2529,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_breather (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_BREATHER] = {
 		"item_breather",
 		Pickup_Powerup,
 		Use_Breather,
@@ -2514,7 +2553,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_enviro (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_ENVIRO] = {
 		"item_enviro",
 		Pickup_Powerup,
 		Use_Envirosuit,
@@ -2539,7 +2578,7 @@ gitem_t itemlist[] = {
 	 * QUAKED item_ancient_head (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 * Special item that gives +2 to maximum health
 	 */
-	{
+	[IT_ANCIENT_HEAD] = {
 		"item_ancient_head",
 		Pickup_AncientHead,
 		NULL,
@@ -2564,7 +2603,7 @@ gitem_t itemlist[] = {
 	 * QUAKED item_adrenaline (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 * gives +1 to maximum health
 	 */
-	{
+	[IT_ADRENALINE] = {
 		"item_adrenaline",
 		Pickup_Adrenaline,
 		NULL,
@@ -2588,7 +2627,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_bandolier (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_BANDOLIER] = {
 		"item_bandolier",
 		Pickup_Bandolier,
 		NULL,
@@ -2612,7 +2651,7 @@ gitem_t itemlist[] = {
 	/*
 	 * QUAKED item_pack (.3 .3 1) (-16 -16 -16) (16 16 16)
 	 */
-	{
+	[IT_PACK] = {
 		"item_pack",
 		Pickup_Pack,
 		NULL,
@@ -2637,7 +2676,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_data_cd (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * key for computer centers
 	 */
-	{
+	[IT_KEY_DATA_CD] = {
 		"key_data_cd",
 		Pickup_Key,
 		NULL,
@@ -2662,7 +2701,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_power_cube (0 .5 .8) (-16 -16 -16) (16 16 16) TRIGGER_SPAWN NO_TOUCH
 	 * warehouse circuits
 	 */
-	{
+	[IT_KEY_POWER_CUBE] = {
 		"key_power_cube",
 		Pickup_Key,
 		NULL,
@@ -2687,7 +2726,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_pyramid (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * key for the entrance of jail3
 	 */
-	{
+	[IT_KEY_PYRAMID] = {
 		"key_pyramid",
 		Pickup_Key,
 		NULL,
@@ -2712,7 +2751,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_data_spinner (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * key for the city computer
 	 */
-	{
+	[IT_KEY_DATA_SPINNER] = {
 		"key_data_spinner",
 		Pickup_Key,
 		NULL,
@@ -2737,7 +2776,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_pass (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * security pass for the security level
 	 */
-	{
+	[IT_KEY_PASS] = {
 		"key_pass",
 		Pickup_Key,
 		NULL,
@@ -2762,7 +2801,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_blue_key (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * normal door key - blue
 	 */
-	{
+	[IT_KEY_BLUE_KEY] = {
 		"key_blue_key",
 		Pickup_Key,
 		NULL,
@@ -2787,7 +2826,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_red_key (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * normal door key - red
 	 */
-	{
+	[IT_KEY_RED_KEY] = {
 		"key_red_key",
 		Pickup_Key,
 		NULL,
@@ -2813,7 +2852,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_green_key (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * normal door key - blue
 	 */
-	{
+	[IT_KEY_GREEN_KEY] = {
 		"key_green_key",
 		Pickup_Key,
 		NULL,
@@ -2838,7 +2877,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_commander_head (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * tank commander's head
 	 */
-	{
+	[IT_KEY_COMMANDER_HEAD] = {
 		"key_commander_head",
 		Pickup_Key,
 		NULL,
@@ -2863,7 +2902,7 @@ gitem_t itemlist[] = {
 	 * QUAKED key_airstrike_target (0 .5 .8) (-16 -16 -16) (16 16 16)
 	 * tank commander's head
 	 */
-	{
+	[IT_KEY_AIRSTRIKE_TARGET] = {
 		"key_airstrike_target",
 		Pickup_Key,
 		NULL,
@@ -2884,7 +2923,7 @@ gitem_t itemlist[] = {
 		""
 	},
 
-	{
+	[IT_HEALTH] = {
 		NULL,
 		Pickup_Health,
 		NULL,
@@ -2906,7 +2945,7 @@ gitem_t itemlist[] = {
 	},
 
 	/* end of list marker */
-	{NULL}
+	[IT_TOTAL] = {NULL}
 };
 
 const int itemlist_len = ARRLEN(itemlist) - 1;
@@ -2930,8 +2969,8 @@ SP_item_health(edict_t *self)
 
 	self->model = "models/items/healing/medium/tris.md2";
 	self->count = 10;
-	SpawnItem(self, FindItem("Health"));
-	gi.soundindex("items/n_health.wav");
+	SpawnItem(self, ITEM_BY_ID(IT_HEALTH));
+	G_SoundIndex(SND_N_HEALTH);
 }
 
 /*
@@ -2953,9 +2992,9 @@ SP_item_health_small(edict_t *self)
 
 	self->model = "models/items/healing/stimpack/tris.md2";
 	self->count = 2;
-	SpawnItem(self, FindItem("Health"));
+	SpawnItem(self, ITEM_BY_ID(IT_HEALTH));
 	self->style = HEALTH_IGNORE_MAX;
-	gi.soundindex("items/s_health.wav");
+	G_SoundIndex(SND_S_HEALTH);
 }
 
 /*
@@ -2977,8 +3016,8 @@ SP_item_health_large(edict_t *self)
 
 	self->model = "models/items/healing/large/tris.md2";
 	self->count = 25;
-	SpawnItem(self, FindItem("Health"));
-	gi.soundindex("items/l_health.wav");
+	SpawnItem(self, ITEM_BY_ID(IT_HEALTH));
+	G_SoundIndex(SND_L_HEALTH);
 }
 
 /*
@@ -3000,8 +3039,8 @@ SP_item_health_mega(edict_t *self)
 
 	self->model = "models/items/mega_h/tris.md2";
 	self->count = 100;
-	SpawnItem(self, FindItem("Health"));
-	gi.soundindex("items/m_health.wav");
+	SpawnItem(self, ITEM_BY_ID(IT_HEALTH));
+	G_SoundIndex(SND_M_HEALTH);
 	self->style = HEALTH_IGNORE_MAX | HEALTH_TIMED;
 }
 
@@ -3020,16 +3059,26 @@ SP_item_foodcube(edict_t *self)
 	}
 
 	self->model = "models/objects/trapfx/tris.md2";
-	SpawnItem(self, FindItem("Health"));
+	SpawnItem(self, ITEM_BY_ID(IT_HEALTH));
 	self->spawnflags |= DROPPED_ITEM;
 	self->style = HEALTH_IGNORE_MAX;
-	gi.soundindex("items/s_health.wav");
+	G_SoundIndex(SND_S_HEALTH);
 	self->classname = "foodcube";
 }
 
 void
 InitItems(void)
 {
+	int i;
+
+	memset(item_hash_classname, 0, sizeof(item_hash_classname));
+	memset(item_hash_pickup, 0, sizeof(item_hash_pickup));
+
+	for (i = 1; i < itemlist_len; i++)
+	{
+		ItemHashInsert(item_hash_classname, i);
+		ItemHashInsert(item_hash_pickup, i);
+	}
 }
 
 /*
@@ -3047,9 +3096,9 @@ SetItemNames(void)
 		gi.configstring(CS_ITEMS + i, it->pickup_name);
 	}
 
-	jacket_armor_index = ITEM_INDEX(FindItem("Jacket Armor"));
-	combat_armor_index = ITEM_INDEX(FindItem("Combat Armor"));
-	body_armor_index = ITEM_INDEX(FindItem("Body Armor"));
-	power_screen_index = ITEM_INDEX(FindItem("Power Screen"));
-	power_shield_index = ITEM_INDEX(FindItem("Power Shield"));
+	jacket_armor_index = IT_ARMOR_JACKET;
+	combat_armor_index = IT_ARMOR_COMBAT;
+	body_armor_index = IT_ARMOR_BODY;
+	power_screen_index = IT_POWER_SCREEN;
+	power_shield_index = IT_POWER_SHIELD;
 }
@@ -0,0 +1,364 @@
+/*
+ * =======================================================================
+ *
+ * Lag compensation for hitscan weapons. The position of every
+ * client is recorded at the end of each server frame. When a
+ * client fires a hitscan weapon all other clients are moved
+ * back to where the shooter saw them, the shot is traced and
+ * everybody is put back afterwards. g_lagcomp caps the
+ * rewind in milliseconds, it is off by default.
+ *
+ * =======================================================================
+ */
+
+#include "header/local.h"
+
+#define LAG_HISTORY 32         /* frames, 3.2 seconds */
+#define LAG_TELEPORT_DIST 256  /* don't interpolate larger jumps */
+
+typedef struct
+{
+	int framenum; /* 0 if the slot holds no sample */
+	vec3_t origin;
+	vec3_t mins;
+	vec3_t maxs;
+} lagsample_t;
+
+typedef struct
+{
+	edict_t *ent;
+	vec3_t origin;
+	vec3_t mins;
+	vec3_t maxs;
+	vec3_t rewound;
+	vec3_t rewoundmins;
+	vec3_t rewoundmaxs;
+} lagsaved_t;
+
+static lagsample_t *lag_history; /* LAG_HISTORY samples per client */
+static lagsaved_t *lag_saved;
+static int lag_numsaved;
+static qboolean lag_active;
+
+void
+G_InitLagCompensation(void)
+{
+	lag_history = gi.TagMalloc(game.maxclients * LAG_HISTORY *
+			sizeof(lagsample_t), TAG_GAME);
+	lag_saved = gi.TagMalloc(game.maxclients * sizeof(lagsaved_t), TAG_GAME);
+	lag_numsaved = 0;
+	lag_active = false;
+}
+
+/*
+ * Forgets the history of one client,
+ * or of all clients if ent is NULL.
+ */
+void
+G_ResetLagHistory(edict_t *ent)
+{
+	if (!lag_history)
+	{
+		return;
+	}
+
+	if (!ent)
+	{
+		memset(lag_history, 0, game.maxclients * LAG_HISTORY *
+				sizeof(lagsample_t));
+		return;
+	}
+
+	memset(lag_history + (ent - g_edicts - 1) * LAG_HISTORY, 0,
+			LAG_HISTORY * sizeof(lagsample_t));
+}
+
+/*
+ * Called once per frame after
+ * all clients were moved.
+ */
+void
+G_RecordLagHistory(void)
+{
+	lagsample_t *sample;
+	edict_t *ent;
+	int i;
+
+	if (!lag_history)
+	{
+		return;
+	}
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		ent = g_edicts + 1 + i;
+		sample = &lag_history[i * LAG_HISTORY + level.framenum % LAG_HISTORY];
+
+		if (!ent->inuse || !ent->client || (ent->solid == SOLID_NOT))
+		{
+			sample->framenum = 0;
+			continue;
+		}
+
+		sample->framenum = level.framenum;
+		VectorCopy(ent->s.origin, sample->origin);
+		VectorCopy(ent->mins, sample->mins);
+		VectorCopy(ent->maxs, sample->maxs);
+	}
+}
+
+static const lagsample_t *
+LagSample(int client, int framenum)
+{
+	const lagsample_t *sample;
+
+	if ((framenum <= 0) || (framenum > level.framenum) ||
+		(framenum <= level.framenum - LAG_HISTORY))
+	{
+		return NULL;
+	}
+
+	sample = &lag_history[client * LAG_HISTORY + framenum % LAG_HISTORY];
+
+	if (sample->framenum != framenum)
+	{
+		return NULL;
+	}
+
+	return sample;
+}
+
+/*
+ * Moves all clients except the shooter
+ * back by the given amount of milliseconds.
+ */
+static void
+LagRewind(edict_t *shooter, int msec)
+{
+	const lagsample_t *a, *b;
+	lagsaved_t *saved;
+	vec3_t origin, delta;
+	const float *to, *mins, *maxs;
+	edict_t *ent;
+	float back, frac;
+	int i, framenum;
+
+	lag_numsaved = 0;
+
+	/* the time the shooter saw, in frames */
+	back = level.framenum - msec / (1000 * FRAMETIME);
+	framenum = (int)back;
+	frac = back - framenum;
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		ent = g_edicts + 1 + i;
+
+		if ((ent == shooter) || !ent->inuse || !ent->client ||
+			(ent->solid == SOLID_NOT) || (ent->deadflag != DEAD_NO))
+		{
+			continue;
+		}
+
+		a = LagSample(i, framenum);
+
+		if (!a)
+		{
+			continue;
+		}
+
+		/* the newest sample may not be recorded yet */
+		b = LagSample(i, framenum + 1);
+		to = b ? b->origin : ent->s.origin;
+
+		VectorSubtract(to, a->origin, delta);
+
+		if (VectorLength(delta) > LAG_TELEPORT_DIST)
+		{
+			/* don't interpolate through teleporters */
+			VectorMA(a->origin, (frac < 0.5) ? 0 : 1, delta, origin);
+		}
+		else
+		{
+			VectorMA(a->origin, frac, delta, origin);
+		}
+
+		if (b && (frac >= 0.5))
+		{
+			mins = b->mins;
+			maxs = b->maxs;
+		}
+		else
+		{
+			mins = a->mins;
+			maxs = a->maxs;
+		}
+
+		if (VectorCompare(origin, ent->s.origin) &&
+			VectorCompare(mins, ent->mins) && VectorCompare(maxs, ent->maxs))
+		{
+			continue;
+		}
+
+		saved = &lag_saved[lag_numsaved++];
+		saved->ent = ent;
+		VectorCopy(ent->s.origin, saved->origin);
+		VectorCopy(ent->mins, saved->mins);
+		VectorCopy(ent->maxs, saved->maxs);
+		VectorCopy(origin, saved->rewound);
+		VectorCopy(mins, saved->rewoundmins);
+		VectorCopy(maxs, saved->rewoundmaxs);
+
+		VectorCopy(origin, ent->s.origin);
+		VectorCopy(mins, ent->mins);
+		VectorCopy(maxs, ent->maxs);
+		G_LinkEntity(ent);
+	}
+
+	lag_active = true;
+}
+
+/*
+ * Rewinds the other clients to the view time of the
+ * shooter. Every call must be paired with G_LagRestore().
+ */
+void
+G_LagRewind(edict_t *shooter)
+{
+	int msec;
+
+	if (!shooter || !shooter->client || lag_active || !lag_history)
+	{
+		return;
+	}
+
+	msec = shooter->client->ping;
+
+	if (msec > g_lagcomp->value)
+	{
+		msec = (int)g_lagcomp->value;
+	}
+
+	if (msec <= 0)
+	{
+		return;
+	}
+
+	LagRewind(shooter, msec);
+}
+
+/*
+ * Puts the rewound clients back. Movement and
+ * bbox changes done by the shot (knockback,
+ * gibbing) are carried over.
+ */
+void
+G_LagRestore(void)
+{
+	lagsaved_t *saved;
+	edict_t *ent;
+	vec3_t moved;
+	int i;
+
+	if (!lag_active)
+	{
+		return;
+	}
+
+	for (i = 0; i < lag_numsaved; i++)
+	{
+		saved = &lag_saved[i];
+		ent = saved->ent;
+
+		if (!ent->inuse)
+		{
+			continue;
+		}
+
+		VectorSubtract(ent->s.origin, saved->rewound, moved);
+		VectorAdd(saved->origin, moved, ent->s.origin);
+
+		if (VectorCompare(ent->mins, saved->rewoundmins))
+		{
+			VectorCopy(saved->mins, ent->mins);
+		}
+
+		if (VectorCompare(ent->maxs, saved->rewoundmaxs))
+		{
+			VectorCopy(saved->maxs, ent->maxs);
+		}
+
+		G_LinkEntity(ent);
+	}
+
+	lag_numsaved = 0;
+	lag_active = false;
+}
+
+/*
+ * sv lagbench [shots] [msec]
+ *
+ * Measures the cost of rewinding and restoring all
+ * clients for the given number of shots, fired from
+ * the first client.
+ */
+void
+SVCmd_LagBench_f(void)
+{
+	long long start, rewind, restore;
+	edict_t *shooter;
+	int i, shots, msec, moved;
+
+	shots = (gi.argc() > 2) ? (int)strtol(gi.argv(2), NULL, 10) : 1000;
+	msec = (gi.argc() > 3) ? (int)strtol(gi.argv(3), NULL, 10) : 200;
+
+	if ((shots <= 0) || (msec <= 0))
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Usage: sv lagbench [shots] [msec]\n");
+		return;
+	}
+
+	shooter = NULL;
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		if (g_edicts[i + 1].inuse && g_edicts[i + 1].client)
+		{
+			shooter = g_edicts + i + 1;
+			break;
+		}
+	}
+
+	if (!shooter || !lag_history || lag_active)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "No client to shoot from.\n");
+		return;
+	}
+
+	rewind = restore = 0;
+	moved = 0;
+
+	for (i = 0; i < shots; i++)
+	{
+		start = Q_Microseconds();
+		LagRewind(shooter, msec);
+		rewind += Q_Microseconds() - start;
+
+		moved = lag_numsaved;
+
+		start = Q_Microseconds();
+		G_LagRestore();
+		restore += Q_Microseconds() - start;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i shots, %i of %i clients rewound by %i ms\n",
+			shots, moved, game.maxclients - 1, msec);
+	gi.cprintf(NULL, PRINT_HIGH, "rewind  %8.3f us/shot\n", (double)rewind / shots);
+	gi.cprintf(NULL, PRINT_HIGH, "restore %8.3f us/shot\n", (double)restore / shots);
+
+	if (moved)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "total   %8.3f us/client/shot\n",
+				(double)(rewind + restore) / shots / moved);
+	}
+}
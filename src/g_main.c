@@ -34,6 +34,15 @@ cvar_t *needpass;
 cvar_t *maxclients;
 cvar_t *maxspectators;
 cvar_t *maxentities;
+cvar_t *g_debug_edicts;
+cvar_t *g_async_save;
+cvar_t *g_delta_saves;
+cvar_t *g_entcache;
+cvar_t *g_threads;
+cvar_t *g_callstats;
+cvar_t *g_netstats;
+cvar_t *g_flightrec;
+cvar_t *g_flightrec_frames;
 cvar_t *g_select_empty;
 cvar_t *dedicated;
 cvar_t *g_footsteps;
@@ -41,8 +50,10 @@ cvar_t *g_monsterfootsteps;
 cvar_t *g_fix_triggered;
 
 cvar_t *filterban;
+cvar_t *filterbanlist;
 
 cvar_t *sv_maxvelocity;
+cvar_t *g_lagcomp;
 cvar_t *sv_gravity;
 
 cvar_t *sv_rollspeed;
@@ -50,6 +61,7 @@ cvar_t *sv_rollangle;
 cvar_t *gun_x;
 cvar_t *gun_y;
 cvar_t *gun_z;
+cvar_t *cl_gun;
 
 cvar_t *run_pitch;
 cvar_t *run_roll;
@@ -62,6 +74,7 @@ cvar_t *sv_cheats;
 cvar_t *flood_msgs;
 cvar_t *flood_persecond;
 cvar_t *flood_waitdelay;
+cvar_t *g_cmd_ratelimit;
 
 cvar_t *sv_maplist;
 
@@ -88,8 +101,15 @@ ShutdownGame(void)
 {
 	gi.dprintf("==== ShutdownGame ====\n");
 
+	SV_ShutdownSaves();
+	G_ShutdownReplay();
+	G_ShutdownWorkers();
+	G_ShutdownFlight();
+	G_ShutdownTimeline();
+
 	gi.FreeTags(TAG_LEVEL);
 	gi.FreeTags(TAG_GAME);
+	gi.FreeTags(TAG_FILTER);
 }
 
 /*
@@ -126,6 +146,7 @@ GetGameAPI(const game_import_t *import)
 
 	/* Initalize the PRNG */
 	randk_seed();
+	G_SeedRandomTime();
 
 	return &globals;
 }
@@ -161,22 +182,11 @@ Com_Printf(const char *msg, ...)
 void
 ClientEndServerFrames(void)
 {
-	int i;
-	edict_t *ent;
-
 	/* calc the player views now that all
 	   pushing and damage has been added */
-	for (i = 0; i < maxclients->value; i++)
-	{
-		ent = g_edicts + 1 + i;
-
-		if (!ent->inuse || !ent->client)
-		{
-			continue;
-		}
+	P_EndServerFrames();
 
-		ClientEndServerFrame(ent);
-	}
+	G_RecordLagHistory();
 }
 
 /*
@@ -398,7 +408,14 @@ G_RunFrame(void)
 	int i;
 	edict_t *ent;
 
+	G_ReplayBeginFrame();
+	G_CallStatsBeginFrame();
+	G_NetStatsBeginFrame();
+
 	level.framenum++;
+
+	G_FlightBeginFrame();
+
 	level.time = level.framenum * FRAMETIME;
 
 	debristhisframe = 0;
@@ -411,16 +428,20 @@ G_RunFrame(void)
 	if (level.exitintermission)
 	{
 		ExitLevel();
+		G_FlightEndFrame();
+		G_ReplayEndFrame();
 		return;
 	}
 
 	/* treat each object in turn even
-	   the world gets a chance to think */
+	   the world gets a chance to think.
+	   objects with nothing to do are
+	   skipped, see G_EdictNeedsRun() */
 	ent = &g_edicts[0];
 
 	for (i = 0; i < globals.num_edicts; i++, ent++)
 	{
-		if (!ent->inuse)
+		if (!G_EdictNeedsRun(i))
 		{
 			continue;
 		}
@@ -442,13 +463,20 @@ G_RunFrame(void)
 			}
 		}
 
+		G_SpanBegin(ent->classname, ent);
+
 		if ((i > 0) && (i <= maxclients->value))
 		{
 			ClientBeginServerFrame(ent);
+			G_SpanEnd();
 			continue;
 		}
 
 		G_RunEntity(ent);
+
+		G_SpanEnd();
+
+		G_SyncEdictMirror(ent);
 	}
 
 	/* see if it is time to end a deathmatch */
@@ -458,6 +486,11 @@ G_RunFrame(void)
 	CheckNeedPass();
 
 	/* build the playerstate_t structures for all players */
+	G_SpanBegin("ClientEndServerFrames", NULL);
 	ClientEndServerFrames();
+	G_SpanEnd();
+
+	G_FlightEndFrame();
+	G_ReplayEndFrame();
 }
 
@@ -53,9 +53,9 @@ SP_func_areaportal(edict_t *ent)
 void
 VelocityForDamage(int damage, vec3_t v)
 {
-	v[0] = 100.0 * crandom();
-	v[1] = 100.0 * crandom();
-	v[2] = 200.0 + 100.0 * random();
+	v[0] = 100.0 * G_CRandom(RAND_EFFECT);
+	v[1] = 100.0 * G_CRandom(RAND_EFFECT);
+	v[2] = 200.0 + 100.0 * G_Random(RAND_EFFECT);
 
 	if (damage < 50)
 	{
@@ -117,7 +117,7 @@ gib_think(edict_t *self)
 	if (self->s.frame == 10)
 	{
 		self->think = G_FreeEdict;
-		self->nextthink = level.time + 8 + random() * 10;
+		self->nextthink = level.time + 8 + G_Random(RAND_EFFECT) * 10;
 	}
 }
 
@@ -140,7 +140,7 @@ gib_touch(edict_t *self, edict_t *other /* unused */, const cplane_t *plane, con
 
 	if (plane)
 	{
-		gi.sound(self, CHAN_VOICE, gi.soundindex("misc/fhit3.wav"), 1, ATTN_NORM, 0);
+		gi.sound(self, CHAN_VOICE, G_SoundIndex(SND_FHIT3), 1, ATTN_NORM, 0);
 
 		vectoangles(plane->normal, normal_angles);
 		AngleVectors(normal_angles, NULL, right, NULL);
@@ -197,15 +197,15 @@ ThrowGib(edict_t *self, const char *gibname, int damage, gibtype_t type)
 
 	VectorScale(self->size, 0.5, size);
 	VectorAdd(self->absmin, size, origin);
-	gib->s.origin[0] = origin[0] + crandom() * size[0];
-	gib->s.origin[1] = origin[1] + crandom() * size[1];
-	gib->s.origin[2] = origin[2] + crandom() * size[2];
+	gib->s.origin[0] = origin[0] + G_CRandom(RAND_EFFECT) * size[0];
+	gib->s.origin[1] = origin[1] + G_CRandom(RAND_EFFECT) * size[1];
+	gib->s.origin[2] = origin[2] + G_CRandom(RAND_EFFECT) * size[2];
 
-	gi.setmodel(gib, gibname);
+	gib->s.modelindex = G_ModelIndexByName(gibname);
 	gib->solid = SOLID_BBOX;
 	gib->svflags = SVF_DEADMONSTER;
 	gib->s.effects |= EF_GIB;
-	gib->flags |= FL_NO_KNOCKBACK;
+	gib->flags |= FL_NO_KNOCKBACK | FL_BALLISTIC;
 	gib->takedamage = DAMAGE_YES;
 	gib->die = gib_die;
 	gib->health = 250;
@@ -225,14 +225,14 @@ ThrowGib(edict_t *self, const char *gibname, int damage, gibtype_t type)
 	VelocityForDamage(damage, vd);
 	VectorMA(self->velocity, vscale, vd, gib->velocity);
 	ClipGibVelocity(gib);
-	gib->avelocity[0] = random() * 600;
-	gib->avelocity[1] = random() * 600;
-	gib->avelocity[2] = random() * 600;
+	gib->avelocity[0] = G_Random(RAND_EFFECT) * 600;
+	gib->avelocity[1] = G_Random(RAND_EFFECT) * 600;
+	gib->avelocity[2] = G_Random(RAND_EFFECT) * 600;
 
 	gib->think = G_FreeEdict;
-	gib->nextthink = level.time + 10 + random() * 10;
+	gib->nextthink = level.time + 10 + G_Random(RAND_EFFECT) * 10;
 
-	gi.linkentity(gib);
+	G_LinkEntity(gib);
 }
 
 void
@@ -252,7 +252,7 @@ ThrowHead(edict_t *self, const char *gibname, int damage, gibtype_t type)
 	VectorClear(self->maxs);
 
 	self->s.modelindex2 = 0;
-	gi.setmodel(self, gibname);
+	self->s.modelindex = G_ModelIndexByName(gibname);
 	self->solid = SOLID_BBOX;
 	self->s.effects |= EF_GIB;
 	self->s.effects &= ~EF_FLIES;
@@ -282,12 +282,12 @@ ThrowHead(edict_t *self, const char *gibname, int damage, gibtype_t type)
 	VectorMA(self->velocity, vscale, vd, self->velocity);
 	ClipGibVelocity(self);
 
-	self->avelocity[YAW] = crandom() * 600;
+	self->avelocity[YAW] = G_CRandom(RAND_EFFECT) * 600;
 
 	self->think = G_FreeEdict;
-	self->nextthink = level.time + 10 + random() * 10;
+	self->nextthink = level.time + 10 + G_Random(RAND_EFFECT) * 10;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -315,12 +315,11 @@ ThrowGibACID(edict_t *self, const char *gibname, int damage, gibtype_t type)
 
 	VectorScale(self->size, 0.5, size);
 	VectorAdd(self->absmin, size, origin);
-	gib->s.origin[0] = origin[0] + crandom() * size[0];
-	gib->s.origin[1] = origin[1] + crandom() * size[1];
-	gib->s.origin[2] = origin[2] + crandom() * size[2];
+	gib->s.origin[0] = origin[0] + G_CRandom(RAND_EFFECT) * size[0];
+	gib->s.origin[1] = origin[1] + G_CRandom(RAND_EFFECT) * size[1];
+	gib->s.origin[2] = origin[2] + G_CRandom(RAND_EFFECT) * size[2];
 
-	/* gi.setmodel (gib, gibname); */
-	gib->s.modelindex = gi.modelindex(gibname);
+	gib->s.modelindex = G_ModelIndexByName(gibname);
 
 	gib->clipmask = MASK_SHOT;
 	gib->solid = SOLID_BBOX;
@@ -328,7 +327,7 @@ ThrowGibACID(edict_t *self, const char *gibname, int damage, gibtype_t type)
 	gib->s.effects |= EF_GREENGIB;
 	/* note to self check this */
 	gib->s.renderfx |= RF_FULLBRIGHT;
-	gib->flags |= FL_NO_KNOCKBACK;
+	gib->flags |= FL_NO_KNOCKBACK | FL_BALLISTIC;
 	gib->takedamage = DAMAGE_YES;
 	gib->die = gib_die;
 	gib->dmg = 2;
@@ -348,14 +347,14 @@ ThrowGibACID(edict_t *self, const char *gibname, int damage, gibtype_t type)
 	VelocityForDamage(damage, vd);
 	VectorMA(self->velocity, vscale, vd, gib->velocity);
 	ClipGibVelocity(gib);
-	gib->avelocity[0] = random() * 600;
-	gib->avelocity[1] = random() * 600;
-	gib->avelocity[2] = random() * 600;
+	gib->avelocity[0] = G_Random(RAND_EFFECT) * 600;
+	gib->avelocity[1] = G_Random(RAND_EFFECT) * 600;
+	gib->avelocity[2] = G_Random(RAND_EFFECT) * 600;
 
 	gib->think = G_FreeEdict;
-	gib->nextthink = level.time + 10 + random() * 10;
+	gib->nextthink = level.time + 10 + G_Random(RAND_EFFECT) * 10;
 
-	gi.linkentity(gib);
+	G_LinkEntity(gib);
 }
 
 void
@@ -375,7 +374,7 @@ ThrowHeadACID(edict_t *self, const char *gibname, int damage, gibtype_t type)
 	VectorClear(self->maxs);
 
 	self->s.modelindex2 = 0;
-	gi.setmodel(self, gibname);
+	self->s.modelindex = G_ModelIndexByName(gibname);
 
 	self->clipmask = MASK_SHOT;
 	self->solid = SOLID_BBOX;
@@ -405,12 +404,12 @@ ThrowHeadACID(edict_t *self, const char *gibname, int damage, gibtype_t type)
 	VectorMA(self->velocity, vscale, vd, self->velocity);
 	ClipGibVelocity(self);
 
-	self->avelocity[YAW] = crandom() * 600;
+	self->avelocity[YAW] = G_CRandom(RAND_EFFECT) * 600;
 
 	self->think = G_FreeEdict;
-	self->nextthink = level.time + 10 + random() * 10;
+	self->nextthink = level.time + 10 + G_Random(RAND_EFFECT) * 10;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -424,7 +423,7 @@ ThrowClientHead(edict_t *self, int damage)
 		return;
 	}
 
-	if (randk() & 1)
+	if (G_RandInt(RAND_EFFECT) & 1)
 	{
 		gibname = "models/objects/gibs/head2/tris.md2";
 		self->s.skinnum = 1; /* second skin is player */
@@ -437,7 +436,7 @@ ThrowClientHead(edict_t *self, int damage)
 
 	self->s.origin[2] += 32;
 	self->s.frame = 0;
-	gi.setmodel(self, gibname);
+	self->s.modelindex = G_ModelIndexByName(gibname);
 	VectorSet(self->mins, -16, -16, 0);
 	VectorSet(self->maxs, 16, 16, 16);
 
@@ -466,7 +465,7 @@ ThrowClientHead(edict_t *self, int damage)
 		self->nextthink = 0;
 	}
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -507,25 +506,25 @@ ThrowDebris(edict_t *self, char *modelname, float speed, vec3_t origin)
 	debristhisframe++;
 
 	VectorCopy(origin, chunk->s.origin);
-	gi.setmodel(chunk, modelname);
-	v[0] = 100 * crandom();
-	v[1] = 100 * crandom();
-	v[2] = 100 + 100 * crandom();
+	chunk->s.modelindex = G_ModelIndexByName(modelname);
+	v[0] = 100 * G_CRandom(RAND_EFFECT);
+	v[1] = 100 * G_CRandom(RAND_EFFECT);
+	v[2] = 100 + 100 * G_CRandom(RAND_EFFECT);
 	VectorMA(self->velocity, speed, v, chunk->velocity);
 	chunk->movetype = MOVETYPE_BOUNCE;
 	chunk->solid = SOLID_NOT;
-	chunk->avelocity[0] = random() * 600;
-	chunk->avelocity[1] = random() * 600;
-	chunk->avelocity[2] = random() * 600;
+	chunk->avelocity[0] = G_Random(RAND_EFFECT) * 600;
+	chunk->avelocity[1] = G_Random(RAND_EFFECT) * 600;
+	chunk->avelocity[2] = G_Random(RAND_EFFECT) * 600;
 	chunk->think = G_FreeEdict;
-	chunk->nextthink = level.time + 5 + random() * 5;
+	chunk->nextthink = level.time + 5 + G_Random(RAND_EFFECT) * 5;
 	chunk->s.frame = 0;
-	chunk->flags = 0;
+	chunk->flags = FL_BALLISTIC;
 	chunk->classname = "debris";
 	chunk->takedamage = DAMAGE_YES;
 	chunk->die = debris_die;
 	chunk->health = 250;
-	gi.linkentity(chunk);
+	G_LinkEntity(chunk);
 }
 
 void
@@ -536,10 +535,10 @@ BecomeExplosion1(edict_t *self)
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_EXPLOSION1);
-	gi.WritePosition(self->s.origin);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_EXPLOSION1);
+	G_WritePosition(self->s.origin);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	G_FreeEdict(self);
 }
@@ -552,10 +551,10 @@ BecomeExplosion2(edict_t *self)
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_EXPLOSION2);
-	gi.WritePosition(self->s.origin);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_EXPLOSION2);
+	G_WritePosition(self->s.origin);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	G_FreeEdict(self);
 }
@@ -622,15 +621,15 @@ path_corner_touch(edict_t *self, edict_t *other, const cplane_t *plane /* unused
 
 	if (self->wait)
 	{
-		other->monsterinfo.pausetime = level.time + self->wait;
-		other->monsterinfo.stand(other);
+		G_EnsureMonsterInfo(other)->pausetime = level.time + self->wait;
+		G_MonsterInfo(other)->stand(other);
 		return;
 	}
 
 	if (!other->movetarget)
 	{
-		other->monsterinfo.pausetime = level.time + 100000000;
-		other->monsterinfo.stand(other);
+		G_EnsureMonsterInfo(other)->pausetime = level.time + 100000000;
+		G_MonsterInfo(other)->stand(other);
 	}
 	else
 	{
@@ -660,7 +659,7 @@ SP_path_corner(edict_t *self)
 	VectorSet(self->mins, -8, -8, -8);
 	VectorSet(self->maxs, 8, 8, 8);
 	self->svflags |= SVF_NOCLIENT;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ===================================================== */
@@ -712,9 +711,9 @@ point_combat_touch(edict_t *self, edict_t *other, const cplane_t *plane /* unuse
 	}
 	else if ((self->spawnflags & 1) && !(other->flags & (FL_SWIM | FL_FLY)))
 	{
-		other->monsterinfo.pausetime = level.time + 100000000;
-		other->monsterinfo.aiflags |= AI_STAND_GROUND;
-		other->monsterinfo.stand(other);
+		G_EnsureMonsterInfo(other)->pausetime = level.time + 100000000;
+		G_EnsureMonsterInfo(other)->aiflags |= AI_STAND_GROUND;
+		G_MonsterInfo(other)->stand(other);
 	}
 
 	if (other->movetarget == self)
@@ -722,7 +721,7 @@ point_combat_touch(edict_t *self, edict_t *other, const cplane_t *plane /* unuse
 		other->target = NULL;
 		other->movetarget = NULL;
 		other->goalentity = other->enemy;
-		other->monsterinfo.aiflags &= ~AI_COMBAT_POINT;
+		G_EnsureMonsterInfo(other)->aiflags &= ~AI_COMBAT_POINT;
 	}
 
 	if (self->pathtarget)
@@ -773,7 +772,7 @@ SP_point_combat(edict_t *self)
 	VectorSet(self->mins, -8, -8, -16);
 	VectorSet(self->maxs, 8, 8, 16);
 	self->svflags = SVF_NOCLIENT;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ===================================================== */
@@ -810,7 +809,7 @@ SP_viewthing(edict_t *ent)
 	VectorSet(ent->mins, -16, -16, -24);
 	VectorSet(ent->maxs, 16, 16, 32);
 	ent->s.modelindex = gi.modelindex("models/objects/banner/tris.md2");
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 	ent->nextthink = level.time + 0.5;
 	ent->think = TH_viewthing;
 	return;
@@ -946,7 +945,7 @@ func_wall_use(edict_t *self, edict_t *other /* unused */, edict_t *activator /*
 		self->svflags |= SVF_NOCLIENT;
 	}
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	if (!(self->spawnflags & 2))
 	{
@@ -979,7 +978,7 @@ SP_func_wall(edict_t *self)
 	if ((self->spawnflags & 7) == 0)
 	{
 		self->solid = SOLID_BSP;
-		gi.linkentity(self);
+		G_LinkEntity(self);
 		return;
 	}
 
@@ -1011,7 +1010,7 @@ SP_func_wall(edict_t *self)
 		self->svflags |= SVF_NOCLIENT;
 	}
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ===================================================== */
@@ -1119,7 +1118,7 @@ SP_func_object(edict_t *self)
 
 	self->clipmask = MASK_MONSTERSOLID;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ===================================================== */
@@ -1192,9 +1191,9 @@ func_explosive_explode(edict_t *self, edict_t *inflictor, edict_t *attacker,
 
 		while (count--)
 		{
-			chunkorigin[0] = origin[0] + crandom() * size[0];
-			chunkorigin[1] = origin[1] + crandom() * size[1];
-			chunkorigin[2] = origin[2] + crandom() * size[2];
+			chunkorigin[0] = origin[0] + G_CRandom(RAND_EFFECT) * size[0];
+			chunkorigin[1] = origin[1] + G_CRandom(RAND_EFFECT) * size[1];
+			chunkorigin[2] = origin[2] + G_CRandom(RAND_EFFECT) * size[2];
 			ThrowDebris(self, "models/objects/debris1/tris.md2", 1, chunkorigin);
 		}
 	}
@@ -1209,9 +1208,9 @@ func_explosive_explode(edict_t *self, edict_t *inflictor, edict_t *attacker,
 
 	while (count--)
 	{
-		chunkorigin[0] = origin[0] + crandom() * size[0];
-		chunkorigin[1] = origin[1] + crandom() * size[1];
-		chunkorigin[2] = origin[2] + crandom() * size[2];
+		chunkorigin[0] = origin[0] + G_CRandom(RAND_EFFECT) * size[0];
+		chunkorigin[1] = origin[1] + G_CRandom(RAND_EFFECT) * size[1];
+		chunkorigin[2] = origin[2] + G_CRandom(RAND_EFFECT) * size[2];
 		ThrowDebris(self, "models/objects/debris2/tris.md2", 2, chunkorigin);
 	}
 
@@ -1240,7 +1239,7 @@ func_explosive_spawn(edict_t *self, edict_t *other, edict_t *activator)
 	self->svflags &= ~SVF_NOCLIENT;
 	self->use = NULL;
 	KillBox(self);
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -1302,7 +1301,7 @@ SP_func_explosive(edict_t *self)
 		self->takedamage = DAMAGE_YES;
 	}
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ===================================================== */
@@ -1353,13 +1352,13 @@ barrel_explode(edict_t *self)
 
 	/* a few big chunks */
 	spd = 1.5 * (float)self->dmg / 200.0;
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris1/tris.md2", spd, org);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris1/tris.md2", spd, org);
 
 	/* bottom corners */
@@ -1379,37 +1378,37 @@ barrel_explode(edict_t *self)
 
 	/* a bunch of little chunks */
 	spd = (float)(2 * self->dmg / 200);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris2/tris.md2", spd, org);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris2/tris.md2", spd, org);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris2/tris.md2", spd, org);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris2/tris.md2", spd, org);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris2/tris.md2", spd, org);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris2/tris.md2", spd, org);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris2/tris.md2", spd, org);
-	org[0] = self->s.origin[0] + crandom() * self->size[0];
-	org[1] = self->s.origin[1] + crandom() * self->size[1];
-	org[2] = self->s.origin[2] + crandom() * self->size[2];
+	org[0] = self->s.origin[0] + G_CRandom(RAND_EFFECT) * self->size[0];
+	org[1] = self->s.origin[1] + G_CRandom(RAND_EFFECT) * self->size[1];
+	org[2] = self->s.origin[2] + G_CRandom(RAND_EFFECT) * self->size[2];
 	ThrowDebris(self, "models/objects/debris2/tris.md2", spd, org);
 
 	VectorCopy(save, self->s.origin);
@@ -1483,14 +1482,14 @@ SP_misc_explobox(edict_t *self)
 
 	self->die = barrel_delay;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.aiflags = AI_NOSTEP;
+	G_EnsureMonsterInfo(self)->aiflags = AI_NOSTEP;
 
 	self->touch = barrel_touch;
 
 	self->think = M_droptofloor;
 	self->nextthink = level.time + 2 * FRAMETIME;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 
@@ -1533,7 +1532,7 @@ void misc_blackhole_transparent (edict_t *ent)
 {
 	ent->s.renderfx = RF_TRANSLUCENT|RF_NOSHADOW;
 	ent->prethink = NULL;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 void
@@ -1554,7 +1553,7 @@ SP_misc_blackhole(edict_t *ent)
 	ent->think = misc_blackhole_think;
     ent->prethink = misc_blackhole_transparent;
 	ent->nextthink = level.time + 2 * FRAMETIME;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -1597,7 +1596,7 @@ SP_misc_eastertank(edict_t *ent)
 	ent->s.frame = 254;
 	ent->think = misc_eastertank_think;
 	ent->nextthink = level.time + 2 * FRAMETIME;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -1640,7 +1639,7 @@ SP_misc_easterchick(edict_t *ent)
 	ent->s.frame = 208;
 	ent->think = misc_easterchick_think;
 	ent->nextthink = level.time + 2 * FRAMETIME;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -1681,7 +1680,7 @@ SP_misc_easterchick2(edict_t *ent)
 	ent->s.frame = 248;
 	ent->think = misc_easterchick2_think;
 	ent->nextthink = level.time + 2 * FRAMETIME;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -1758,7 +1757,7 @@ SP_monster_commander_body(edict_t *self)
 	self->takedamage = DAMAGE_YES;
 	self->flags = FL_GODMODE;
 	self->s.renderfx |= RF_FRAMELERP;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	gi.soundindex("tank/thud.wav");
 	gi.soundindex("tank/pain.wav");
@@ -1797,8 +1796,8 @@ SP_misc_banner(edict_t *ent)
 	ent->movetype = MOVETYPE_NONE;
 	ent->solid = SOLID_NOT;
 	ent->s.modelindex = gi.modelindex("models/objects/banner/tris.md2");
-	ent->s.frame = randk() % 16;
-	gi.linkentity(ent);
+	ent->s.frame = G_RandInt(RAND_EFFECT) % 16;
+	G_LinkEntity(ent);
 
 	ent->think = misc_banner_think;
 	ent->nextthink = level.time + FRAMETIME;
@@ -1826,7 +1825,7 @@ misc_deadsoldier_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *at
 		return;
 	}
 
-	gi.sound(self, CHAN_BODY, gi.soundindex("misc/udeath.wav"), 1, ATTN_NORM, 0);
+	gi.sound(self, CHAN_BODY, G_SoundIndex(SND_UDEATH), 1, ATTN_NORM, 0);
 
 	for (n = 0; n < 4; n++)
 	{
@@ -1890,9 +1889,9 @@ SP_misc_deadsoldier(edict_t *ent)
 	ent->takedamage = DAMAGE_YES;
 	ent->svflags |= SVF_MONSTER | SVF_DEADMONSTER;
 	ent->die = misc_deadsoldier_die;
-	ent->monsterinfo.aiflags |= AI_GOOD_GUY;
+	G_EnsureMonsterInfo(ent)->aiflags |= AI_GOOD_GUY;
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -1952,10 +1951,10 @@ SP_misc_viper(edict_t *ent)
 	ent->nextthink = level.time + FRAMETIME;
 	ent->use = misc_viper_use;
 	ent->svflags |= SVF_NOCLIENT;
-	ent->moveinfo.accel = ent->moveinfo.decel = ent->moveinfo.speed =
+	G_EnsureMoveInfo(ent)->accel = G_EnsureMoveInfo(ent)->decel = G_EnsureMoveInfo(ent)->speed =
 													ent->speed;
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -1992,9 +1991,9 @@ SP_misc_crashviper(edict_t *ent)
 	ent->nextthink = level.time + FRAMETIME;
 	ent->use = misc_viper_use;
 	ent->svflags |= SVF_NOCLIENT;
-	ent->moveinfo.accel = ent->moveinfo.decel = ent->moveinfo.speed = ent->speed;
+	G_EnsureMoveInfo(ent)->accel = G_EnsureMoveInfo(ent)->decel = G_EnsureMoveInfo(ent)->speed = ent->speed;
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -2009,7 +2008,7 @@ SP_misc_bigviper(edict_t *ent)
 	VectorSet(ent->mins, -176, -120, -24);
 	VectorSet(ent->maxs, 176, 120, 72);
 	ent->s.modelindex = gi.modelindex("models/ships/bigviper/tris.md2");
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -2054,7 +2053,7 @@ misc_viper_bomb_prethink(edict_t *self)
 		diff = -1.0;
 	}
 
-	VectorScale(self->moveinfo.dir, 1.0 + diff, v);
+	VectorScale(G_MoveInfo(self)->dir, 1.0 + diff, v);
 	v[2] = diff;
 
 	diff = self->s.angles[2];
@@ -2082,10 +2081,10 @@ misc_viper_bomb_use(edict_t *self, edict_t *other /* unused */, edict_t *activat
 	self->activator = activator;
 
 	viper = G_Find(NULL, FOFS(classname), "misc_viper");
-	VectorScale(viper->moveinfo.dir, viper->moveinfo.speed, self->velocity);
+	VectorScale(G_MoveInfo(viper)->dir, G_MoveInfo(viper)->speed, self->velocity);
 
 	self->timestamp = level.time;
-	VectorCopy(viper->moveinfo.dir, self->moveinfo.dir);
+	VectorCopy(G_MoveInfo(viper)->dir, G_EnsureMoveInfo(self)->dir);
 }
 
 void
@@ -2111,7 +2110,7 @@ SP_misc_viper_bomb(edict_t *self)
 	self->use = misc_viper_bomb_use;
 	self->svflags |= SVF_NOCLIENT;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /*
@@ -2170,7 +2169,7 @@ SP_misc_viper_missile(edict_t *self)
 	self->use = misc_viper_missile_use;
 	self->svflags |= SVF_NOCLIENT;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /*
@@ -2229,10 +2228,10 @@ SP_misc_strogg_ship(edict_t *ent)
 	ent->nextthink = level.time + FRAMETIME;
 	ent->use = misc_strogg_ship_use;
 	ent->svflags |= SVF_NOCLIENT;
-	ent->moveinfo.accel = ent->moveinfo.decel = ent->moveinfo.speed =
+	G_EnsureMoveInfo(ent)->accel = G_EnsureMoveInfo(ent)->decel = G_EnsureMoveInfo(ent)->speed =
 													ent->speed;
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -2271,14 +2270,14 @@ SP_misc_transport(edict_t *ent)
 	ent->nextthink = level.time + FRAMETIME;
 	ent->use = misc_strogg_ship_use;
 	ent->svflags |= SVF_NOCLIENT;
-	ent->moveinfo.accel = ent->moveinfo.decel = ent->moveinfo.speed = ent->speed;
+	G_EnsureMoveInfo(ent)->accel = G_EnsureMoveInfo(ent)->decel = G_EnsureMoveInfo(ent)->speed = ent->speed;
 
 	if (!(ent->spawnflags & 1))
 	{
 		ent->spawnflags |= 1;
 	}
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -2329,7 +2328,7 @@ SP_misc_satellite_dish(edict_t *ent)
 	VectorSet(ent->maxs, 64, 64, 128);
 	ent->s.modelindex = gi.modelindex("models/objects/satellite/tris.md2");
 	ent->use = misc_satellite_dish_use;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -2348,7 +2347,7 @@ SP_light_mine1(edict_t *ent)
 	ent->movetype = MOVETYPE_NONE;
 	ent->solid = SOLID_BBOX;
 	ent->s.modelindex = gi.modelindex("models/objects/minelite/light1/tris.md2");
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -2365,7 +2364,7 @@ SP_light_mine2(edict_t *ent)
 	ent->movetype = MOVETYPE_NONE;
 	ent->solid = SOLID_BBOX;
 	ent->s.modelindex = gi.modelindex("models/objects/minelite/light2/tris.md2");
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -2390,12 +2389,12 @@ SP_misc_gib_arm(edict_t *ent)
 	ent->movetype = MOVETYPE_TOSS;
 	ent->svflags |= SVF_MONSTER;
 	ent->deadflag = DEAD_DEAD;
-	ent->avelocity[0] = random() * 200;
-	ent->avelocity[1] = random() * 200;
-	ent->avelocity[2] = random() * 200;
+	ent->avelocity[0] = G_Random(RAND_EFFECT) * 200;
+	ent->avelocity[1] = G_Random(RAND_EFFECT) * 200;
+	ent->avelocity[2] = G_Random(RAND_EFFECT) * 200;
 	ent->think = G_FreeEdict;
 	ent->nextthink = level.time + 30;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -2418,12 +2417,12 @@ SP_misc_gib_leg(edict_t *ent)
 	ent->movetype = MOVETYPE_TOSS;
 	ent->svflags |= SVF_MONSTER;
 	ent->deadflag = DEAD_DEAD;
-	ent->avelocity[0] = random() * 200;
-	ent->avelocity[1] = random() * 200;
-	ent->avelocity[2] = random() * 200;
+	ent->avelocity[0] = G_Random(RAND_EFFECT) * 200;
+	ent->avelocity[1] = G_Random(RAND_EFFECT) * 200;
+	ent->avelocity[2] = G_Random(RAND_EFFECT) * 200;
 	ent->think = G_FreeEdict;
 	ent->nextthink = level.time + 30;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -2446,12 +2445,12 @@ SP_misc_gib_head(edict_t *ent)
 	ent->movetype = MOVETYPE_TOSS;
 	ent->svflags |= SVF_MONSTER;
 	ent->deadflag = DEAD_DEAD;
-	ent->avelocity[0] = random() * 200;
-	ent->avelocity[1] = random() * 200;
-	ent->avelocity[2] = random() * 200;
+	ent->avelocity[0] = G_Random(RAND_EFFECT) * 200;
+	ent->avelocity[1] = G_Random(RAND_EFFECT) * 200;
+	ent->avelocity[2] = G_Random(RAND_EFFECT) * 200;
 	ent->think = G_FreeEdict;
 	ent->nextthink = level.time + 30;
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ===================================================== */
@@ -2498,7 +2497,7 @@ SP_target_character(edict_t *self)
 	gi.setmodel(self, self->model);
 	self->solid = SOLID_BSP;
 	self->s.frame = TARGET_CHAR_BLANK;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ===================================================== */
@@ -2855,7 +2854,7 @@ teleporter_touch(edict_t *self, edict_t *other, const cplane_t *plane /* unused
 	/* kill anything at the destination */
 	KillBox(other);
 
-	gi.linkentity(other);
+	G_LinkEntity(other);
 }
 
 /*
@@ -2887,7 +2886,7 @@ SP_misc_teleporter(edict_t *ent)
 
 	VectorSet(ent->mins, -32, -32, -24);
 	VectorSet(ent->maxs, 32, 32, -16);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	trig = G_Spawn();
 	trig->touch = teleporter_touch;
@@ -2897,7 +2896,7 @@ SP_misc_teleporter(edict_t *ent)
 	VectorCopy(ent->s.origin, trig->s.origin);
 	VectorSet(trig->mins, -8, -8, 8);
 	VectorSet(trig->maxs, 8, 8, 24);
-	gi.linkentity(trig);
+	G_LinkEntity(trig);
 }
 
 /*
@@ -2917,7 +2916,7 @@ SP_misc_teleporter_dest(edict_t *ent)
 	ent->solid = SOLID_BBOX;
 	VectorSet(ent->mins, -32, -32, -24);
 	VectorSet(ent->maxs, 32, 32, -16);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -2949,7 +2948,7 @@ SP_misc_amb4(edict_t *ent)
 	ent->think = amb4_think;
 	ent->nextthink = level.time + 1;
 	amb4sound = gi.soundindex("world/amb4.wav");
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -22,10 +22,10 @@ monster_fire_bullet(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 	fire_bullet(self, start, dir, damage, kick, hspread, vspread, MOD_UNKNOWN);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -40,10 +40,10 @@ monster_fire_shotgun(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	fire_shotgun(self, start, aimdir, damage, kick, hspread, vspread,
 			count, MOD_UNKNOWN);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -57,10 +57,10 @@ monster_fire_blaster(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 	fire_blaster(self, start, dir, damage, speed, effect, false);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -74,10 +74,10 @@ monster_fire_blueblaster(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 	fire_blueblaster(self, start, dir, damage, speed, effect);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(MZ_BLUEHYPERBLASTER);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(MZ_BLUEHYPERBLASTER);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -91,10 +91,10 @@ monster_fire_ionripper(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 	fire_ionripper(self, start, dir, damage, speed, effect);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -108,10 +108,10 @@ monster_fire_heat(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 	fire_heat(self, start, dir, damage, speed, damage, damage);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -133,7 +133,7 @@ dabeam_hit(edict_t *self)
 
 	while (1)
 	{
-		tr = gi.trace(start, NULL, NULL, end, ignore,
+		tr = G_Trace(start, NULL, NULL, end, ignore,
 				CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER);
 
 		if (!tr.ent)
@@ -167,13 +167,13 @@ dabeam_hit(edict_t *self)
 			if (self->spawnflags & 0x80000000)
 			{
 				self->spawnflags &= ~0x80000000;
-				gi.WriteByte(svc_temp_entity);
-				gi.WriteByte(TE_LASER_SPARKS);
-				gi.WriteByte(10);
-				gi.WritePosition(tr.endpos);
-				gi.WriteDir(tr.plane.normal);
-				gi.WriteByte(self->s.skinnum);
-				gi.multicast(tr.endpos, MULTICAST_PVS);
+				G_WriteByte(svc_temp_entity);
+				G_WriteByte(TE_LASER_SPARKS);
+				G_WriteByte(10);
+				G_WritePosition(tr.endpos);
+				G_WriteDir(tr.plane.normal);
+				G_WriteByte(self->s.skinnum);
+				G_Multicast(tr.endpos, MULTICAST_PVS);
 			}
 
 			break;
@@ -206,7 +206,7 @@ monster_dabeam(edict_t *self)
 
 	self->s.frame = 2;
 
-	if (self->owner->monsterinfo.aiflags & AI_MEDIC)
+	if (G_MonsterInfo(self->owner)->aiflags & AI_MEDIC)
 	{
 		self->s.skinnum = 0xf3f3f1f1;
 	}
@@ -220,7 +220,7 @@ monster_dabeam(edict_t *self)
 		VectorCopy(self->movedir, last_movedir);
 		VectorMA(self->enemy->absmin, 0.5, self->enemy->size, point);
 
-		if (self->owner->monsterinfo.aiflags & AI_MEDIC)
+		if (G_MonsterInfo(self->owner)->aiflags & AI_MEDIC)
 		{
 			point[0] += sin(level.time) * 8;
 		}
@@ -242,7 +242,7 @@ monster_dabeam(edict_t *self)
 	self->nextthink = level.time + 0.1;
 	VectorSet(self->mins, -8, -8, -8);
 	VectorSet(self->maxs, 8, 8, 8);
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	self->spawnflags |= 0x80000001;
 	self->svflags &= ~SVF_NOCLIENT;
@@ -259,10 +259,10 @@ monster_fire_grenade(edict_t *self, vec3_t start, vec3_t aimdir,
 
 	fire_grenade(self, start, aimdir, damage, speed, 2.5, damage + 40);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -276,10 +276,10 @@ monster_fire_rocket(edict_t *self, vec3_t start, vec3_t dir,
 
 	fire_rocket(self, start, dir, damage, speed, damage + 20, damage);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -293,10 +293,10 @@ monster_fire_railgun(edict_t *self, vec3_t start, vec3_t aimdir,
 
 	fire_rail(self, start, aimdir, damage, kick);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 void
@@ -310,10 +310,10 @@ monster_fire_bfg(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 
 	fire_bfg(self, start, aimdir, damage, speed, damage_radius);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash2);
+	G_WriteShort(self - g_edicts);
+	G_WriteByte(flashtype);
+	G_Multicast(start, MULTICAST_PVS);
 }
 
 /* Monster utility functions */
@@ -344,7 +344,7 @@ M_FliesOn(edict_t *self)
 	}
 
 	self->s.effects |= EF_FLIES;
-	self->s.sound = gi.soundindex("infantry/inflies1.wav");
+	self->s.sound = G_SoundIndex(SND_INFLIES1);
 	self->think = M_FliesOff;
 	self->nextthink = level.time + 60;
 }
@@ -362,13 +362,13 @@ M_FlyCheck(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.5)
+	if (G_Random(RAND_AI) > 0.5)
 	{
 		return;
 	}
 
 	self->think = M_FliesOn;
-	self->nextthink = level.time + 5 + 10 * random();
+	self->nextthink = level.time + 5 + 10 * G_Random(RAND_AI);
 }
 
 void
@@ -379,7 +379,7 @@ AttackFinished(edict_t *self, float time)
 		return;
 	}
 
-	self->monsterinfo.attack_finished = level.time + time;
+	G_EnsureMonsterInfo(self)->attack_finished = level.time + time;
 }
 
 void
@@ -410,7 +410,7 @@ M_CheckGround(edict_t *ent)
 	point[1] = ent->s.origin[1];
 	point[2] = ent->s.origin[2] - 0.25;
 
-	trace = gi.trace(ent->s.origin, ent->mins, ent->maxs,
+	trace = G_Trace(ent->s.origin, ent->mins, ent->maxs,
 			point, ent, MASK_MONSTERSOLID);
 
 	/* check steepness */
@@ -444,7 +444,7 @@ M_CatagorizePosition(edict_t *ent)
 	point[0] = (ent->absmax[0] + ent->absmin[0])/2;
 	point[1] = (ent->absmax[1] + ent->absmin[1])/2;
 	point[2] = ent->absmin[2] + 2;
-	cont = gi.pointcontents(point);
+	cont = G_PointContents(point);
 
 	if (!(cont & MASK_WATER))
 	{
@@ -456,7 +456,7 @@ M_CatagorizePosition(edict_t *ent)
 	ent->watertype = cont;
 	ent->waterlevel = 1;
 	point[2] += 26;
-	cont = gi.pointcontents(point);
+	cont = G_PointContents(point);
 
 	if (!(cont & MASK_WATER))
 	{
@@ -465,7 +465,7 @@ M_CatagorizePosition(edict_t *ent)
 
 	ent->waterlevel = 2;
 	point[2] += 22;
-	cont = gi.pointcontents(point);
+	cont = G_PointContents(point);
 
 	if (cont & MASK_WATER)
 	{
@@ -539,7 +539,7 @@ M_WorldEffects(edict_t *ent)
 	{
 		if (ent->flags & FL_INWATER)
 		{
-			gi.sound(ent, CHAN_BODY, gi.soundindex( "player/watr_out.wav"),
+			gi.sound(ent, CHAN_BODY, G_SoundIndex( SND_WATR_OUT),
 					1, ATTN_NORM, 0);
 			ent->flags &= ~FL_INWATER;
 		}
@@ -573,25 +573,25 @@ M_WorldEffects(edict_t *ent)
 		{
 			if (ent->watertype & CONTENTS_LAVA)
 			{
-				if (random() <= 0.5)
+				if (G_Random(RAND_AI) <= 0.5)
 				{
-					gi.sound(ent, CHAN_BODY, gi.soundindex( "player/lava1.wav"),
+					gi.sound(ent, CHAN_BODY, G_SoundIndex( SND_LAVA1),
 							1, ATTN_NORM, 0);
 				}
 				else
 				{
-					gi.sound(ent, CHAN_BODY, gi.soundindex("player/lava2.wav"),
+					gi.sound(ent, CHAN_BODY, G_SoundIndex(SND_LAVA2),
 							1, ATTN_NORM, 0);
 				}
 			}
 			else if (ent->watertype & CONTENTS_SLIME)
 			{
-				gi.sound(ent, CHAN_BODY, gi.soundindex("player/watr_in.wav"),
+				gi.sound(ent, CHAN_BODY, G_SoundIndex(SND_WATR_IN),
 						1, ATTN_NORM, 0);
 			}
 			else if (ent->watertype & CONTENTS_WATER)
 			{
-				gi.sound(ent, CHAN_BODY, gi.soundindex("player/watr_in.wav"),
+				gi.sound(ent, CHAN_BODY, G_SoundIndex(SND_WATR_IN),
 						1, ATTN_NORM, 0);
 			}
 		}
@@ -616,7 +616,7 @@ M_droptofloor(edict_t *ent)
 	VectorCopy(ent->s.origin, end);
 	end[2] -= 256;
 
-	trace = gi.trace(ent->s.origin, ent->mins, ent->maxs, end,
+	trace = G_Trace(ent->s.origin, ent->mins, ent->maxs, end,
 			ent, MASK_MONSTERSOLID);
 
 	if ((trace.fraction == 1) || trace.allsolid)
@@ -626,7 +626,7 @@ M_droptofloor(edict_t *ent)
 
 	VectorCopy(trace.endpos, ent->s.origin);
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 	M_CheckGround(ent);
 	M_CatagorizePosition(ent);
 }
@@ -642,7 +642,7 @@ M_SetEffects(edict_t *ent)
 	ent->s.effects &= ~(EF_COLOR_SHELL | EF_POWERSCREEN);
 	ent->s.renderfx &= ~(RF_SHELL_RED | RF_SHELL_GREEN | RF_SHELL_BLUE);
 
-	if (ent->monsterinfo.aiflags & AI_RESURRECTING)
+	if (G_MonsterInfo(ent)->aiflags & AI_RESURRECTING)
 	{
 		ent->s.effects |= EF_COLOR_SHELL;
 		ent->s.renderfx |= RF_SHELL_RED;
@@ -655,11 +655,11 @@ M_SetEffects(edict_t *ent)
 
 	if (ent->powerarmor_time > level.time)
 	{
-		if (ent->monsterinfo.power_armor_type == POWER_ARMOR_SCREEN)
+		if (G_MonsterInfo(ent)->power_armor_type == POWER_ARMOR_SCREEN)
 		{
 			ent->s.effects |= EF_POWERSCREEN;
 		}
-		else if (ent->monsterinfo.power_armor_type == POWER_ARMOR_SHIELD)
+		else if (G_MonsterInfo(ent)->power_armor_type == POWER_ARMOR_SHIELD)
 		{
 			ent->s.effects |= EF_COLOR_SHELL;
 			ent->s.renderfx |= RF_SHELL_GREEN;
@@ -678,7 +678,7 @@ M_MoveFrame(edict_t *self)
 		return;
 	}
 
-	move = self->monsterinfo.currentmove;
+	move = G_MonsterInfo(self)->currentmove;
 	self->nextthink = level.time + FRAMETIME;
 
 	if (!move)
@@ -686,22 +686,22 @@ M_MoveFrame(edict_t *self)
 		return;
 	}
 
-	if ((self->monsterinfo.nextframe) &&
-		(self->monsterinfo.nextframe >= move->firstframe) &&
-		(self->monsterinfo.nextframe <= move->lastframe))
+	if ((G_MonsterInfo(self)->nextframe) &&
+		(G_MonsterInfo(self)->nextframe >= move->firstframe) &&
+		(G_MonsterInfo(self)->nextframe <= move->lastframe))
 	{
-		if (self->s.frame != self->monsterinfo.nextframe)
+		if (self->s.frame != G_MonsterInfo(self)->nextframe)
 		{
-			self->s.frame = self->monsterinfo.nextframe;
-			self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			self->s.frame = G_MonsterInfo(self)->nextframe;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 		}
 
-		self->monsterinfo.nextframe = 0;
+		G_EnsureMonsterInfo(self)->nextframe = 0;
 	}
 	else
 	{
 		/* prevent nextframe from leaking into a future move */
-		self->monsterinfo.nextframe = 0;
+		G_EnsureMonsterInfo(self)->nextframe = 0;
 
 		if (self->s.frame == move->lastframe)
 		{
@@ -710,7 +710,7 @@ M_MoveFrame(edict_t *self)
 				move->endfunc(self);
 
 				/* regrab move, endfunc is very likely to change it */
-				move = self->monsterinfo.currentmove;
+				move = G_MonsterInfo(self)->currentmove;
 
 				/* check for death */
 				if (self->svflags & SVF_DEADMONSTER)
@@ -723,12 +723,12 @@ M_MoveFrame(edict_t *self)
 		if ((self->s.frame < move->firstframe) ||
 			(self->s.frame > move->lastframe))
 		{
-			self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 			self->s.frame = move->firstframe;
 		}
 		else
 		{
-			if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
+			if (!(G_MonsterInfo(self)->aiflags & AI_HOLD_FRAME))
 			{
 				self->s.frame++;
 
@@ -744,10 +744,10 @@ M_MoveFrame(edict_t *self)
 
 	if (move->frame[index].aifunc)
 	{
-		if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
+		if (!(G_MonsterInfo(self)->aiflags & AI_HOLD_FRAME))
 		{
 			move->frame[index].aifunc(self,
-					move->frame[index].dist * self->monsterinfo.scale);
+					move->frame[index].dist * G_MonsterInfo(self)->scale);
 		}
 		else
 		{
@@ -771,9 +771,9 @@ monster_think(edict_t *self)
 
 	M_MoveFrame(self);
 
-	if (self->linkcount != self->monsterinfo.linkcount)
+	if (self->linkcount != G_MonsterInfo(self)->linkcount)
 	{
-		self->monsterinfo.linkcount = self->linkcount;
+		G_EnsureMonsterInfo(self)->linkcount = self->linkcount;
 		M_CheckGround(self);
 	}
 
@@ -809,7 +809,7 @@ monster_use(edict_t *self, edict_t *other /* unused */, edict_t *activator)
 		return;
 	}
 
-	if (!(activator->client) && !(activator->monsterinfo.aiflags & AI_GOOD_GUY))
+	if (!(activator->client) && !(G_MonsterInfo(activator)->aiflags & AI_GOOD_GUY))
 	{
 		return;
 	}
@@ -835,7 +835,7 @@ monster_triggered_spawn(edict_t *self)
 	self->movetype = MOVETYPE_STEP;
 	self->svflags &= ~SVF_NOCLIENT;
 	self->air_finished = level.time + 12;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	monster_start_go(self);
 
@@ -909,7 +909,7 @@ monster_death_use(edict_t *self)
 	}
 
 	self->flags &= ~(FL_FLY | FL_SWIM);
-	self->monsterinfo.aiflags &= AI_GOOD_GUY;
+	G_EnsureMonsterInfo(self)->aiflags &= AI_GOOD_GUY;
 
 	if (self->item)
 	{
@@ -944,7 +944,7 @@ monster_start(edict_t *self)
 		return false;
 	}
 
-	if ((self->spawnflags & 4) && !(self->monsterinfo.aiflags & AI_GOOD_GUY))
+	if ((self->spawnflags & 4) && !(G_MonsterInfo(self)->aiflags & AI_GOOD_GUY))
 	{
 		self->spawnflags &= ~4;
 		self->spawnflags |= 1;
@@ -960,7 +960,7 @@ monster_start(edict_t *self)
 		gi.dprintf ("triggered %s at %s has no targetname\n", self->classname, vtos (self->s.origin));
 	}
 
-	if (!(self->monsterinfo.aiflags & AI_GOOD_GUY))
+	if (!(G_MonsterInfo(self)->aiflags & AI_GOOD_GUY))
 	{
 		level.total_monsters++;
 	}
@@ -983,9 +983,9 @@ monster_start(edict_t *self)
 	self->deadflag = DEAD_NO;
 	self->svflags &= ~SVF_DEADMONSTER;
 
-	if (!self->monsterinfo.checkattack)
+	if (!G_MonsterInfo(self)->checkattack)
 	{
-		self->monsterinfo.checkattack = M_CheckAttack;
+		G_EnsureMonsterInfo(self)->checkattack = M_CheckAttack;
 	}
 
 	VectorCopy(self->s.origin, self->s.old_origin);
@@ -1002,12 +1002,12 @@ monster_start(edict_t *self)
 	}
 
 	/* randomize what frame they start on */
-	if (self->monsterinfo.currentmove)
+	if (G_MonsterInfo(self)->currentmove)
 	{
-		self->s.frame = self->monsterinfo.currentmove->firstframe +
-						(randk() %
-						 (self->monsterinfo.currentmove->lastframe -
-		 self->monsterinfo.currentmove->firstframe + 1));
+		self->s.frame = G_MonsterInfo(self)->currentmove->firstframe +
+						(G_RandInt(RAND_AI) %
+						 (G_MonsterInfo(self)->currentmove->lastframe -
+		 G_MonsterInfo(self)->currentmove->firstframe + 1));
 	}
 
 	return true;
@@ -1095,27 +1095,27 @@ monster_start_go(edict_t *self)
 			gi.dprintf("%s can't find target %s at %s\n", self->classname,
 					self->target, vtos(self->s.origin));
 			self->target = NULL;
-			self->monsterinfo.pausetime = 100000000;
-			self->monsterinfo.stand(self);
+			G_EnsureMonsterInfo(self)->pausetime = 100000000;
+			G_MonsterInfo(self)->stand(self);
 		}
 		else if (strcmp(self->movetarget->classname, "path_corner") == 0)
 		{
 			VectorSubtract(self->goalentity->s.origin, self->s.origin, v);
 			self->ideal_yaw = self->s.angles[YAW] = vectoyaw(v);
-			self->monsterinfo.walk(self);
+			G_MonsterInfo(self)->walk(self);
 			self->target = NULL;
 		}
 		else
 		{
 			self->goalentity = self->movetarget = NULL;
-			self->monsterinfo.pausetime = 100000000;
-			self->monsterinfo.stand(self);
+			G_EnsureMonsterInfo(self)->pausetime = 100000000;
+			G_MonsterInfo(self)->stand(self);
 		}
 	}
 	else
 	{
-		self->monsterinfo.pausetime = 100000000;
-		self->monsterinfo.stand(self);
+		G_EnsureMonsterInfo(self)->pausetime = 100000000;
+		G_MonsterInfo(self)->stand(self);
 	}
 
 	self->think = monster_think;
@@ -0,0 +1,605 @@
+/*
+ * =======================================================================
+ *
+ * Accounting of the network messages built by the game. While
+ * g_netstats is set, G_Write*(), G_Multicast() and G_Unicast()
+ * sum up messages and bytes per message type and entity class.
+ * Temp entities are split up by their TE_* type. Otherwise the
+ * macros in local.h go straight to the engine, which costs a
+ * single test of netstats_active.
+ *
+ * The class is taken from the entity in muzzle flash messages,
+ * else from the entity that is running (multicasts) or from the
+ * receiving client (unicasts). The bytes sent are estimated by
+ * testing the PVS or PHS against the origins of the clients.
+ *
+ * =======================================================================
+ */
+
+#include "header/local.h"
+
+#define NETSTAT_HASH 512 /* must be a power of two */
+#define MAX_NETSTATS 384
+
+/* temp entities are counted as NETKIND_TE + TE_* */
+#define NETKIND_TE 256
+
+typedef struct
+{
+	int kind;
+	char classname[32];
+
+	unsigned int msgs;
+	long long bytes;
+	long long sent; /* bytes times the estimated recipients */
+
+	long long framesent; /* in the running frame */
+	long long peaksent; /* the most in a single frame */
+	long long spikesent; /* in the worst frame overall */
+} netstat_t;
+
+static const char *te_names[] = {
+	"TE_GUNSHOT", "TE_BLOOD", "TE_BLASTER", "TE_RAILTRAIL", "TE_SHOTGUN",
+	"TE_EXPLOSION1", "TE_EXPLOSION2", "TE_ROCKET_EXPLOSION",
+	"TE_GRENADE_EXPLOSION", "TE_SPARKS", "TE_SPLASH", "TE_BUBBLETRAIL",
+	"TE_SCREEN_SPARKS", "TE_SHIELD_SPARKS", "TE_BULLET_SPARKS",
+	"TE_LASER_SPARKS", "TE_PARASITE_ATTACK", "TE_ROCKET_EXPLOSION_WATER",
+	"TE_GRENADE_EXPLOSION_WATER", "TE_MEDIC_CABLE_ATTACK", "TE_BFG_EXPLOSION",
+	"TE_BFG_BIGEXPLOSION", "TE_BOSSTPORT", "TE_BFG_LASER", "TE_GRAPPLE_CABLE",
+	"TE_WELDING_SPARKS", "TE_GREENBLOOD", "TE_BLUEHYPERBLASTER",
+	"TE_PLASMA_EXPLOSION", "TE_TUNNEL_SPARKS", "TE_BLASTER2", "TE_RAILTRAIL2",
+	"TE_FLAME", "TE_LIGHTNING", "TE_DEBUGTRAIL", "TE_PLAIN_EXPLOSION",
+	"TE_FLASHLIGHT", "TE_FORCEWALL", "TE_HEATBEAM", "TE_MONSTER_HEATBEAM",
+	"TE_STEAM", "TE_BUBBLETRAIL2", "TE_MOREBLOOD", "TE_HEATBEAM_SPARKS",
+	"TE_HEATBEAM_STEAM", "TE_CHAINFIST_SMOKE", "TE_ELECTRIC_SPARKS",
+	"TE_TRACKER_EXPLOSION", "TE_TELEPORT_EFFECT", "TE_DBALL_GOAL",
+	"TE_WIDOWBEAMOUT", "TE_NUKEBLAST", "TE_WIDOWSPLASH", "TE_EXPLOSION1_BIG",
+	"TE_EXPLOSION1_NP", "TE_FLECHETTE"
+};
+
+static netstat_t netstats[MAX_NETSTATS];
+static short nethash[NETSTAT_HASH]; /* index + 1, 0 is free */
+static int numnetstats;
+static int netframes;
+static unsigned int netdropped;
+
+static long long framesent;
+static long long peakframesent;
+static int peakframe;
+
+/* the message being written */
+static struct
+{
+	int writes;
+	int bytes;
+	int svc;
+	int arg; /* temp entity type or muzzle flash entity */
+} netmsg;
+
+qboolean netstats_active;
+
+/* ====================================================================== */
+
+static const char *
+NetStats_KindName(int kind, char *buf, size_t size)
+{
+	if (kind >= NETKIND_TE)
+	{
+		if (kind - NETKIND_TE < (int)(sizeof(te_names) / sizeof(te_names[0])))
+		{
+			return te_names[kind - NETKIND_TE];
+		}
+
+		Com_sprintf(buf, size, "TE_%i", kind - NETKIND_TE);
+		return buf;
+	}
+
+	switch (kind)
+	{
+		case svc_muzzleflash:
+			return "svc_muzzleflash";
+		case svc_muzzleflash2:
+			return "svc_muzzleflash2";
+		case svc_temp_entity:
+			return "svc_temp_entity";
+		case svc_layout:
+			return "svc_layout";
+		case svc_inventory:
+			return "svc_inventory";
+		case svc_stufftext:
+			return "svc_stufftext";
+		default:
+			Com_sprintf(buf, size, "svc_%i", kind);
+			return buf;
+	}
+}
+
+/* Returns NULL if full. */
+static netstat_t *
+NetStats_Find(int kind, const char *classname)
+{
+	netstat_t *ns;
+	unsigned int h;
+	const char *s;
+	int i;
+
+	h = 2166136261u ^ kind;
+
+	for (s = classname; *s; s++)
+	{
+		h = (h ^ (byte)*s) * 16777619u;
+	}
+
+	for (i = 0; i < NETSTAT_HASH; i++)
+	{
+		h &= NETSTAT_HASH - 1;
+
+		if (!nethash[h])
+		{
+			break;
+		}
+
+		ns = &netstats[nethash[h] - 1];
+
+		if ((ns->kind == kind) &&
+			(strncmp(ns->classname, classname, sizeof(ns->classname) - 1) == 0))
+		{
+			return ns;
+		}
+
+		h++;
+	}
+
+	if ((i == NETSTAT_HASH) || (numnetstats == MAX_NETSTATS))
+	{
+		return NULL;
+	}
+
+	ns = &netstats[numnetstats++];
+	ns->kind = kind;
+	Q_strlcpy(ns->classname, classname, sizeof(ns->classname));
+	nethash[h] = numnetstats;
+
+	return ns;
+}
+
+static int
+NetStats_Recipients(const vec3_t origin, multicast_t to)
+{
+	edict_t *ent;
+	vec3_t org;
+	int i, num;
+
+	VectorCopy(origin, org);
+	num = 0;
+
+	for (i = 1; i <= game.maxclients; i++)
+	{
+		ent = &g_edicts[i];
+
+		if (!ent->inuse || !ent->client || !ent->client->pers.connected)
+		{
+			continue;
+		}
+
+		switch (to)
+		{
+			case MULTICAST_PHS:
+			case MULTICAST_PHS_R:
+				num += gi.inPHS(org, ent->s.origin) ? 1 : 0;
+				break;
+			case MULTICAST_PVS:
+			case MULTICAST_PVS_R:
+				num += gi.inPVS(org, ent->s.origin) ? 1 : 0;
+				break;
+			default:
+				num++;
+				break;
+		}
+	}
+
+	return num;
+}
+
+/*
+ * Books the message written so far. source
+ * is used if the message doesn't name one.
+ */
+static void
+NetStats_Send(const edict_t *source, int recipients)
+{
+	const char *classname;
+	netstat_t *ns;
+	int kind;
+
+	if (!netmsg.writes)
+	{
+		return;
+	}
+
+	kind = netmsg.svc;
+
+	if ((kind == svc_temp_entity) && (netmsg.writes > 1))
+	{
+		kind = NETKIND_TE + netmsg.arg;
+	}
+	else if (((kind == svc_muzzleflash) || (kind == svc_muzzleflash2)) &&
+			 (netmsg.writes > 1) && (netmsg.arg > 0) &&
+			 (netmsg.arg < globals.num_edicts))
+	{
+		source = &g_edicts[netmsg.arg];
+	}
+
+	if (!source)
+	{
+		classname = "none";
+	}
+	else if (!source->classname)
+	{
+		classname = "noclass";
+	}
+	else
+	{
+		classname = source->classname;
+	}
+
+	ns = NetStats_Find(kind, classname);
+
+	if (ns)
+	{
+		ns->msgs++;
+		ns->bytes += netmsg.bytes;
+		ns->sent += (long long)netmsg.bytes * recipients;
+		ns->framesent += (long long)netmsg.bytes * recipients;
+	}
+	else
+	{
+		netdropped++;
+	}
+
+	framesent += (long long)netmsg.bytes * recipients;
+	memset(&netmsg, 0, sizeof(netmsg));
+}
+
+static void
+NetStats_Add(int size, int value)
+{
+	if (netmsg.writes == 0)
+	{
+		netmsg.svc = value & 0xff;
+	}
+	else if (netmsg.writes == 1)
+	{
+		netmsg.arg = value;
+	}
+
+	netmsg.writes++;
+	netmsg.bytes += size;
+}
+
+/* ====================================================================== */
+
+/*
+ * Use the G_Write*() macros, they
+ * only call here while counting.
+ */
+void
+G_NetMulticast(const vec3_t origin, multicast_t to)
+{
+	NetStats_Send(level.current_entity, NetStats_Recipients(origin, to));
+	gi.multicast(origin, to);
+}
+
+void
+G_NetUnicast(const edict_t *ent, qboolean reliable)
+{
+	NetStats_Send(ent, 1);
+	gi.unicast(ent, reliable);
+}
+
+void
+G_NetWriteChar(int c)
+{
+	NetStats_Add(1, c);
+	gi.WriteChar(c);
+}
+
+void
+G_NetWriteByte(int c)
+{
+	NetStats_Add(1, c);
+	gi.WriteByte(c);
+}
+
+void
+G_NetWriteShort(int c)
+{
+	NetStats_Add(2, c);
+	gi.WriteShort(c);
+}
+
+void
+G_NetWriteLong(int c)
+{
+	NetStats_Add(4, c);
+	gi.WriteLong(c);
+}
+
+void
+G_NetWriteFloat(float f)
+{
+	NetStats_Add(4, 0);
+	gi.WriteFloat(f);
+}
+
+void
+G_NetWriteString(const char *s)
+{
+	NetStats_Add(s ? (int)strlen(s) + 1 : 1, 0);
+	gi.WriteString(s);
+}
+
+void
+G_NetWritePosition(const vec3_t pos)
+{
+	NetStats_Add(6, 0);
+	gi.WritePosition(pos);
+}
+
+void
+G_NetWriteDir(const vec3_t dir)
+{
+	NetStats_Add(1, 0);
+	gi.WriteDir(dir);
+}
+
+void
+G_NetWriteAngle(float f)
+{
+	NetStats_Add(1, 0);
+	gi.WriteAngle(f);
+}
+
+/* ====================================================================== */
+
+/*
+ * Closes the previous frame and picks up
+ * changes to g_netstats. Called at the
+ * start of every server frame.
+ */
+void
+G_NetStatsBeginFrame(void)
+{
+	netstat_t *ns;
+	qboolean spike;
+	int i;
+
+	if (netstats_active)
+	{
+		netframes++;
+
+		spike = framesent > peakframesent;
+
+		if (spike)
+		{
+			peakframesent = framesent;
+			peakframe = level.framenum;
+		}
+
+		for (i = 0, ns = netstats; i < numnetstats; i++, ns++)
+		{
+			if (ns->framesent > ns->peaksent)
+			{
+				ns->peaksent = ns->framesent;
+			}
+
+			if (spike)
+			{
+				ns->spikesent = ns->framesent;
+			}
+
+			ns->framesent = 0;
+		}
+
+		framesent = 0;
+	}
+
+	/* a message never spans frames */
+	memset(&netmsg, 0, sizeof(netmsg));
+	netstats_active = g_netstats->value != 0;
+}
+
+static void
+NetStats_Reset(void)
+{
+	memset(netstats, 0, sizeof(netstats));
+	memset(nethash, 0, sizeof(nethash));
+	numnetstats = 0;
+	netframes = 0;
+	netdropped = 0;
+	framesent = 0;
+	peakframesent = 0;
+	peakframe = 0;
+}
+
+static int
+NetStats_CompareSent(const void *a, const void *b)
+{
+	const netstat_t *na, *nb;
+
+	na = &netstats[*(const int *)a];
+	nb = &netstats[*(const int *)b];
+
+	return (na->sent < nb->sent) - (na->sent > nb->sent);
+}
+
+static int
+NetStats_CompareSpike(const void *a, const void *b)
+{
+	const netstat_t *na, *nb;
+
+	na = &netstats[*(const int *)a];
+	nb = &netstats[*(const int *)b];
+
+	return (na->spikesent < nb->spikesent) - (na->spikesent > nb->spikesent);
+}
+
+static int
+NetStats_Sort(int *order, int (*compare)(const void *, const void *))
+{
+	int i;
+
+	for (i = 0; i < numnetstats; i++)
+	{
+		order[i] = i;
+	}
+
+	qsort(order, numnetstats, sizeof(order[0]), compare);
+
+	return numnetstats;
+}
+
+static void
+NetStats_WriteCSV(const char *file)
+{
+	int order[MAX_NETSTATS];
+	char name[MAX_OSPATH];
+	char kind[32];
+	netstat_t *ns;
+	cvar_t *game;
+	FILE *f;
+	int i, num;
+
+	game = gi.cvar("game", "", 0);
+
+	Com_sprintf(name, sizeof(name), "%s/%s.csv",
+			*game->string ? game->string : GAMEVERSION, file);
+
+	f = Q_fopen(name, "w");
+
+	if (!f)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", name);
+		return;
+	}
+
+	fprintf(f, "message,class,msgs,bytes,sent,frames,peak_sent,spike_sent\n");
+
+	num = NetStats_Sort(order, NetStats_CompareSent);
+
+	for (i = 0; i < num; i++)
+	{
+		ns = &netstats[order[i]];
+
+		fprintf(f, "%s,%s,%u,%lld,%lld,%i,%lld,%lld\n",
+				NetStats_KindName(ns->kind, kind, sizeof(kind)), ns->classname,
+				ns->msgs, ns->bytes, ns->sent, netframes, ns->peaksent,
+				ns->spikesent);
+	}
+
+	fclose(f);
+
+	gi.cprintf(NULL, PRINT_HIGH, "Wrote %i entries to %s\n", num, name);
+}
+
+static void
+NetStats_Print(int count)
+{
+	int order[MAX_NETSTATS];
+	long long total;
+	char kind[32];
+	netstat_t *ns;
+	int i, num, frames;
+
+	frames = netframes ? netframes : 1;
+	total = 0;
+
+	num = NetStats_Sort(order, NetStats_CompareSent);
+
+	gi.cprintf(NULL, PRINT_HIGH, "%-26s %-20s %7s %9s %10s %8s %7s\n",
+			"message", "class", "msgs", "bytes", "sent", "/frame", "peak");
+
+	for (i = 0; i < num; i++)
+	{
+		ns = &netstats[order[i]];
+		total += ns->sent;
+
+		if (i >= count)
+		{
+			continue;
+		}
+
+		gi.cprintf(NULL, PRINT_HIGH, "%-26s %-20.20s %7u %9lld %10lld %8.1f %7lld\n",
+				NetStats_KindName(ns->kind, kind, sizeof(kind)), ns->classname,
+				ns->msgs, ns->bytes, ns->sent, (float)ns->sent / frames,
+				ns->peaksent);
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n%lld bytes sent over %i frames, %.1f per frame\n",
+			total, netframes, (float)total / frames);
+
+	if (peakframesent)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Worst frame %i with %lld bytes:\n",
+				peakframe, peakframesent);
+
+		NetStats_Sort(order, NetStats_CompareSpike);
+
+		for (i = 0; (i < num) && (i < 10); i++)
+		{
+			ns = &netstats[order[i]];
+
+			if (!ns->spikesent)
+			{
+				break;
+			}
+
+			gi.cprintf(NULL, PRINT_HIGH, "  %-26s %-20.20s %7lld\n",
+					NetStats_KindName(ns->kind, kind, sizeof(kind)),
+					ns->classname, ns->spikesent);
+		}
+	}
+
+	if (netdropped)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "%u messages not recorded\n", netdropped);
+	}
+
+	if (!netstats_active)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "g_netstats is 0\n");
+	}
+}
+
+/*
+ * sv netstats [count]
+ * sv netstats reset
+ * sv netstats csv <file>
+ */
+void
+SVCmd_NetStats_f(void)
+{
+	const char *arg;
+
+	arg = gi.argv(2);
+
+	if (Q_stricmp(arg, "reset") == 0)
+	{
+		NetStats_Reset();
+		gi.cprintf(NULL, PRINT_HIGH, "Network statistics reset.\n");
+	}
+	else if (Q_stricmp(arg, "csv") == 0)
+	{
+		if (gi.argc() < 4)
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "Usage: sv netstats csv <file>\n");
+			return;
+		}
+
+		NetStats_WriteCSV(gi.argv(3));
+	}
+	else
+	{
+		NetStats_Print(*arg ? (int)strtol(arg, NULL, 10) : 30);
+	}
+}
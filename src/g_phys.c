@@ -10,6 +10,14 @@
 #define STOP_EPSILON 0.1
 #define MAX_CLIP_PLANES 5
 
+/* number of frames covered by a single
+   sweep of a ballistic trajectory */
+#define BALLISTIC_LOOKAHEAD 4
+
+/* no sweep if a mover or another blocking
+   entity is this close to the swept volume */
+#define BALLISTIC_MARGIN 128
+
 #define sv_stopspeed 100
 #define sv_friction 6
 #define sv_waterfriction 1
@@ -55,7 +63,7 @@ SV_TestEntityPosition(edict_t *ent)
 		mask = MASK_SOLID;
 	}
 
-	trace = gi.trace(ent->s.origin, ent->mins, ent->maxs,
+	trace = G_Trace(ent->s.origin, ent->mins, ent->maxs,
 			ent->s.origin, ent, mask);
 
 	if (trace.startsolid)
@@ -111,7 +119,10 @@ SV_RunThink(edict_t *ent)
 
 	if (ent->think)
 	{
+		G_FlightEvent(FLIGHT_THINK, ent, NULL, 0);
+		G_SpanBegin("think", ent);
 		ent->think(ent);
+		G_SpanEnd();
 	}
 
 	return false;
@@ -135,11 +146,15 @@ SV_Impact(edict_t *e1, trace_t *trace)
 
 	if (e1->touch && (e1->solid != SOLID_NOT))
 	{
+		G_MarkEdictDirty(e2);
+		G_FlightEvent(FLIGHT_TOUCH, e1, e2, 0);
 		e1->touch(e1, e2, &trace->plane, trace->surface);
 	}
 
 	if (e2->touch && (e2->solid != SOLID_NOT))
 	{
+		G_MarkEdictDirty(e2);
+		G_FlightEvent(FLIGHT_TOUCH, e2, e1, 0);
 		e2->touch(e2, e1, NULL, NULL);
 	}
 }
@@ -232,7 +247,7 @@ SV_FlyMove(edict_t *ent, float time, int mask)
 			end[i] = ent->s.origin[i] + time_left * ent->velocity[i];
 		}
 
-		trace = gi.trace(ent->s.origin, ent->mins, ent->maxs, end, ent, mask);
+		trace = G_Trace(ent->s.origin, ent->mins, ent->maxs, end, ent, mask);
 
 		if (trace.allsolid)
 		{
@@ -500,7 +515,7 @@ retry:
 		mask = MASK_SOLID;
 	}
 
-	trace = gi.trace(start, ent->mins, ent->maxs, end, ent, mask);
+	trace = G_Trace(start, ent->mins, ent->maxs, end, ent, mask);
 
 	/* startsolid treats different-content volumes
 	   as continuous, like the bbox of a monster/player
@@ -510,11 +525,11 @@ retry:
 	*/
 	if (trace.startsolid && (mask & ~MASK_SOLID))
 	{
-		trace = gi.trace (start, ent->mins, ent->maxs, end, ent, MASK_SOLID);
+		trace = G_Trace (start, ent->mins, ent->maxs, end, ent, MASK_SOLID);
 	}
 
 	VectorCopy(trace.endpos, ent->s.origin);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	/* Push slightly away from non-horizontal surfaces,
 	   prevent origin stuck in the plane which causes
@@ -541,7 +556,7 @@ retry:
 		{
 			/* move the pusher back and try again */
 			VectorCopy(start, ent->s.origin);
-			gi.linkentity(ent);
+			G_LinkEntity(ent);
 			goto retry;
 		}
 	}
@@ -580,6 +595,8 @@ Pushed_Append(edict_t *e)
 		return false;
 	}
 
+	G_MarkEdictDirty(e);
+
 	pushed_p->ent = e;
 	VectorCopy(e->s.origin, pushed_p->origin);
 	VectorCopy(e->s.angles, pushed_p->angles);
@@ -610,7 +627,7 @@ Pushed_Undo(void)
 		VectorCopy(p->origin, p->ent->s.origin);
 		VectorCopy(p->angles, p->ent->s.angles);
 
-		gi.linkentity(p->ent);
+		G_LinkEntity(p->ent);
 	}
 
 	pushed_p = pushed;
@@ -674,7 +691,7 @@ SV_Push(edict_t *pusher, vec3_t move, vec3_t amove)
 
 	VectorAdd(pusher->s.origin, move, pusher->s.origin);
 	VectorAdd(pusher->s.angles, amove, pusher->s.angles);
-	gi.linkentity(pusher);
+	G_LinkEntity(pusher);
 
 	/* Create a real bounding box for
 	   rotating brush models. */
@@ -767,7 +784,7 @@ SV_Push(edict_t *pusher, vec3_t move, vec3_t amove)
 
 			if (!SV_TestEntityPosition(check))
 			{
-				gi.linkentity(check);
+				G_LinkEntity(check);
 				continue;
 			}
 
@@ -853,6 +870,7 @@ SV_Physics_Pusher(edict_t *ent)
 
 		if (part->blocked)
 		{
+			G_MarkEdictDirty(obstacle);
 			part->blocked(part, obstacle);
 		}
 	}
@@ -900,7 +918,7 @@ SV_Physics_Noclip(edict_t *ent)
 	VectorMA(ent->s.angles, FRAMETIME, ent->avelocity, ent->s.angles);
 	VectorMA(ent->s.origin, FRAMETIME, ent->velocity, ent->s.origin);
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ============================================================================== */
@@ -1022,7 +1040,7 @@ SV_Physics_Toss(edict_t *ent)
 
 	/* check for water transition */
 	wasinwater = (ent->watertype & MASK_WATER);
-	ent->watertype = gi.pointcontents(ent->s.origin);
+	ent->watertype = G_PointContents(ent->s.origin);
 	isinwater = ent->watertype & MASK_WATER;
 
 	if (isinwater)
@@ -1040,21 +1058,317 @@ SV_Physics_Toss(edict_t *ent)
 		if (level.framenum > 3)
 		{
 			gi.positioned_sound(old_origin, g_edicts, CHAN_AUTO,
-					gi.soundindex("misc/h2ohit1.wav"), 1, 1, 0);
+					G_SoundIndex(SND_H2OHIT1), 1, 1, 0);
 		}
 	}
 	else if (wasinwater && !isinwater)
 	{
 		gi.positioned_sound(ent->s.origin, g_edicts, CHAN_AUTO,
-				gi.soundindex("misc/h2ohit1.wav"), 1, 1, 0);
+				G_SoundIndex(SND_H2OHIT1), 1, 1, 0);
 	}
 
 	/* move teamslaves */
 	for (slave = ent->teamchain; slave; slave = slave->teamchain)
 	{
 		VectorCopy(ent->s.origin, slave->s.origin);
-		gi.linkentity(slave);
+		G_LinkEntity(slave);
+	}
+}
+
+/*
+ * Sweep state of the FL_BALLISTIC entities, by edict number.
+ * Not saved, a loaded game just starts with a new sweep.
+ */
+typedef struct
+{
+	float wait; /* last frame covered by the sweep */
+	vec3_t origin; /* where the last frame left us */
+	vec3_t velocity;
+} ballistic_t;
+
+static ballistic_t *ballistics;
+
+/*
+ * True if nothing that could block a trace with mask is
+ * near the box, e.g. a door that moves into the path.
+ */
+static qboolean
+SV_BallisticClear(const edict_t *ent, const vec3_t mins, const vec3_t maxs,
+		int mask)
+{
+	edict_t *touch[MAX_EDICTS], *hit;
+	vec3_t absmin, absmax;
+	int i, num;
+
+	for (i = 0; i < 3; i++)
+	{
+		absmin[i] = mins[i] - BALLISTIC_MARGIN;
+		absmax[i] = maxs[i] + BALLISTIC_MARGIN;
+	}
+
+	num = G_BoxEdicts(absmin, absmax, touch, MAX_EDICTS, AREA_SOLID);
+
+	for (i = 0; i < num; i++)
+	{
+		hit = touch[i];
+
+		if (hit == ent)
+		{
+			continue;
+		}
+
+		/* boxes only block traces that include monsters */
+		if ((hit->solid == SOLID_BSP) || (mask & CONTENTS_MONSTER))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Cheap toss and bounce movement for cosmetic entities
+ * (FL_BALLISTIC), e.g. gibs and debris. Instead of tracing
+ * every frame the trajectory is swept a few frames ahead
+ * in one trace and then integrated blindly until the swept
+ * part is used up or an impact is due. Triggers are never
+ * touched, only the entities own touch function is run.
+ *
+ * The sweep traces the chord of the arc with the box grown
+ * by how far the arc bends away from it, so it covers every
+ * frame's segment. It is only done with no mover or other
+ * blocking entity nearby, those may move into the path.
+ */
+static void
+SV_Physics_Ballistic(edict_t *ent)
+{
+	trace_t trace;
+	ballistic_t *b;
+	vec3_t end, vel, mins, maxs;
+	vec3_t points[BALLISTIC_LOOKAHEAD + 1];
+	vec3_t absmin, absmax;
+	vec3_t old_origin;
+	float backoff, bend;
+	int i, j, frames, mask;
+	qboolean wasinwater;
+	qboolean isinwater;
+
+	if (!ent)
+	{
+		return;
+	}
+
+	SV_RunThink(ent);
+
+	/* entities are very often freed during thinking */
+	if (!ent->inuse)
+	{
+		return;
+	}
+
+	if (ent->velocity[2] > 0)
+	{
+		ent->groundentity = NULL;
+	}
+
+	/* check for the groundentity going away */
+	if (ent->groundentity)
+	{
+		if (!ent->groundentity->inuse)
+		{
+			ent->groundentity = NULL;
+		}
+	}
+
+	/* if onground, return without moving */
+	if (ent->groundentity)
+	{
+		return;
+	}
+
+	b = &ballistics[ent - g_edicts];
+
+	/* something else moved or pushed us, the sweep is stale */
+	if (!VectorCompare(ent->s.origin, b->origin) ||
+		!VectorCompare(ent->velocity, b->velocity))
+	{
+		b->wait = 0;
+	}
+
+	VectorCopy(ent->s.origin, old_origin);
+
+	SV_CheckVelocity(ent);
+	SV_AddGravity(ent);
+
+	VectorMA(ent->s.angles, FRAMETIME, ent->avelocity, ent->s.angles);
+	VectorMA(ent->s.origin, FRAMETIME, ent->velocity, end);
+
+	/* still inside the swept part of the trajectory */
+	if (level.time <= b->wait + 0.001)
+	{
+		VectorCopy(end, ent->s.origin);
+		VectorCopy(end, b->origin);
+		VectorCopy(ent->velocity, b->velocity);
+		G_LinkEntity(ent);
+		return;
+	}
+
+	if (ent->clipmask)
+	{
+		mask = ent->clipmask;
+	}
+	else
+	{
+		mask = MASK_SOLID;
+	}
+
+	/* the positions at the end of the next frames */
+	VectorCopy(ent->s.origin, points[0]);
+	VectorCopy(end, points[1]);
+	VectorCopy(ent->velocity, vel);
+
+	for (i = 2; i <= BALLISTIC_LOOKAHEAD; i++)
+	{
+		vel[2] -= ent->gravity * sv_gravity->value * FRAMETIME;
+		VectorMA(points[i - 1], FRAMETIME, vel, points[i]);
+	}
+
+	/* grow the box by how far the path bends away from the
+	   chord, the horizontal movement is linear in time */
+	VectorCopy(ent->mins, mins);
+	VectorCopy(ent->maxs, maxs);
+
+	for (i = 1; i < BALLISTIC_LOOKAHEAD; i++)
+	{
+		bend = points[i][2] - (points[0][2] + (points[BALLISTIC_LOOKAHEAD][2] -
+					points[0][2]) * i / BALLISTIC_LOOKAHEAD);
+
+		if (bend > maxs[2] - ent->maxs[2])
+		{
+			maxs[2] = ent->maxs[2] + bend;
+		}
+		else if (bend < mins[2] - ent->mins[2])
+		{
+			mins[2] = ent->mins[2] + bend;
+		}
+	}
+
+	for (j = 0; j < 3; j++)
+	{
+		if (points[0][j] < points[BALLISTIC_LOOKAHEAD][j])
+		{
+			absmin[j] = points[0][j] + mins[j];
+			absmax[j] = points[BALLISTIC_LOOKAHEAD][j] + maxs[j];
+		}
+		else
+		{
+			absmin[j] = points[BALLISTIC_LOOKAHEAD][j] + mins[j];
+			absmax[j] = points[0][j] + maxs[j];
+		}
+	}
+
+	frames = 0;
+
+	if (SV_BallisticClear(ent, absmin, absmax, mask))
+	{
+		trace = G_Trace(points[0], mins, maxs, points[BALLISTIC_LOOKAHEAD],
+				ent, mask);
+
+		if (!trace.startsolid)
+		{
+			frames = (int)(trace.fraction * BALLISTIC_LOOKAHEAD);
+		}
+	}
+
+	if (frames >= 1)
+	{
+		/* no impact this frame */
+		b->wait = level.time + (frames - 1) * FRAMETIME;
+		VectorCopy(end, ent->s.origin);
+	}
+	else
+	{
+		/* impact may be due, trace this frame precisely */
+		b->wait = 0;
+		trace = G_Trace(ent->s.origin, ent->mins, ent->maxs, end, ent, mask);
+		VectorCopy(trace.endpos, ent->s.origin);
+
+		if (trace.fraction < 1)
+		{
+			/* Push slightly away from non-horizontal
+			   surfaces, see SV_PushEntity() */
+			if (trace.plane.type != 2)
+			{
+				VectorAdd(ent->s.origin, trace.plane.normal, ent->s.origin);
+			}
+
+			if (ent->touch)
+			{
+				G_MarkEdictDirty(trace.ent);
+				G_FlightEvent(FLIGHT_TOUCH, ent, trace.ent, 0);
+				ent->touch(ent, trace.ent, &trace.plane, trace.surface);
+
+				if (!ent->inuse)
+				{
+					return;
+				}
+			}
+
+			if (ent->movetype == MOVETYPE_BOUNCE)
+			{
+				backoff = 1.5;
+			}
+			else
+			{
+				backoff = 1;
+			}
+
+			ClipVelocity(ent->velocity, trace.plane.normal, ent->velocity, backoff);
+
+			/* stop if on ground */
+			if (trace.plane.normal[2] > 0.7)
+			{
+				if ((ent->velocity[2] < 60) || (ent->movetype != MOVETYPE_BOUNCE))
+				{
+					ent->groundentity = trace.ent;
+					ent->groundentity_linkcount = trace.ent->linkcount;
+					VectorCopy(vec3_origin, ent->velocity);
+					VectorCopy(vec3_origin, ent->avelocity);
+				}
+			}
+		}
+	}
+
+	/* check for water transition, only
+	   done when the trajectory is traced */
+	wasinwater = (ent->watertype & MASK_WATER);
+	ent->watertype = G_PointContents(ent->s.origin);
+	isinwater = ent->watertype & MASK_WATER;
+
+	if (isinwater)
+	{
+		ent->waterlevel = 1;
+	}
+	else
+	{
+		ent->waterlevel = 0;
+	}
+
+	if (!wasinwater && isinwater)
+	{
+		gi.positioned_sound(old_origin, g_edicts, CHAN_AUTO,
+				G_SoundIndex(SND_H2OHIT1), 1, 1, 0);
 	}
+	else if (wasinwater && !isinwater)
+	{
+		gi.positioned_sound(ent->s.origin, g_edicts, CHAN_AUTO,
+				G_SoundIndex(SND_H2OHIT1), 1, 1, 0);
+	}
+
+	VectorCopy(ent->s.origin, b->origin);
+	VectorCopy(ent->velocity, b->velocity);
+	G_LinkEntity(ent);
 }
 
 /* =============================================================================== */
@@ -1252,7 +1566,7 @@ SV_Physics_Step(edict_t *ent)
 		   move. */
 		if (!VectorCompare(ent->s.origin, oldorig))
 		{
-			tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin, ent, mask);
+			tr = G_Trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin, ent, mask);
 
 			if (tr.startsolid)
 			{
@@ -1260,7 +1574,7 @@ SV_Physics_Step(edict_t *ent)
 			}
 		}
 
-		gi.linkentity(ent);
+		G_LinkEntity(ent);
 		G_TouchTriggers(ent);
 
 		if (!ent->inuse)
@@ -1274,7 +1588,7 @@ SV_Physics_Step(edict_t *ent)
 			{
 				if (hitsound)
 				{
-					gi.sound(ent, 0, gi.soundindex("world/land.wav"), 1, 1, 0);
+					gi.sound(ent, 0, G_SoundIndex(SND_LAND), 1, 1, 0);
 				}
 			}
 		}
@@ -1315,6 +1629,15 @@ G_RunEntity(edict_t *ent)
 			break;
 		case MOVETYPE_TOSS:
 		case MOVETYPE_BOUNCE:
+			if (ent->flags & FL_BALLISTIC)
+			{
+				SV_Physics_Ballistic(ent);
+			}
+			else
+			{
+				SV_Physics_Toss(ent);
+			}
+			break;
 		case MOVETYPE_FLY:
 		case MOVETYPE_FLYMISSILE:
 		case MOVETYPE_WALLBOUNCE:
@@ -1329,3 +1652,255 @@ G_RunEntity(edict_t *ent)
 	}
 }
 
+/* ============================================================================ */
+
+/*
+ * Compact mirror of the edict fields the frame loop needs to
+ * decide whether an edict has to be run at all. Edicts that
+ * are known to do nothing this frame (resting items, closed
+ * doors, triggers, lights, ...) are skipped without touching
+ * more than one cache line of the edict itself.
+ *
+ * The mirror is refreshed after an edict was run. Everything
+ * that changes an edict from the outside (use, touch, damage,
+ * pushers, movers) should call G_MarkEdictDirty(), so the
+ * edict is run at least once and resynced. A nextthink set
+ * from the outside without a mark is caught anyway, since it
+ * no longer matches the mirrored one.
+ */
+
+#define EM_INUSE 1
+#define EM_DIRTY 2 /* changed from the outside, run it */
+#define EM_QUIET 4 /* physics do nothing until woken */
+
+static byte *em_state;
+static float *em_nextthink;
+static int *em_linkcount;
+static int *em_ground; /* -1 if not on ground */
+static int *em_groundlink;
+
+void
+G_InitEdictMirror(void)
+{
+	em_state = gi.TagMalloc(game.maxentities * sizeof(*em_state), TAG_GAME);
+	em_nextthink = gi.TagMalloc(game.maxentities * sizeof(*em_nextthink), TAG_GAME);
+	em_linkcount = gi.TagMalloc(game.maxentities * sizeof(*em_linkcount), TAG_GAME);
+	em_ground = gi.TagMalloc(game.maxentities * sizeof(*em_ground), TAG_GAME);
+	em_groundlink = gi.TagMalloc(game.maxentities * sizeof(*em_groundlink), TAG_GAME);
+	ballistics = gi.TagMalloc(game.maxentities * sizeof(*ballistics), TAG_GAME);
+}
+
+/*
+ * Forces the edict to be run by the next frame loop
+ * that gets to it. Must be called after all edicts
+ * were replaced, e.g. by a map change or a loadgame.
+ */
+void
+G_ResetEdictMirror(void)
+{
+	int i;
+
+	if (!em_state)
+	{
+		return;
+	}
+
+	for (i = 0; i < game.maxentities; i++)
+	{
+		em_state[i] = ((i < globals.num_edicts) && g_edicts[i].inuse) ?
+			(EM_INUSE | EM_DIRTY) : 0;
+	}
+}
+
+void
+G_MarkEdictDirty(const edict_t *ent)
+{
+	if (!ent || !em_state)
+	{
+		return;
+	}
+
+	em_state[ent - g_edicts] = ent->inuse ? (EM_INUSE | EM_DIRTY) : 0;
+}
+
+/*
+ * True if running the edict is a no-op
+ * as long as its think isn't due.
+ */
+static qboolean
+SV_IsQuiet(const edict_t *ent)
+{
+	if (ent->prethink || ent->client || (ent->svflags & SVF_MONSTER))
+	{
+		return false;
+	}
+
+	/* old_origin must not change when skipped */
+	if (!VectorCompare(ent->s.origin, ent->s.old_origin))
+	{
+		return false;
+	}
+
+	switch ((int)ent->movetype)
+	{
+		case MOVETYPE_NONE:
+			return true;
+		case MOVETYPE_PUSH:
+		case MOVETYPE_STOP:
+			/* team slaves are moved by their captain */
+			if (ent->flags & FL_TEAMSLAVE)
+			{
+				return true;
+			}
+
+			return !ent->teamchain &&
+				VectorCompare(ent->velocity, vec3_origin) &&
+				VectorCompare(ent->avelocity, vec3_origin);
+		case MOVETYPE_TOSS:
+		case MOVETYPE_BOUNCE:
+		case MOVETYPE_FLY:
+		case MOVETYPE_FLYMISSILE:
+		case MOVETYPE_WALLBOUNCE:
+			/* at rest on the ground */
+			return !(ent->flags & FL_TEAMSLAVE) && ent->groundentity &&
+				ent->groundentity->inuse && (ent->velocity[2] <= 0);
+		default:
+			return false;
+	}
+}
+
+/*
+ * Called after the edict was run.
+ */
+void
+G_SyncEdictMirror(const edict_t *ent)
+{
+	int i;
+
+	if (!ent || !em_state)
+	{
+		return;
+	}
+
+	i = ent - g_edicts;
+
+	if (!ent->inuse)
+	{
+		em_state[i] = 0;
+		return;
+	}
+
+	em_nextthink[i] = ent->nextthink;
+	em_linkcount[i] = ent->linkcount;
+
+	if (ent->groundentity)
+	{
+		em_ground[i] = ent->groundentity - g_edicts;
+		em_groundlink[i] = ent->groundentity_linkcount;
+	}
+	else
+	{
+		em_ground[i] = -1;
+	}
+
+	em_state[i] = EM_INUSE;
+
+	if (SV_IsQuiet(ent))
+	{
+		em_state[i] |= EM_QUIET;
+	}
+}
+
+/*
+ * Decides if the frame loop has to run
+ * the edict with the given number.
+ */
+qboolean
+G_EdictNeedsRun(int num)
+{
+	const edict_t *ent, *ground;
+	float thinktime;
+	int state;
+
+	/* clients are always run */
+	if (!em_state || ((num > 0) && (num <= game.maxclients)))
+	{
+		return g_edicts[num].inuse;
+	}
+
+	state = em_state[num];
+
+	if (!(state & EM_INUSE))
+	{
+		return false;
+	}
+
+	if ((state & (EM_DIRTY | EM_QUIET)) != EM_QUIET)
+	{
+		return true;
+	}
+
+	thinktime = em_nextthink[num];
+
+	if ((thinktime > 0) && (thinktime <= level.time + 0.001))
+	{
+		return true;
+	}
+
+	ent = &g_edicts[num];
+
+	/* rescheduled by somebody else */
+	if (ent->nextthink != thinktime)
+	{
+		return true;
+	}
+
+	/* moved by somebody else */
+	if (ent->linkcount != em_linkcount[num])
+	{
+		return true;
+	}
+
+	/* the ground moved or went away */
+	if (em_ground[num] >= 0)
+	{
+		ground = &g_edicts[em_ground[num]];
+
+		if (!ground->inuse || (ground->linkcount != em_groundlink[num]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Number of edicts in use and how
+ * many of them are currently quiet.
+ */
+void
+G_EdictMirrorStats(int *inuse, int *quiet)
+{
+	int i;
+
+	*inuse = *quiet = 0;
+
+	if (!em_state)
+	{
+		return;
+	}
+
+	for (i = 0; i < globals.num_edicts; i++)
+	{
+		if (em_state[i] & EM_INUSE)
+		{
+			(*inuse)++;
+
+			if ((em_state[i] & (EM_DIRTY | EM_QUIET)) == EM_QUIET)
+			{
+				(*quiet)++;
+			}
+		}
+	}
+}
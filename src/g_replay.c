@@ -0,0 +1,959 @@
+/*
+ * =======================================================================
+ *
+ * Recording and replay of client input. The recorder writes
+ * everything the server hands to the game for its clients
+ * (connects, userinfo changes, usercmds and commands) into
+ * a compact binary file, together with the frame boundaries
+ * and the random seed. The replayer feeds the file back into
+ * the game frame by frame, so a session can be replayed
+ * against a new build to compare the cost of G_RunFrame.
+ *
+ * Recordings start and end with a level. Replays are meant
+ * for dedicated servers, real clients are refused while a
+ * replay is running and slots they already hold are left
+ * alone. Replayed clients have no slot in the engine, so
+ * nothing may be sent to them, see G_IsReplayedClient().
+ *
+ * =======================================================================
+ */
+
+#include "header/local.h"
+
+#define REPLAY_MAGIC 0x50523251 /* "Q2RP" */
+#define REPLAY_VERSION 1
+
+/* event types */
+enum
+{
+	RP_FRAME,
+	RP_CONNECT,
+	RP_USERINFO,
+	RP_BEGIN,
+	RP_DISCONNECT,
+	RP_THINK,
+	RP_COMMAND
+};
+
+/* usercmd fields that changed since the last one */
+#define UC_MSEC (1 << 0)
+#define UC_BUTTONS (1 << 1)
+#define UC_ANGLES (1 << 2)
+#define UC_FORWARD (1 << 3)
+#define UC_SIDE (1 << 4)
+#define UC_UP (1 << 5)
+#define UC_IMPULSE (1 << 6)
+#define UC_LIGHT (1 << 7)
+
+#define REPLAY_MAX_ARGS 64
+
+void ClientThink(edict_t *ent, usercmd_t *cmd);
+qboolean ClientConnect(edict_t *ent, char *userinfo);
+void ClientUserinfoChanged(edict_t *ent, char *userinfo);
+void ClientDisconnect(edict_t *ent);
+void ClientBegin(edict_t *ent);
+void ClientCommand(edict_t *ent);
+
+typedef struct
+{
+	int magic;
+	int version;
+	unsigned int seed;
+	int maxclients;
+	char mapname[MAX_QPATH];
+} replayheader_t;
+
+typedef enum
+{
+	REPLAY_IDLE,
+	REPLAY_ARMED,  /* waiting for the next level */
+	REPLAY_RUNNING
+} replaystate_t;
+
+static struct
+{
+	replaystate_t state;
+	qboolean playback;
+	char filename[MAX_OSPATH];
+	unsigned int seed;
+	FILE *f;
+
+	usercmd_t lastcmd[MAX_CLIENTS]; /* for delta compression */
+
+	/* playback */
+	qboolean dispatching;
+	qboolean replayed[MAX_CLIENTS]; /* clients driven by the replay */
+	int argc;
+	char argv[REPLAY_MAX_ARGS][MAX_TOKEN_CHARS];
+	char args[MAX_STRING_CHARS];
+	int (*real_argc)(void);
+	char *(*real_argv)(int n);
+	char *(*real_args)(void);
+
+	/* stats */
+	int frames;
+	long long framestart;
+	long long frametime;
+	long long maxframetime;
+	long events;
+} replay;
+
+static void
+Replay_Path(char *name, size_t size, const char *file)
+{
+	cvar_t *game;
+
+	game = gi.cvar("game", "", 0);
+
+	Com_sprintf(name, size, "%s/%s.rec",
+			*game->string ? game->string : GAMEVERSION, file);
+}
+
+/* ====================================================================== */
+
+static void
+Replay_WriteByte(int c)
+{
+	byte b;
+
+	b = (byte)c;
+	fwrite(&b, 1, 1, replay.f);
+}
+
+static void
+Replay_WriteShort(int c)
+{
+	short s;
+
+	s = (short)c;
+	fwrite(&s, sizeof(s), 1, replay.f);
+}
+
+static void
+Replay_WriteString(const char *s)
+{
+	size_t len;
+
+	len = strlen(s);
+
+	if (len > MAX_STRING_CHARS - 1)
+	{
+		len = MAX_STRING_CHARS - 1;
+	}
+
+	Replay_WriteShort((int)len);
+	fwrite(s, len, 1, replay.f);
+}
+
+static qboolean
+Replay_Recording(void)
+{
+	return (replay.state == REPLAY_RUNNING) && !replay.playback;
+}
+
+static void
+Replay_WriteEvent(int type, const edict_t *ent)
+{
+	Replay_WriteByte(type);
+	Replay_WriteByte((int)(ent - g_edicts - 1));
+	replay.events++;
+}
+
+void
+G_RecordConnect(const edict_t *ent, const char *userinfo)
+{
+	if (!Replay_Recording())
+	{
+		return;
+	}
+
+	Replay_WriteEvent(RP_CONNECT, ent);
+	Replay_WriteString(userinfo);
+
+	memset(&replay.lastcmd[ent - g_edicts - 1], 0, sizeof(usercmd_t));
+}
+
+void
+G_RecordUserinfo(const edict_t *ent, const char *userinfo)
+{
+	if (!Replay_Recording())
+	{
+		return;
+	}
+
+	Replay_WriteEvent(RP_USERINFO, ent);
+	Replay_WriteString(userinfo);
+}
+
+void
+G_RecordBegin(const edict_t *ent)
+{
+	if (!Replay_Recording())
+	{
+		return;
+	}
+
+	Replay_WriteEvent(RP_BEGIN, ent);
+}
+
+void
+G_RecordDisconnect(const edict_t *ent)
+{
+	if (!Replay_Recording())
+	{
+		return;
+	}
+
+	Replay_WriteEvent(RP_DISCONNECT, ent);
+}
+
+/*
+ * Usercmds are written as a mask of the
+ * fields that changed and their values.
+ */
+void
+G_RecordThink(const edict_t *ent, const usercmd_t *ucmd)
+{
+	usercmd_t *last;
+	int bits, i;
+
+	if (!Replay_Recording())
+	{
+		return;
+	}
+
+	last = &replay.lastcmd[ent - g_edicts - 1];
+	bits = 0;
+
+	if (ucmd->msec != last->msec)
+	{
+		bits |= UC_MSEC;
+	}
+
+	if (ucmd->buttons != last->buttons)
+	{
+		bits |= UC_BUTTONS;
+	}
+
+	if (memcmp(ucmd->angles, last->angles, sizeof(ucmd->angles)))
+	{
+		bits |= UC_ANGLES;
+	}
+
+	if (ucmd->forwardmove != last->forwardmove)
+	{
+		bits |= UC_FORWARD;
+	}
+
+	if (ucmd->sidemove != last->sidemove)
+	{
+		bits |= UC_SIDE;
+	}
+
+	if (ucmd->upmove != last->upmove)
+	{
+		bits |= UC_UP;
+	}
+
+	if (ucmd->impulse != last->impulse)
+	{
+		bits |= UC_IMPULSE;
+	}
+
+	if (ucmd->lightlevel != last->lightlevel)
+	{
+		bits |= UC_LIGHT;
+	}
+
+	Replay_WriteEvent(RP_THINK, ent);
+	Replay_WriteByte(bits);
+
+	if (bits & UC_MSEC)
+	{
+		Replay_WriteByte(ucmd->msec);
+	}
+
+	if (bits & UC_BUTTONS)
+	{
+		Replay_WriteByte(ucmd->buttons);
+	}
+
+	if (bits & UC_ANGLES)
+	{
+		for (i = 0; i < 3; i++)
+		{
+			Replay_WriteShort(ucmd->angles[i]);
+		}
+	}
+
+	if (bits & UC_FORWARD)
+	{
+		Replay_WriteShort(ucmd->forwardmove);
+	}
+
+	if (bits & UC_SIDE)
+	{
+		Replay_WriteShort(ucmd->sidemove);
+	}
+
+	if (bits & UC_UP)
+	{
+		Replay_WriteShort(ucmd->upmove);
+	}
+
+	if (bits & UC_IMPULSE)
+	{
+		Replay_WriteByte(ucmd->impulse);
+	}
+
+	if (bits & UC_LIGHT)
+	{
+		Replay_WriteByte(ucmd->lightlevel);
+	}
+
+	*last = *ucmd;
+}
+
+void
+G_RecordCommand(const edict_t *ent)
+{
+	int i, argc;
+
+	if (!Replay_Recording())
+	{
+		return;
+	}
+
+	argc = gi.argc();
+
+	if (argc > REPLAY_MAX_ARGS)
+	{
+		argc = REPLAY_MAX_ARGS;
+	}
+
+	Replay_WriteEvent(RP_COMMAND, ent);
+	Replay_WriteByte(argc);
+
+	for (i = 0; i < argc; i++)
+	{
+		Replay_WriteString(gi.argv(i));
+	}
+}
+
+/* ====================================================================== */
+
+static qboolean
+Replay_Read(void *dest, size_t n)
+{
+	return fread(dest, n, 1, replay.f) == 1;
+}
+
+static qboolean
+Replay_ReadByte(int *c)
+{
+	byte b;
+
+	if (!Replay_Read(&b, 1))
+	{
+		return false;
+	}
+
+	*c = b;
+	return true;
+}
+
+static qboolean
+Replay_ReadShort(short *c)
+{
+	return Replay_Read(c, sizeof(*c));
+}
+
+static qboolean
+Replay_ReadString(char *out, size_t size)
+{
+	short len;
+
+	if (!Replay_ReadShort(&len) || (len < 0) || ((size_t)len >= size))
+	{
+		return false;
+	}
+
+	out[len] = 0;
+
+	return !len || Replay_Read(out, len);
+}
+
+static int
+Replay_Argc(void)
+{
+	return replay.argc;
+}
+
+static char *
+Replay_Argv(int n)
+{
+	if ((n < 0) || (n >= replay.argc))
+	{
+		return "";
+	}
+
+	return replay.argv[n];
+}
+
+static char *
+Replay_Args(void)
+{
+	return replay.args;
+}
+
+/*
+ * Runs a recorded client command with the
+ * argument functions pointing to the record.
+ */
+static void
+Replay_Command(edict_t *ent)
+{
+	int i;
+
+	replay.args[0] = 0;
+
+	for (i = 1; i < replay.argc; i++)
+	{
+		if (i > 1)
+		{
+			Q_strlcat(replay.args, " ", sizeof(replay.args));
+		}
+
+		Q_strlcat(replay.args, replay.argv[i], sizeof(replay.args));
+	}
+
+	replay.real_argc = gi.argc;
+	replay.real_argv = gi.argv;
+	replay.real_args = gi.args;
+	gi.argc = Replay_Argc;
+	gi.argv = Replay_Argv;
+	gi.args = Replay_Args;
+
+	ClientCommand(ent);
+
+	gi.argc = replay.real_argc;
+	gi.argv = replay.real_argv;
+	gi.args = replay.real_args;
+}
+
+static qboolean
+Replay_Think(edict_t *ent, int client)
+{
+	usercmd_t *cmd;
+	int bits, c, i;
+
+	cmd = &replay.lastcmd[client];
+
+	if (!Replay_ReadByte(&bits))
+	{
+		return false;
+	}
+
+	if ((bits & UC_MSEC) && Replay_ReadByte(&c))
+	{
+		cmd->msec = c;
+	}
+
+	if ((bits & UC_BUTTONS) && Replay_ReadByte(&c))
+	{
+		cmd->buttons = c;
+	}
+
+	if (bits & UC_ANGLES)
+	{
+		for (i = 0; i < 3; i++)
+		{
+			Replay_ReadShort(&cmd->angles[i]);
+		}
+	}
+
+	if (bits & UC_FORWARD)
+	{
+		Replay_ReadShort(&cmd->forwardmove);
+	}
+
+	if (bits & UC_SIDE)
+	{
+		Replay_ReadShort(&cmd->sidemove);
+	}
+
+	if (bits & UC_UP)
+	{
+		Replay_ReadShort(&cmd->upmove);
+	}
+
+	if ((bits & UC_IMPULSE) && Replay_ReadByte(&c))
+	{
+		cmd->impulse = c;
+	}
+
+	if ((bits & UC_LIGHT) && Replay_ReadByte(&c))
+	{
+		cmd->lightlevel = c;
+	}
+
+	if (feof(replay.f) || ferror(replay.f))
+	{
+		return false;
+	}
+
+	if (replay.replayed[client] && ent->inuse && ent->client)
+	{
+		ClientThink(ent, cmd);
+	}
+
+	return true;
+}
+
+/*
+ * Dispatches one recorded event. Returns
+ * false at a frame boundary or at the end.
+ */
+static qboolean
+Replay_Event(qboolean *done)
+{
+	char userinfo[MAX_INFO_STRING];
+	edict_t *ent;
+	int type, client, i;
+
+	*done = false;
+
+	if (!Replay_ReadByte(&type))
+	{
+		*done = true;
+		return false;
+	}
+
+	if (type == RP_FRAME)
+	{
+		return false;
+	}
+
+	if (!Replay_ReadByte(&client) || (client >= game.maxclients))
+	{
+		*done = true;
+		return false;
+	}
+
+	ent = g_edicts + client + 1;
+	replay.events++;
+
+	switch (type)
+	{
+		case RP_CONNECT:
+			if (!Replay_ReadString(userinfo, sizeof(userinfo)))
+			{
+				*done = true;
+				return false;
+			}
+
+			/* held by a real client */
+			if (!replay.replayed[client] && game.clients[client].pers.connected)
+			{
+				gi.dprintf("%s: client %i is taken, not replaying it\n",
+						__func__, client);
+				break;
+			}
+
+			memset(&replay.lastcmd[client], 0, sizeof(usercmd_t));
+
+			if (ClientConnect(ent, userinfo))
+			{
+				replay.replayed[client] = true;
+			}
+
+			break;
+		case RP_USERINFO:
+			if (!Replay_ReadString(userinfo, sizeof(userinfo)))
+			{
+				*done = true;
+				return false;
+			}
+
+			if (replay.replayed[client])
+			{
+				ClientUserinfoChanged(ent, userinfo);
+			}
+
+			break;
+		case RP_BEGIN:
+			if (replay.replayed[client])
+			{
+				ClientBegin(ent);
+			}
+
+			break;
+		case RP_DISCONNECT:
+			if (replay.replayed[client])
+			{
+				ClientDisconnect(ent);
+				replay.replayed[client] = false;
+			}
+
+			break;
+		case RP_THINK:
+			if (!Replay_Think(ent, client))
+			{
+				*done = true;
+				return false;
+			}
+
+			break;
+		case RP_COMMAND:
+			if (!Replay_ReadByte(&replay.argc) || (replay.argc > REPLAY_MAX_ARGS))
+			{
+				*done = true;
+				return false;
+			}
+
+			for (i = 0; i < replay.argc; i++)
+			{
+				if (!Replay_ReadString(replay.argv[i], sizeof(replay.argv[i])))
+				{
+					*done = true;
+					return false;
+				}
+			}
+
+			if (replay.replayed[client])
+			{
+				Replay_Command(ent);
+			}
+
+			break;
+		default:
+			gi.dprintf("%s: unknown event %i in %s\n", __func__, type,
+					replay.filename);
+			*done = true;
+			return false;
+	}
+
+	return true;
+}
+
+/* ====================================================================== */
+
+static void
+Replay_Stop(void)
+{
+	int i;
+
+	if (replay.f)
+	{
+		fclose(replay.f);
+		replay.f = NULL;
+	}
+
+	if (replay.playback && (replay.state == REPLAY_RUNNING))
+	{
+		/* the replayed clients leave with the replay */
+		replay.dispatching = true;
+
+		for (i = 0; i < game.maxclients; i++)
+		{
+			if (replay.replayed[i])
+			{
+				ClientDisconnect(g_edicts + i + 1);
+				replay.replayed[i] = false;
+			}
+		}
+
+		replay.dispatching = false;
+
+		gi.cprintf(NULL, PRINT_HIGH, "Replay of %s finished: %i frames, %li events\n",
+				replay.filename, replay.frames, replay.events);
+
+		if (replay.frames)
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "G_RunFrame %8.3f ms avg, %8.3f ms max, %.3f s total\n",
+					(double)replay.frametime / replay.frames / 1000.0,
+					(double)replay.maxframetime / 1000.0,
+					(double)replay.frametime / 1000000.0);
+		}
+	}
+	else if (replay.state == REPLAY_RUNNING)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Recorded %i frames, %li events to %s\n",
+				replay.frames, replay.events, replay.filename);
+	}
+
+	replay.state = REPLAY_IDLE;
+}
+
+/*
+ * Called by SpawnEntities() before the level
+ * is spawned. Ends the running recording or
+ * replay and starts an armed one.
+ */
+void
+G_ReplayLevelStart(const char *mapname)
+{
+	replayheader_t header;
+	int i;
+
+	if (replay.state == REPLAY_RUNNING)
+	{
+		Replay_Stop();
+		return;
+	}
+
+	if (replay.state != REPLAY_ARMED)
+	{
+		return;
+	}
+
+	replay.state = REPLAY_IDLE;
+	replay.frames = 0;
+	replay.events = 0;
+	replay.frametime = 0;
+	replay.maxframetime = 0;
+
+	memset(replay.lastcmd, 0, sizeof(replay.lastcmd));
+	memset(replay.replayed, 0, sizeof(replay.replayed));
+
+	if (!replay.playback)
+	{
+		replay.f = Q_fopen(replay.filename, "wb");
+
+		if (!replay.f)
+		{
+			gi.dprintf("Couldn't open %s\n", replay.filename);
+			return;
+		}
+
+		memset(&header, 0, sizeof(header));
+		header.magic = REPLAY_MAGIC;
+		header.version = REPLAY_VERSION;
+		header.seed = replay.seed;
+		header.maxclients = game.maxclients;
+		Q_strlcpy(header.mapname, mapname, sizeof(header.mapname));
+
+		fwrite(&header, sizeof(header), 1, replay.f);
+
+		/* clients that stay over the level change
+		   don't connect again, so the replay gets
+		   their connect from the current userinfo */
+		for (i = 0; i < game.maxclients; i++)
+		{
+			if (game.clients[i].pers.connected)
+			{
+				Replay_WriteEvent(RP_CONNECT, g_edicts + i + 1);
+				Replay_WriteString(game.clients[i].pers.userinfo);
+			}
+		}
+	}
+	else
+	{
+		replay.f = Q_fopen(replay.filename, "rb");
+
+		if (!replay.f)
+		{
+			gi.dprintf("Couldn't open %s\n", replay.filename);
+			return;
+		}
+
+		if (!Replay_Read(&header, sizeof(header)) ||
+			(header.magic != REPLAY_MAGIC) ||
+			(header.version != REPLAY_VERSION) ||
+			(header.maxclients != game.maxclients))
+		{
+			gi.dprintf("%s is not a replay for this server\n", replay.filename);
+			fclose(replay.f);
+			replay.f = NULL;
+			return;
+		}
+
+		header.mapname[sizeof(header.mapname) - 1] = 0;
+
+		if (Q_stricmp(header.mapname, mapname))
+		{
+			gi.dprintf("%s was recorded on %s\n", replay.filename, header.mapname);
+			fclose(replay.f);
+			replay.f = NULL;
+			return;
+		}
+
+		replay.seed = header.seed;
+	}
+
+	G_SeedRandom(replay.seed);
+	replay.state = REPLAY_RUNNING;
+}
+
+/*
+ * Called at the start of G_RunFrame(). Marks
+ * the frame in the recording or feeds the
+ * events recorded before it to the game.
+ */
+void
+G_ReplayBeginFrame(void)
+{
+	qboolean done;
+
+	if (replay.state != REPLAY_RUNNING)
+	{
+		return;
+	}
+
+	replay.frames++;
+
+	if (!replay.playback)
+	{
+		Replay_WriteByte(RP_FRAME);
+		return;
+	}
+
+	replay.dispatching = true;
+
+	while (Replay_Event(&done))
+	{
+	}
+
+	replay.dispatching = false;
+
+	if (done)
+	{
+		replay.frames--;
+		Replay_Stop();
+		return;
+	}
+
+	replay.framestart = Q_Microseconds();
+}
+
+/*
+ * Called at the end of G_RunFrame().
+ */
+void
+G_ReplayEndFrame(void)
+{
+	long long msec;
+
+	if ((replay.state != REPLAY_RUNNING) || !replay.playback)
+	{
+		return;
+	}
+
+	msec = Q_Microseconds() - replay.framestart;
+	replay.frametime += msec;
+
+	if (msec > replay.maxframetime)
+	{
+		replay.maxframetime = msec;
+	}
+}
+
+/*
+ * True if a client connecting now must be
+ * refused because a replay owns the slots.
+ */
+qboolean
+G_ReplayRejects(void)
+{
+	return replay.playback && (replay.state != REPLAY_IDLE) && !replay.dispatching;
+}
+
+/*
+ * True if the client is driven by the replay.
+ * The engine never set up its slot, so print
+ * and unicast must not be sent to it.
+ */
+qboolean
+G_IsReplayedClient(const edict_t *ent)
+{
+	int client;
+
+	if (!ent || !replay.playback || (replay.state != REPLAY_RUNNING))
+	{
+		return false;
+	}
+
+	client = ent - g_edicts - 1;
+
+	return (client >= 0) && (client < game.maxclients) &&
+		replay.replayed[client];
+}
+
+/*
+ * Drops a message written for a replayed client. The
+ * engine only clears its message buffer when sending,
+ * so it goes to the PVS of a point outside the world,
+ * which is empty.
+ */
+void
+G_ReplayDropUnicast(void)
+{
+	static const vec3_t outside = {0, 0, -16384};
+
+	G_Multicast(outside, MULTICAST_PVS);
+}
+
+void
+G_ShutdownReplay(void)
+{
+	if (replay.f)
+	{
+		fclose(replay.f);
+		replay.f = NULL;
+	}
+
+	replay.state = REPLAY_IDLE;
+}
+
+/*
+ * sv record <name> [seed]
+ * sv replay <name>
+ * sv stopreplay
+ *
+ * Recording and replay start with the next level,
+ * change or restart the map after these commands.
+ */
+void
+SVCmd_Record_f(qboolean playback)
+{
+	if (gi.argc() < 3)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Usage: sv %s <name>%s\n",
+				playback ? "replay" : "record", playback ? "" : " [seed]");
+		return;
+	}
+
+	if (replay.state == REPLAY_RUNNING)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Already %s %s.\n",
+				replay.playback ? "replaying" : "recording", replay.filename);
+		return;
+	}
+
+	Replay_Path(replay.filename, sizeof(replay.filename), gi.argv(2));
+	replay.playback = playback;
+	replay.seed = (gi.argc() > 3) ?
+		(unsigned int)strtoul(gi.argv(3), NULL, 10) : G_RandomSeed();
+	replay.state = REPLAY_ARMED;
+
+	gi.cprintf(NULL, PRINT_HIGH, "%s %s with the next level.\n",
+			playback ? "Replaying" : "Recording to", replay.filename);
+}
+
+void
+SVCmd_StopReplay_f(void)
+{
+	if (replay.state == REPLAY_IDLE)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Not recording or replaying.\n");
+		return;
+	}
+
+	if (replay.state == REPLAY_ARMED)
+	{
+		replay.state = REPLAY_IDLE;
+		return;
+	}
+
+	Replay_Stop();
+}
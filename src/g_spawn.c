@@ -25,6 +25,7 @@
  */
 
 #include "header/local.h"
+#include "savegame/savegame.h"
 #include "savegame/tables/spawnfunc_decs.h"
 
 typedef struct
@@ -66,240 +67,1293 @@ qboolean Spawn_CheckCoop_MapHacks (edict_t *ent)
 	return false;
 }
 
+/*
+ * Finds the item or the index of the
+ * spawn function for a classname, -1
+ * if it has none.
+ */
+static int
+ED_FindSpawn(const char *classname, gitem_t **item)
+{
+	const spawn_t *s;
+
+	/* check item spawn functions, the lookup
+	   ignores case but spawning never did */
+	*item = FindItemByClassname(classname);
+
+	if (*item && strcmp((*item)->classname, classname))
+	{
+		*item = NULL;
+	}
+
+	if (*item)
+	{
+		return -1;
+	}
+
+	/* check normal spawn functions */
+	for (s = spawns; s->name; s++)
+	{
+		if (!strcmp(s->name, classname))
+		{
+			return (int)(s - spawns);
+		}
+	}
+
+	return -1;
+}
+
+static void
+ED_Spawn(edict_t *ent, gitem_t *item, int spawn)
+{
+	if (!ent->classname)
+	{
+		gi.dprintf("%s: NULL classname\n", __func__);
+		G_FreeEdict(ent);
+		return;
+	}
+
+	/* may be called on an edict that is already in use */
+	G_MarkEdictDirty(ent);
+
+	if (item)
+	{
+		SpawnItem(ent, item);
+	}
+	else if (spawn >= 0)
+	{
+		spawns[spawn].spawn(ent);
+	}
+	else
+	{
+		gi.dprintf("%s doesn't have a spawn function\n", ent->classname);
+	}
+}
+
 /*
  * Finds the spawn function for
  * the entity and calls it
  */
 void
-ED_CallSpawn(edict_t *ent)
+ED_CallSpawn(edict_t *ent)
+{
+	gitem_t *item;
+	int spawn;
+
+	if (!ent)
+	{
+		return;
+	}
+
+	item = NULL;
+	spawn = ent->classname ? ED_FindSpawn(ent->classname, &item) : -1;
+
+	ED_Spawn(ent, item, spawn);
+}
+
+/* the engine keeps the entity
+   string around for the level */
+static char *spawn_entities;
+
+/*
+ * Copies len chars of in to out, turning the
+ * escapes of the entity string into characters.
+ * out must have room for len + 1 chars.
+ */
+static void
+ED_Unescape(char *out, const char *in, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++)
+	{
+		if ((in[i] == '\\') && (i < len - 1))
+		{
+			i++;
+
+			if (in[i] == 'n')
+			{
+				*out++ = '\n';
+			}
+			else
+			{
+				*out++ = '\\';
+			}
+		}
+		else
+		{
+			*out++ = in[i];
+		}
+	}
+
+	*out = 0;
+}
+
+char *
+ED_NewString(const char *string)
+{
+	char buf[MAX_TOKEN_CHARS];
+	char *newb, *interned;
+	size_t l;
+
+	if (!string)
+	{
+		return NULL;
+	}
+
+	l = strlen(string);
+
+	if (l < sizeof(buf))
+	{
+		newb = buf;
+	}
+	else
+	{
+		newb = gi.TagMalloc(l + 1, TAG_LEVEL);
+	}
+
+	ED_Unescape(newb, string, l);
+	interned = G_InternString(newb);
+
+	if (newb != buf)
+	{
+		gi.TagFree(newb);
+	}
+
+	return interned;
+}
+
+/* tokens never reach MAX_TOKEN_CHARS, see ED_NextToken() */
+static char *
+ED_NewStringSpan(const char *string, size_t len)
+{
+	char buf[MAX_TOKEN_CHARS];
+
+	ED_Unescape(buf, string, len);
+
+	return G_InternString(buf);
+}
+
+/*
+ * Returns the next token of the entity string as a
+ * span into the string, nothing is copied. Follows
+ * the rules of COM_Parse(), including dropping
+ * tokens that don't fit into com_token. Returns
+ * false and sets *data_p to NULL at the end.
+ */
+static qboolean
+ED_NextToken(const char **data_p, const char **token, size_t *len)
+{
+	const char *data;
+	int c;
+
+	data = *data_p;
+	*token = "";
+	*len = 0;
+
+	if (!data)
+	{
+		return false;
+	}
+
+skipwhite:
+
+	while ((c = *data) <= ' ')
+	{
+		if (c == 0)
+		{
+			*data_p = NULL;
+			return false;
+		}
+
+		data++;
+	}
+
+	/* skip // comments */
+	if ((c == '/') && (data[1] == '/'))
+	{
+		while (*data && (*data != '\n'))
+		{
+			data++;
+		}
+
+		goto skipwhite;
+	}
+
+	if (c == '\"')
+	{
+		/* quoted strings end at the next quote */
+		*token = ++data;
+
+		while (*data && (*data != '\"'))
+		{
+			data++;
+		}
+
+		*len = data - *token;
+
+		if (*data)
+		{
+			data++;
+		}
+	}
+	else
+	{
+		*token = data;
+
+		do
+		{
+			data++;
+		}
+		while (*data > 32);
+
+		*len = data - *token;
+	}
+
+	if (*len >= MAX_TOKEN_CHARS)
+	{
+		*len = 0;
+	}
+
+	*data_p = data;
+
+	return true;
+}
+
+/* powers of ten that are exact doubles */
+static const double ed_pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static qboolean
+ED_IsSpace(int c)
+{
+	return (c == ' ') || ((c >= '\t') && (c <= '\r'));
+}
+
+/* strtod() on a span, for everything ED_ParseFloat() can't do */
+static const char *
+ED_ParseFloatSlow(const char *s, const char *end, double *out)
+{
+	char buf[64];
+	char *stop;
+	size_t len;
+
+	len = end - s;
+
+	if (len >= sizeof(buf))
+	{
+		len = sizeof(buf) - 1;
+	}
+
+	memcpy(buf, s, len);
+	buf[len] = 0;
+
+	*out = strtod(buf, &stop);
+
+	return s + (stop - buf);
+}
+
+/*
+ * Parses a decimal number out of [s, end) like strtod().
+ * Returns the end of the number, or s if there was none.
+ * Numbers with up to 15 significant digits and a small
+ * exponent are exact in a double and done by hand, the
+ * rest (hex, inf, long mantissas) go to strtod().
+ */
+static const char *
+ED_ParseFloat(const char *s, const char *end, double *out)
+{
+	unsigned long long mant;
+	const char *p, *q;
+	int digits, exp, e;
+	qboolean neg, seen, eneg;
+	double value;
+
+	p = s;
+
+	while ((p < end) && ED_IsSpace(*p))
+	{
+		p++;
+	}
+
+	neg = false;
+
+	if ((p < end) && ((*p == '-') || (*p == '+')))
+	{
+		neg = (*p == '-');
+		p++;
+	}
+
+	mant = 0;
+	digits = 0;
+	exp = 0;
+	seen = false;
+
+	for ( ; (p < end) && (*p >= '0') && (*p <= '9'); p++)
+	{
+		seen = true;
+
+		if (mant || (*p != '0'))
+		{
+			mant = mant * 10 + (*p - '0');
+			digits++;
+		}
+	}
+
+	if ((p < end) && (*p == '.'))
+	{
+		for (p++; (p < end) && (*p >= '0') && (*p <= '9'); p++)
+		{
+			seen = true;
+
+			if (mant || (*p != '0'))
+			{
+				mant = mant * 10 + (*p - '0');
+				digits++;
+			}
+
+			exp--;
+		}
+	}
+
+	if (!seen)
+	{
+		if ((p < end) && (*p != '.'))
+		{
+			/* inf, nan */
+			return ED_ParseFloatSlow(s, end, out);
+		}
+
+		*out = 0;
+		return s;
+	}
+
+	if ((p < end) && ((*p == 'x') || (*p == 'X')))
+	{
+		return ED_ParseFloatSlow(s, end, out);
+	}
+
+	if ((p < end) && ((*p == 'e') || (*p == 'E')))
+	{
+		q = p + 1;
+		eneg = false;
+
+		if ((q < end) && ((*q == '-') || (*q == '+')))
+		{
+			eneg = (*q == '-');
+			q++;
+		}
+
+		if ((q < end) && (*q >= '0') && (*q <= '9'))
+		{
+			for (e = 0; (q < end) && (*q >= '0') && (*q <= '9'); q++)
+			{
+				if (e < 10000)
+				{
+					e = e * 10 + (*q - '0');
+				}
+			}
+
+			exp += eneg ? -e : e;
+			p = q;
+		}
+	}
+
+	if ((digits > 15) || (exp < -22) || (exp > 22))
+	{
+		return ED_ParseFloatSlow(s, end, out);
+	}
+
+	value = (double)mant;
+	value = (exp < 0) ? value / ed_pow10[-exp] : value * ed_pow10[exp];
+
+	*out = neg ? -value : value;
+
+	return p;
+}
+
+/* strtol(s, NULL, 10) on a span */
+static int
+ED_ParseInt(const char *s, const char *end)
+{
+	const char *p;
+	qboolean neg;
+	int value, digits;
+	char buf[64];
+	size_t len;
+
+	p = s;
+
+	while ((p < end) && ED_IsSpace(*p))
+	{
+		p++;
+	}
+
+	neg = false;
+
+	if ((p < end) && ((*p == '-') || (*p == '+')))
+	{
+		neg = (*p == '-');
+		p++;
+	}
+
+	value = 0;
+
+	for (digits = 0; (p < end) && (*p >= '0') && (*p <= '9'); p++, digits++)
+	{
+		if (digits == 9)
+		{
+			/* may overflow, let strtol() clamp it */
+			len = end - s;
+
+			if (len >= sizeof(buf))
+			{
+				len = sizeof(buf) - 1;
+			}
+
+			memcpy(buf, s, len);
+			buf[len] = 0;
+
+			return (int)strtol(buf, NULL, 10);
+		}
+
+		value = value * 10 + (*p - '0');
+	}
+
+	return neg ? -value : value;
+}
+
+/*
+ * Takes a key/value pair and sets
+ * the binary values in an edict
+ */
+static void
+ED_ParseField(const char *key, size_t keylen, const char *value,
+		size_t valuelen, edict_t *ent)
+{
+	const field_t *f;
+	const char *p, *q, *end;
+	qboolean spawntemp;
+	double d;
+	void *b;
+	vec_t *vec;
+	int i;
+
+	if (!ent || !value || !key)
+	{
+		return;
+	}
+
+	f = FindSpawnFieldSpan(key, keylen, &spawntemp);
+
+	if (!f)
+	{
+		gi.dprintf("'%.*s' is not a field. Value is '%.*s'\n",
+				(int)keylen, key, (int)valuelen, value);
+		return;
+	}
+
+	b = spawntemp ? (byte *)&st + f->ofs : (byte *)ent + f->ofs;
+	end = value + valuelen;
+
+	switch (f->type)
+	{
+		case F_LSTRING:
+			*(char **)b = ED_NewStringSpan(value, valuelen);
+			break;
+		case F_VECTOR:
+			vec = b;
+
+			for (i = 0, p = value; i < 3; i++)
+			{
+				q = ED_ParseFloat(p, end, &d);
+
+				if (q == p)
+				{
+					break;
+				}
+
+				vec[i] = (vec_t)d;
+				p = q;
+			}
+
+			if (i != 3)
+			{
+				memset(vec, 0, sizeof(vec3_t));
+				gi.dprintf("%s: entity %d: incomplete '%s' field\n",
+					__func__, ent->s.number, f->name);
+			}
+			break;
+		case F_INT:
+			*(int *)b = ED_ParseInt(value, end);
+			break;
+		case F_FLOAT:
+			ED_ParseFloat(value, end, &d);
+			*(float *)b = (float)d;
+			break;
+		case F_ANGLEHACK:
+			vec = b;
+			ED_ParseFloat(value, end, &d);
+			vec[0] = 0;
+			vec[1] = (vec_t)d;
+			vec[2] = 0;
+			break;
+		case F_IGNORE:
+			break;
+		default:
+			break;
+	}
+}
+
+/*
+ * Parses an edict out of the given string,
+ * returning the new position. ed should be
+ * a properly initialized empty edict.
+ */
+static const char *
+ED_ParseEdict(const char *data, edict_t *ent)
+{
+	const char *key, *value;
+	size_t keylen, valuelen;
+	qboolean init;
+
+	if (!ent)
+	{
+		return NULL;
+	}
+
+	init = false;
+	memset(&st, 0, sizeof(st));
+
+	/* go through all the dictionary pairs */
+	while (1)
+	{
+		/* parse key */
+		ED_NextToken(&data, &key, &keylen);
+
+		if (keylen && (key[0] == '}'))
+		{
+			break;
+		}
+
+		if (!data)
+		{
+			gi.error("ED_ParseEntity: EOF without closing brace");
+			break;
+		}
+
+		/* parse value */
+		ED_NextToken(&data, &value, &valuelen);
+
+		if (!data)
+		{
+			gi.error("%s: EOF without closing brace", __func__);
+			break;
+		}
+
+		if (valuelen && (value[0] == '}'))
+		{
+			gi.error("%s: closing brace without data", __func__);
+			break;
+		}
+
+		init = true;
+
+		/* keynames with a leading underscore are
+		   used for utility comments, and are
+		   immediately discarded by quake */
+		if (keylen && (key[0] == '_'))
+		{
+			continue;
+		}
+
+		ED_ParseField(key, keylen, value, valuelen, ent);
+	}
+
+	if (!init)
+	{
+		memset(ent, 0, sizeof(*ent));
+	}
+
+	return data;
+}
+
+/*
+ * The parser as it was before the span tokenizer
+ * and the field hash, for comparison by sv entbench.
+ */
+static int
+ED_BenchParseReference(char *data, edict_t *ent)
+{
+	char keyname[256];
+	const char *com_token;
+	const field_t *f;
+	vec_t *vec;
+	void *b;
+	int fields;
+
+	fields = 0;
+
+	while (1)
+	{
+		com_token = COM_Parse(&data);
+
+		if (!data)
+		{
+			break;
+		}
+
+		while (1)
+		{
+			com_token = COM_Parse(&data);
+
+			if ((com_token[0] == '}') || !data)
+			{
+				break;
+			}
+
+			Q_strlcpy(keyname, com_token, sizeof(keyname));
+			com_token = COM_Parse(&data);
+
+			if (!data || (keyname[0] == '_'))
+			{
+				continue;
+			}
+
+			fields++;
+
+			if ((f = FindSpawntempField(keyname)) != NULL)
+			{
+				b = (byte *)&st + f->ofs;
+			}
+			else if ((f = FindSpawnfield(keyname)) != NULL)
+			{
+				b = (byte *)ent + f->ofs;
+			}
+			else
+			{
+				continue;
+			}
+
+			switch (f->type)
+			{
+				case F_LSTRING:
+					*(char **)b = ED_NewString(com_token);
+					break;
+				case F_VECTOR:
+					vec = b;
+					sscanf(com_token, "%f %f %f", &vec[0], &vec[1], &vec[2]);
+					break;
+				case F_INT:
+					*(int *)b = (int)strtol(com_token, (char **)NULL, 10);
+					break;
+				case F_FLOAT:
+					*(float *)b = (float)strtod(com_token, (char **)NULL);
+					break;
+				case F_ANGLEHACK:
+					vec = b;
+					vec[1] = (vec_t)strtod(com_token, (char **)NULL);
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	return fields;
+}
+
+/*
+ * Parses the entity string into a scratch edict
+ * without spawning anything, like SpawnEntities().
+ */
+static int
+ED_BenchParse(const char *data, edict_t *ent)
+{
+	const char *key, *value;
+	size_t keylen, valuelen;
+	qboolean spawntemp;
+	int fields;
+
+	fields = 0;
+
+	while (ED_NextToken(&data, &key, &keylen))
+	{
+		while (1)
+		{
+			ED_NextToken(&data, &key, &keylen);
+
+			if ((keylen && (key[0] == '}')) || !data)
+			{
+				break;
+			}
+
+			ED_NextToken(&data, &value, &valuelen);
+
+			if (!data || (keylen && (key[0] == '_')))
+			{
+				continue;
+			}
+
+			fields++;
+
+			/* don't print the unknown ones every time */
+			if (FindSpawnFieldSpan(key, keylen, &spawntemp))
+			{
+				ED_ParseField(key, keylen, value, valuelen, ent);
+			}
+		}
+	}
+
+	return fields;
+}
+
+/*
+ * sv entbench [iterations]
+ *
+ * Parses the entity string of the current level
+ * with the old and the new parser and compares.
+ */
+void
+SVCmd_EntBench_f(void)
 {
-	const spawn_t *s;
-	gitem_t *item;
-	int i;
+	static edict_t scratch;
+	spawn_temp_t saved;
+	long long start, oldtime, newtime;
+	int i, n, fields;
+	size_t size;
 
-	if (!ent)
+	n = (gi.argc() > 2) ? (int)strtol(gi.argv(2), NULL, 10) : 100;
+
+	if (!spawn_entities || (n <= 0))
 	{
+		gi.cprintf(NULL, PRINT_HIGH, "Usage: sv entbench [iterations], needs a level\n");
 		return;
 	}
 
-	if (!ent->classname)
+	saved = st;
+	fields = ED_BenchParse(spawn_entities, &scratch);
+	size = strlen(spawn_entities);
+
+	start = Q_Microseconds();
+
+	for (i = 0; i < n; i++)
 	{
-		gi.dprintf("%s: NULL classname\n", __func__);
-		G_FreeEdict(ent);
-		return;
+		ED_BenchParseReference(spawn_entities, &scratch);
 	}
 
-	/* check item spawn functions */
-	for (i = 0, item = itemlist; i < itemlist_len; i++, item++)
+	oldtime = Q_Microseconds() - start;
+	start = Q_Microseconds();
+
+	for (i = 0; i < n; i++)
 	{
-		if (!item->classname)
-		{
-			continue;
-		}
+		ED_BenchParse(spawn_entities, &scratch);
+	}
 
-		if (!strcmp(item->classname, ent->classname))
-		{
-			/* found it */
-			SpawnItem(ent, item);
-			return;
-		}
+	newtime = Q_Microseconds() - start;
+	st = saved;
+
+	gi.cprintf(NULL, PRINT_HIGH, "%u bytes, %i fields, %i iterations\n",
+			(unsigned int)size, fields, n);
+	gi.cprintf(NULL, PRINT_HIGH, "old %8.3f ms/parse\n", oldtime / 1000.0 / n);
+	gi.cprintf(NULL, PRINT_HIGH, "new %8.3f ms/parse (%.1fx)\n", newtime / 1000.0 / n,
+			newtime ? (double)oldtime / newtime : 0.0);
+}
+
+/* =================================================================== */
+
+/*
+ * Entity cache (g_entcache). The entities of a map that
+ * survived the skill, deathmatch and coop filters are
+ * stored after parsing: the spawn fields that differ from
+ * a fresh edict and the resolved spawn function. The next
+ * load of the map reads the file in one go and spawns the
+ * records without parsing, filtering or name lookups. The
+ * cache is keyed by the entity string, the map name, the
+ * filter settings and the field layout of the build.
+ */
+#define ENTCACHE_MAGIC 0x43544e45 /* "ENTC" */
+#define ENTCACHE_VERSION 1
+#define ENTCACHE_NULLSTRING 0xffff
+
+typedef struct
+{
+	int magic;
+	int version;
+	unsigned long long key;
+	int numrecords;
+	int inhibit;
+} entcacheheader_t;
+
+static struct
+{
+	qboolean writing;
+	char filename[MAX_OSPATH];
+	unsigned long long key;
+	savebuf_t buf;
+	int numrecords;
+	edict_t base; /* the edict before parsing */
+} entcache;
+
+static unsigned long long
+EntCache_Hash(unsigned long long hash, const void *data, size_t len)
+{
+	const byte *p;
+	size_t i;
+
+	p = data;
+
+	for (i = 0; i < len; i++)
+	{
+		hash = (hash ^ p[i]) * 1099511628211ULL;
 	}
 
-	/* check normal spawn functions */
-	for (s = spawns; s->name; s++)
+	return hash;
+}
+
+static unsigned long long
+EntCache_Key(const char *mapname, const char *entities)
+{
+	unsigned long long hash;
+	const field_t *f;
+	qboolean spawntemp;
+	int i, v[6];
+
+	hash = EntCache_Hash(14695981039346656037ULL, entities, strlen(entities));
+	hash = EntCache_Hash(hash, mapname, strlen(mapname) + 1);
+
+	v[0] = (int)skill->value;
+	v[1] = (int)deathmatch->value;
+	v[2] = (int)coop->value;
+	v[3] = (int)sizeof(edict_t);
+	v[4] = (int)sizeof(spawn_temp_t);
+	v[5] = itemlist_len;
+	hash = EntCache_Hash(hash, v, sizeof(v));
+
+	for (i = 0; (f = GetSpawnField(i, &spawntemp)) != NULL; i++)
+	{
+		hash = EntCache_Hash(hash, f->name, strlen(f->name) + 1);
+		hash = EntCache_Hash(hash, &f->ofs, sizeof(f->ofs));
+		hash = EntCache_Hash(hash, &f->type, sizeof(f->type));
+	}
+
+	for (i = 0; spawns[i].name; i++)
+	{
+		hash = EntCache_Hash(hash, spawns[i].name, strlen(spawns[i].name) + 1);
+	}
+
+	return hash;
+}
+
+static void
+EntCache_Path(char *name, size_t size, const char *mapname)
+{
+	cvar_t *game;
+	char *c;
+
+	game = gi.cvar("game", "", 0);
+
+	Com_sprintf(name, size, "%s/", *game->string ? game->string : GAMEVERSION);
+	c = name + strlen(name);
+	Q_strlcat(name, mapname, size);
+
+	/* maps in subdirectories */
+	for ( ; *c; c++)
 	{
-		if (!strcmp(s->name, ent->classname))
+		if ((*c == '/') || (*c == '\\'))
 		{
-			/* found it */
-			s->spawn(ent);
-			return;
+			*c = '_';
 		}
 	}
 
-	gi.dprintf("%s doesn't have a spawn function\n", ent->classname);
+	Q_strlcat(name, ".entcache", size);
 }
 
-char *
-ED_NewString(const char *string)
+static void
+EntCache_WriteShort(int v)
 {
-	char *newb, *new_p;
-	size_t i, l;
+	short s;
 
-	if (!string)
+	s = (short)v;
+	SaveBuf_Write(&entcache.buf, &s, sizeof(s));
+}
+
+/*
+ * Called before an edict is parsed.
+ */
+static void
+EntCache_BeginRecord(const edict_t *ent)
+{
+	if (entcache.writing)
 	{
-		return NULL;
+		entcache.base = *ent;
 	}
+}
+
+/*
+ * Called when the edict passed the filters
+ * and is about to be spawned.
+ */
+static void
+EntCache_WriteRecord(const edict_t *ent)
+{
+	static const spawn_temp_t nost;
+	const byte *b, *base;
+	const field_t *f;
+	qboolean spawntemp;
+	size_t countofs, len;
+	gitem_t *item;
+	const char *s;
+	int i, count, spawn;
+	short s16;
 
-	l = strlen(string) + 1;
+	if (!entcache.writing)
+	{
+		return;
+	}
 
-	newb = gi.TagMalloc(l, TAG_LEVEL);
+	item = NULL;
+	spawn = ent->classname ? ED_FindSpawn(ent->classname, &item) : -1;
 
-	new_p = newb;
+	countofs = entcache.buf.size;
+	EntCache_WriteShort(0);
+	EntCache_WriteShort(item ? ITEM_INDEX(item) : 0);
+	EntCache_WriteShort(spawn);
 
-	for (i = 0; i < l; i++)
+	for (i = 0, count = 0; (f = GetSpawnField(i, &spawntemp)) != NULL; i++)
 	{
-		if ((string[i] == '\\') && (i < l - 1))
+		if (f->flags & FFL_NOSPAWN)
 		{
-			i++;
-
-			if (string[i] == 'n')
-			{
-				*new_p++ = '\n';
-			}
-			else
-			{
-				*new_p++ = '\\';
-			}
+			continue;
 		}
-		else
+
+		b = spawntemp ? (const byte *)&st + f->ofs : (const byte *)ent + f->ofs;
+		base = spawntemp ? (const byte *)&nost + f->ofs :
+			(const byte *)&entcache.base + f->ofs;
+
+		switch (f->type)
 		{
-			*new_p++ = string[i];
+			case F_LSTRING:
+				if (*(char **)b == *(char **)base)
+				{
+					continue;
+				}
+
+				EntCache_WriteShort(i);
+				s = *(char **)b;
+
+				if (!s)
+				{
+					EntCache_WriteShort(ENTCACHE_NULLSTRING);
+					break;
+				}
+
+				len = strlen(s);
+
+				if (len >= ENTCACHE_NULLSTRING)
+				{
+					len = ENTCACHE_NULLSTRING - 1;
+				}
+
+				EntCache_WriteShort((int)len);
+				SaveBuf_Write(&entcache.buf, s, len);
+				SaveBuf_Write(&entcache.buf, "", 1);
+				break;
+			case F_VECTOR:
+			case F_ANGLEHACK:
+				if (!memcmp(b, base, sizeof(vec3_t)))
+				{
+					continue;
+				}
+
+				EntCache_WriteShort(i);
+				SaveBuf_Write(&entcache.buf, b, sizeof(vec3_t));
+				break;
+			case F_INT:
+			case F_FLOAT:
+				if (!memcmp(b, base, 4))
+				{
+					continue;
+				}
+
+				EntCache_WriteShort(i);
+				SaveBuf_Write(&entcache.buf, b, 4);
+				break;
+			default:
+				continue;
 		}
+
+		count++;
 	}
 
-	return newb;
+	s16 = (short)count;
+	memcpy(entcache.buf.data + countofs, &s16, sizeof(s16));
+	entcache.numrecords++;
 }
 
-/*
- * Takes a key/value pair and sets
- * the binary values in an edict
- */
 static void
-ED_ParseField(const char *key, const char *value, edict_t *ent)
+EntCache_Finish(int inhibit)
 {
-	const field_t *f;
-	void *b;
-	vec_t *vec;
+	entcacheheader_t *header;
+	FILE *f;
 
-	if (!ent || !value || !key)
+	if (!entcache.writing)
 	{
 		return;
 	}
 
-	f = FindSpawntempField(key);
+	entcache.writing = false;
+
+	header = (entcacheheader_t *)entcache.buf.data;
+	header->numrecords = entcache.numrecords;
+	header->inhibit = inhibit;
+
+	f = Q_fopen(entcache.filename, "wb");
+
 	if (f)
 	{
-		b = (byte *)&st + f->ofs;
+		fwrite(entcache.buf.data, entcache.buf.size, 1, f);
+		fclose(f);
 	}
 	else
 	{
-		f = FindSpawnfield(key);
-		if (!f)
+		gi.dprintf("Couldn't write %s\n", entcache.filename);
+	}
+
+	SaveBuf_Free(&entcache.buf);
+}
+
+/*
+ * Walks the records without spawning
+ * anything. False if the file is broken.
+ */
+static qboolean
+EntCache_Validate(const byte *p, const byte *end, int numrecords)
+{
+	const field_t *f;
+	qboolean spawntemp;
+	short s[3], id, len;
+	int i, j;
+
+	for (i = 0; i < numrecords; i++)
+	{
+		if (end - p < (int)sizeof(s))
 		{
-			gi.dprintf("'%s' is not a field. Value is '%s'\n", key, value);
-			return;
+			return false;
 		}
 
-		b = (byte *)ent + f->ofs;
-	}
+		memcpy(s, p, sizeof(s));
+		p += sizeof(s);
 
-	switch (f->type)
-	{
-		case F_LSTRING:
-			*(char **)b = ED_NewString(value);
-			break;
-		case F_VECTOR:
-			vec = b;
-			if (sscanf(value, "%f %f %f", &vec[0], &vec[1], &vec[2]) != 3)
+		if ((s[0] < 0) || (s[1] < 0) || (s[1] >= itemlist_len) ||
+			(s[2] < -1) || (s[2] >= (int)(sizeof(spawns) / sizeof(spawns[0])) - 1))
+		{
+			return false;
+		}
+
+		for (j = 0; j < s[0]; j++)
+		{
+			if (end - p < (int)sizeof(id))
 			{
-				memset(vec, 0, sizeof(vec3_t));
-				gi.dprintf("%s: entity %d: incomplete '%s' field\n",
-					__func__, ent->s.number, f->name);
+				return false;
 			}
-			break;
-		case F_INT:
-			*(int *)b = (int)strtol(value, (char **)NULL, 10);
-			break;
-		case F_FLOAT:
-			*(float *)b = (float)strtod(value, (char **)NULL);
-			break;
-		case F_ANGLEHACK:
-			vec = b;
-			vec[0] = 0;
-			vec[1] = (vec_t)strtod(value, (char **)NULL);
-			vec[2] = 0;
-			break;
-		case F_IGNORE:
-			break;
-		default:
-			break;
+
+			memcpy(&id, p, sizeof(id));
+			p += sizeof(id);
+
+			f = GetSpawnField(id, &spawntemp);
+
+			if (!f || (f->flags & FFL_NOSPAWN))
+			{
+				return false;
+			}
+
+			switch (f->type)
+			{
+				case F_LSTRING:
+					if (end - p < (int)sizeof(len))
+					{
+						return false;
+					}
+
+					memcpy(&len, p, sizeof(len));
+					p += sizeof(len);
+
+					if ((unsigned short)len == ENTCACHE_NULLSTRING)
+					{
+						break;
+					}
+
+					if ((len < 0) || (end - p < len + 1) || p[len])
+					{
+						return false;
+					}
+
+					p += len + 1;
+					break;
+				case F_VECTOR:
+				case F_ANGLEHACK:
+					p += sizeof(vec3_t);
+					break;
+				case F_INT:
+				case F_FLOAT:
+					p += 4;
+					break;
+				default:
+					return false;
+			}
+
+			if (p > end)
+			{
+				return false;
+			}
+		}
 	}
+
+	return p == end;
 }
 
 /*
- * Parses an edict out of the given string,
- * returning the new position. ed should be
- * a properly initialized empty edict.
+ * Spawns the entities from the cache. Returns
+ * false if there is no usable cache, then the
+ * entity string must be parsed and the cache
+ * is written while doing so.
  */
-static char *
-ED_ParseEdict(char *data, edict_t *ent)
+static qboolean
+EntCache_Load(const char *mapname, const char *entities, int *inhibit)
 {
-	qboolean init;
+	entcacheheader_t header;
+	const field_t *f;
+	qboolean spawntemp;
+	byte *data;
+	const byte *p;
+	short s[3], id, len;
+	edict_t *ent;
+	FILE *file;
+	long size;
+	int i, j;
+	void *b;
 
-	if (!ent)
+	entcache.writing = false;
+
+	if (!g_entcache->value)
 	{
-		return NULL;
+		return false;
 	}
 
-	init = false;
-	memset(&st, 0, sizeof(st));
+	EntCache_Path(entcache.filename, sizeof(entcache.filename), mapname);
+	entcache.key = EntCache_Key(mapname, entities);
 
-	/* go through all the dictionary pairs */
-	while (1)
-	{
-		const char *com_token;
-		char keyname[256];
+	file = Q_fopen(entcache.filename, "rb");
+	data = NULL;
+	size = 0;
 
-		/* parse key */
-		com_token = COM_Parse(&data);
+	if (file)
+	{
+		fseek(file, 0, SEEK_END);
+		size = ftell(file);
+		fseek(file, 0, SEEK_SET);
 
-		if (com_token[0] == '}')
+		if (size >= (long)sizeof(header))
 		{
-			break;
-		}
+			data = gi.TagMalloc(size, TAG_LEVEL);
 
-		if (!data)
-		{
-			gi.error("ED_ParseEntity: EOF without closing brace");
-			break;
+			if (fread(data, size, 1, file) != 1)
+			{
+				gi.TagFree(data);
+				data = NULL;
+			}
 		}
 
-		Q_strlcpy(keyname, com_token, sizeof(keyname));
+		fclose(file);
+	}
 
-		/* parse value */
-		com_token = COM_Parse(&data);
+	if (data)
+	{
+		memcpy(&header, data, sizeof(header));
 
-		if (!data)
+		if ((header.magic != ENTCACHE_MAGIC) ||
+			(header.version != ENTCACHE_VERSION) ||
+			(header.key != entcache.key) || (header.numrecords <= 0) ||
+			!EntCache_Validate(data + sizeof(header), data + size,
+				header.numrecords))
 		{
-			gi.error("%s: EOF without closing brace", __func__);
-			break;
+			gi.TagFree(data);
+			data = NULL;
 		}
+	}
 
-		if (com_token[0] == '}')
-		{
-			gi.error("%s: closing brace without data", __func__);
-			break;
-		}
+	if (!data)
+	{
+		/* build it while parsing */
+		memset(&header, 0, sizeof(header));
+		header.magic = ENTCACHE_MAGIC;
+		header.version = ENTCACHE_VERSION;
+		header.key = entcache.key;
 
-		init = true;
+		memset(&entcache.buf, 0, sizeof(entcache.buf));
+		SaveBuf_Write(&entcache.buf, &header, sizeof(header));
+		entcache.numrecords = 0;
+		entcache.writing = true;
 
-		/* keynames with a leading underscore are
-		   used for utility comments, and are
-		   immediately discarded by quake */
-		if (keyname[0] == '_')
+		return false;
+	}
+
+	p = data + sizeof(header);
+	ent = NULL;
+
+	for (i = 0; i < header.numrecords; i++)
+	{
+		ent = ent ? G_Spawn() : g_edicts;
+		memset(&st, 0, sizeof(st));
+
+		memcpy(s, p, sizeof(s));
+		p += sizeof(s);
+
+		for (j = 0; j < s[0]; j++)
 		{
-			continue;
+			memcpy(&id, p, sizeof(id));
+			p += sizeof(id);
+
+			f = GetSpawnField(id, &spawntemp);
+			b = spawntemp ? (byte *)&st + f->ofs : (byte *)ent + f->ofs;
+
+			switch (f->type)
+			{
+				case F_LSTRING:
+					memcpy(&len, p, sizeof(len));
+					p += sizeof(len);
+
+					if ((unsigned short)len == ENTCACHE_NULLSTRING)
+					{
+						*(char **)b = NULL;
+						break;
+					}
+
+					*(char **)b = G_InternString((const char *)p);
+					p += len + 1;
+					break;
+				case F_VECTOR:
+				case F_ANGLEHACK:
+					memcpy(b, p, sizeof(vec3_t));
+					p += sizeof(vec3_t);
+					break;
+				default:
+					memcpy(b, p, 4);
+					p += 4;
+					break;
+			}
 		}
 
-		ED_ParseField(keyname, com_token, ent);
+		ED_Spawn(ent, GetItemByIndex(s[1]), s[2]);
 	}
 
-	if (!init)
-	{
-		memset(ent, 0, sizeof(*ent));
-	}
+	gi.TagFree(data);
+	*inhibit = header.inhibit;
 
-	return data;
+	return true;
 }
 
 /*
@@ -357,7 +1411,7 @@ G_FindTeams(void)
 				continue;
 			}
 
-			if (!strcmp(e->team, e2->team))
+			if (G_StringsEqual(e->team, e2->team))
 			{
 				c2++;
 				chain->teamchain = e2;
@@ -380,7 +1434,8 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 {
 	edict_t *ent;
 	int inhibit;
-	const char *com_token;
+	const char *data, *token;
+	size_t len;
 	int i;
 	float skill_level;
 
@@ -406,12 +1461,26 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 		gi.cvar_forceset("skill", va("%f", skill_level));
 	}
 
+	/* ends a running recording or starts
+	   an armed one before anything is spawned */
+	G_ReplayLevelStart(mapname);
+
+	/* the last level may still be written in the background */
+	SV_WaitForSaves();
+
 	SaveClientData();
 
 	gi.FreeTags(TAG_LEVEL);
+	G_FlightClear();
+	G_ResetEdictPools();
+	G_ResetStrings();
+	G_ResetLevelSaveBase();
 
 	memset(&level, 0, sizeof(level));
-	memset(g_edicts, 0, game.maxentities * sizeof(g_edicts[0]));
+	G_ResetEdicts();
+	G_ResetIndexes();
+	G_ResetLagHistory(NULL);
+	InvalidateScoreboard();
 
 	Q_strlcpy(level.mapname, mapname, sizeof(level.mapname));
 	Q_strlcpy(game.spawnpoint, spawnpoint, sizeof(game.spawnpoint));
@@ -424,21 +1493,27 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 
 	ent = NULL;
 	inhibit = 0;
+	data = entities;
+	spawn_entities = entities;
+
+	if (EntCache_Load(mapname, entities, &inhibit))
+	{
+		data = NULL;
+	}
 
 	/* parse ents */
-	while (1)
+	while (data)
 	{
 		/* parse the opening brace */
-		com_token = COM_Parse(&entities);
-
-		if (!entities)
+		if (!ED_NextToken(&data, &token, &len))
 		{
 			break;
 		}
 
-		if (com_token[0] != '{')
+		if (!len || (token[0] != '{'))
 		{
-			gi.error("%s: found %s when expecting {", __func__, com_token);
+			gi.error("%s: found %.*s when expecting {", __func__,
+					(int)len, token);
 			break;
 		}
 
@@ -451,7 +1526,8 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 			ent = G_Spawn();
 		}
 
-		entities = ED_ParseEdict(entities, ent);
+		EntCache_BeginRecord(ent);
+		data = ED_ParseEdict(data, ent);
 
 		/* yet another map hack */
 		if (!Q_stricmp(level.mapname, "command") &&
@@ -498,9 +1574,12 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 				  SPAWNFLAG_NOT_COOP | SPAWNFLAG_NOT_DEATHMATCH);
 		}
 
+		EntCache_WriteRecord(ent);
 		ED_CallSpawn(ent);
 	}
 
+	EntCache_Finish(inhibit);
+
 	/* in case the last entity in the entstring has spawntemp fields */
 	memset(&st, 0, sizeof(st));
 
@@ -509,6 +1588,8 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 	G_FindTeams();
 
 	PlayerTrail_Init();
+
+	G_ResetEdictMirror();
 }
 
 /* =================================================================== */
@@ -745,37 +1826,37 @@ SP_worldspawn(edict_t *ent)
 
 	snd_fry = gi.soundindex("player/fry.wav"); /* standing in lava / slime */
 
-	PrecacheItem(FindItem("Blaster"));
+	PrecacheItem(ITEM_BY_ID(IT_WEAPON_BLASTER));
 
-	gi.soundindex("player/lava1.wav");
-	gi.soundindex("player/lava2.wav");
+	G_SoundIndex(SND_LAVA1);
+	G_SoundIndex(SND_LAVA2);
 
-	gi.soundindex("misc/pc_up.wav");
-	gi.soundindex("misc/talk1.wav");
+	G_SoundIndex(SND_PC_UP);
+	G_SoundIndex(SND_TALK1);
 
-	gi.soundindex("misc/udeath.wav");
+	G_SoundIndex(SND_UDEATH);
 
 	/* gibs */
 	gi.soundindex("items/respawn1.wav");
 
 	/* sexed sounds */
-	gi.soundindex("*death1.wav");
-	gi.soundindex("*death2.wav");
-	gi.soundindex("*death3.wav");
-	gi.soundindex("*death4.wav");
+	G_SoundIndex(SND_DEATH1);
+	G_SoundIndex(SND_DEATH2);
+	G_SoundIndex(SND_DEATH3);
+	G_SoundIndex(SND_DEATH4);
 	gi.soundindex("*fall1.wav");
 	gi.soundindex("*fall2.wav");
-	gi.soundindex("*gurp1.wav"); /* drowning damage */
-	gi.soundindex("*gurp2.wav");
-	gi.soundindex("*jump1.wav"); /* player jump */
-	gi.soundindex("*pain25_1.wav");
-	gi.soundindex("*pain25_2.wav");
-	gi.soundindex("*pain50_1.wav");
-	gi.soundindex("*pain50_2.wav");
-	gi.soundindex("*pain75_1.wav");
-	gi.soundindex("*pain75_2.wav");
-	gi.soundindex("*pain100_1.wav");
-	gi.soundindex("*pain100_2.wav");
+	G_SoundIndex(SND_GURP1); /* drowning damage */
+	G_SoundIndex(SND_GURP2);
+	G_SoundIndex(SND_JUMP1); /* player jump */
+	G_SoundIndex(SND_PAIN25_1);
+	G_SoundIndex(SND_PAIN25_2);
+	G_SoundIndex(SND_PAIN50_1);
+	G_SoundIndex(SND_PAIN50_2);
+	G_SoundIndex(SND_PAIN75_1);
+	G_SoundIndex(SND_PAIN75_2);
+	G_SoundIndex(SND_PAIN100_1);
+	G_SoundIndex(SND_PAIN100_2);
 
 	/* sexed models: THIS ORDER MUST MATCH THE DEFINES IN g_local.h
 	   you can add more, max 19 (pete change)these models are only
@@ -800,33 +1881,33 @@ SP_worldspawn(edict_t *ent)
 
 	/* ------------------- */
 
-	gi.soundindex("player/gasp1.wav"); /* gasping for air */
-	gi.soundindex("player/gasp2.wav"); /* head breaking surface, not gasping */
+	G_SoundIndex(SND_GASP1); /* gasping for air */
+	G_SoundIndex(SND_GASP2); /* head breaking surface, not gasping */
 
-	gi.soundindex("player/watr_in.wav"); /* feet hitting water */
-	gi.soundindex("player/watr_out.wav"); /* feet leaving water */
+	G_SoundIndex(SND_WATR_IN); /* feet hitting water */
+	G_SoundIndex(SND_WATR_OUT); /* feet leaving water */
 
-	gi.soundindex("player/watr_un.wav"); /* head going underwater */
+	G_SoundIndex(SND_WATR_UN); /* head going underwater */
 
-	gi.soundindex("player/u_breath1.wav");
-	gi.soundindex("player/u_breath2.wav");
+	G_SoundIndex(SND_U_BREATH1);
+	G_SoundIndex(SND_U_BREATH2);
 
 	gi.soundindex("items/pkup.wav"); /* bonus item pickup */
-	gi.soundindex("world/land.wav"); /* landing thud */
-	gi.soundindex("misc/h2ohit1.wav"); /* landing splash */
+	G_SoundIndex(SND_LAND); /* landing thud */
+	G_SoundIndex(SND_H2OHIT1); /* landing splash */
 
-	gi.soundindex("items/damage.wav");
-	gi.soundindex("items/protect.wav");
-	gi.soundindex("items/protect4.wav");
-	gi.soundindex("weapons/noammo.wav");
+	G_SoundIndex(SND_DAMAGE);
+	G_SoundIndex(SND_PROTECT);
+	G_SoundIndex(SND_PROTECT4);
+	G_SoundIndex(SND_NOAMMO);
 
-	gi.soundindex("infantry/inflies1.wav");
+	G_SoundIndex(SND_INFLIES1);
 
-	sm_meat_index = gi.modelindex("models/objects/gibs/sm_meat/tris.md2");
+	sm_meat_index = G_ModelIndex(MDL_GIB_SM_MEAT);
 	gi.modelindex("models/objects/gibs/arm/tris.md2");
 	gi.modelindex("models/objects/gibs/bone/tris.md2");
 	gi.modelindex("models/objects/gibs/bone2/tris.md2");
-	gi.modelindex("models/objects/gibs/chest/tris.md2");
+	G_ModelIndex(MDL_GIB_CHEST);
 	gi.modelindex("models/objects/gibs/skull/tris.md2");
 	gi.modelindex("models/objects/gibs/head2/tris.md2");
 
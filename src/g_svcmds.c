@@ -7,8 +7,6 @@
 
 #include "header/local.h"
 
-#define MAX_IPFILTERS 1024
-
 void
 Svcmd_Test_f(void)
 {
@@ -26,11 +24,13 @@ Svcmd_Test_f(void)
  * addip <ip>
  * removeip <ip>
  *
- * The ip address is specified in dot format, and any unspecified
- * digits will match any value, so you can specify an entire class
- * C network with "addip 192.246.40".
+ * The ip address is specified in dot format, optionally followed
+ * by a CIDR prefix length: "addip 192.246.40.0/24". Without a prefix
+ * length any unspecified or trailing zero digits will match any
+ * value, so you can also specify an entire class C network with
+ * "addip 192.246.40".
  *
- * Removeip will only remove an address specified exactly the same
+ * Removeip will only remove a prefix specified exactly the same
  * way. You cannot addip a subnet, then removeip a single host.
  *
  * listip
@@ -41,6 +41,12 @@ Svcmd_Test_f(void)
  *  at a later date. The filter lists are not saved and restored
  *  by default, because I belive it would cause too much confusion.
  *
+ * loadip [file]
+ *  Adds every prefix in the given file, one per line. Lines starting
+ *  with '#' or "//" are ignored. Without an argument the file named
+ *  by filterbanlist (default "banlist.txt", relative to the game
+ *  directory) is loaded. That file is also loaded at startup.
+ *
  * filterban <0 or 1>
  *  If 1 (the default), then ip addresses matching the current list
  *  will be prohibited from entering the game.This is the default
@@ -49,71 +55,331 @@ Svcmd_Test_f(void)
  *  This lets you easily set up a private game, or a game that only
  *  allows players from your local network.
  *
+ * The filters are kept in a path compressed binary radix trie, so
+ * a lookup costs at most 32 bit tests regardless of the number of
+ * filters and the trie never holds more than two nodes per filter.
+ * Old style filters with a zero octet in front of a non zero one,
+ * e.g. "10.0.5.1", aren't prefixes. The zero still matches any
+ * value, those few filters are kept in a plain list.
+ *
  * ==============================================================================
  */
 
+#define MAX_IPFILTERS 262144
+#define IPFILTER_BLOCK 1024
+
+typedef struct ipnode_s
+{
+	unsigned key;       /* address prefix, host byte order */
+	byte len;           /* prefix length in bits */
+	qboolean terminal;  /* a filter ends here */
+	struct ipnode_s *child[2];
+} ipnode_t;
+
+#define MAX_MASKFILTERS 1024
+
 typedef struct
 {
+	unsigned key;
 	unsigned mask;
-	unsigned compare;
-} ipfilter_t;
+} maskfilter_t;
 
-ipfilter_t ipfilters[MAX_IPFILTERS];
-int numipfilters;
+static ipnode_t *ipfilter_root;
+static ipnode_t *ipfilter_free;
+static int numipfilters;
 
-qboolean
-StringToFilter(char *s, ipfilter_t *f)
+static maskfilter_t maskfilters[MAX_MASKFILTERS];
+static int nummaskfilters;
+
+static unsigned
+IPMask(int len)
+{
+	return len ? 0xffffffff << (32 - len) : 0;
+}
+
+static int
+IPBit(unsigned key, int bit)
+{
+	return (key >> (31 - bit)) & 1;
+}
+
+static ipnode_t *
+IPNodeAlloc(unsigned key, int len, qboolean terminal)
+{
+	ipnode_t *n;
+	int i;
+
+	if (!ipfilter_free)
+	{
+		ipfilter_free = gi.TagMalloc(IPFILTER_BLOCK * sizeof(ipnode_t), TAG_FILTER);
+
+		for (i = 0; i < IPFILTER_BLOCK - 1; i++)
+		{
+			ipfilter_free[i].child[0] = &ipfilter_free[i + 1];
+		}
+
+		ipfilter_free[i].child[0] = NULL;
+	}
+
+	n = ipfilter_free;
+	ipfilter_free = n->child[0];
+
+	n->key = key & IPMask(len);
+	n->len = len;
+	n->terminal = terminal;
+	n->child[0] = n->child[1] = NULL;
+
+	return n;
+}
+
+static void
+IPNodeFree(ipnode_t *n)
+{
+	n->child[0] = ipfilter_free;
+	ipfilter_free = n;
+}
+
+/* Length of a prefix mask, -1 if it isn't one. */
+static int
+IPMaskLen(unsigned mask)
+{
+	int len;
+
+	for (len = 0; (len < 32) && (mask & 0x80000000); len++)
+	{
+		mask <<= 1;
+	}
+
+	return mask ? -1 : len;
+}
+
+/*
+ * Parses "a.b.c.d/len". Without "/len" every
+ * zero octet matches any value, like it did
+ * before CIDR prefixes were supported.
+ */
+static qboolean
+StringToFilter(const char *s, unsigned *key, unsigned *mask)
 {
-	char num[128];
-	int i, j;
-	byte b[4];
-	byte m[4];
+	const char *p;
+	unsigned b[4];
+	int i, octets, bits;
 
-	if (!s || !f)
+	if (!s || !key || !mask)
 	{
 		return false;
 	}
 
+	p = s;
+	b[0] = b[1] = b[2] = b[3] = 0;
+	octets = 0;
+
 	for (i = 0; i < 4; i++)
 	{
-		b[i] = 0;
-		m[i] = 0;
+		if ((*p < '0') || (*p > '9'))
+		{
+			break;
+		}
+
+		while (*p >= '0' && *p <= '9')
+		{
+			b[i] = b[i] * 10 + (*p++ - '0');
+
+			if (b[i] > 255)
+			{
+				gi.cprintf(NULL, PRINT_HIGH, "Bad filter address: %s\n", s);
+				return false;
+			}
+		}
+
+		octets++;
+
+		if (*p != '.')
+		{
+			break;
+		}
+
+		p++;
 	}
 
-	for (i = 0; i < 4; i++)
+	if (!octets)
 	{
-		if ((*s < '0') || (*s > '9'))
+		gi.cprintf(NULL, PRINT_HIGH, "Bad filter address: %s\n", s);
+		return false;
+	}
+
+	*key = (b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3];
+
+	if (*p == '/')
+	{
+		p++;
+		bits = 0;
+
+		if ((*p < '0') || (*p > '9'))
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "Bad filter prefix: %s\n", s);
+			return false;
+		}
+
+		while (*p >= '0' && *p <= '9' && bits <= 32)
+		{
+			bits = bits * 10 + (*p++ - '0');
+		}
+
+		if (bits > 32)
 		{
-			gi.cprintf(NULL, PRINT_HIGH, "Bad filter address: %s\n", s);
+			gi.cprintf(NULL, PRINT_HIGH, "Bad filter prefix: %s\n", s);
 			return false;
 		}
 
-		j = 0;
+		*mask = IPMask(bits);
+	}
+	else
+	{
+		/* old style, zero octets are wildcards */
+		*mask = 0;
+
+		for (i = 0; i < 4; i++)
+		{
+			if (b[i])
+			{
+				*mask |= 0xff000000 >> (8 * i);
+			}
+		}
+	}
+
+	if (*p && (*p != ' ') && (*p != '\t') && (*p != '\r') && (*p != '\n'))
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Bad filter address: %s\n", s);
+		return false;
+	}
+
+	*key &= *mask;
+
+	return true;
+}
+
+/*
+ * Returns false if the prefix
+ * is already in the list.
+ */
+static qboolean
+SV_AddIPFilter(unsigned key, int len)
+{
+	ipnode_t **link, *n, *split;
+	int common;
+	unsigned diff;
+
+	link = &ipfilter_root;
+
+	while ((n = *link) != NULL)
+	{
+		/* length of the common prefix */
+		diff = (key ^ n->key) & IPMask(n->len < len ? n->len : len);
+
+		for (common = 0; common < 32 && !(diff & 0x80000000); common++)
+		{
+			diff <<= 1;
+		}
+
+		if (common > n->len)
+		{
+			common = n->len;
+		}
 
-		while (*s >= '0' && *s <= '9')
+		if (common > len)
 		{
-			num[j++] = *s++;
+			common = len;
 		}
 
-		num[j] = 0;
-		b[i] = atoi(num);
+		if (common < n->len)
+		{
+			/* split the edge */
+			split = IPNodeAlloc(key, common, common == len);
+			split->child[IPBit(n->key, common)] = n;
+			*link = split;
+
+			if (common < len)
+			{
+				split->child[IPBit(key, common)] = IPNodeAlloc(key, len, true);
+			}
+
+			numipfilters++;
+			return true;
+		}
+
+		if (n->len == len)
+		{
+			if (n->terminal)
+			{
+				return false;
+			}
+
+			n->terminal = true;
+			numipfilters++;
+			return true;
+		}
+
+		link = &n->child[IPBit(key, n->len)];
+	}
+
+	*link = IPNodeAlloc(key, len, true);
+	numipfilters++;
+
+	return true;
+}
+
+static qboolean
+SV_RemoveIPFilter(unsigned key, int len)
+{
+	ipnode_t **link, **parentlink, *n, *parent;
+
+	parentlink = NULL;
+	link = &ipfilter_root;
 
-		if (b[i] != 0)
+	while ((n = *link) != NULL)
+	{
+		if ((n->len > len) || ((key ^ n->key) & IPMask(n->len)))
 		{
-			m[i] = 255;
+			return false;
 		}
 
-		if (!*s)
+		if (n->len == len)
 		{
 			break;
 		}
 
-		s++;
+		parentlink = link;
+		link = &n->child[IPBit(key, n->len)];
+	}
+
+	if (!n || !n->terminal)
+	{
+		return false;
 	}
 
-	/* PVS NOTE: maybe use memcpy here instead? */
-	f->mask = *(unsigned *)m;
-	f->compare = *(unsigned *)b;
+	n->terminal = false;
+	numipfilters--;
+
+	if (n->child[0] && n->child[1])
+	{
+		return true;
+	}
+
+	/* unlink the node and merge a now pointless parent */
+	*link = n->child[0] ? n->child[0] : n->child[1];
+	IPNodeFree(n);
+
+	if (!*link && parentlink)
+	{
+		parent = *parentlink;
+
+		if (!parent->terminal)
+		{
+			*parentlink = parent->child[0] ? parent->child[0] : parent->child[1];
+			IPNodeFree(parent);
+		}
+	}
 
 	return true;
 }
@@ -122,8 +388,8 @@ qboolean
 SV_FilterPacket(char *from)
 {
 	int i;
-	unsigned in;
-	byte m[4];
+	unsigned in, octet;
+	ipnode_t *n;
 	char *p;
 
 	if (!from)
@@ -131,33 +397,50 @@ SV_FilterPacket(char *from)
 		return false;
 	}
 
-	i = 0;
+	in = 0;
 	p = from;
 
-	while (*p && i < 4)
+	for (i = 0; i < 4; i++)
 	{
-		m[i] = 0;
+		octet = 0;
 
 		while (*p >= '0' && *p <= '9')
 		{
-			m[i] = m[i] * 10 + (*p - '0');
+			octet = octet * 10 + (*p - '0');
 			p++;
 		}
 
-		if (!*p || (*p == ':'))
+		in |= (octet & 255) << (24 - 8 * i);
+
+		if (*p != '.')
 		{
 			break;
 		}
 
-		i++, p++;
+		p++;
 	}
 
-	/* PVS NOTE: maybe use memcpy instead? */
-	in = *(unsigned *)m;
+	for (n = ipfilter_root; n; n = n->child[IPBit(in, n->len)])
+	{
+		if ((in ^ n->key) & IPMask(n->len))
+		{
+			break;
+		}
+
+		if (n->terminal)
+		{
+			return (filterban->value != 0);
+		}
+
+		if (n->len == 32)
+		{
+			break;
+		}
+	}
 
-	for (i = 0; i < numipfilters; i++)
+	for (i = 0; i < nummaskfilters; i++)
 	{
-		if ((in & ipfilters[i].mask) == ipfilters[i].compare)
+		if ((in & maskfilters[i].mask) == maskfilters[i].key)
 		{
 			return (filterban->value != 0);
 		}
@@ -166,47 +449,199 @@ SV_FilterPacket(char *from)
 	return (filterban->value == 0);
 }
 
-void
-SVCmd_AddIP_f(void)
+/*
+ * Adds a filter to the trie or, if the mask isn't
+ * a prefix, to the list. False if already there.
+ */
+static qboolean
+SV_AddFilter(unsigned key, unsigned mask)
 {
-	int i;
+	int i, len;
 
-	if (gi.argc() < 3)
+	len = IPMaskLen(mask);
+
+	if (len >= 0)
 	{
-		gi.cprintf(NULL, PRINT_HIGH, "Usage:  addip <ip-mask>\n");
-		return;
+		return SV_AddIPFilter(key, len);
 	}
 
-	for (i = 0; i < numipfilters; i++)
+	for (i = 0; i < nummaskfilters; i++)
 	{
-		if (ipfilters[i].compare == 0xffffffff)
+		if ((maskfilters[i].key == key) && (maskfilters[i].mask == mask))
 		{
-			break; /* free spot */
+			return false;
 		}
 	}
 
-	if (i == numipfilters)
+	if (nummaskfilters == MAX_MASKFILTERS)
 	{
-		if (numipfilters == MAX_IPFILTERS)
+		gi.cprintf(NULL, PRINT_HIGH, "Too many filters with wildcard octets\n");
+		return false;
+	}
+
+	maskfilters[nummaskfilters].key = key;
+	maskfilters[nummaskfilters].mask = mask;
+	nummaskfilters++;
+
+	return true;
+}
+
+static qboolean
+SV_RemoveFilter(unsigned key, unsigned mask)
+{
+	int i, len;
+
+	len = IPMaskLen(mask);
+
+	if (len >= 0)
+	{
+		return SV_RemoveIPFilter(key, len);
+	}
+
+	for (i = 0; i < nummaskfilters; i++)
+	{
+		if ((maskfilters[i].key == key) && (maskfilters[i].mask == mask))
+		{
+			maskfilters[i] = maskfilters[--nummaskfilters];
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void
+SV_ClearIPFilters(void)
+{
+	gi.FreeTags(TAG_FILTER);
+
+	ipfilter_root = NULL;
+	ipfilter_free = NULL;
+	numipfilters = 0;
+	nummaskfilters = 0;
+}
+
+static void
+SV_FilterPath(char *name, size_t size, const char *file)
+{
+	cvar_t *game;
+
+	game = gi.cvar("game", "", 0);
+
+	if (!*game->string)
+	{
+		Com_sprintf(name, size, "%s/%s", GAMEVERSION, file);
+	}
+	else
+	{
+		Com_sprintf(name, size, "%s/%s", game->string, file);
+	}
+}
+
+static void
+SV_LoadIPFilters(const char *file, qboolean verbose)
+{
+	char name[MAX_OSPATH];
+	char line[256];
+	char *s;
+	unsigned key, mask;
+	int added, lineno;
+	FILE *f;
+
+	SV_FilterPath(name, sizeof(name), file);
+
+	f = Q_fopen(name, "rb");
+
+	if (!f)
+	{
+		if (verbose)
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", name);
+		}
+
+		return;
+	}
+
+	added = 0;
+	lineno = 0;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		lineno++;
+
+		for (s = line; *s == ' ' || *s == '\t'; s++)
+		{
+		}
+
+		if (!*s || (*s == '\r') || (*s == '\n') || (*s == '#') ||
+			((s[0] == '/') && (s[1] == '/')))
+		{
+			continue;
+		}
+
+		if (numipfilters >= MAX_IPFILTERS)
 		{
 			gi.cprintf(NULL, PRINT_HIGH, "IP filter list is full\n");
-			return;
+			break;
 		}
 
-		numipfilters++;
+		if (!StringToFilter(s, &key, &mask))
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "%s:%i: skipped\n", name, lineno);
+			continue;
+		}
+
+		if (SV_AddFilter(key, mask))
+		{
+			added++;
+		}
 	}
 
-	if (!StringToFilter(gi.argv(2), &ipfilters[i]))
+	fclose(f);
+
+	gi.cprintf(NULL, PRINT_HIGH, "Loaded %i ip filters from %s.\n", added, name);
+}
+
+void
+SV_InitIPFilters(void)
+{
+	SV_ClearIPFilters();
+
+	if (filterbanlist && *filterbanlist->string)
 	{
-		ipfilters[i].compare = 0xffffffff;
+		SV_LoadIPFilters(filterbanlist->string, false);
 	}
 }
 
+void
+SVCmd_AddIP_f(void)
+{
+	unsigned key, mask;
+
+	if (gi.argc() < 3)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Usage:  addip <ip-mask>\n");
+		return;
+	}
+
+	if (numipfilters >= MAX_IPFILTERS)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "IP filter list is full\n");
+		return;
+	}
+
+	if (!StringToFilter(gi.argv(2), &key, &mask))
+	{
+		return;
+	}
+
+	SV_AddFilter(key, mask);
+}
+
 void
 SVCmd_RemoveIP_f(void)
 {
-	ipfilter_t f;
-	int i, j;
+	unsigned key, mask;
 
 	if (gi.argc() < 3)
 	{
@@ -214,45 +649,85 @@ SVCmd_RemoveIP_f(void)
 		return;
 	}
 
-	if (!StringToFilter(gi.argv(2), &f))
+	if (!StringToFilter(gi.argv(2), &key, &mask))
 	{
 		return;
 	}
 
-	for (i = 0; i < numipfilters; i++)
+	if (SV_RemoveFilter(key, mask))
 	{
-		if ((ipfilters[i].mask == f.mask) &&
-			(ipfilters[i].compare == f.compare))
-		{
-			for (j = i + 1; j < numipfilters; j++)
-			{
-				ipfilters[j - 1] = ipfilters[j];
-			}
+		gi.cprintf(NULL, PRINT_HIGH, "Removed.\n");
+		return;
+	}
 
-			numipfilters--;
-			gi.cprintf(NULL, PRINT_HIGH, "Removed.\n");
-			return;
+	gi.cprintf(NULL, PRINT_HIGH, "Didn't find %s.\n", gi.argv(2));
+}
+
+void
+SVCmd_LoadIP_f(void)
+{
+	if (gi.argc() < 3)
+	{
+		SV_LoadIPFilters(filterbanlist->string, true);
+	}
+	else
+	{
+		SV_LoadIPFilters(gi.argv(2), true);
+	}
+}
+
+/*
+ * Walks the trie in address order and
+ * hands every filter to the callback.
+ */
+static void
+SV_WalkIPFilters(const ipnode_t *n, void (*func)(const ipnode_t *, void *),
+		void *data)
+{
+	for ( ; n; n = n->child[1])
+	{
+		if (n->terminal)
+		{
+			func(n, data);
 		}
+
+		SV_WalkIPFilters(n->child[0], func, data);
 	}
+}
 
-	gi.cprintf(NULL, PRINT_HIGH, "Didn't find %s.\n", gi.argv(2));
+static void
+SV_PrintIPFilter(const ipnode_t *n, void *data)
+{
+	gi.cprintf(NULL, PRINT_HIGH, "%3u.%3u.%3u.%3u/%i\n",
+			n->key >> 24, (n->key >> 16) & 255, (n->key >> 8) & 255,
+			n->key & 255, n->len);
+}
+
+static void
+SV_WriteIPFilter(const ipnode_t *n, void *data)
+{
+	fprintf((FILE *)data, "sv addip %u.%u.%u.%u/%i\n",
+			n->key >> 24, (n->key >> 16) & 255, (n->key >> 8) & 255,
+			n->key & 255, n->len);
 }
 
 void
 SVCmd_ListIP_f(void)
 {
 	int i;
-	byte b[4];
 
 	gi.cprintf(NULL, PRINT_HIGH, "Filter list:\n");
+	SV_WalkIPFilters(ipfilter_root, SV_PrintIPFilter, NULL);
 
-	for (i = 0; i < numipfilters; i++)
+	/* zero octets are wildcards */
+	for (i = 0; i < nummaskfilters; i++)
 	{
-		/* PVS NOTE: maybe use memcpy instead? */
-		*(unsigned *)b = ipfilters[i].compare;
-		gi.cprintf(NULL, PRINT_HIGH, "%3i.%3i.%3i.%3i\n",
-				b[0], b[1], b[2], b[3]);
+		gi.cprintf(NULL, PRINT_HIGH, "%3u.%3u.%3u.%3u\n",
+				maskfilters[i].key >> 24, (maskfilters[i].key >> 16) & 255,
+				(maskfilters[i].key >> 8) & 255, maskfilters[i].key & 255);
 	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i filters.\n", numipfilters + nummaskfilters);
 }
 
 void
@@ -260,24 +735,13 @@ SVCmd_WriteIP_f(void)
 {
 	FILE *f;
 	char name[MAX_OSPATH];
-	byte b[4];
 	int i;
-	cvar_t *game;
 
-	game = gi.cvar("game", "", 0);
-
-	if (!*game->string)
-	{
-		sprintf(name, "%s/listip.cfg", GAMEVERSION);
-	}
-	else
-	{
-		sprintf(name, "%s/listip.cfg", game->string);
-	}
+	SV_FilterPath(name, sizeof(name), "listip.cfg");
 
 	gi.cprintf(NULL, PRINT_HIGH, "Writing %s.\n", name);
 
-	f = fopen(name, "wb");
+	f = Q_fopen(name, "wb");
 
 	if (!f)
 	{
@@ -286,12 +750,13 @@ SVCmd_WriteIP_f(void)
 	}
 
 	fprintf(f, "set filterban %d\n", (int)filterban->value);
+	SV_WalkIPFilters(ipfilter_root, SV_WriteIPFilter, f);
 
-	for (i = 0; i < numipfilters; i++)
+	for (i = 0; i < nummaskfilters; i++)
 	{
-		/* PVS NOTE: maybe use memcpy instead? */
-		*(unsigned *)b = ipfilters[i].compare;
-		fprintf(f, "sv addip %i.%i.%i.%i\n", b[0], b[1], b[2], b[3]);
+		fprintf(f, "sv addip %u.%u.%u.%u\n",
+				maskfilters[i].key >> 24, (maskfilters[i].key >> 16) & 255,
+				(maskfilters[i].key >> 8) & 255, maskfilters[i].key & 255);
 	}
 
 	fclose(f);
@@ -329,6 +794,66 @@ ServerCommand(void)
 	{
 		SVCmd_WriteIP_f();
 	}
+	else if (Q_stricmp(cmd, "loadip") == 0)
+	{
+		SVCmd_LoadIP_f();
+	}
+	else if (Q_stricmp(cmd, "cmdstats") == 0)
+	{
+		SVCmd_CmdStats_f();
+	}
+	else if (Q_stricmp(cmd, "lagbench") == 0)
+	{
+		SVCmd_LagBench_f();
+	}
+	else if (Q_stricmp(cmd, "edictstats") == 0)
+	{
+		SVCmd_EdictStats_f();
+	}
+	else if (Q_stricmp(cmd, "snapshot") == 0)
+	{
+		SVCmd_Snapshot_f();
+	}
+	else if (Q_stricmp(cmd, "rollback") == 0)
+	{
+		SVCmd_Rollback_f();
+	}
+	else if (Q_stricmp(cmd, "strings") == 0)
+	{
+		SVCmd_StringStats_f();
+	}
+	else if (Q_stricmp(cmd, "seed") == 0)
+	{
+		SVCmd_Seed_f();
+	}
+	else if (Q_stricmp(cmd, "record") == 0)
+	{
+		SVCmd_Record_f(false);
+	}
+	else if (Q_stricmp(cmd, "replay") == 0)
+	{
+		SVCmd_Record_f(true);
+	}
+	else if (Q_stricmp(cmd, "stopreplay") == 0)
+	{
+		SVCmd_StopReplay_f();
+	}
+	else if (Q_stricmp(cmd, "entbench") == 0)
+	{
+		SVCmd_EntBench_f();
+	}
+	else if (Q_stricmp(cmd, "callstats") == 0)
+	{
+		SVCmd_CallStats_f();
+	}
+	else if (Q_stricmp(cmd, "netstats") == 0)
+	{
+		SVCmd_NetStats_f();
+	}
+	else if (Q_stricmp(cmd, "timeline") == 0)
+	{
+		SVCmd_Timeline_f();
+	}
 	else
 	{
 		gi.cprintf(NULL, PRINT_HIGH, "Unknown server command \"%s\"\n", cmd);
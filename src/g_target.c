@@ -23,10 +23,10 @@ Use_Target_Tent(edict_t *ent, edict_t *other /* unused */ , edict_t *activator /
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(ent->style);
-	gi.WritePosition(ent->s.origin);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(ent->style);
+	G_WritePosition(ent->s.origin);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 }
 
 void
@@ -149,7 +149,7 @@ SP_target_speaker(edict_t *ent)
 
 	/* must link the entity so we get areas and clusters so
 	   the server can determine who to send updates to */
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /* ========================================================== */
@@ -375,10 +375,10 @@ target_explosion_explode(edict_t *self)
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_EXPLOSION1);
-	gi.WritePosition(self->s.origin);
-	gi.multicast(self->s.origin, MULTICAST_PHS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_EXPLOSION1);
+	G_WritePosition(self->s.origin);
+	G_Multicast(self->s.origin, MULTICAST_PHS);
 
 	T_RadiusDamage(self, self->activator, self->dmg, NULL,
 			self->dmg + 40, MOD_EXPLOSIVE);
@@ -524,13 +524,13 @@ use_target_splash(edict_t *self, edict_t *other /* unused */, edict_t *activator
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_SPLASH);
-	gi.WriteByte(self->count);
-	gi.WritePosition(self->s.origin);
-	gi.WriteDir(self->movedir);
-	gi.WriteByte(self->sounds);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_SPLASH);
+	G_WriteByte(self->count);
+	G_WritePosition(self->s.origin);
+	G_WriteDir(self->movedir);
+	G_WriteByte(self->sounds);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	if (self->dmg)
 	{
@@ -592,7 +592,7 @@ use_target_spawner(edict_t *self, edict_t *other /* unused */, edict_t *activato
 	ED_CallSpawn(ent);
 	gi.unlinkentity(ent);
 	KillBox(ent);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	if (self->speed)
 	{
@@ -795,7 +795,7 @@ target_laser_think(edict_t *self)
 
 	while (1)
 	{
-		tr = gi.trace(start, NULL, NULL, end, ignore,
+		tr = G_Trace(start, NULL, NULL, end, ignore,
 				CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER);
 
 		if (!tr.ent)
@@ -816,13 +816,13 @@ target_laser_think(edict_t *self)
 			if (self->spawnflags & 0x80000000)
 			{
 				self->spawnflags &= ~0x80000000;
-				gi.WriteByte(svc_temp_entity);
-				gi.WriteByte(TE_LASER_SPARKS);
-				gi.WriteByte(count);
-				gi.WritePosition(tr.endpos);
-				gi.WriteDir(tr.plane.normal);
-				gi.WriteByte(self->s.skinnum);
-				gi.multicast(tr.endpos, MULTICAST_PVS);
+				G_WriteByte(svc_temp_entity);
+				G_WriteByte(TE_LASER_SPARKS);
+				G_WriteByte(count);
+				G_WritePosition(tr.endpos);
+				G_WriteDir(tr.plane.normal);
+				G_WriteByte(self->s.skinnum);
+				G_Multicast(tr.endpos, MULTICAST_PVS);
 			}
 
 			break;
@@ -966,7 +966,7 @@ target_laser_start(edict_t *self)
 
 	VectorSet(self->mins, -8, -8, -8);
 	VectorSet(self->maxs, 8, 8, 8);
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	if (self->spawnflags & 1)
 	{
@@ -1128,7 +1128,7 @@ SP_target_mal_laser(edict_t *self)
 
 	self->use = target_mal_laser_use;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	if (self->spawnflags & 1)
 	{
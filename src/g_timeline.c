@@ -0,0 +1,284 @@
+/*
+ * =======================================================================
+ *
+ * Timeline of the server frames in the Chrome trace event format,
+ * which can be loaded into chrome://tracing or Perfetto. Started
+ * and stopped with "sv timeline". While running, the game exports
+ * for frames, client thinks, spawning and savegames are replaced
+ * by wrappers, and G_SpanBegin() / G_SpanEnd() add nested spans
+ * for entities, thinks, radius damage, pain and death. Otherwise
+ * the spans cost a single test of timeline_active.
+ *
+ * Spans must be closed on every path. Only the main thread may
+ * add them.
+ *
+ * =======================================================================
+ */
+
+#include "header/local.h"
+
+void ClientThink(edict_t *ent, usercmd_t *cmd);
+void G_RunFrame(void);
+
+qboolean timeline_active;
+
+static struct
+{
+	FILE *f;
+	char filename[MAX_OSPATH];
+	long long start;
+	unsigned int events;
+	int depth;
+} timeline;
+
+/* ====================================================================== */
+
+static void
+Timeline_WriteString(const char *s)
+{
+	fputc('"', timeline.f);
+
+	for ( ; *s; s++)
+	{
+		if ((*s == '"') || (*s == '\\'))
+		{
+			fputc('\\', timeline.f);
+		}
+
+		if ((byte)*s >= ' ')
+		{
+			fputc(*s, timeline.f);
+		}
+	}
+
+	fputc('"', timeline.f);
+}
+
+static void
+Timeline_WriteEvent(char phase, const char *name, const edict_t *ent)
+{
+	fprintf(timeline.f, "%s{\"ph\":\"%c\",\"pid\":1,\"tid\":1,\"ts\":%.3f",
+			timeline.events ? ",\n" : "", phase,
+			(Q_Nanoseconds() - timeline.start) / 1000.0);
+
+	if (name)
+	{
+		fprintf(timeline.f, ",\"name\":");
+		Timeline_WriteString(name);
+	}
+
+	if (ent)
+	{
+		fprintf(timeline.f, ",\"args\":{\"ent\":%i,\"classname\":",
+				(int)(ent - g_edicts));
+		Timeline_WriteString(ent->classname ? ent->classname : "");
+		fprintf(timeline.f, "}");
+	}
+
+	fprintf(timeline.f, "}");
+
+	timeline.events++;
+}
+
+/*
+ * Use G_SpanBegin(), it only
+ * calls here while running.
+ */
+void
+G_TimelineBegin(const char *name, const edict_t *ent)
+{
+	Timeline_WriteEvent('B', name, ent);
+	timeline.depth++;
+}
+
+void
+G_TimelineEnd(void)
+{
+	if (timeline.depth > 0)
+	{
+		Timeline_WriteEvent('E', NULL, NULL);
+		timeline.depth--;
+	}
+}
+
+/* ====================================================================== */
+
+static void
+Timeline_RunFrame(void)
+{
+	G_TimelineBegin("G_RunFrame", NULL);
+	G_RunFrame();
+	G_TimelineEnd();
+}
+
+static void
+Timeline_ClientThink(edict_t *ent, usercmd_t *cmd)
+{
+	G_TimelineBegin("ClientThink", ent);
+	ClientThink(ent, cmd);
+	G_TimelineEnd();
+}
+
+static void
+Timeline_SpawnEntities(const char *mapname, char *entities,
+		const char *spawnpoint)
+{
+	G_TimelineBegin("SpawnEntities", NULL);
+	SpawnEntities(mapname, entities, spawnpoint);
+	G_TimelineEnd();
+}
+
+static void
+Timeline_WriteGame(const char *filename, qboolean autosave)
+{
+	G_TimelineBegin("WriteGame", NULL);
+	WriteGame(filename, autosave);
+	G_TimelineEnd();
+}
+
+static void
+Timeline_ReadGame(const char *filename)
+{
+	G_TimelineBegin("ReadGame", NULL);
+	ReadGame(filename);
+	G_TimelineEnd();
+}
+
+static void
+Timeline_WriteLevel(const char *filename)
+{
+	G_TimelineBegin("WriteLevel", NULL);
+	WriteLevel(filename);
+	G_TimelineEnd();
+}
+
+static void
+Timeline_ReadLevel(const char *filename)
+{
+	G_TimelineBegin("ReadLevel", NULL);
+	ReadLevel(filename);
+	G_TimelineEnd();
+}
+
+/* ====================================================================== */
+
+static void
+Timeline_Start(const char *file)
+{
+	cvar_t *game;
+
+	game = gi.cvar("game", "", 0);
+
+	Com_sprintf(timeline.filename, sizeof(timeline.filename), "%s/%s.json",
+			*game->string ? game->string : GAMEVERSION, file);
+
+	timeline.f = Q_fopen(timeline.filename, "w");
+
+	if (!timeline.f)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", timeline.filename);
+		return;
+	}
+
+	fprintf(timeline.f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	timeline.start = Q_Nanoseconds();
+	timeline.events = 0;
+	timeline.depth = 0;
+
+	globals.RunFrame = Timeline_RunFrame;
+	globals.ClientThink = Timeline_ClientThink;
+	globals.SpawnEntities = Timeline_SpawnEntities;
+	globals.WriteGame = Timeline_WriteGame;
+	globals.ReadGame = Timeline_ReadGame;
+	globals.WriteLevel = Timeline_WriteLevel;
+	globals.ReadLevel = Timeline_ReadLevel;
+
+	timeline_active = true;
+
+	gi.cprintf(NULL, PRINT_HIGH, "Writing the timeline to %s\n",
+			timeline.filename);
+}
+
+static void
+Timeline_Stop(void)
+{
+	if (!timeline.f)
+	{
+		return;
+	}
+
+	while (timeline.depth > 0)
+	{
+		G_TimelineEnd();
+	}
+
+	globals.RunFrame = G_RunFrame;
+	globals.ClientThink = ClientThink;
+	globals.SpawnEntities = SpawnEntities;
+	globals.WriteGame = WriteGame;
+	globals.ReadGame = ReadGame;
+	globals.WriteLevel = WriteLevel;
+	globals.ReadLevel = ReadLevel;
+
+	timeline_active = false;
+
+	fprintf(timeline.f, "\n]}\n");
+
+	if (fclose(timeline.f) != 0)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Error writing %s\n", timeline.filename);
+	}
+	else
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Wrote %u events to %s\n",
+				timeline.events, timeline.filename);
+	}
+
+	timeline.f = NULL;
+}
+
+void
+G_ShutdownTimeline(void)
+{
+	Timeline_Stop();
+}
+
+/*
+ * sv timeline start <file>
+ * sv timeline stop
+ */
+void
+SVCmd_Timeline_f(void)
+{
+	const char *arg;
+
+	arg = gi.argv(2);
+
+	if ((Q_stricmp(arg, "start") == 0) && (gi.argc() >= 4))
+	{
+		Timeline_Stop();
+		Timeline_Start(gi.argv(3));
+	}
+	else if (Q_stricmp(arg, "stop") == 0)
+	{
+		if (!timeline.f)
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "No timeline running.\n");
+			return;
+		}
+
+		Timeline_Stop();
+	}
+	else
+	{
+		if (timeline.f)
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "Writing %s, %u events so far.\n",
+					timeline.filename, timeline.events);
+		}
+
+		gi.cprintf(NULL, PRINT_HIGH,
+				"Usage: sv timeline start <file> | sv timeline stop\n");
+	}
+}
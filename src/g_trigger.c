@@ -166,7 +166,7 @@ trigger_enable(edict_t *self, edict_t *other /* unused */,
 
 	self->solid = SOLID_TRIGGER;
 	self->use = Use_Multi;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -216,7 +216,7 @@ SP_trigger_multiple(edict_t *ent)
 	}
 
 	gi.setmodel(ent, ent->model);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 }
 
 /*
@@ -324,7 +324,7 @@ trigger_key_use(edict_t *self, edict_t *other /* unused */, edict_t *activator)
 		}
 
 		self->touch_debounce_time = level.time + 5.0;
-		gi.centerprintf(activator, "You need the %s", self->item->pickup_name);
+		G_CenterPrintf(activator, "You need the %s", self->item->pickup_name);
 		gi.sound(activator, CHAN_AUTO, gi.soundindex(
 						"misc/keytry.wav"), 1, ATTN_NORM, 0);
 		return;
@@ -466,7 +466,7 @@ trigger_counter_use(edict_t *self, edict_t *other /* unused */, edict_t *activat
 	{
 		if (!(self->spawnflags & 1))
 		{
-			gi.centerprintf(activator, "%i more to go...", self->count);
+			G_CenterPrintf(activator, "%i more to go...", self->count);
 			gi.sound(activator, CHAN_AUTO, gi.soundindex(
 							"misc/talk1.wav"), 1, ATTN_NORM, 0);
 		}
@@ -476,7 +476,7 @@ trigger_counter_use(edict_t *self, edict_t *other /* unused */, edict_t *activat
 
 	if (!(self->spawnflags & 1))
 	{
-		gi.centerprintf(activator, "Sequence completed!");
+		G_CenterPrintf(activator, "Sequence completed!");
 		gi.sound(activator, CHAN_AUTO, gi.soundindex(
 						"misc/talk1.wav"), 1, ATTN_NORM, 0);
 	}
@@ -585,14 +585,14 @@ trigger_effect(edict_t *self)
 
 	for (i = 0; i < 10; i++)
 	{
-		origin[2] += (self->speed * 0.01) * (i + random());
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_TUNNEL_SPARKS);
-		gi.WriteByte(1);
-		gi.WritePosition(origin);
-		gi.WriteDir(vec3_origin);
-		gi.WriteByte(0x74 + (randk() & 7));
-		gi.multicast(self->s.origin, MULTICAST_PVS);
+		origin[2] += (self->speed * 0.01) * (i + G_Random(RAND_EFFECT));
+		G_WriteByte(svc_temp_entity);
+		G_WriteByte(TE_TUNNEL_SPARKS);
+		G_WriteByte(1);
+		G_WritePosition(origin);
+		G_WriteDir(vec3_origin);
+		G_WriteByte(0x74 + (G_RandInt(RAND_EFFECT) & 7));
+		G_Multicast(self->s.origin, MULTICAST_PVS);
 	}
 }
 
@@ -668,7 +668,7 @@ SP_trigger_push(edict_t *self)
 		self->speed = 1000;
 	}
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /*
@@ -700,7 +700,7 @@ hurt_use(edict_t *self, edict_t *other /* unused */, edict_t *activator /* unuse
 		self->solid = SOLID_NOT;
 	}
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	if (!(self->spawnflags & 2))
 	{
@@ -791,7 +791,7 @@ SP_trigger_hurt(edict_t *self)
 		self->use = hurt_use;
 	}
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /*
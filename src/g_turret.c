@@ -114,7 +114,7 @@ turret_breach_fire(edict_t *self)
 	VectorMA(start, self->move_origin[1], r, start);
 	VectorMA(start, self->move_origin[2], u, start);
 
-	damage = 100 + random() * 50;
+	damage = 100 + G_Random(RAND_WEAPON) * 50;
 	speed = 550 + 50 * skill->value;
 	fire_rocket(self->teammaster->owner, start, f, damage, speed, 150, damage);
 	gi.positioned_sound(start, self, CHAN_WEAPON,
@@ -360,7 +360,7 @@ SP_turret_breach(edict_t *self)
 
 	self->think = turret_breach_finish_init;
 	self->nextthink = level.time + FRAMETIME;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /*
@@ -380,7 +380,7 @@ SP_turret_base(edict_t *self)
 	self->movetype = MOVETYPE_PUSH;
 	gi.setmodel(self, self->model);
 	self->blocked = turret_blocked;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /*
@@ -445,22 +445,22 @@ turret_driver_think(edict_t *self)
 			return;
 		}
 
-		self->monsterinfo.trail_time = level.time;
-		self->monsterinfo.aiflags &= ~AI_LOST_SIGHT;
+		G_EnsureMonsterInfo(self)->trail_time = level.time;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_LOST_SIGHT;
 	}
 	else
 	{
 		if (visible(self, self->enemy))
 		{
-			if (self->monsterinfo.aiflags & AI_LOST_SIGHT)
+			if (G_MonsterInfo(self)->aiflags & AI_LOST_SIGHT)
 			{
-				self->monsterinfo.trail_time = level.time;
-				self->monsterinfo.aiflags &= ~AI_LOST_SIGHT;
+				G_EnsureMonsterInfo(self)->trail_time = level.time;
+				G_EnsureMonsterInfo(self)->aiflags &= ~AI_LOST_SIGHT;
 			}
 		}
 		else
 		{
-			self->monsterinfo.aiflags |= AI_LOST_SIGHT;
+			G_EnsureMonsterInfo(self)->aiflags |= AI_LOST_SIGHT;
 			return;
 		}
 	}
@@ -472,19 +472,19 @@ turret_driver_think(edict_t *self)
 	vectoangles(dir, self->target_ent->move_angles);
 
 	/* decide if we should shoot */
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < G_MonsterInfo(self)->attack_finished)
 	{
 		return;
 	}
 
 	reaction_time = (3 - skill->value) * 1.0;
 
-	if ((level.time - self->monsterinfo.trail_time) < reaction_time)
+	if ((level.time - G_MonsterInfo(self)->trail_time) < reaction_time)
 	{
 		return;
 	}
 
-	self->monsterinfo.attack_finished = level.time + reaction_time + 1.0;
+	G_EnsureMonsterInfo(self)->attack_finished = level.time + reaction_time + 1.0;
 	self->target_ent->spawnflags |= 65536;
 }
 
@@ -557,7 +557,7 @@ SP_turret_driver(edict_t *self)
 	self->viewheight = 24;
 
 	self->die = turret_driver_die;
-	self->monsterinfo.stand = infantry_stand;
+	G_EnsureMonsterInfo(self)->stand = infantry_stand;
 
 	self->flags |= FL_NO_KNOCKBACK;
 
@@ -569,7 +569,7 @@ SP_turret_driver(edict_t *self)
 	self->use = monster_use;
 	self->clipmask = MASK_MONSTERSOLID;
 	VectorCopy(self->s.origin, self->s.old_origin);
-	self->monsterinfo.aiflags |= AI_STAND_GROUND | AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_STAND_GROUND | AI_DUCKED;
 
 	if (st.item)
 	{
@@ -585,5 +585,5 @@ SP_turret_driver(edict_t *self)
 	self->think = turret_driver_link;
 	self->nextthink = level.time + FRAMETIME;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
@@ -5,10 +5,128 @@
  * =======================================================================
  */
 
+#include <ctype.h>
+#include <stddef.h>
+
 #include "header/local.h"
 
 #define MAXCHOICES 8
 
+/*
+ * Level strings (classnames, targets, messages,
+ * ...) are interned. Every distinct string is
+ * stored once in a TAG_LEVEL arena and all edicts
+ * share the canonical pointer, so interned strings
+ * can be compared by pointer and must never be
+ * modified. A second table keyed by the canonical
+ * pointers tells interned strings apart in O(1).
+ */
+#define STRING_HASH_SIZE 1024  /* power of 2 */
+#define STRING_BLOCK_SIZE 16384
+
+typedef struct lstring_s
+{
+	struct lstring_s *next; /* hash chain */
+	unsigned int hash;
+	unsigned int foldhash;  /* case insensitive */
+	char str[1];
+} lstring_t;
+
+typedef struct strblock_s
+{
+	struct strblock_s *next;
+	size_t size;
+	size_t used;
+} strblock_t;
+
+static lstring_t *string_hash[STRING_HASH_SIZE];
+static strblock_t *string_blocks;
+
+/* open addressing, at most half full */
+static const lstring_t **string_ptrs;
+static unsigned int string_ptrsize; /* power of 2 */
+
+static struct
+{
+	int requests;
+	int unique;
+	size_t bytes;
+	size_t saved;
+} string_stats;
+
+static unsigned int
+StringPtrHash(const char *s)
+{
+	return (unsigned int)((size_t)s >> 3) * 2654435761u;
+}
+
+/* The header of an interned string, NULL for any other string. */
+static const lstring_t *
+StringHeader(const char *s)
+{
+	unsigned int i;
+
+	if (!s || !string_ptrs)
+	{
+		return NULL;
+	}
+
+	for (i = StringPtrHash(s); ; i++)
+	{
+		i &= string_ptrsize - 1;
+
+		if (!string_ptrs[i])
+		{
+			return NULL;
+		}
+
+		if (string_ptrs[i]->str == s)
+		{
+			return string_ptrs[i];
+		}
+	}
+}
+
+static void
+StringPtrInsert(const lstring_t *ls)
+{
+	const lstring_t **old;
+	unsigned int i, oldsize;
+
+	if ((unsigned int)string_stats.unique * 2 >= string_ptrsize)
+	{
+		old = string_ptrs;
+		oldsize = string_ptrsize;
+
+		string_ptrsize = oldsize ? oldsize * 2 : STRING_HASH_SIZE;
+		string_ptrs = gi.TagMalloc(string_ptrsize * sizeof(*string_ptrs), TAG_LEVEL);
+
+		for (i = 0; i < oldsize; i++)
+		{
+			if (old[i])
+			{
+				StringPtrInsert(old[i]);
+			}
+		}
+
+		if (old)
+		{
+			gi.TagFree(old);
+		}
+	}
+
+	for (i = StringPtrHash(ls->str); ; i++)
+	{
+		i &= string_ptrsize - 1;
+
+		if (!string_ptrs[i])
+		{
+			string_ptrs[i] = ls;
+			return;
+		}
+	}
+}
+
 void
 G_ProjectSource(const vec3_t point, const vec3_t distance, const vec3_t forward,
 		const vec3_t right, vec3_t result)
@@ -28,6 +146,7 @@ G_ProjectSource(const vec3_t point, const vec3_t distance, const vec3_t forward,
 edict_t *
 G_Find(edict_t *from, int fieldofs, const char *match)
 {
+	const lstring_t *lmatch, *ls;
 	char *s;
 
 	if (!from)
@@ -39,6 +158,8 @@ G_Find(edict_t *from, int fieldofs, const char *match)
 		from++;
 	}
 
+	lmatch = StringHeader(match);
+
 	for ( ; from < &g_edicts[globals.num_edicts]; from++)
 	{
 		if (!from->inuse)
@@ -53,6 +174,19 @@ G_Find(edict_t *from, int fieldofs, const char *match)
 			continue;
 		}
 
+		if (s == match)
+		{
+			return from;
+		}
+
+		/* interned strings with different
+		   hashes can't match */
+		if (lmatch && (ls = StringHeader(s)) &&
+			(ls->foldhash != lmatch->foldhash))
+		{
+			continue;
+		}
+
 		if (!Q_stricmp(s, match))
 		{
 			return from;
@@ -152,7 +286,7 @@ G_PickTarget(char *targetname)
 		return NULL;
 	}
 
-	return choice[randk() % num_choices];
+	return choice[G_RandInt(RAND_GAME) % num_choices];
 }
 
 void
@@ -167,6 +301,47 @@ Think_Delay(edict_t *ent)
 	G_FreeEdict(ent);
 }
 
+/*
+ * G_CPrintf() and G_CenterPrintf() for messages to a
+ * client. Clients driven by a replay have no slot in the
+ * engine, messages to them are dropped.
+ */
+void
+G_CPrintf(const edict_t *ent, int printlevel, const char *fmt, ...)
+{
+	char msg[1024];
+	va_list argptr;
+
+	if (G_IsReplayedClient(ent))
+	{
+		return;
+	}
+
+	va_start(argptr, fmt);
+	vsnprintf(msg, sizeof(msg), fmt, argptr);
+	va_end(argptr);
+
+	gi.cprintf(ent, printlevel, "%s", msg);
+}
+
+void
+G_CenterPrintf(const edict_t *ent, const char *fmt, ...)
+{
+	char msg[1024];
+	va_list argptr;
+
+	if (G_IsReplayedClient(ent))
+	{
+		return;
+	}
+
+	va_start(argptr, fmt);
+	vsnprintf(msg, sizeof(msg), fmt, argptr);
+	va_end(argptr);
+
+	gi.centerprintf(ent, "%s", msg);
+}
+
 /*
  * the global "activator" should be set to the entity that initiated the firing.
  *
@@ -212,7 +387,7 @@ G_UseTargets(edict_t *ent, edict_t *activator /* may be NULL */)
 	/* print the message */
 	if (activator && (ent->message) && !(activator->svflags & SVF_MONSTER))
 	{
-		gi.centerprintf(activator, "%s", ent->message);
+		G_CenterPrintf(activator, "%s", ent->message);
 
 		if (ent->noise_index)
 		{
@@ -220,7 +395,7 @@ G_UseTargets(edict_t *ent, edict_t *activator /* may be NULL */)
 		}
 		else
 		{
-			gi.sound(activator, CHAN_AUTO, gi.soundindex("misc/talk1.wav"),
+			gi.sound(activator, CHAN_AUTO, G_SoundIndex(SND_TALK1),
 					1, ATTN_NORM, 0);
 		}
 	}
@@ -265,6 +440,7 @@ G_UseTargets(edict_t *ent, edict_t *activator /* may be NULL */)
 			{
 				if (t->use)
 				{
+					G_MarkEdictDirty(t);
 					t->use(t, ent, activator);
 				}
 			}
@@ -442,14 +618,516 @@ vectoangles(const vec3_t value, vec3_t angles)
 	angles[ROLL] = 0;
 }
 
+/*
+ * Must be called whenever TAG_LEVEL
+ * memory was freed.
+ */
+void
+G_ResetStrings(void)
+{
+	memset(string_hash, 0, sizeof(string_hash));
+	memset(&string_stats, 0, sizeof(string_stats));
+	string_blocks = NULL;
+	string_ptrs = NULL;
+	string_ptrsize = 0;
+}
+
+static void *
+StringAlloc(size_t size)
+{
+	strblock_t *block;
+	size_t blocksize;
+	void *p;
+
+	/* keep the headers aligned */
+	size = (size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+	block = string_blocks;
+
+	if (!block || (block->used + size > block->size))
+	{
+		blocksize = sizeof(strblock_t) + size;
+
+		if (blocksize < STRING_BLOCK_SIZE)
+		{
+			blocksize = STRING_BLOCK_SIZE;
+		}
+
+		block = gi.TagMalloc(blocksize, TAG_LEVEL);
+		block->size = blocksize;
+		block->used = sizeof(strblock_t);
+
+		/* the current block stays in front if
+		   this one was allocated for a long string */
+		if (string_blocks && (blocksize > STRING_BLOCK_SIZE))
+		{
+			block->next = string_blocks->next;
+			string_blocks->next = block;
+		}
+		else
+		{
+			block->next = string_blocks;
+			string_blocks = block;
+		}
+	}
+
+	p = (byte *)block + block->used;
+	block->used += size;
+	string_stats.bytes += size;
+
+	return p;
+}
+
+/*
+ * Returns the canonical copy of the string.
+ */
+char *
+G_InternString(const char *in)
+{
+	unsigned int hash, foldhash;
+	lstring_t *ls;
+	const char *c;
+	size_t len;
+
+	if (!in)
+	{
+		return NULL;
+	}
+
+	string_stats.requests++;
+
+	/* FNV-1a, once as is and once lower case */
+	hash = foldhash = 2166136261u;
+
+	for (c = in; *c; c++)
+	{
+		hash = (hash ^ (byte)*c) * 16777619u;
+		foldhash = (foldhash ^ (byte)tolower((byte)*c)) * 16777619u;
+	}
+
+	len = c - in;
+
+	for (ls = string_hash[hash & (STRING_HASH_SIZE - 1)]; ls; ls = ls->next)
+	{
+		if ((ls->hash == hash) && !strcmp(ls->str, in))
+		{
+			string_stats.saved += len + 1;
+			return ls->str;
+		}
+	}
+
+	ls = StringAlloc(offsetof(lstring_t, str) + len + 1);
+	ls->hash = hash;
+	ls->foldhash = foldhash;
+	memcpy(ls->str, in, len + 1);
+
+	ls->next = string_hash[hash & (STRING_HASH_SIZE - 1)];
+	string_hash[hash & (STRING_HASH_SIZE - 1)] = ls;
+	StringPtrInsert(ls);
+	string_stats.unique++;
+
+	return ls->str;
+}
+
+/*
+ * Same as !strcmp(a, b), but interned
+ * strings are compared by pointer.
+ */
+qboolean
+G_StringsEqual(const char *a, const char *b)
+{
+	if (a == b)
+	{
+		return true;
+	}
+
+	if (StringHeader(a) && StringHeader(b))
+	{
+		return false;
+	}
+
+	return !strcmp(a, b);
+}
+
+/*
+ * Level strings are interned, the
+ * result must not be modified.
+ */
 char *
 G_CopyString(const char *in)
 {
-	char *out;
+	return G_InternString(in);
+}
+
+/*
+ * sv strings
+ */
+void
+SVCmd_StringStats_f(void)
+{
+	const strblock_t *block;
+	size_t allocated;
+
+	allocated = 0;
+
+	for (block = string_blocks; block; block = block->next)
+	{
+		allocated += block->size;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i level strings, %i unique\n",
+			string_stats.requests, string_stats.unique);
+	gi.cprintf(NULL, PRINT_HIGH, "%i bytes used, %i allocated, %i saved by sharing\n",
+			(int)string_stats.bytes, (int)allocated, (int)string_stats.saved);
+}
+
+/*
+ * Precache registry. Sound and model indexes
+ * are only valid for the current level, so they're
+ * resolved on first use (or when precached by
+ * worldspawn) and cached until the next level.
+ * This keeps the string lookups in the server
+ * out of the per frame code paths.
+ */
+static const char *sound_names[SND_NUM] = {
+	[SND_AIROUT] = "items/airout.wav",
+	[SND_BFG_HUM] = "weapons/bfg_hum.wav",
+	[SND_BFG_L1A] = "weapons/bfg__l1a.wav",
+	[SND_BFG_X1B] = "weapons/bfg__x1b.wav",
+	[SND_BURN1] = "player/burn1.wav",
+	[SND_BURN2] = "player/burn2.wav",
+	[SND_CHNGND1A] = "weapons/chngnd1a.wav",
+	[SND_CHNGNL1A] = "weapons/chngnl1a.wav",
+	[SND_CHNGNU1A] = "weapons/chngnu1a.wav",
+	[SND_DAMAGE] = "items/damage.wav",
+	[SND_DAMAGE2] = "items/damage2.wav",
+	[SND_DAMAGE3] = "items/damage3.wav",
+	[SND_DEATH1] = "*death1.wav",
+	[SND_DEATH2] = "*death2.wav",
+	[SND_DEATH3] = "*death3.wav",
+	[SND_DEATH4] = "*death4.wav",
+	[SND_DROWN1] = "player/drown1.wav",
+	[SND_FHIT3] = "misc/fhit3.wav",
+	[SND_GASP1] = "player/gasp1.wav",
+	[SND_GASP2] = "player/gasp2.wav",
+	[SND_GRENLB1B] = "weapons/grenlb1b.wav",
+	[SND_GURP1] = "*gurp1.wav",
+	[SND_GURP2] = "*gurp2.wav",
+	[SND_H2OHIT1] = "misc/h2ohit1.wav",
+	[SND_HGRENA1B] = "weapons/hgrena1b.wav",
+	[SND_HGRENB1A] = "weapons/hgrenb1a.wav",
+	[SND_HGRENB2A] = "weapons/hgrenb2a.wav",
+	[SND_HGRENC1B] = "weapons/hgrenc1b.wav",
+	[SND_HGRENT1A] = "weapons/hgrent1a.wav",
+	[SND_HYPRBD1A] = "weapons/hyprbd1a.wav",
+	[SND_HYPRBL1A] = "weapons/hyprbl1a.wav",
+	[SND_INFLIES1] = "infantry/inflies1.wav",
+	[SND_JUMP1] = "*jump1.wav",
+	[SND_LAND] = "world/land.wav",
+	[SND_LASFLY] = "misc/lasfly.wav",
+	[SND_LAVA1] = "player/lava1.wav",
+	[SND_LAVA2] = "player/lava2.wav",
+	[SND_LAVA_IN] = "player/lava_in.wav",
+	[SND_L_HEALTH] = "items/l_health.wav",
+	[SND_M_HEALTH] = "items/m_health.wav",
+	[SND_NOAMMO] = "weapons/noammo.wav",
+	[SND_N_HEALTH] = "items/n_health.wav",
+	[SND_PAIN25_1] = "*pain25_1.wav",
+	[SND_PAIN25_2] = "*pain25_2.wav",
+	[SND_PAIN50_1] = "*pain50_1.wav",
+	[SND_PAIN50_2] = "*pain50_2.wav",
+	[SND_PAIN75_1] = "*pain75_1.wav",
+	[SND_PAIN75_2] = "*pain75_2.wav",
+	[SND_PAIN100_1] = "*pain100_1.wav",
+	[SND_PAIN100_2] = "*pain100_2.wav",
+	[SND_PC_UP] = "misc/pc_up.wav",
+	[SND_PHALOOP] = "weapons/phaloop.wav",
+	[SND_POWER1] = "misc/power1.wav",
+	[SND_POWER2] = "misc/power2.wav",
+	[SND_PROTECT] = "items/protect.wav",
+	[SND_PROTECT2] = "items/protect2.wav",
+	[SND_PROTECT4] = "items/protect4.wav",
+	[SND_QUADFIRE1] = "items/quadfire1.wav",
+	[SND_QUADFIRE2] = "items/quadfire2.wav",
+	[SND_RG_HUM] = "weapons/rg_hum.wav",
+	[SND_ROCKFLY] = "weapons/rockfly.wav",
+	[SND_S_HEALTH] = "items/s_health.wav",
+	[SND_TALK1] = "misc/talk1.wav",
+	[SND_TRAPCOCK] = "weapons/trapcock.wav",
+	[SND_TRAPDOWN] = "weapons/trapdown.wav",
+	[SND_TRAPLOOP] = "weapons/traploop.wav",
+	[SND_TRAPSUCK] = "weapons/trapsuck.wav",
+	[SND_U_BREATH1] = "player/u_breath1.wav",
+	[SND_U_BREATH2] = "player/u_breath2.wav",
+	[SND_UDEATH] = "misc/udeath.wav",
+	[SND_WATR_IN] = "player/watr_in.wav",
+	[SND_WATR_OUT] = "player/watr_out.wav",
+	[SND_WATR_UN] = "player/watr_un.wav",
+};
+
+static const char *model_names[MDL_NUM] = {
+	[MDL_BFG1] = "sprites/s_bfg1.sp2",
+	[MDL_BFG3] = "sprites/s_bfg3.sp2",
+	[MDL_BLASER] = "models/objects/blaser/tris.md2",
+	[MDL_BOOMRANG] = "models/objects/boomrang/tris.md2",
+	[MDL_GEKKGIB_TORSO] = "models/objects/gekkgib/torso/tris.md2",
+	[MDL_GIB_CHEST] = "models/objects/gibs/chest/tris.md2",
+	[MDL_GIB_SM_MEAT] = "models/objects/gibs/sm_meat/tris.md2",
+	[MDL_GRENADE] = "models/objects/grenade/tris.md2",
+	[MDL_GRENADE2] = "models/objects/grenade2/tris.md2",
+	[MDL_LASER] = "models/objects/laser/tris.md2",
+	[MDL_PHOTON] = "sprites/s_photon.sp2",
+	[MDL_ROCKET] = "models/objects/rocket/tris.md2",
+	[MDL_TRAP] = "models/weapons/z_trap/tris.md2",
+};
+
+static int sound_indexes[SND_NUM];
+static int model_indexes[MDL_NUM];
+
+/* gib and debris models are passed around by name,
+   they're cached by the address of the string */
+#define MODEL_CACHE_SIZE 64
+
+typedef struct
+{
+	const char *name;
+	int index;
+} modelcache_t;
+
+static modelcache_t model_cache[MODEL_CACHE_SIZE];
+
+/* same for the icons in the status bar */
+#define IMAGE_CACHE_SIZE 128
+
+static modelcache_t image_cache[IMAGE_CACHE_SIZE];
+
+/*
+ * Must be called whenever the server's
+ * configstrings are changed, e.g. when
+ * a new level is loaded.
+ */
+void
+G_ResetIndexes(void)
+{
+	memset(sound_indexes, 0, sizeof(sound_indexes));
+	memset(model_indexes, 0, sizeof(model_indexes));
+	memset(model_cache, 0, sizeof(model_cache));
+	memset(image_cache, 0, sizeof(image_cache));
+}
+
+int
+G_SoundIndex(gsound_t snd)
+{
+	if (!sound_indexes[snd])
+	{
+		sound_indexes[snd] = gi.soundindex(sound_names[snd]);
+	}
+
+	return sound_indexes[snd];
+}
+
+int
+G_ModelIndex(gmodel_t mdl)
+{
+	if (!model_indexes[mdl])
+	{
+		model_indexes[mdl] = gi.modelindex(model_names[mdl]);
+	}
+
+	return model_indexes[mdl];
+}
+
+/*
+ * Like gi.modelindex(), but cached by the
+ * address of name. name must never change,
+ * which is true for string literals.
+ */
+int
+G_ModelIndexByName(const char *name)
+{
+	modelcache_t *mc;
+	unsigned int h;
+	int i;
+
+	h = (unsigned int)(((size_t)name) >> 3);
+
+	for (i = 0; i < MODEL_CACHE_SIZE; i++)
+	{
+		mc = &model_cache[(h + i) & (MODEL_CACHE_SIZE - 1)];
+
+		if (mc->name == name)
+		{
+			return mc->index;
+		}
+
+		if (!mc->name)
+		{
+			mc->name = name;
+			mc->index = gi.modelindex(name);
+
+			return mc->index;
+		}
+	}
+
+	/* cache is full */
+	return gi.modelindex(name);
+}
+
+/*
+ * Like gi.imageindex(), cached by
+ * the address of name.
+ */
+int
+G_ImageIndexByName(const char *name)
+{
+	modelcache_t *mc;
+	unsigned int h;
+	int i;
+
+	h = (unsigned int)(((size_t)name) >> 3);
+
+	for (i = 0; i < IMAGE_CACHE_SIZE; i++)
+	{
+		mc = &image_cache[(h + i) & (IMAGE_CACHE_SIZE - 1)];
+
+		if (mc->name == name)
+		{
+			return mc->index;
+		}
+
+		if (!mc->name)
+		{
+			mc->name = name;
+			mc->index = gi.imageindex(name);
+
+			return mc->index;
+		}
+	}
 
-	out = gi.TagMalloc(strlen(in) + 1, TAG_LEVEL);
-	strcpy(out, in);
-	return out;
+	return gi.imageindex(name);
+}
+
+/*
+ * Only looks into the cache, -1 if name
+ * isn't there. Safe from worker threads.
+ */
+int
+G_FindImageIndex(const char *name)
+{
+	const modelcache_t *mc;
+	unsigned int h;
+	int i;
+
+	h = (unsigned int)(((size_t)name) >> 3);
+
+	for (i = 0; i < IMAGE_CACHE_SIZE; i++)
+	{
+		mc = &image_cache[(h + i) & (IMAGE_CACHE_SIZE - 1)];
+
+		if (mc->name == name)
+		{
+			return mc->index;
+		}
+
+		if (!mc->name)
+		{
+			break;
+		}
+	}
+
+	return -1;
+}
+
+/*
+ * Edicts are cleared lazily on a level change. Only the
+ * world and the clients are wiped right away, all other
+ * slots are cleared when the level first grows into them.
+ * A slot needs clearing if it was handed out in an earlier
+ * level generation, slots that were never used are still
+ * zero from the allocation.
+ */
+static int *edict_generation;
+static int edict_level_generation;
+
+void
+G_InitEdictGenerations(void)
+{
+	edict_generation = gi.TagMalloc(game.maxentities * sizeof(*edict_generation),
+			TAG_GAME);
+	edict_level_generation = 1;
+}
+
+/*
+ * g_debug_edicts: makes sure a slot that is
+ * handed out is as clean as a memset one.
+ */
+static void
+G_VerifyEdictClear(const edict_t *e, const char *what)
+{
+	const byte *p;
+	size_t i;
+
+	p = (const byte *)e;
+
+	for (i = 0; i < sizeof(*e); i++)
+	{
+		if (p[i])
+		{
+			gi.dprintf("%s: edict %i not clear at offset %i\n",
+					what, (int)(e - g_edicts), (int)i);
+			return;
+		}
+	}
+}
+
+/*
+ * Wipes all edicts for a new level.
+ */
+void
+G_ResetEdicts(void)
+{
+	int num_c;
+
+	num_c = game.maxclients + 1;
+
+	memset(g_edicts, 0, num_c * sizeof(g_edicts[0]));
+	globals.num_edicts = num_c;
+
+	edict_level_generation++;
+}
+
+/*
+ * Grows the number of edicts so that num
+ * is valid and returns the edict.
+ */
+edict_t *
+G_ExtendEdicts(int num)
+{
+	edict_t *e;
+	int i;
+
+	for (i = globals.num_edicts; i <= num; i++)
+	{
+		e = &g_edicts[i];
+
+		if (edict_generation[i] && (edict_generation[i] != edict_level_generation))
+		{
+			memset(e, 0, sizeof(*e));
+		}
+		else if (g_debug_edicts->value)
+		{
+			G_VerifyEdictClear(e, __func__);
+		}
+
+		edict_generation[i] = edict_level_generation;
+	}
+
+	if (num >= globals.num_edicts)
+	{
+		globals.num_edicts = num + 1;
+	}
+
+	return &g_edicts[num];
 }
 
 void
@@ -459,6 +1137,8 @@ G_InitEdict(edict_t *e)
 	e->classname = "noclass";
 	e->gravity = 1.0;
 	e->s.number = e - g_edicts;
+
+	G_MarkEdictDirty(e);
 }
 
 /*
@@ -485,6 +1165,17 @@ G_FindFreeEdict(int policy)
 		*/
 		if (!e->inuse && (policy == POLICY_DESPERATE || e->freetime < 2.0f || (level.time - e->freetime) > 0.5f))
 		{
+			if (g_debug_edicts->value)
+			{
+				edict_t clean;
+
+				/* all but what G_FreeEdict() leaves behind */
+				clean = *e;
+				clean.classname = NULL;
+				clean.freetime = 0;
+				G_VerifyEdictClear(&clean, __func__);
+			}
+
 			G_InitEdict (e);
 			return e;
 		}
@@ -498,18 +1189,20 @@ G_SpawnOptional(void)
 {
 	edict_t	*e = G_FindFreeEdict (POLICY_DEFAULT);
 
-	if (e)
+	if (!e && (globals.num_edicts >= game.maxentities))
 	{
-		return e;
+		e = G_FindFreeEdict (POLICY_DESPERATE);
 	}
-
-	if (globals.num_edicts >= game.maxentities)
+	else if (!e)
 	{
-		return G_FindFreeEdict (POLICY_DESPERATE);
+		e = G_ExtendEdicts(globals.num_edicts);
+		G_InitEdict (e);
 	}
 
-	e = &g_edicts[globals.num_edicts++];
-	G_InitEdict (e);
+	if (e)
+	{
+		G_FlightEvent(FLIGHT_SPAWN, e, level.current_entity, 0);
+	}
 
 	return e;
 }
@@ -525,6 +1218,178 @@ G_Spawn(void)
 	return e;
 }
 
+/*
+ * moveinfo_t and monsterinfo_t are only needed by movers
+ * and monsters. They live in pools of TAG_LEVEL blocks
+ * and are attached to the edict on first use.
+ */
+#define EDICT_POOL_BLOCK 64
+
+typedef struct poolitem_s
+{
+	struct poolitem_s *next;
+} poolitem_t;
+
+typedef struct
+{
+	poolitem_t *free;
+	size_t size;
+	int inuse;
+	int allocated;
+} edictpool_t;
+
+static edictpool_t moveinfo_pool = {NULL, sizeof(moveinfo_t)};
+static edictpool_t monsterinfo_pool = {NULL, sizeof(monsterinfo_t)};
+
+static void *
+PoolAlloc(edictpool_t *pool)
+{
+	poolitem_t *item;
+	byte *block;
+	int i;
+
+	if (!pool->free)
+	{
+		block = gi.TagMalloc(EDICT_POOL_BLOCK * pool->size, TAG_LEVEL);
+
+		for (i = EDICT_POOL_BLOCK - 1; i >= 0; i--)
+		{
+			item = (poolitem_t *)(block + i * pool->size);
+			item->next = pool->free;
+			pool->free = item;
+		}
+
+		pool->allocated += EDICT_POOL_BLOCK;
+	}
+
+	item = pool->free;
+	pool->free = item->next;
+	pool->inuse++;
+
+	memset(item, 0, pool->size);
+
+	return item;
+}
+
+static void
+PoolFree(edictpool_t *pool, void *p)
+{
+	poolitem_t *item;
+
+	item = p;
+	item->next = pool->free;
+	pool->free = item;
+	pool->inuse--;
+}
+
+const moveinfo_t g_nomoveinfo;
+const monsterinfo_t g_nomonsterinfo;
+
+moveinfo_t *
+G_AllocMoveInfo(edict_t *ent)
+{
+	ent->moveinfo = PoolAlloc(&moveinfo_pool);
+
+	return ent->moveinfo;
+}
+
+monsterinfo_t *
+G_AllocMonsterInfo(edict_t *ent)
+{
+	ent->monsterinfo = PoolAlloc(&monsterinfo_pool);
+
+	return ent->monsterinfo;
+}
+
+/*
+ * Gives the data blocks of the
+ * edict back to their pools.
+ */
+void
+G_ReleaseEdictInfo(edict_t *ent)
+{
+	if (ent->moveinfo)
+	{
+		PoolFree(&moveinfo_pool, ent->moveinfo);
+		ent->moveinfo = NULL;
+	}
+
+	if (ent->monsterinfo)
+	{
+		PoolFree(&monsterinfo_pool, ent->monsterinfo);
+		ent->monsterinfo = NULL;
+	}
+}
+
+/*
+ * Must be called whenever TAG_LEVEL
+ * is freed and the edicts are wiped.
+ */
+void
+G_ResetEdictPools(void)
+{
+	moveinfo_pool.free = NULL;
+	moveinfo_pool.inuse = moveinfo_pool.allocated = 0;
+
+	monsterinfo_pool.free = NULL;
+	monsterinfo_pool.inuse = monsterinfo_pool.allocated = 0;
+}
+
+/*
+ * sv edictstats
+ *
+ * Prints the memory used by the edicts and the pools and
+ * the bytes G_RunFrame() strides over per frame, compared
+ * to edicts with inline moveinfo_t and monsterinfo_t.
+ */
+void
+SVCmd_EdictStats_f(void)
+{
+	size_t inline_size, pooled, total;
+	int i, inuse, mirrored, quiet;
+
+	inuse = 0;
+
+	for (i = 0; i < globals.num_edicts; i++)
+	{
+		if (g_edicts[i].inuse)
+		{
+			inuse++;
+		}
+	}
+
+	inline_size = sizeof(edict_t) + sizeof(moveinfo_t) + sizeof(monsterinfo_t)
+		- sizeof(moveinfo_t *) - sizeof(monsterinfo_t *);
+	pooled = moveinfo_pool.inuse * sizeof(moveinfo_t) +
+		monsterinfo_pool.inuse * sizeof(monsterinfo_t);
+	total = inuse * sizeof(edict_t) + pooled;
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i edicts in use, %i slots scanned per frame\n",
+			inuse, globals.num_edicts);
+	gi.cprintf(NULL, PRINT_HIGH, "edict_t       %5i bytes (%i inline)\n",
+			(int)sizeof(edict_t), (int)inline_size);
+	gi.cprintf(NULL, PRINT_HIGH, "moveinfo_t    %5i bytes, %i used, %i allocated\n",
+			(int)sizeof(moveinfo_t), moveinfo_pool.inuse, moveinfo_pool.allocated);
+	gi.cprintf(NULL, PRINT_HIGH, "monsterinfo_t %5i bytes, %i used, %i allocated\n",
+			(int)sizeof(monsterinfo_t), monsterinfo_pool.inuse,
+			monsterinfo_pool.allocated);
+
+	if (inuse)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "bytes per edict: %i, was %i\n",
+				(int)(total / inuse), (int)inline_size);
+	}
+
+	/* one cache line per 64 bytes of edict array walked */
+	gi.cprintf(NULL, PRINT_HIGH, "cache lines per frame walk: %i, was %i\n",
+			(int)((globals.num_edicts * sizeof(edict_t) + 63) / 64),
+			(int)((globals.num_edicts * inline_size + 63) / 64));
+
+	G_EdictMirrorStats(&mirrored, &quiet);
+	gi.cprintf(NULL, PRINT_HIGH, "%i of %i edicts quiet, skipped by the frame loop\n",
+			quiet, mirrored);
+}
+
 /*
  * Marks the edict as free
  */
@@ -538,10 +1403,14 @@ G_FreeEdict(edict_t *ed)
 		return;
 	}
 
+	G_FlightEvent(FLIGHT_FREE, ed, NULL, 0);
+	G_ReleaseEdictInfo(ed);
 	memset(ed, 0, sizeof(*ed));
 	ed->classname = "freed";
 	ed->freetime = level.time;
 	ed->inuse = false;
+
+	G_MarkEdictDirty(ed);
 }
 
 void
@@ -561,7 +1430,7 @@ G_TouchTriggers(edict_t *ent)
 		return;
 	}
 
-	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch,
+	num = G_BoxEdicts(ent->absmin, ent->absmax, touch,
 			MAX_EDICTS, AREA_TRIGGERS);
 
 	/* be careful, it is possible to have an entity in this
@@ -580,6 +1449,8 @@ G_TouchTriggers(edict_t *ent)
 			continue;
 		}
 
+		G_MarkEdictDirty(hit);
+		G_FlightEvent(FLIGHT_TOUCH, hit, ent, 0);
 		hit->touch(hit, ent, NULL, NULL);
 	}
 }
@@ -599,7 +1470,7 @@ G_TouchSolids(edict_t *ent)
 		return;
 	}
 
-	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch,
+	num = G_BoxEdicts(ent->absmin, ent->absmax, touch,
 			MAX_EDICTS, AREA_SOLID);
 
 	/* be careful, it is possible to have an entity in this
@@ -615,6 +1486,8 @@ G_TouchSolids(edict_t *ent)
 
 		if (ent->touch)
 		{
+			G_MarkEdictDirty(hit);
+			G_FlightEvent(FLIGHT_TOUCH, ent, hit, 0);
 			ent->touch(hit, ent, NULL, NULL);
 		}
 
@@ -641,7 +1514,7 @@ KillBox(edict_t *ent)
 
 	while (1)
 	{
-		tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin,
+		tr = G_Trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin,
 				NULL, MASK_PLAYERSOLID);
 
 		if (!tr.ent)
@@ -662,3 +1535,77 @@ KillBox(edict_t *ent)
 
 	return true; /* all clear */
 }
+
+/* ====================================================================== */
+
+static randk_stream_t rand_streams[RAND_NUMSTREAMS];
+static unsigned int rand_seed;
+
+int
+G_RandInt(randstream_t stream)
+{
+	return randk_stream(&rand_streams[stream]);
+}
+
+/*
+ * Restarts all streams. The same seed and
+ * the same input give the same frames.
+ */
+void
+G_SeedRandom(unsigned int seed)
+{
+	int i;
+
+	rand_seed = seed;
+
+	for (i = 0; i < RAND_NUMSTREAMS; i++)
+	{
+		randk_stream_seed(&rand_streams[i], seed, i);
+	}
+}
+
+/*
+ * A different seed for every start. Fixed seeds
+ * only come from "sv seed" and replay headers.
+ */
+void
+G_SeedRandomTime(void)
+{
+	G_SeedRandom((unsigned int)time(NULL) ^ (unsigned int)Q_Microseconds());
+}
+
+unsigned int
+G_RandomSeed(void)
+{
+	return rand_seed;
+}
+
+/* for snapshots */
+void
+G_SaveRandomState(randk_stream_t *state)
+{
+	memcpy(state, rand_streams, sizeof(rand_streams));
+}
+
+void
+G_LoadRandomState(const randk_stream_t *state)
+{
+	memcpy(rand_streams, state, sizeof(rand_streams));
+}
+
+/*
+ * sv seed [seed]
+ */
+void
+SVCmd_Seed_f(void)
+{
+	if (gi.argc() < 3)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Seed is %u\n", rand_seed);
+		return;
+	}
+
+	G_SeedRandom((unsigned int)strtoul(gi.argv(2), NULL, 10));
+	gi.cprintf(NULL, PRINT_HIGH, "Random streams seeded with %u\n", rand_seed);
+}
+
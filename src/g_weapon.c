@@ -30,21 +30,21 @@ check_dodge(edict_t *self, vec3_t start, vec3_t dir, int speed)
 	/* easy mode only ducks one quarter the time */
 	if (skill->value == SKILL_EASY)
 	{
-		if (random() > 0.25)
+		if (G_Random(RAND_WEAPON) > 0.25)
 		{
 			return;
 		}
 	}
 
 	VectorMA(start, 8192, dir, end);
-	tr = gi.trace(start, NULL, NULL, end, self, MASK_SHOT);
+	tr = G_Trace(start, NULL, NULL, end, self, MASK_SHOT);
 
 	if ((tr.ent) && (tr.ent->svflags & SVF_MONSTER) && (tr.ent->health > 0) &&
-		(tr.ent->monsterinfo.dodge) && infront(tr.ent, self))
+		(G_MonsterInfo(tr.ent)->dodge) && infront(tr.ent, self))
 	{
 		VectorSubtract(tr.endpos, start, v);
 		eta = (VectorLength(v) - tr.ent->maxs[0]) / speed;
-		tr.ent->monsterinfo.dodge(tr.ent, self, eta);
+		G_MonsterInfo(tr.ent)->dodge(tr.ent, self, eta);
 	}
 }
 
@@ -100,7 +100,7 @@ fire_hit(edict_t *self, vec3_t aim, int damage, int kick)
 
 	VectorMA(self->s.origin, range, dir, point);
 
-	tr = gi.trace(self->s.origin, NULL, NULL, point, self, MASK_SHOT);
+	tr = G_Trace(self->s.origin, NULL, NULL, point, self, MASK_SHOT);
 
 	if (tr.fraction < 1)
 	{
@@ -167,27 +167,27 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 		return;
 	}
 
-	tr = gi.trace(self->s.origin, NULL, NULL, start, self, MASK_SHOT);
+	tr = G_Trace(self->s.origin, NULL, NULL, start, self, MASK_SHOT);
 
 	if (!(tr.fraction < 1.0))
 	{
 		vectoangles(aimdir, dir);
 		AngleVectors(dir, forward, right, up);
 
-		r = crandom() * hspread;
-		u = crandom() * vspread;
+		r = G_CRandom(RAND_WEAPON) * hspread;
+		u = G_CRandom(RAND_WEAPON) * vspread;
 		VectorMA(start, 8192, forward, end);
 		VectorMA(end, r, right, end);
 		VectorMA(end, u, up, end);
 
-		if (gi.pointcontents(start) & MASK_WATER)
+		if (G_PointContents(start) & MASK_WATER)
 		{
 			water = true;
 			VectorCopy(start, water_start);
 			content_mask &= ~MASK_WATER;
 		}
 
-		tr = gi.trace(start, NULL, NULL, end, self, content_mask);
+		tr = G_Trace(start, NULL, NULL, end, self, content_mask);
 
 		/* see if we hit water */
 		if (tr.contents & MASK_WATER)
@@ -225,28 +225,28 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 
 				if (color != SPLASH_UNKNOWN)
 				{
-					gi.WriteByte(svc_temp_entity);
-					gi.WriteByte(TE_SPLASH);
-					gi.WriteByte(8);
-					gi.WritePosition(tr.endpos);
-					gi.WriteDir(tr.plane.normal);
-					gi.WriteByte(color);
-					gi.multicast(tr.endpos, MULTICAST_PVS);
+					G_WriteByte(svc_temp_entity);
+					G_WriteByte(TE_SPLASH);
+					G_WriteByte(8);
+					G_WritePosition(tr.endpos);
+					G_WriteDir(tr.plane.normal);
+					G_WriteByte(color);
+					G_Multicast(tr.endpos, MULTICAST_PVS);
 				}
 
 				/* change bullet's course when it enters water */
 				VectorSubtract(end, start, dir);
 				vectoangles(dir, dir);
 				AngleVectors(dir, forward, right, up);
-				r = crandom() * hspread * 2;
-				u = crandom() * vspread * 2;
+				r = G_CRandom(RAND_WEAPON) * hspread * 2;
+				u = G_CRandom(RAND_WEAPON) * vspread * 2;
 				VectorMA(water_start, 8192, forward, end);
 				VectorMA(end, r, right, end);
 				VectorMA(end, u, up, end);
 			}
 
 			/* re-trace ignoring water this time */
-			tr = gi.trace(water_start, NULL, NULL, end, self, MASK_SHOT);
+			tr = G_Trace(water_start, NULL, NULL, end, self, MASK_SHOT);
 		}
 	}
 
@@ -264,11 +264,11 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 			{
 				if (strncmp(tr.surface->name, "sky", 3) != 0)
 				{
-					gi.WriteByte(svc_temp_entity);
-					gi.WriteByte(te_impact);
-					gi.WritePosition(tr.endpos);
-					gi.WriteDir(tr.plane.normal);
-					gi.multicast(tr.endpos, MULTICAST_PVS);
+					G_WriteByte(svc_temp_entity);
+					G_WriteByte(te_impact);
+					G_WritePosition(tr.endpos);
+					G_WriteDir(tr.plane.normal);
+					G_Multicast(tr.endpos, MULTICAST_PVS);
 
 					if (self->client)
 					{
@@ -288,23 +288,23 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 		VectorNormalize(dir);
 		VectorMA(tr.endpos, -2, dir, pos);
 
-		if (gi.pointcontents(pos) & MASK_WATER)
+		if (G_PointContents(pos) & MASK_WATER)
 		{
 			VectorCopy(pos, tr.endpos);
 		}
 		else
 		{
-			tr = gi.trace(pos, NULL, NULL, water_start, tr.ent, MASK_WATER);
+			tr = G_Trace(pos, NULL, NULL, water_start, tr.ent, MASK_WATER);
 		}
 
 		VectorAdd(water_start, tr.endpos, pos);
 		VectorScale(pos, 0.5, pos);
 
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_BUBBLETRAIL);
-		gi.WritePosition(water_start);
-		gi.WritePosition(tr.endpos);
-		gi.multicast(pos, MULTICAST_PVS);
+		G_WriteByte(svc_temp_entity);
+		G_WriteByte(TE_BUBBLETRAIL);
+		G_WritePosition(water_start);
+		G_WritePosition(tr.endpos);
+		G_Multicast(pos, MULTICAST_PVS);
 	}
 }
 
@@ -321,8 +321,10 @@ fire_bullet(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 		return;
 	}
 
+	G_LagRewind(self);
 	fire_lead(self, start, aimdir, damage, kick, TE_GUNSHOT,
 			hspread, vspread, mod);
+	G_LagRestore();
 }
 
 /*
@@ -339,11 +341,15 @@ fire_shotgun(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 		return;
 	}
 
+	G_LagRewind(self);
+
 	for (i = 0; i < count; i++)
 	{
 		fire_lead(self, start, aimdir, damage, kick,
 				TE_SHOTGUN, hspread, vspread, mod);
 	}
+
+	G_LagRestore();
 }
 
 /*
@@ -395,11 +401,11 @@ blaster_touch(edict_t *self, edict_t *other, const cplane_t *plane, const csurfa
 	}
 	else
 	{
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_BLASTER);
-		gi.WritePosition(self->s.origin);
-		gi.WriteDir(normal);
-		gi.multicast(self->s.origin, MULTICAST_PVS);
+		G_WriteByte(svc_temp_entity);
+		G_WriteByte(TE_BLASTER);
+		G_WritePosition(self->s.origin);
+		G_WriteDir(normal);
+		G_Multicast(self->s.origin, MULTICAST_PVS);
 	}
 
 	G_FreeEdict(self);
@@ -437,8 +443,8 @@ fire_blaster(edict_t *self, vec3_t start, vec3_t dir, int damage,
 	bolt->s.effects |= effect;
 	VectorClear(bolt->mins);
 	VectorClear(bolt->maxs);
-	bolt->s.modelindex = gi.modelindex("models/objects/laser/tris.md2");
-	bolt->s.sound = gi.soundindex("misc/lasfly.wav");
+	bolt->s.modelindex = G_ModelIndex(MDL_LASER);
+	bolt->s.sound = G_SoundIndex(SND_LASFLY);
 	bolt->owner = self;
 	bolt->touch = blaster_touch;
 	bolt->nextthink = level.time + 2;
@@ -451,14 +457,14 @@ fire_blaster(edict_t *self, vec3_t start, vec3_t dir, int damage,
 		bolt->spawnflags = 1;
 	}
 
-	gi.linkentity(bolt);
+	G_LinkEntity(bolt);
 
 	if (self->client)
 	{
 		check_dodge(self, bolt->s.origin, dir, speed);
 	}
 
-	tr = gi.trace(self->s.origin, NULL, NULL, bolt->s.origin, bolt, MASK_SHOT);
+	tr = G_Trace(self->s.origin, NULL, NULL, bolt->s.origin, bolt, MASK_SHOT);
 
 	if (tr.fraction < 1.0)
 	{
@@ -493,22 +499,22 @@ fire_blueblaster(edict_t *self, vec3_t start, vec3_t dir, int damage,
 	VectorClear(bolt->mins);
 	VectorClear(bolt->maxs);
 
-	bolt->s.modelindex = gi.modelindex("models/objects/blaser/tris.md2");
-	bolt->s.sound = gi.soundindex("misc/lasfly.wav");
+	bolt->s.modelindex = G_ModelIndex(MDL_BLASER);
+	bolt->s.sound = G_SoundIndex(SND_LASFLY);
 	bolt->owner = self;
 	bolt->touch = blaster_touch;
 	bolt->nextthink = level.time + 2;
 	bolt->think = G_FreeEdict;
 	bolt->dmg = damage;
 	bolt->classname = "bolt";
-	gi.linkentity(bolt);
+	G_LinkEntity(bolt);
 
 	if (self->client)
 	{
 		check_dodge(self, bolt->s.origin, dir, speed);
 	}
 
-	tr = gi.trace(self->s.origin, NULL, NULL, bolt->s.origin, bolt, MASK_SHOT);
+	tr = G_Trace(self->s.origin, NULL, NULL, bolt->s.origin, bolt, MASK_SHOT);
 
 	if (tr.fraction < 1.0)
 	{
@@ -574,33 +580,33 @@ Grenade_Explode(edict_t *ent)
 	T_RadiusDamage(ent, ent->owner, ent->dmg, ent->enemy, ent->dmg_radius, mod);
 
 	VectorMA(ent->s.origin, -0.02, ent->velocity, origin);
-	gi.WriteByte(svc_temp_entity);
+	G_WriteByte(svc_temp_entity);
 
 	if (ent->waterlevel)
 	{
 		if (ent->groundentity)
 		{
-			gi.WriteByte(TE_GRENADE_EXPLOSION_WATER);
+			G_WriteByte(TE_GRENADE_EXPLOSION_WATER);
 		}
 		else
 		{
-			gi.WriteByte(TE_ROCKET_EXPLOSION_WATER);
+			G_WriteByte(TE_ROCKET_EXPLOSION_WATER);
 		}
 	}
 	else
 	{
 		if (ent->groundentity)
 		{
-			gi.WriteByte(TE_GRENADE_EXPLOSION);
+			G_WriteByte(TE_GRENADE_EXPLOSION);
 		}
 		else
 		{
-			gi.WriteByte(TE_ROCKET_EXPLOSION);
+			G_WriteByte(TE_ROCKET_EXPLOSION);
 		}
 	}
 
-	gi.WritePosition(origin);
-	gi.multicast(ent->s.origin, MULTICAST_PHS);
+	G_WritePosition(origin);
+	G_Multicast(ent->s.origin, MULTICAST_PHS);
 
 	G_FreeEdict(ent);
 }
@@ -629,20 +635,20 @@ Grenade_Touch(edict_t *ent, edict_t *other, const cplane_t *plane, const csurfac
 	{
 		if (ent->spawnflags & 1)
 		{
-			if (random() > 0.5)
+			if (G_Random(RAND_WEAPON) > 0.5)
 			{
-				gi.sound(ent, CHAN_VOICE, gi.soundindex("weapons/hgrenb1a.wav"),
+				gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_HGRENB1A),
 						1, ATTN_NORM, 0);
 			}
 			else
 			{
-				gi.sound(ent, CHAN_VOICE, gi.soundindex("weapons/hgrenb2a.wav"),
+				gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_HGRENB2A),
 						1, ATTN_NORM, 0);
 			}
 		}
 		else
 		{
-			gi.sound(ent, CHAN_VOICE, gi.soundindex("weapons/grenlb1b.wav"),
+			gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_GRENLB1B),
 					1, ATTN_NORM, 0);
 		}
 
@@ -672,8 +678,8 @@ fire_grenade(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	grenade = G_Spawn();
 	VectorCopy(start, grenade->s.origin);
 	VectorScale(aimdir, speed, grenade->velocity);
-	VectorMA(grenade->velocity, 200 + crandom() * 10.0, up, grenade->velocity);
-	VectorMA(grenade->velocity, crandom() * 10.0, right, grenade->velocity);
+	VectorMA(grenade->velocity, 200 + G_CRandom(RAND_WEAPON) * 10.0, up, grenade->velocity);
+	VectorMA(grenade->velocity, G_CRandom(RAND_WEAPON) * 10.0, right, grenade->velocity);
 	VectorSet(grenade->avelocity, 300, 300, 300);
 	grenade->movetype = MOVETYPE_BOUNCE;
 	grenade->clipmask = MASK_SHOT;
@@ -681,7 +687,7 @@ fire_grenade(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	grenade->s.effects |= EF_GRENADE;
 	VectorClear(grenade->mins);
 	VectorClear(grenade->maxs);
-	grenade->s.modelindex = gi.modelindex("models/objects/grenade/tris.md2");
+	grenade->s.modelindex = G_ModelIndex(MDL_GRENADE);
 	grenade->owner = self;
 	grenade->touch = Grenade_Touch;
 	grenade->nextthink = level.time + timer;
@@ -690,7 +696,7 @@ fire_grenade(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	grenade->dmg_radius = damage_radius;
 	grenade->classname = "grenade";
 
-	gi.linkentity(grenade);
+	G_LinkEntity(grenade);
 }
 
 void
@@ -712,8 +718,8 @@ fire_grenade2(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	grenade = G_Spawn();
 	VectorCopy(start, grenade->s.origin);
 	VectorScale(aimdir, speed, grenade->velocity);
-	VectorMA(grenade->velocity, 200 + crandom() * 10.0, up, grenade->velocity);
-	VectorMA(grenade->velocity, crandom() * 10.0, right, grenade->velocity);
+	VectorMA(grenade->velocity, 200 + G_CRandom(RAND_WEAPON) * 10.0, up, grenade->velocity);
+	VectorMA(grenade->velocity, G_CRandom(RAND_WEAPON) * 10.0, right, grenade->velocity);
 	VectorSet(grenade->avelocity, 300, 300, 300);
 	grenade->movetype = MOVETYPE_BOUNCE;
 	grenade->clipmask = MASK_SHOT;
@@ -721,7 +727,7 @@ fire_grenade2(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	grenade->s.effects |= EF_GRENADE;
 	VectorClear(grenade->mins);
 	VectorClear(grenade->maxs);
-	grenade->s.modelindex = gi.modelindex("models/objects/grenade2/tris.md2");
+	grenade->s.modelindex = G_ModelIndex(MDL_GRENADE2);
 	grenade->owner = self;
 	grenade->touch = Grenade_Touch;
 	grenade->nextthink = level.time + timer;
@@ -739,7 +745,7 @@ fire_grenade2(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 		grenade->spawnflags = 1;
 	}
 
-	grenade->s.sound = gi.soundindex("weapons/hgrenc1b.wav");
+	grenade->s.sound = G_SoundIndex(SND_HGRENC1B);
 
 	if (timer <= 0.0)
 	{
@@ -747,9 +753,9 @@ fire_grenade2(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	}
 	else
 	{
-		gi.sound(self, CHAN_WEAPON, gi.soundindex("weapons/hgrent1a.wav"),
+		gi.sound(self, CHAN_WEAPON, G_SoundIndex(SND_HGRENT1A),
 				1, ATTN_NORM, 0);
-		gi.linkentity(grenade);
+		G_LinkEntity(grenade);
 	}
 }
 
@@ -800,7 +806,7 @@ rocket_touch(edict_t *ent, edict_t *other, const cplane_t *plane, const csurface
 			if ((surf) && !(surf->flags &
 				(SURF_WARP | SURF_TRANS33 | SURF_TRANS66 | SURF_FLOWING)))
 			{
-				n = randk() % 5;
+				n = G_RandInt(RAND_WEAPON) % 5;
 
 				while (n--)
 				{
@@ -814,19 +820,19 @@ rocket_touch(edict_t *ent, edict_t *other, const cplane_t *plane, const csurface
 	T_RadiusDamage(ent, ent->owner, ent->radius_dmg, other,
 			ent->dmg_radius, MOD_R_SPLASH);
 
-	gi.WriteByte(svc_temp_entity);
+	G_WriteByte(svc_temp_entity);
 
 	if (ent->waterlevel)
 	{
-		gi.WriteByte(TE_ROCKET_EXPLOSION_WATER);
+		G_WriteByte(TE_ROCKET_EXPLOSION_WATER);
 	}
 	else
 	{
-		gi.WriteByte(TE_ROCKET_EXPLOSION);
+		G_WriteByte(TE_ROCKET_EXPLOSION);
 	}
 
-	gi.WritePosition(origin);
-	gi.multicast(ent->s.origin, MULTICAST_PHS);
+	G_WritePosition(origin);
+	G_Multicast(ent->s.origin, MULTICAST_PHS);
 
 	G_FreeEdict(ent);
 }
@@ -853,7 +859,7 @@ fire_rocket(edict_t *self, vec3_t start, vec3_t dir, int damage,
 	rocket->s.effects |= EF_ROCKET;
 	VectorClear(rocket->mins);
 	VectorClear(rocket->maxs);
-	rocket->s.modelindex = gi.modelindex("models/objects/rocket/tris.md2");
+	rocket->s.modelindex = G_ModelIndex(MDL_ROCKET);
 	rocket->owner = self;
 	rocket->touch = rocket_touch;
 	rocket->nextthink = level.time + (8000.0f / (float)speed);
@@ -861,7 +867,7 @@ fire_rocket(edict_t *self, vec3_t start, vec3_t dir, int damage,
 	rocket->dmg = damage;
 	rocket->radius_dmg = radius_damage;
 	rocket->dmg_radius = damage_radius;
-	rocket->s.sound = gi.soundindex("weapons/rockfly.wav");
+	rocket->s.sound = G_SoundIndex(SND_ROCKFLY);
 	rocket->classname = "rocket";
 
 	if (self->client)
@@ -869,7 +875,7 @@ fire_rocket(edict_t *self, vec3_t start, vec3_t dir, int damage,
 		check_dodge(self, rocket->s.origin, dir, speed);
 	}
 
-	gi.linkentity(rocket);
+	G_LinkEntity(rocket);
 }
 
 void
@@ -893,9 +899,11 @@ fire_rail(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick)
 	water = false;
 	mask = MASK_SHOT | CONTENTS_SLIME | CONTENTS_LAVA;
 
+	G_LagRewind(self);
+
 	while (ignore)
 	{
-		tr = gi.trace(from, NULL, NULL, end, ignore, mask);
+		tr = G_Trace(from, NULL, NULL, end, ignore, mask);
 
 		if (tr.contents & (CONTENTS_SLIME | CONTENTS_LAVA))
 		{
@@ -929,20 +937,22 @@ fire_rail(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick)
 		VectorCopy(tr.endpos, from);
 	}
 
+	G_LagRestore();
+
 	/* send gun puff / flash */
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_RAILTRAIL);
-	gi.WritePosition(start);
-	gi.WritePosition(tr.endpos);
-	gi.multicast(self->s.origin, MULTICAST_PHS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_RAILTRAIL);
+	G_WritePosition(start);
+	G_WritePosition(tr.endpos);
+	G_Multicast(self->s.origin, MULTICAST_PHS);
 
 	if (water)
 	{
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_RAILTRAIL);
-		gi.WritePosition(start);
-		gi.WritePosition(tr.endpos);
-		gi.multicast(tr.endpos, MULTICAST_PHS);
+		G_WriteByte(svc_temp_entity);
+		G_WriteByte(TE_RAILTRAIL);
+		G_WritePosition(start);
+		G_WritePosition(tr.endpos);
+		G_Multicast(tr.endpos, MULTICAST_PHS);
 	}
 
 	if (self->client)
@@ -1002,10 +1012,10 @@ bfg_explode(edict_t *self)
 				points = points * 0.5;
 			}
 
-			gi.WriteByte(svc_temp_entity);
-			gi.WriteByte(TE_BFG_EXPLOSION);
-			gi.WritePosition(ent->s.origin);
-			gi.multicast(ent->s.origin, MULTICAST_PHS);
+			G_WriteByte(svc_temp_entity);
+			G_WriteByte(TE_BFG_EXPLOSION);
+			G_WritePosition(ent->s.origin);
+			G_Multicast(ent->s.origin, MULTICAST_PHS);
 			T_Damage(ent, self, self->owner, self->velocity, ent->s.origin,
 					vec3_origin, (int)points, 0, DAMAGE_ENERGY, MOD_BFG_EFFECT);
 		}
@@ -1058,7 +1068,7 @@ bfg_touch(edict_t *self, edict_t *other, const cplane_t *plane, const csurface_t
 
 	T_RadiusDamage(self, self->owner, 200, other, 100, MOD_BFG_BLAST);
 
-	gi.sound(self, CHAN_VOICE, gi.soundindex("weapons/bfg__x1b.wav"), 1, ATTN_NORM, 0);
+	gi.sound(self, CHAN_VOICE, G_SoundIndex(SND_BFG_X1B), 1, ATTN_NORM, 0);
 	self->solid = SOLID_NOT;
 	self->touch = NULL;
 
@@ -1070,7 +1080,7 @@ bfg_touch(edict_t *self, edict_t *other, const cplane_t *plane, const csurface_t
 	}
 
 	VectorClear(self->velocity);
-	self->s.modelindex = gi.modelindex("sprites/s_bfg3.sp2");
+	self->s.modelindex = G_ModelIndex(MDL_BFG3);
 	self->s.frame = 0;
 	self->s.sound = 0;
 	self->s.effects &= ~EF_ANIM_ALLFAST;
@@ -1078,12 +1088,12 @@ bfg_touch(edict_t *self, edict_t *other, const cplane_t *plane, const csurface_t
 	self->nextthink = level.time + FRAMETIME;
 	self->enemy = other;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_BFG_BIGEXPLOSION);
-	gi.WritePosition(self->s.origin);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_BFG_BIGEXPLOSION);
+	G_WritePosition(self->s.origin);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 }
 
 void
@@ -1148,7 +1158,7 @@ bfg_think(edict_t *self)
 
 		while (1)
 		{
-			tr = gi.trace(start, NULL, NULL, end, ignore,
+			tr = G_Trace(start, NULL, NULL, end, ignore,
 					CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER);
 
 			if (!tr.ent)
@@ -1167,13 +1177,13 @@ bfg_think(edict_t *self)
 			/* if we hit something that's not a monster or player we're done */
 			if (!(tr.ent->svflags & SVF_MONSTER) && (!tr.ent->client))
 			{
-				gi.WriteByte(svc_temp_entity);
-				gi.WriteByte(TE_LASER_SPARKS);
-				gi.WriteByte(4);
-				gi.WritePosition(tr.endpos);
-				gi.WriteDir(tr.plane.normal);
-				gi.WriteByte(self->s.skinnum);
-				gi.multicast(tr.endpos, MULTICAST_PVS);
+				G_WriteByte(svc_temp_entity);
+				G_WriteByte(TE_LASER_SPARKS);
+				G_WriteByte(4);
+				G_WritePosition(tr.endpos);
+				G_WriteDir(tr.plane.normal);
+				G_WriteByte(self->s.skinnum);
+				G_Multicast(tr.endpos, MULTICAST_PVS);
 				break;
 			}
 
@@ -1181,11 +1191,11 @@ bfg_think(edict_t *self)
 			VectorCopy(tr.endpos, start);
 		}
 
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_BFG_LASER);
-		gi.WritePosition(self->s.origin);
-		gi.WritePosition(tr.endpos);
-		gi.multicast(self->s.origin, MULTICAST_PHS);
+		G_WriteByte(svc_temp_entity);
+		G_WriteByte(TE_BFG_LASER);
+		G_WritePosition(self->s.origin);
+		G_WritePosition(tr.endpos);
+		G_Multicast(self->s.origin, MULTICAST_PHS);
 	}
 
 	self->nextthink = level.time + FRAMETIME;
@@ -1213,7 +1223,7 @@ fire_bfg(edict_t *self, vec3_t start, vec3_t dir, int damage,
 	bfg->s.effects |= EF_BFG | EF_ANIM_ALLFAST;
 	VectorClear(bfg->mins);
 	VectorClear(bfg->maxs);
-	bfg->s.modelindex = gi.modelindex("sprites/s_bfg1.sp2");
+	bfg->s.modelindex = G_ModelIndex(MDL_BFG1);
 	bfg->owner = self;
 	bfg->touch = bfg_touch;
 	bfg->nextthink = level.time + (8000.0f / (float)speed);
@@ -1221,7 +1231,7 @@ fire_bfg(edict_t *self, vec3_t start, vec3_t dir, int damage,
 	bfg->radius_dmg = damage;
 	bfg->dmg_radius = damage_radius;
 	bfg->classname = "bfg blast";
-	bfg->s.sound = gi.soundindex("weapons/bfg__l1a.wav");
+	bfg->s.sound = G_SoundIndex(SND_BFG_L1A);
 
 	bfg->think = bfg_think;
 	bfg->nextthink = level.time + FRAMETIME;
@@ -1233,7 +1243,7 @@ fire_bfg(edict_t *self, vec3_t start, vec3_t dir, int damage,
 		check_dodge(self, bfg->s.origin, dir, speed);
 	}
 
-	gi.linkentity(bfg);
+	G_LinkEntity(bfg);
 }
 
 void
@@ -1244,13 +1254,13 @@ ionripper_sparks(edict_t *self)
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_WELDING_SPARKS);
-	gi.WriteByte(0);
-	gi.WritePosition(self->s.origin);
-	gi.WriteDir(vec3_origin);
-	gi.WriteByte(0xe4 + (randk() & 3));
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_WELDING_SPARKS);
+	G_WriteByte(0);
+	G_WritePosition(self->s.origin);
+	G_WriteDir(vec3_origin);
+	G_WriteByte(0xe4 + (G_RandInt(RAND_EFFECT) & 3));
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	G_FreeEdict(self);
 }
@@ -1321,22 +1331,22 @@ fire_ionripper(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 	VectorClear(ion->mins);
 	VectorClear(ion->maxs);
-	ion->s.modelindex = gi.modelindex("models/objects/boomrang/tris.md2");
-	ion->s.sound = gi.soundindex("misc/lasfly.wav");
+	ion->s.modelindex = G_ModelIndex(MDL_BOOMRANG);
+	ion->s.sound = G_SoundIndex(SND_LASFLY);
 	ion->owner = self;
 	ion->touch = ionripper_touch;
 	ion->nextthink = level.time + 3;
 	ion->think = ionripper_sparks;
 	ion->dmg = damage;
 	ion->dmg_radius = 100;
-	gi.linkentity(ion);
+	G_LinkEntity(ion);
 
 	if (self->client)
 	{
 		check_dodge(self, ion->s.origin, dir, speed);
 	}
 
-	tr = gi.trace(self->s.origin, NULL, NULL, ion->s.origin, ion, MASK_SHOT);
+	tr = G_Trace(self->s.origin, NULL, NULL, ion->s.origin, ion, MASK_SHOT);
 
 	if (tr.fraction < 1.0)
 	{
@@ -1430,7 +1440,7 @@ fire_heat(edict_t *self, vec3_t start, vec3_t dir, int damage, int speed,
 	heat->s.effects |= EF_ROCKET;
 	VectorClear(heat->mins);
 	VectorClear(heat->maxs);
-	heat->s.modelindex = gi.modelindex("models/objects/rocket/tris.md2");
+	heat->s.modelindex = G_ModelIndex(MDL_ROCKET);
 	heat->owner = self;
 	heat->touch = rocket_touch;
 
@@ -1440,14 +1450,14 @@ fire_heat(edict_t *self, vec3_t start, vec3_t dir, int damage, int speed,
 	heat->dmg = damage;
 	heat->radius_dmg = radius_damage;
 	heat->dmg_radius = damage_radius;
-	heat->s.sound = gi.soundindex("weapons/rockfly.wav");
+	heat->s.sound = G_SoundIndex(SND_ROCKFLY);
 
 	if (self->client)
 	{
 		check_dodge(self, heat->s.origin, dir, speed);
 	}
 
-	gi.linkentity(heat);
+	G_LinkEntity(heat);
 }
 
 void
@@ -1491,19 +1501,19 @@ plasma_touch(edict_t *ent, edict_t *other, const cplane_t *plane, const csurface
 	T_RadiusDamage(ent, ent->owner, ent->radius_dmg, other,
 			ent->dmg_radius, MOD_PHALANX);
 
-	gi.WriteByte(svc_temp_entity);
+	G_WriteByte(svc_temp_entity);
 
 	if (ent->waterlevel)
 	{
-		gi.WriteByte(TE_ROCKET_EXPLOSION_WATER);
+		G_WriteByte(TE_ROCKET_EXPLOSION_WATER);
 	}
 	else
 	{
-		gi.WriteByte(TE_PLASMA_EXPLOSION);
+		G_WriteByte(TE_PLASMA_EXPLOSION);
 	}
 
-	gi.WritePosition(origin);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WritePosition(origin);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	G_FreeEdict(ent);
 }
@@ -1538,9 +1548,9 @@ fire_plasma(edict_t *self, vec3_t start, vec3_t dir, int damage,
 	plasma->dmg = damage;
 	plasma->radius_dmg = radius_damage;
 	plasma->dmg_radius = damage_radius;
-	plasma->s.sound = gi.soundindex("weapons/rockfly.wav");
+	plasma->s.sound = G_SoundIndex(SND_ROCKFLY);
 
-	plasma->s.modelindex = gi.modelindex("sprites/s_photon.sp2");
+	plasma->s.modelindex = G_ModelIndex(MDL_PHOTON);
 	plasma->s.effects |= EF_PLASMA | EF_ANIM_ALLFAST;
 
 	if (self->client)
@@ -1548,7 +1558,7 @@ fire_plasma(edict_t *self, vec3_t start, vec3_t dir, int damage,
 		check_dodge(self, plasma->s.origin, dir, speed);
 	}
 
-	gi.linkentity(plasma);
+	G_LinkEntity(plasma);
 }
 
 void
@@ -1586,7 +1596,7 @@ Trap_Think(edict_t *ent)
 		{
 			if (ent->wait == 64)
 			{
-				gi.sound(ent, CHAN_VOICE, gi.soundindex("weapons/trapdown.wav"),
+				gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_TRAPDOWN),
 						1, ATTN_IDLE, 0);
 			}
 
@@ -1599,17 +1609,17 @@ Trap_Think(edict_t *ent)
 
 				if (strcmp(ent->enemy->classname, "monster_gekk") == 0)
 				{
-					best->s.modelindex = gi.modelindex("models/objects/gekkgib/torso/tris.md2");
+					best->s.modelindex = G_ModelIndex(MDL_GEKKGIB_TORSO);
 					best->s.effects |= TE_GREENBLOOD;
 				}
 				else if (ent->mass > 200)
 				{
-					best->s.modelindex = gi.modelindex("models/objects/gibs/chest/tris.md2");
+					best->s.modelindex = G_ModelIndex(MDL_GIB_CHEST);
 					best->s.effects |= TE_BLOOD;
 				}
 				else
 				{
-					best->s.modelindex = gi.modelindex("models/objects/gibs/sm_meat/tris.md2");
+					best->s.modelindex = G_ModelIndex(MDL_GIB_SM_MEAT);
 					best->s.effects |= TE_BLOOD;
 				}
 
@@ -1635,7 +1645,7 @@ Trap_Think(edict_t *ent)
 				VectorClear(best->mins);
 				VectorClear(best->maxs);
 
-				best->watertype = gi.pointcontents(best->s.origin);
+				best->watertype = G_PointContents(best->s.origin);
 
 				if (best->watertype & MASK_WATER)
 				{
@@ -1644,7 +1654,7 @@ Trap_Think(edict_t *ent)
 
 				best->nextthink = level.time + 0.1;
 				best->think = G_FreeEdict;
-				gi.linkentity(best);
+				G_LinkEntity(best);
 			}
 
 			if (ent->wait < 19)
@@ -1668,7 +1678,7 @@ Trap_Think(edict_t *ent)
 			best->s.origin[2] += 16;
 			best->velocity[2] = 400;
 			best->count = ent->mass;
-			gi.linkentity(best);
+			G_LinkEntity(best);
 			return;
 		}
 
@@ -1754,8 +1764,7 @@ Trap_Think(edict_t *ent)
 			VectorScale(forward, 256, best->velocity);
 		}
 
-		gi.sound(ent, CHAN_VOICE, gi.soundindex(
-						"weapons/trapsuck.wav"), 1, ATTN_IDLE, 0);
+		gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_TRAPSUCK), 1, ATTN_IDLE, 0);
 
 		if (len < 32)
 		{
@@ -1808,22 +1817,22 @@ fire_trap(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	trap = G_Spawn();
 	VectorCopy(start, trap->s.origin);
 	VectorScale(aimdir, speed, trap->velocity);
-	VectorMA(trap->velocity, 200 + crandom() * 10.0, up, trap->velocity);
-	VectorMA(trap->velocity, crandom() * 10.0, right, trap->velocity);
+	VectorMA(trap->velocity, 200 + G_CRandom(RAND_WEAPON) * 10.0, up, trap->velocity);
+	VectorMA(trap->velocity, G_CRandom(RAND_WEAPON) * 10.0, right, trap->velocity);
 	VectorSet(trap->avelocity, 0, 300, 0);
 	trap->movetype = MOVETYPE_BOUNCE;
 	trap->clipmask = MASK_SHOT;
 	trap->solid = SOLID_BBOX;
 	VectorSet(trap->mins, -4, -4, 0);
 	VectorSet(trap->maxs, 4, 4, 8);
-	trap->s.modelindex = gi.modelindex("models/weapons/z_trap/tris.md2");
+	trap->s.modelindex = G_ModelIndex(MDL_TRAP);
 	trap->owner = self;
 	trap->nextthink = level.time + 1.0;
 	trap->think = Trap_Think;
 	trap->dmg = damage;
 	trap->dmg_radius = damage_radius;
 	trap->classname = "htrap";
-	trap->s.sound = gi.soundindex("weapons/traploop.wav");
+	trap->s.sound = G_SoundIndex(SND_TRAPLOOP);
 
 	if (held)
 	{
@@ -1840,7 +1849,7 @@ fire_trap(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	}
 	else
 	{
-		gi.linkentity(trap);
+		G_LinkEntity(trap);
 	}
 
 	trap->timestamp = level.time + 30;
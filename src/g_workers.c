@@ -0,0 +1,277 @@
+/*
+ * =======================================================================
+ *
+ * A small pool of worker threads for pure computations that
+ * can be split up by index, e.g. one job per client. The main
+ * thread hands out the jobs, takes part in running them and
+ * returns when all are done. Jobs must not call into the
+ * engine or touch anything but their own data.
+ *
+ * The pool size is set by g_threads. 0 runs everything in the
+ * main thread, which is also done for a single job.
+ *
+ * =======================================================================
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "header/local.h"
+
+#define MAX_WORKERS 15
+
+static struct
+{
+	int numthreads;
+	int wanted; /* g_threads the threads were started for */
+
+#ifdef _WIN32
+	HANDLE threads[MAX_WORKERS];
+	SRWLOCK lock;
+	CONDITION_VARIABLE wake;
+	CONDITION_VARIABLE done;
+#else
+	pthread_t threads[MAX_WORKERS];
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	pthread_cond_t done;
+#endif
+
+	/* the current batch, protected by lock */
+	void (*func)(int index);
+	int count;
+	int next;
+	int pending;
+	int generation;
+	qboolean quit;
+
+	qboolean active;
+} pool = {
+	0, 0,
+#ifdef _WIN32
+	{NULL}, SRWLOCK_INIT, CONDITION_VARIABLE_INIT, CONDITION_VARIABLE_INIT,
+#else
+	{0}, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+	PTHREAD_COND_INITIALIZER,
+#endif
+};
+
+#ifdef _WIN32
+#define Pool_Lock() AcquireSRWLockExclusive(&pool.lock)
+#define Pool_Unlock() ReleaseSRWLockExclusive(&pool.lock)
+#define Pool_Wait(cond) SleepConditionVariableSRW(&(cond), &pool.lock, INFINITE, 0)
+#define Pool_Signal(cond) WakeConditionVariable(&(cond))
+#define Pool_Broadcast(cond) WakeAllConditionVariable(&(cond))
+#else
+#define Pool_Lock() pthread_mutex_lock(&pool.lock)
+#define Pool_Unlock() pthread_mutex_unlock(&pool.lock)
+#define Pool_Wait(cond) pthread_cond_wait(&(cond), &pool.lock)
+#define Pool_Signal(cond) pthread_cond_signal(&(cond))
+#define Pool_Broadcast(cond) pthread_cond_broadcast(&(cond))
+#endif
+
+/*
+ * Runs jobs of the current batch until none are
+ * left. Called and returns with the lock held.
+ */
+static void
+Pool_RunJobs(void)
+{
+	int i;
+
+	while (pool.next < pool.count)
+	{
+		i = pool.next++;
+
+		Pool_Unlock();
+		pool.func(i);
+		Pool_Lock();
+
+		if (--pool.pending == 0)
+		{
+			Pool_Signal(pool.done);
+		}
+	}
+}
+
+static void
+Pool_Worker(void)
+{
+	int generation;
+
+	Pool_Lock();
+	generation = pool.generation;
+
+	while (1)
+	{
+		while (!pool.quit && (generation == pool.generation))
+		{
+			Pool_Wait(pool.wake);
+		}
+
+		if (pool.quit)
+		{
+			break;
+		}
+
+		generation = pool.generation;
+		Pool_RunJobs();
+	}
+
+	Pool_Unlock();
+}
+
+#ifdef _WIN32
+static DWORD WINAPI
+Pool_Thread(LPVOID arg)
+{
+	Pool_Worker();
+	return 0;
+}
+#else
+static void *
+Pool_Thread(void *arg)
+{
+	Pool_Worker();
+	return NULL;
+}
+#endif
+
+static void
+Pool_Start(int wanted)
+{
+	int i, num;
+
+	num = wanted;
+
+	if (num > MAX_WORKERS)
+	{
+		num = MAX_WORKERS;
+	}
+
+	pool.quit = false;
+	pool.wanted = wanted;
+
+	for (i = 0; i < num; i++)
+	{
+#ifdef _WIN32
+		pool.threads[i] = CreateThread(NULL, 0, Pool_Thread, NULL, 0, NULL);
+
+		if (!pool.threads[i])
+		{
+			break;
+		}
+#else
+		if (pthread_create(&pool.threads[i], NULL, Pool_Thread, NULL) != 0)
+		{
+			break;
+		}
+#endif
+	}
+
+	pool.numthreads = i;
+
+	if (i < num)
+	{
+		gi.dprintf("Couldn't start more than %i of %i worker threads\n",
+				i, num);
+	}
+}
+
+void
+G_ShutdownWorkers(void)
+{
+	int i;
+
+	if (!pool.numthreads)
+	{
+		pool.wanted = 0;
+		return;
+	}
+
+	Pool_Lock();
+	pool.quit = true;
+	Pool_Broadcast(pool.wake);
+	Pool_Unlock();
+
+	for (i = 0; i < pool.numthreads; i++)
+	{
+#ifdef _WIN32
+		WaitForSingleObject(pool.threads[i], INFINITE);
+		CloseHandle(pool.threads[i]);
+#else
+		pthread_join(pool.threads[i], NULL);
+#endif
+	}
+
+	pool.numthreads = 0;
+	pool.wanted = 0;
+}
+
+/*
+ * True while jobs are running. Code shared
+ * with the serial paths uses this to stay
+ * away from the engine.
+ */
+qboolean
+G_InParallel(void)
+{
+	return pool.active;
+}
+
+/*
+ * Calls func(0) to func(count - 1), spread over the
+ * worker threads and the main thread. The order is
+ * undefined, returns when all calls are done.
+ */
+void
+G_RunParallel(void (*func)(int index), int count)
+{
+	int i, wanted;
+
+	wanted = (g_threads->value > 0) ? (int)g_threads->value : 0;
+
+	if (wanted != pool.wanted)
+	{
+		G_ShutdownWorkers();
+
+		if (wanted)
+		{
+			Pool_Start(wanted);
+		}
+	}
+
+	if (!pool.numthreads || (count < 2))
+	{
+		for (i = 0; i < count; i++)
+		{
+			func(i);
+		}
+
+		return;
+	}
+
+	Pool_Lock();
+
+	pool.func = func;
+	pool.count = count;
+	pool.next = 0;
+	pool.pending = count;
+	pool.generation++;
+	pool.active = true;
+
+	Pool_Broadcast(pool.wake);
+	Pool_RunJobs();
+
+	while (pool.pending)
+	{
+		Pool_Wait(pool.done);
+	}
+
+	pool.active = false;
+
+	Pool_Unlock();
+}
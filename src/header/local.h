@@ -73,6 +73,7 @@
 #define FL_NO_KNOCKBACK 0x00000800
 #define FL_POWER_ARMOR 0x00001000 /* power armor (if any) is active */
 #define FL_COOP_TAKEN 0x00002000 /* Another client has already taken it */
+#define FL_BALLISTIC 0x00004000 /* cosmetic, cheap toss physics without triggers */
 #define FL_RESPAWN 0x80000000 /* used for item respawning */
 
 #define FRAMETIME 0.1
@@ -80,6 +81,7 @@
 /* memory tags to allow dynamic memory to be cleaned up */
 #define TAG_GAME 765 /* clear when unloading the dll */
 #define TAG_LEVEL 766 /* clear when loading a new level */
+#define TAG_FILTER 767 /* ip filters, survive loading a savegame */
 
 #define MELEE_DISTANCE 80
 #define BODY_QUEUE_SIZE 8
@@ -270,6 +272,62 @@ typedef struct gitem_s
 	const char *precaches;            /* string of all models, sounds, and images this item will use */
 } gitem_t;
 
+/* indexes into itemlist[], must match the
+   designated initializers in g_items.c */
+typedef enum
+{
+	IT_NULL,
+	IT_ARMOR_BODY,
+	IT_ARMOR_COMBAT,
+	IT_ARMOR_JACKET,
+	IT_ARMOR_SHARD,
+	IT_POWER_SCREEN,
+	IT_POWER_SHIELD,
+	IT_WEAPON_BLASTER,
+	IT_WEAPON_SHOTGUN,
+	IT_WEAPON_SUPERSHOTGUN,
+	IT_WEAPON_MACHINEGUN,
+	IT_WEAPON_CHAINGUN,
+	IT_AMMO_GRENADES,
+	IT_AMMO_TRAP,
+	IT_WEAPON_GRENADELAUNCHER,
+	IT_WEAPON_ROCKETLAUNCHER,
+	IT_WEAPON_HYPERBLASTER,
+	IT_WEAPON_BOOMER,
+	IT_WEAPON_RAILGUN,
+	IT_WEAPON_PHALANX,
+	IT_WEAPON_BFG,
+	IT_AMMO_SHELLS,
+	IT_AMMO_BULLETS,
+	IT_AMMO_CELLS,
+	IT_AMMO_ROCKETS,
+	IT_AMMO_SLUGS,
+	IT_AMMO_MAGSLUG,
+	IT_QUAD,
+	IT_QUADFIRE,
+	IT_INVULNERABILITY,
+	IT_SILENCER,
+	IT_BREATHER,
+	IT_ENVIRO,
+	IT_ANCIENT_HEAD,
+	IT_ADRENALINE,
+	IT_BANDOLIER,
+	IT_PACK,
+	IT_KEY_DATA_CD,
+	IT_KEY_POWER_CUBE,
+	IT_KEY_PYRAMID,
+	IT_KEY_DATA_SPINNER,
+	IT_KEY_PASS,
+	IT_KEY_BLUE_KEY,
+	IT_KEY_RED_KEY,
+	IT_KEY_GREEN_KEY,
+	IT_KEY_COMMANDER_HEAD,
+	IT_KEY_AIRSTRIKE_TARGET,
+	IT_HEALTH,
+
+	IT_TOTAL
+} itemid_t;
+
 /* this structure is left intact through an entire game
    it should be initialized at dll load time, and read/written to
    the server.ssv file for savegames */
@@ -459,6 +517,107 @@ extern spawn_temp_t st;
 extern int sm_meat_index;
 extern int snd_fry;
 
+/* sounds and models used during gameplay. The
+   indexes are resolved once per level and cached,
+   see G_SoundIndex() and G_ModelIndex() */
+typedef enum
+{
+	SND_AIROUT,
+	SND_BFG_HUM,
+	SND_BFG_L1A,
+	SND_BFG_X1B,
+	SND_BURN1,
+	SND_BURN2,
+	SND_CHNGND1A,
+	SND_CHNGNL1A,
+	SND_CHNGNU1A,
+	SND_DAMAGE,
+	SND_DAMAGE2,
+	SND_DAMAGE3,
+	SND_DEATH1, /* SND_DEATH1 - SND_DEATH4 must be in order */
+	SND_DEATH2,
+	SND_DEATH3,
+	SND_DEATH4,
+	SND_DROWN1,
+	SND_FHIT3,
+	SND_GASP1,
+	SND_GASP2,
+	SND_GRENLB1B,
+	SND_GURP1,
+	SND_GURP2,
+	SND_H2OHIT1,
+	SND_HGRENA1B,
+	SND_HGRENB1A,
+	SND_HGRENB2A,
+	SND_HGRENC1B,
+	SND_HGRENT1A,
+	SND_HYPRBD1A,
+	SND_HYPRBL1A,
+	SND_INFLIES1,
+	SND_JUMP1,
+	SND_LAND,
+	SND_LASFLY,
+	SND_LAVA1,
+	SND_LAVA2,
+	SND_LAVA_IN,
+	SND_L_HEALTH,
+	SND_M_HEALTH,
+	SND_NOAMMO,
+	SND_N_HEALTH,
+	SND_PAIN25_1, /* SND_PAIN25_1 - SND_PAIN100_2 must be in order */
+	SND_PAIN25_2,
+	SND_PAIN50_1,
+	SND_PAIN50_2,
+	SND_PAIN75_1,
+	SND_PAIN75_2,
+	SND_PAIN100_1,
+	SND_PAIN100_2,
+	SND_PC_UP,
+	SND_PHALOOP,
+	SND_POWER1,
+	SND_POWER2,
+	SND_PROTECT,
+	SND_PROTECT2,
+	SND_PROTECT4,
+	SND_QUADFIRE1,
+	SND_QUADFIRE2,
+	SND_RG_HUM,
+	SND_ROCKFLY,
+	SND_S_HEALTH,
+	SND_TALK1,
+	SND_TRAPCOCK,
+	SND_TRAPDOWN,
+	SND_TRAPLOOP,
+	SND_TRAPSUCK,
+	SND_U_BREATH1,
+	SND_U_BREATH2,
+	SND_UDEATH,
+	SND_WATR_IN,
+	SND_WATR_OUT,
+	SND_WATR_UN,
+
+	SND_NUM
+} gsound_t;
+
+typedef enum
+{
+	MDL_BFG1,
+	MDL_BFG3,
+	MDL_BLASER,
+	MDL_BOOMRANG,
+	MDL_GEKKGIB_TORSO,
+	MDL_GIB_CHEST,
+	MDL_GIB_SM_MEAT,
+	MDL_GRENADE,
+	MDL_GRENADE2,
+	MDL_LASER,
+	MDL_PHOTON,
+	MDL_ROCKET,
+	MDL_TRAP,
+
+	MDL_NUM
+} gmodel_t;
+
 extern int debristhisframe;
 extern int gibsthisframe;
 
@@ -519,8 +678,24 @@ extern edict_t *g_edicts;
 #define LLOFS(x) (size_t)&(((level_locals_t *)NULL)->x)
 #define CLOFS(x) (size_t)&(((gclient_t *)NULL)->x)
 
-#define random() ((randk() & 0x7fff) / ((float)0x7fff))
-#define crandom() (2.0 * (random() - 0.5))
+/* random number streams, one per subsystem so
+   that e.g. gibs don't change what monsters do */
+typedef enum
+{
+	RAND_GAME,   /* world logic */
+	RAND_AI,     /* monster decisions and attacks */
+	RAND_WEAPON, /* spread and damage */
+	RAND_EFFECT, /* purely cosmetic */
+	RAND_SPAWN,  /* spawn points, items */
+
+	RAND_NUMSTREAMS
+} randstream_t;
+
+#define G_Random(s) ((G_RandInt(s) & 0x7fff) / ((float)0x7fff))
+#define G_CRandom(s) (2.0 * (G_Random(s) - 0.5))
+
+#define random() G_Random(RAND_GAME)
+#define crandom() G_CRandom(RAND_GAME)
 
 extern cvar_t *maxentities;
 extern cvar_t *deathmatch;
@@ -541,11 +716,23 @@ extern cvar_t *g_monsterfootsteps;
 extern cvar_t *g_fix_triggered;
 
 extern cvar_t *filterban;
+extern cvar_t *filterbanlist;
 
 extern cvar_t *sv_gravity;
 extern cvar_t *sv_maxvelocity;
+extern cvar_t *g_lagcomp;
+extern cvar_t *g_debug_edicts;
+extern cvar_t *g_async_save;
+extern cvar_t *g_delta_saves;
+extern cvar_t *g_entcache;
+extern cvar_t *g_threads;
+extern cvar_t *g_callstats;
+extern cvar_t *g_netstats;
+extern cvar_t *g_flightrec;
+extern cvar_t *g_flightrec_frames;
 
 extern cvar_t *gun_x, *gun_y, *gun_z;
+extern cvar_t *cl_gun;
 extern cvar_t *sv_rollspeed;
 extern cvar_t *sv_rollangle;
 
@@ -562,6 +749,7 @@ extern cvar_t *maxspectators;
 extern cvar_t *flood_msgs;
 extern cvar_t *flood_persecond;
 extern cvar_t *flood_waitdelay;
+extern cvar_t *g_cmd_ratelimit;
 
 extern cvar_t *sv_maplist;
 
@@ -610,12 +798,16 @@ typedef struct
 
 const field_t *FindSpawnfield(const char *key);
 const field_t *FindSpawntempField(const char *key);
+const field_t *FindSpawnFieldSpan(const char *key, size_t len, qboolean *spawntemp);
+const field_t *GetSpawnField(int index, qboolean *spawntemp);
 
 extern gitem_t itemlist[];
 extern const int itemlist_len;
 
 /* g_cmds.c */
 void Cmd_Help_f(edict_t *ent);
+void G_ResetCommandLimits(edict_t *ent);
+void SVCmd_CmdStats_f(void);
 
 /* g_items.c */
 void PrecacheItem(const gitem_t *it);
@@ -625,6 +817,7 @@ gitem_t *FindItem(const char *pickup_name);
 gitem_t *FindItemByClassname(const char *classname);
 
 #define ITEM_INDEX(x) ((x) - itemlist)
+#define ITEM_BY_ID(x) (&itemlist[(x)])
 
 edict_t *Drop_Item(edict_t *ent, const gitem_t *item);
 void SetRespawn(edict_t *ent, float delay);
@@ -647,17 +840,64 @@ edict_t *G_Find(edict_t *from, int fieldofs, const char *match);
 edict_t *findradius(edict_t *from, const vec3_t org, float rad);
 edict_t *G_PickTarget(char *targetname);
 void G_UseTargets(edict_t *ent, edict_t *activator);
+void G_CPrintf(const edict_t *ent, int printlevel, const char *fmt, ...);
+void G_CenterPrintf(const edict_t *ent, const char *fmt, ...);
 void G_SetMovedir(vec3_t angles, vec3_t movedir);
 
+void G_InitEdictGenerations(void);
+void G_ResetEdicts(void);
+edict_t *G_ExtendEdicts(int num);
 void G_InitEdict(edict_t *e);
 edict_t *G_SpawnOptional(void);
 edict_t *G_Spawn(void);
 void G_FreeEdict(edict_t *e);
 
+moveinfo_t *G_AllocMoveInfo(edict_t *ent);
+monsterinfo_t *G_AllocMonsterInfo(edict_t *ent);
+void G_ReleaseEdictInfo(edict_t *ent);
+void G_ResetEdictPools(void);
+void SVCmd_EdictStats_f(void);
+
 void G_TouchTriggers(edict_t *ent);
 void G_TouchSolids(edict_t *ent);
 
 char *G_CopyString(const char *in);
+void G_ResetStrings(void);
+char *G_InternString(const char *in);
+qboolean G_StringsEqual(const char *a, const char *b);
+void SVCmd_StringStats_f(void);
+int G_RandInt(randstream_t stream);
+void G_SeedRandom(unsigned int seed);
+void G_SeedRandomTime(void);
+void G_SaveRandomState(randk_stream_t *state);
+void G_LoadRandomState(const randk_stream_t *state);
+void SVCmd_Seed_f(void);
+unsigned int G_RandomSeed(void);
+
+/* g_replay.c */
+void G_RecordConnect(const edict_t *ent, const char *userinfo);
+void G_RecordUserinfo(const edict_t *ent, const char *userinfo);
+void G_RecordBegin(const edict_t *ent);
+void G_RecordDisconnect(const edict_t *ent);
+void G_RecordThink(const edict_t *ent, const usercmd_t *ucmd);
+void G_RecordCommand(const edict_t *ent);
+void G_ReplayLevelStart(const char *mapname);
+void G_ReplayBeginFrame(void);
+void G_ReplayEndFrame(void);
+qboolean G_ReplayRejects(void);
+qboolean G_IsReplayedClient(const edict_t *ent);
+void G_ReplayDropUnicast(void);
+void G_ShutdownReplay(void);
+void SVCmd_Record_f(qboolean playback);
+void SVCmd_StopReplay_f(void);
+void SVCmd_EntBench_f(void);
+
+void G_ResetIndexes(void);
+int G_SoundIndex(gsound_t snd);
+int G_ModelIndex(gmodel_t mdl);
+int G_ModelIndexByName(const char *name);
+int G_ImageIndexByName(const char *name);
+int G_FindImageIndex(const char *name);
 
 float *tv(float x, float y, float z);
 char *vtos(vec3_t v);
@@ -801,20 +1041,190 @@ void player_pain(edict_t *self, edict_t *other, float kick, int damage);
 void player_die(edict_t *self, edict_t *inflictor, edict_t *attacker,
 		int damage, const vec3_t point);
 
+/* g_lagcomp.c */
+void G_InitLagCompensation(void);
+void G_ResetLagHistory(edict_t *ent);
+void G_RecordLagHistory(void);
+void G_LagRewind(edict_t *shooter);
+void G_LagRestore(void);
+void SVCmd_LagBench_f(void);
+
+/* g_workers.c */
+void G_RunParallel(void (*func)(int index), int count);
+qboolean G_InParallel(void);
+void G_ShutdownWorkers(void);
+
+/* g_flightrec.c */
+typedef enum
+{
+	FLIGHT_FRAME,
+	FLIGHT_THINK,
+	FLIGHT_TOUCH,
+	FLIGHT_SPAWN,
+	FLIGHT_FREE,
+	FLIGHT_DAMAGE,
+	FLIGHT_TRACE
+} flighttype_t;
+
+extern qboolean flightrec_active;
+
+void G_FlightRecord(flighttype_t type, const edict_t *ent,
+		const edict_t *other, int value);
+void G_FlightTrace(const char *file, int line, const edict_t *passent);
+void G_FlightClear(void);
+void G_FlightBeginFrame(void);
+void G_FlightEndFrame(void);
+void G_ShutdownFlight(void);
+
+#define G_FlightEvent(type, ent, other, value) \
+	do \
+	{ \
+		if (flightrec_active) \
+		{ \
+			G_FlightRecord(type, ent, other, value); \
+		} \
+	} while (0)
+
+/* g_timeline.c */
+extern qboolean timeline_active;
+
+void G_TimelineBegin(const char *name, const edict_t *ent);
+void G_TimelineEnd(void);
+void G_ShutdownTimeline(void);
+void SVCmd_Timeline_f(void);
+
+#define G_SpanBegin(name, ent) \
+	do \
+	{ \
+		if (timeline_active) \
+		{ \
+			G_TimelineBegin(name, ent); \
+		} \
+	} while (0)
+#define G_SpanEnd() \
+	do \
+	{ \
+		if (timeline_active) \
+		{ \
+			G_TimelineEnd(); \
+		} \
+	} while (0)
+
+/* g_callstats.c */
+typedef enum
+{
+	CALL_TRACE,
+	CALL_POINTCONTENTS,
+	CALL_BOXEDICTS,
+	CALL_INPVS,
+	CALL_INPHS,
+	CALL_LINKENTITY,
+	CALL_NUM
+} enginecall_t;
+
+extern qboolean callstats_active;
+
+trace_t G_TraceAt(const char *file, int line, const vec3_t start,
+		const vec3_t mins, const vec3_t maxs, const vec3_t end,
+		const edict_t *passent, int contentmask);
+int G_PointContentsAt(const char *file, int line, const vec3_t point);
+int G_BoxEdictsAt(const char *file, int line, const vec3_t mins,
+		const vec3_t maxs, edict_t **list, int maxcount, int areatype);
+qboolean G_InPVSAt(const char *file, int line, vec3_t p1, vec3_t p2);
+qboolean G_InPHSAt(const char *file, int line, vec3_t p1, vec3_t p2);
+void G_LinkEntityAt(const char *file, int line, edict_t *ent);
+void G_CallStatsBeginFrame(void);
+const char *G_CallSiteName(const char *file);
+void SVCmd_CallStats_f(void);
+
+/* the engine calls to use in game code, counted
+   per call site while g_callstats is set. traces
+   also go to the flight recorder. */
+#define G_Trace(start, mins, maxs, end, passent, contentmask) \
+	((callstats_active || flightrec_active) ? \
+	 G_TraceAt(__FILE__, __LINE__, start, mins, maxs, end, passent, contentmask) : \
+	 gi.trace(start, mins, maxs, end, passent, contentmask))
+#define G_PointContents(point) \
+	(callstats_active ? \
+	 G_PointContentsAt(__FILE__, __LINE__, point) : \
+	 gi.pointcontents(point))
+#define G_BoxEdicts(mins, maxs, list, maxcount, areatype) \
+	(callstats_active ? \
+	 G_BoxEdictsAt(__FILE__, __LINE__, mins, maxs, list, maxcount, areatype) : \
+	 gi.BoxEdicts(mins, maxs, list, maxcount, areatype))
+#define G_InPVS(p1, p2) \
+	(callstats_active ? \
+	 G_InPVSAt(__FILE__, __LINE__, p1, p2) : \
+	 gi.inPVS(p1, p2))
+#define G_InPHS(p1, p2) \
+	(callstats_active ? \
+	 G_InPHSAt(__FILE__, __LINE__, p1, p2) : \
+	 gi.inPHS(p1, p2))
+#define G_LinkEntity(ent) \
+	(callstats_active ? \
+	 G_LinkEntityAt(__FILE__, __LINE__, ent) : \
+	 gi.linkentity(ent))
+
+/* g_netstats.c */
+extern qboolean netstats_active;
+
+void G_NetMulticast(const vec3_t origin, multicast_t to);
+void G_NetUnicast(const edict_t *ent, qboolean reliable);
+void G_NetWriteChar(int c);
+void G_NetWriteByte(int c);
+void G_NetWriteShort(int c);
+void G_NetWriteLong(int c);
+void G_NetWriteFloat(float f);
+void G_NetWriteString(const char *s);
+void G_NetWritePosition(const vec3_t pos);
+void G_NetWriteDir(const vec3_t dir);
+void G_NetWriteAngle(float f);
+void G_NetStatsBeginFrame(void);
+void SVCmd_NetStats_f(void);
+
+/* messages go through these, see g_netstats.c */
+#define G_Multicast(origin, to) \
+	(netstats_active ? G_NetMulticast(origin, to) : gi.multicast(origin, to))
+#define G_Unicast(ent, reliable) \
+	(G_IsReplayedClient(ent) ? G_ReplayDropUnicast() : \
+	 netstats_active ? G_NetUnicast(ent, reliable) : gi.unicast(ent, reliable))
+#define G_WriteChar(c) \
+	(netstats_active ? G_NetWriteChar(c) : gi.WriteChar(c))
+#define G_WriteByte(c) \
+	(netstats_active ? G_NetWriteByte(c) : gi.WriteByte(c))
+#define G_WriteShort(c) \
+	(netstats_active ? G_NetWriteShort(c) : gi.WriteShort(c))
+#define G_WriteLong(c) \
+	(netstats_active ? G_NetWriteLong(c) : gi.WriteLong(c))
+#define G_WriteFloat(f) \
+	(netstats_active ? G_NetWriteFloat(f) : gi.WriteFloat(f))
+#define G_WriteString(s) \
+	(netstats_active ? G_NetWriteString(s) : gi.WriteString(s))
+#define G_WritePosition(pos) \
+	(netstats_active ? G_NetWritePosition(pos) : gi.WritePosition(pos))
+#define G_WriteDir(dir) \
+	(netstats_active ? G_NetWriteDir(dir) : gi.WriteDir(dir))
+#define G_WriteAngle(f) \
+	(netstats_active ? G_NetWriteAngle(f) : gi.WriteAngle(f))
+
 /* g_svcmds.c */
 void ServerCommand(void);
 qboolean SV_FilterPacket(char *from);
+void SV_InitIPFilters(void);
 
 /* p_view.c */
 void ClientEndServerFrame(edict_t *ent);
+void P_EndServerFrames(void);
 
 /* p_hud.c */
 void MoveClientToIntermission(edict_t *client);
 void G_SetStats(edict_t *ent);
 void G_SetSpectatorStats(edict_t *ent);
 void G_CheckChaseStats(const edict_t *ent);
+qboolean G_StatsDeferred(const edict_t *ent);
 void ValidateSelectedItem(gclient_t *cl);
 void DeathmatchScoreboardMessage(const edict_t *ent, const edict_t *killer);
+void InvalidateScoreboard(void);
 void HelpComputerMessage(edict_t *client);
 void InventoryMessage(edict_t *client);
 
@@ -850,6 +1260,12 @@ void M_ChangeYaw(edict_t *ent);
 
 /* g_phys.c */
 void G_RunEntity(edict_t *ent);
+void G_InitEdictMirror(void);
+void G_ResetEdictMirror(void);
+void G_MarkEdictDirty(const edict_t *ent);
+void G_SyncEdictMirror(const edict_t *ent);
+qboolean G_EdictNeedsRun(int num);
+void G_EdictMirrorStats(int *inuse, int *quiet);
 
 /* g_main.c */
 void SaveClientData(void);
@@ -866,6 +1282,19 @@ void ReadLevel(const char *filename);
 void WriteLevel(const char *filename);
 void ReadGame(const char *filename);
 void WriteGame(const char *filename, qboolean autosave);
+void SV_WaitForSaves(void);
+void SV_FinishSaves(void);
+void G_ResetLevelSaveBase(void);
+void SV_ShutdownSaves(void);
+
+/* in-memory game state, see savegame.c */
+typedef struct snapshot_s snapshot_t;
+
+snapshot_t *G_SnapshotCreate(void);
+qboolean G_SnapshotRestore(const snapshot_t *snap);
+void G_SnapshotFree(snapshot_t *snap);
+void SVCmd_Snapshot_f(void);
+void SVCmd_Rollback_f(void);
 void SpawnEntities(const char *mapname, char *entities, const char *spawnpoint);
 
 /* ============================================================================ */
@@ -1167,13 +1596,46 @@ struct edict_s
 
 	const gitem_t *item;              /* for bonus items */
 
-	/* common data blocks */
-	moveinfo_t moveinfo;
-	monsterinfo_t monsterinfo;
+	/* common data blocks, only movers and monsters
+	   need them. always access them through
+	   G_MoveInfo() and G_MonsterInfo() for reading,
+	   writers allocate them with G_EnsureMoveInfo()
+	   and G_EnsureMonsterInfo() */
+	moveinfo_t *moveinfo;
+	monsterinfo_t *monsterinfo;
 
 	int orders;
 };
 
+/* all zero, read by edicts without the block */
+extern const moveinfo_t g_nomoveinfo;
+extern const monsterinfo_t g_nomonsterinfo;
+
+static YQ2_ATTR_INLINE const moveinfo_t *
+G_MoveInfo(const edict_t *ent)
+{
+	return ent->moveinfo ? ent->moveinfo : &g_nomoveinfo;
+}
+
+static YQ2_ATTR_INLINE const monsterinfo_t *
+G_MonsterInfo(const edict_t *ent)
+{
+	return ent->monsterinfo ? ent->monsterinfo : &g_nomonsterinfo;
+}
+
+/* allocates the block on first use */
+static YQ2_ATTR_INLINE moveinfo_t *
+G_EnsureMoveInfo(edict_t *ent)
+{
+	return ent->moveinfo ? ent->moveinfo : G_AllocMoveInfo(ent);
+}
+
+static YQ2_ATTR_INLINE monsterinfo_t *
+G_EnsureMonsterInfo(edict_t *ent)
+{
+	return ent->monsterinfo ? ent->monsterinfo : G_AllocMonsterInfo(ent);
+}
+
 /*
  * Uncomment for check that exported functions declarations are same as in
  * implementation. (-Wmissing-prototypes )
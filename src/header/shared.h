@@ -295,6 +295,7 @@ void R_ConcatTransforms(const float in1[3][4], const float in2[3][4], float out[
 void AngleVectors(const vec3_t angles, vec3_t forward, vec3_t right, vec3_t up);
 void AngleVectors2(const vec3_t value1, vec3_t angles);
 int BoxOnPlaneSide(const vec3_t emins, const vec3_t emaxs, const struct cplane_s *plane);
+int BoxOnPlaneSide2(const vec3_t emins, const vec3_t emaxs, const struct cplane_s *p);
 float anglemod(float a);
 float LerpAngle(float a1, float a2, float frac);
 
@@ -387,6 +388,13 @@ char *Q_strchr0(const char *s, char c);
 /* Unicode wrappers that also make sure it's a regular file around fopen(). */
 FILE *Q_fopen(const char *file, const char *mode);
 
+/* Renames a file, replacing the target if it exists. */
+qboolean Q_rename(const char *from, const char *to);
+
+/* Monotonic clocks for measuring intervals. */
+long long Q_Microseconds(void);
+long long Q_Nanoseconds(void);
+
 /* Comparator function for qsort(), compares case-insensitive strings. */
 int Q_sort_stricmp(const void *s1, const void *s2);
 
@@ -426,6 +434,16 @@ float frandk(void);
 float crandk(void);
 void randk_seed(void);
 
+typedef struct
+{
+	unsigned long long state;
+	unsigned long long inc;
+} randk_stream_t;
+
+int randk_stream(randk_stream_t *rs);
+void randk_stream_seed(randk_stream_t *rs, unsigned long long seed,
+		unsigned long long id);
+
 /*
  * ==============================================================
  *
@@ -50,7 +50,7 @@ berserk_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("berserk/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (G_RandInt(RAND_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -109,7 +109,7 @@ berserk_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &berserk_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &berserk_move_stand;
 }
 
 static mframe_t berserk_frames_stand_fidget[] = {
@@ -156,17 +156,17 @@ berserk_fidget(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
 		return;
 	}
 
-	if (random() > 0.15)
+	if (G_Random(RAND_AI) > 0.15)
 	{
 		return;
 	}
 
-	self->monsterinfo.currentmove = &berserk_move_stand_fidget;
+	G_EnsureMonsterInfo(self)->currentmove = &berserk_move_stand_fidget;
 	gi.sound(self, CHAN_WEAPON, sound_idle, 1, ATTN_IDLE, 0);
 }
 
@@ -201,7 +201,7 @@ berserk_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &berserk_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &berserk_move_walk;
 }
 
 static mframe_t berserk_frames_run1[] = {
@@ -229,13 +229,13 @@ berserk_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &berserk_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &berserk_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &berserk_move_run1;
+		G_EnsureMonsterInfo(self)->currentmove = &berserk_move_run1;
 	}
 }
 
@@ -249,7 +249,7 @@ berserk_attack_spike(edict_t *self)
 		return;
 	}
 
-	fire_hit(self, aim, (15 + (randk() % 6)), 400); /* Faster attack -- upwards and backwards */
+	fire_hit(self, aim, (15 + (G_RandInt(RAND_AI) % 6)), 400); /* Faster attack -- upwards and backwards */
 }
 
 void
@@ -293,7 +293,7 @@ berserk_attack_club(edict_t *self)
 	}
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], -4);
-	fire_hit(self, aim, (5 + (randk() % 6)), 400); /* Slower attack */
+	fire_hit(self, aim, (5 + (G_RandInt(RAND_AI) % 6)), 400); /* Slower attack */
 }
 
 static mframe_t berserk_frames_attack_club[] = {
@@ -359,13 +359,13 @@ berserk_melee(edict_t *self)
 		return;
 	}
 
-	if ((randk() % 2) == 0)
+	if ((G_RandInt(RAND_AI) % 2) == 0)
 	{
-		self->monsterinfo.currentmove = &berserk_move_attack_spike;
+		G_EnsureMonsterInfo(self)->currentmove = &berserk_move_attack_spike;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &berserk_move_attack_club;
+		G_EnsureMonsterInfo(self)->currentmove = &berserk_move_attack_club;
 	}
 }
 
@@ -442,13 +442,13 @@ berserk_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	if ((damage < 20) || (random() < 0.5))
+	if ((damage < 20) || (G_Random(RAND_AI) < 0.5))
 	{
-		self->monsterinfo.currentmove = &berserk_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &berserk_move_pain1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &berserk_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &berserk_move_pain2;
 	}
 }
 
@@ -465,7 +465,7 @@ berserk_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t berserk_frames_death1[] = {
@@ -555,11 +555,11 @@ berserk_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /*
 
 	if (damage >= 50)
 	{
-		self->monsterinfo.currentmove = &berserk_move_death1;
+		G_EnsureMonsterInfo(self)->currentmove = &berserk_move_death1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &berserk_move_death2;
+		G_EnsureMonsterInfo(self)->currentmove = &berserk_move_death2;
 	}
 }
 
@@ -606,19 +606,19 @@ SP_monster_berserk(edict_t *self)
 	self->pain = berserk_pain;
 	self->die = berserk_die;
 
-	self->monsterinfo.stand = berserk_stand;
-	self->monsterinfo.walk = berserk_walk;
-	self->monsterinfo.run = berserk_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = NULL;
-	self->monsterinfo.melee = berserk_melee;
-	self->monsterinfo.sight = berserk_sight;
-	self->monsterinfo.search = berserk_search;
+	G_EnsureMonsterInfo(self)->stand = berserk_stand;
+	G_EnsureMonsterInfo(self)->walk = berserk_walk;
+	G_EnsureMonsterInfo(self)->run = berserk_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = NULL;
+	G_EnsureMonsterInfo(self)->melee = berserk_melee;
+	G_EnsureMonsterInfo(self)->sight = berserk_sight;
+	G_EnsureMonsterInfo(self)->search = berserk_search;
 
-	self->monsterinfo.currentmove = &berserk_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &berserk_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	walkmonster_start(self);
 }
@@ -25,7 +25,7 @@ boss2_search(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_search1, 1, ATTN_NONE, 0);
 	}
@@ -469,7 +469,7 @@ boss2_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss2_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &boss2_move_stand;
 }
 
 void
@@ -480,13 +480,13 @@ boss2_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &boss2_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &boss2_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &boss2_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &boss2_move_run;
 	}
 }
 
@@ -498,7 +498,7 @@ boss2_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss2_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &boss2_move_walk;
 }
 
 void
@@ -517,17 +517,17 @@ boss2_attack(edict_t *self)
 
 	if (range <= 125)
 	{
-		self->monsterinfo.currentmove = &boss2_move_attack_pre_mg;
+		G_EnsureMonsterInfo(self)->currentmove = &boss2_move_attack_pre_mg;
 	}
 	else
 	{
-		if (random() <= 0.6)
+		if (G_Random(RAND_AI) <= 0.6)
 		{
-			self->monsterinfo.currentmove = &boss2_move_attack_pre_mg;
+			G_EnsureMonsterInfo(self)->currentmove = &boss2_move_attack_pre_mg;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &boss2_move_attack_rocket;
+			G_EnsureMonsterInfo(self)->currentmove = &boss2_move_attack_rocket;
 		}
 	}
 }
@@ -540,7 +540,7 @@ boss2_attack_mg(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss2_move_attack_mg;
+	G_EnsureMonsterInfo(self)->currentmove = &boss2_move_attack_mg;
 }
 
 void
@@ -553,18 +553,18 @@ boss2_reattack_mg(edict_t *self)
 
 	if (infront(self, self->enemy))
 	{
-		if (random() <= 0.7)
+		if (G_Random(RAND_AI) <= 0.7)
 		{
-			self->monsterinfo.currentmove = &boss2_move_attack_mg;
+			G_EnsureMonsterInfo(self)->currentmove = &boss2_move_attack_mg;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &boss2_move_attack_post_mg;
+			G_EnsureMonsterInfo(self)->currentmove = &boss2_move_attack_post_mg;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &boss2_move_attack_post_mg;
+		G_EnsureMonsterInfo(self)->currentmove = &boss2_move_attack_post_mg;
 	}
 }
 
@@ -592,17 +592,17 @@ boss2_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage < 10)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain3, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &boss2_move_pain_light;
+		G_EnsureMonsterInfo(self)->currentmove = &boss2_move_pain_light;
 	}
 	else if (damage < 30)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &boss2_move_pain_light;
+		G_EnsureMonsterInfo(self)->currentmove = &boss2_move_pain_light;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &boss2_move_pain_heavy;
+		G_EnsureMonsterInfo(self)->currentmove = &boss2_move_pain_heavy;
 	}
 }
 
@@ -619,7 +619,7 @@ boss2_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -635,7 +635,7 @@ boss2_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* u
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_NO;
 	self->count = 0;
-	self->monsterinfo.currentmove = &boss2_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &boss2_move_death;
 }
 
 qboolean
@@ -661,7 +661,7 @@ Boss2_CheckAttack(edict_t *self)
 		VectorCopy(self->enemy->s.origin, spot2);
 		spot2[2] += self->enemy->viewheight;
 
-		tr = gi.trace( spot1, NULL, NULL, spot2, self,
+		tr = G_Trace( spot1, NULL, NULL, spot2, self,
 				CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_SLIME |
 				CONTENTS_LAVA);
 
@@ -681,25 +681,25 @@ Boss2_CheckAttack(edict_t *self)
 	/* melee attack */
 	if (enemy_range == RANGE_MELEE)
 	{
-		if (self->monsterinfo.melee)
+		if (G_MonsterInfo(self)->melee)
 		{
-			self->monsterinfo.attack_state = AS_MELEE;
+			G_EnsureMonsterInfo(self)->attack_state = AS_MELEE;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_MISSILE;
+			G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
 		}
 
 		return true;
 	}
 
 	/* missile attack */
-	if (!self->monsterinfo.attack)
+	if (!G_MonsterInfo(self)->attack)
 	{
 		return false;
 	}
 
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < G_MonsterInfo(self)->attack_finished)
 	{
 		return false;
 	}
@@ -709,7 +709,7 @@ Boss2_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -726,22 +726,22 @@ Boss2_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (random() < chance)
+	if (G_Random(RAND_AI) < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2 * random();
+		G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
+		G_EnsureMonsterInfo(self)->attack_finished = level.time + 2 * G_Random(RAND_AI);
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
-		if (random() < 0.3)
+		if (G_Random(RAND_AI) < 0.3)
 		{
-			self->monsterinfo.attack_state = AS_SLIDING;
+			G_EnsureMonsterInfo(self)->attack_state = AS_SLIDING;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			G_EnsureMonsterInfo(self)->attack_state = AS_STRAIGHT;
 		}
 	}
 
@@ -788,16 +788,16 @@ SP_monster_boss2(edict_t *self)
 	self->pain = boss2_pain;
 	self->die = boss2_die;
 
-	self->monsterinfo.stand = boss2_stand;
-	self->monsterinfo.walk = boss2_walk;
-	self->monsterinfo.run = boss2_run;
-	self->monsterinfo.attack = boss2_attack;
-	self->monsterinfo.search = boss2_search;
-	self->monsterinfo.checkattack = Boss2_CheckAttack;
-	gi.linkentity(self);
+	G_EnsureMonsterInfo(self)->stand = boss2_stand;
+	G_EnsureMonsterInfo(self)->walk = boss2_walk;
+	G_EnsureMonsterInfo(self)->run = boss2_run;
+	G_EnsureMonsterInfo(self)->attack = boss2_attack;
+	G_EnsureMonsterInfo(self)->search = boss2_search;
+	G_EnsureMonsterInfo(self)->checkattack = Boss2_CheckAttack;
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &boss2_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &boss2_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
@@ -10,10 +10,10 @@ Use_Boss3(edict_t *ent, edict_t *other /* unused */,
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_BOSSTPORT);
-	gi.WritePosition(ent->s.origin);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_BOSSTPORT);
+	G_WritePosition(ent->s.origin);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 	G_FreeEdict(ent);
 }
 
@@ -70,5 +70,5 @@ SP_monster_boss3_stand(edict_t *self)
 	self->use = Use_Boss3;
 	self->think = Think_Boss3Stand;
 	self->nextthink = level.time + FRAMETIME;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
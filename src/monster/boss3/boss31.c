@@ -49,7 +49,7 @@ jorg_search(edict_t *self)
 		return;
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r <= 0.3)
 	{
@@ -179,7 +179,7 @@ jorg_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &jorg_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &jorg_move_stand;
 }
 
 static mframe_t jorg_frames_run[] = {
@@ -270,7 +270,7 @@ jorg_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &jorg_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &jorg_move_walk;
 }
 
 void
@@ -281,13 +281,13 @@ jorg_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &jorg_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &jorg_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &jorg_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &jorg_move_run;
 	}
 }
 
@@ -493,20 +493,20 @@ jorg_reattack1(edict_t *self)
 
 	if (visible(self, self->enemy))
 	{
-		if (random() < 0.9)
+		if (G_Random(RAND_AI) < 0.9)
 		{
-			self->monsterinfo.currentmove = &jorg_move_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &jorg_move_attack1;
 		}
 		else
 		{
 			self->s.sound = 0;
-			self->monsterinfo.currentmove = &jorg_move_end_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &jorg_move_end_attack1;
 		}
 	}
 	else
 	{
 		self->s.sound = 0;
-		self->monsterinfo.currentmove = &jorg_move_end_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &jorg_move_end_attack1;
 	}
 }
 
@@ -518,7 +518,7 @@ jorg_attack1(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &jorg_move_attack1;
+	G_EnsureMonsterInfo(self)->currentmove = &jorg_move_attack1;
 }
 
 void
@@ -546,7 +546,7 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 	   pain frames if he takes little damage */
 	if (damage <= 40)
 	{
-		if (random() <= 0.6)
+		if (G_Random(RAND_AI) <= 0.6)
 		{
 			return;
 		}
@@ -556,7 +556,7 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 	   lessen the chance of him going into pain */
 	if ((self->s.frame >= FRAME_attak101) && (self->s.frame <= FRAME_attak108))
 	{
-		if (random() <= 0.005)
+		if (G_Random(RAND_AI) <= 0.005)
 		{
 			return;
 		}
@@ -564,7 +564,7 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 
 	if ((self->s.frame >= FRAME_attak109) && (self->s.frame <= FRAME_attak114))
 	{
-		if (random() <= 0.00005)
+		if (G_Random(RAND_AI) <= 0.00005)
 		{
 			return;
 		}
@@ -572,7 +572,7 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 
 	if ((self->s.frame >= FRAME_attak201) && (self->s.frame <= FRAME_attak208))
 	{
-		if (random() <= 0.005)
+		if (G_Random(RAND_AI) <= 0.005)
 		{
 			return;
 		}
@@ -588,19 +588,19 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage <= 50)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &jorg_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &jorg_move_pain1;
 	}
 	else if (damage <= 100)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &jorg_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &jorg_move_pain2;
 	}
 	else
 	{
-		if (random() <= 0.3)
+		if (G_Random(RAND_AI) <= 0.3)
 		{
 			gi.sound(self, CHAN_VOICE, sound_pain3, 1, ATTN_NORM, 0);
-			self->monsterinfo.currentmove = &jorg_move_pain3;
+			G_EnsureMonsterInfo(self)->currentmove = &jorg_move_pain3;
 		}
 	}
 }
@@ -698,16 +698,16 @@ jorg_attack(edict_t *self)
 		return;
 	}
 
-	if (random() <= 0.75)
+	if (G_Random(RAND_AI) <= 0.75)
 	{
 		gi.sound(self, CHAN_VOICE, sound_attack1, 1, ATTN_NORM, 0);
 		self->s.sound = gi.soundindex("boss3/w_loop.wav");
-		self->monsterinfo.currentmove = &jorg_move_start_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &jorg_move_start_attack1;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_attack2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &jorg_move_attack2;
+		G_EnsureMonsterInfo(self)->currentmove = &jorg_move_attack2;
 	}
 }
 
@@ -731,7 +731,7 @@ jorg_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* un
 	self->takedamage = DAMAGE_NO;
 	self->s.sound = 0;
 	self->count = 0;
-	self->monsterinfo.currentmove = &jorg_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &jorg_move_death;
 }
 
 qboolean
@@ -757,7 +757,7 @@ Jorg_CheckAttack(edict_t *self)
 		VectorCopy(self->enemy->s.origin, spot2);
 		spot2[2] += self->enemy->viewheight;
 
-		tr = gi.trace(spot1, NULL, NULL, spot2, self,
+		tr = G_Trace(spot1, NULL, NULL, spot2, self,
 				CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_SLIME |
 				CONTENTS_LAVA);
 
@@ -777,25 +777,25 @@ Jorg_CheckAttack(edict_t *self)
 	/* melee attack */
 	if (enemy_range == RANGE_MELEE)
 	{
-		if (self->monsterinfo.melee)
+		if (G_MonsterInfo(self)->melee)
 		{
-			self->monsterinfo.attack_state = AS_MELEE;
+			G_EnsureMonsterInfo(self)->attack_state = AS_MELEE;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_MISSILE;
+			G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
 		}
 
 		return true;
 	}
 
 	/* missile attack */
-	if (!self->monsterinfo.attack)
+	if (!G_MonsterInfo(self)->attack)
 	{
 		return false;
 	}
 
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < G_MonsterInfo(self)->attack_finished)
 	{
 		return false;
 	}
@@ -805,7 +805,7 @@ Jorg_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -822,22 +822,22 @@ Jorg_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (random() < chance)
+	if (G_Random(RAND_AI) < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2 * random();
+		G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
+		G_EnsureMonsterInfo(self)->attack_finished = level.time + 2 * G_Random(RAND_AI);
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
-		if (random() < 0.3)
+		if (G_Random(RAND_AI) < 0.3)
 		{
-			self->monsterinfo.attack_state = AS_SLIDING;
+			G_EnsureMonsterInfo(self)->attack_state = AS_SLIDING;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			G_EnsureMonsterInfo(self)->attack_state = AS_STRAIGHT;
 		}
 	}
 
@@ -891,19 +891,19 @@ SP_monster_jorg(edict_t *self)
 
 	self->pain = jorg_pain;
 	self->die = jorg_die;
-	self->monsterinfo.stand = jorg_stand;
-	self->monsterinfo.walk = jorg_walk;
-	self->monsterinfo.run = jorg_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = jorg_attack;
-	self->monsterinfo.search = jorg_search;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = NULL;
-	self->monsterinfo.checkattack = Jorg_CheckAttack;
-	gi.linkentity(self);
-
-	self->monsterinfo.currentmove = &jorg_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->stand = jorg_stand;
+	G_EnsureMonsterInfo(self)->walk = jorg_walk;
+	G_EnsureMonsterInfo(self)->run = jorg_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = jorg_attack;
+	G_EnsureMonsterInfo(self)->search = jorg_search;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = NULL;
+	G_EnsureMonsterInfo(self)->checkattack = Jorg_CheckAttack;
+	G_LinkEntity(self);
+
+	G_EnsureMonsterInfo(self)->currentmove = &jorg_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -41,7 +41,7 @@ makron_taunt(edict_t *self)
 		return;
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r <= 0.3)
 	{
@@ -136,7 +136,7 @@ makron_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &makron_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &makron_move_stand;
 }
 
 static mframe_t makron_frames_run[] = {
@@ -240,7 +240,7 @@ makron_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &makron_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &makron_move_walk;
 }
 
 void
@@ -251,13 +251,13 @@ makron_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &makron_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &makron_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &makron_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &makron_move_run;
 	}
 }
 
@@ -697,7 +697,7 @@ makron_pain(edict_t *self, edict_t *other /* unused */,
 	   going into his pain frames */
 	if (damage <= 25)
 	{
-		if (random() < 0.2)
+		if (G_Random(RAND_AI) < 0.2)
 		{
 			return;
 		}
@@ -713,29 +713,29 @@ makron_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage <= 40)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain4, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &makron_move_pain4;
+		G_EnsureMonsterInfo(self)->currentmove = &makron_move_pain4;
 	}
 	else if (damage <= 110)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain5, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &makron_move_pain5;
+		G_EnsureMonsterInfo(self)->currentmove = &makron_move_pain5;
 	}
 	else
 	{
 		if (damage <= 150)
 		{
-			if (random() <= 0.45)
+			if (G_Random(RAND_AI) <= 0.45)
 			{
 				gi.sound(self, CHAN_VOICE, sound_pain6, 1, ATTN_NONE, 0);
-				self->monsterinfo.currentmove = &makron_move_pain6;
+				G_EnsureMonsterInfo(self)->currentmove = &makron_move_pain6;
 			}
 		}
 		else
 		{
-			if (random() <= 0.35)
+			if (G_Random(RAND_AI) <= 0.35)
 			{
 				gi.sound(self, CHAN_VOICE, sound_pain6, 1, ATTN_NONE, 0);
-				self->monsterinfo.currentmove = &makron_move_pain6;
+				G_EnsureMonsterInfo(self)->currentmove = &makron_move_pain6;
 			}
 		}
 	}
@@ -756,19 +756,19 @@ makron_attack(edict_t *self)
 		return;
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r <= 0.3)
 	{
-		self->monsterinfo.currentmove = &makron_move_attack3;
+		G_EnsureMonsterInfo(self)->currentmove = &makron_move_attack3;
 	}
 	else if (r <= 0.6)
 	{
-		self->monsterinfo.currentmove = &makron_move_attack4;
+		G_EnsureMonsterInfo(self)->currentmove = &makron_move_attack4;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &makron_move_attack5;
+		G_EnsureMonsterInfo(self)->currentmove = &makron_move_attack5;
 	}
 }
 
@@ -812,7 +812,7 @@ makron_torso_origin(edict_t *self, edict_t *torso)
 	AngleVectors(self->s.angles, v, NULL, NULL);
 	VectorMA(self->s.origin, -84.0f, v, v);
 
-	tr = gi.trace(self->s.origin, torso->mins, torso->maxs, v, self, MASK_SOLID);
+	tr = G_Trace(self->s.origin, torso->mins, torso->maxs, v, self, MASK_SOLID);
 
 	VectorCopy (tr.endpos, torso->s.origin);
 }
@@ -880,7 +880,7 @@ makron_torso(edict_t *self)
 	torso->nextthink = level.time + 2 * FRAMETIME;
 	torso->s.sound = gi.soundindex("makron/spine.wav");
 
-	gi.linkentity(torso);
+	G_LinkEntity(torso);
 }
 
 /* death */
@@ -897,7 +897,7 @@ makron_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -950,9 +950,9 @@ makron_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /*
 
 	/* lower bbox since the torso is gone */
 	self->maxs[2] = 64;
-	gi.linkentity (self);
+	G_LinkEntity (self);
 
-	self->monsterinfo.currentmove = &makron_move_death2;
+	G_EnsureMonsterInfo(self)->currentmove = &makron_move_death2;
 }
 
 qboolean
@@ -978,7 +978,7 @@ Makron_CheckAttack(edict_t *self)
 		VectorCopy(self->enemy->s.origin, spot2);
 		spot2[2] += self->enemy->viewheight;
 
-		tr = gi.trace(spot1, NULL, NULL, spot2, self,
+		tr = G_Trace(spot1, NULL, NULL, spot2, self,
 				CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_SLIME |
 				CONTENTS_LAVA);
 
@@ -998,25 +998,25 @@ Makron_CheckAttack(edict_t *self)
 	/* melee attack */
 	if (enemy_range == RANGE_MELEE)
 	{
-		if (self->monsterinfo.melee)
+		if (G_MonsterInfo(self)->melee)
 		{
-			self->monsterinfo.attack_state = AS_MELEE;
+			G_EnsureMonsterInfo(self)->attack_state = AS_MELEE;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_MISSILE;
+			G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
 		}
 
 		return true;
 	}
 
 	/* missile attack */
-	if (!self->monsterinfo.attack)
+	if (!G_MonsterInfo(self)->attack)
 	{
 		return false;
 	}
 
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < G_MonsterInfo(self)->attack_finished)
 	{
 		return false;
 	}
@@ -1026,7 +1026,7 @@ Makron_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -1043,22 +1043,22 @@ Makron_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (random() < chance)
+	if (G_Random(RAND_AI) < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2 * random();
+		G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
+		G_EnsureMonsterInfo(self)->attack_finished = level.time + 2 * G_Random(RAND_AI);
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
-		if (random() < 0.3)
+		if (G_Random(RAND_AI) < 0.3)
 		{
-			self->monsterinfo.attack_state = AS_SLIDING;
+			G_EnsureMonsterInfo(self)->attack_state = AS_SLIDING;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			G_EnsureMonsterInfo(self)->attack_state = AS_STRAIGHT;
 		}
 	}
 
@@ -1119,19 +1119,19 @@ SP_monster_makron(edict_t *self)
 
 	self->pain = makron_pain;
 	self->die = makron_die;
-	self->monsterinfo.stand = makron_stand;
-	self->monsterinfo.walk = makron_walk;
-	self->monsterinfo.run = makron_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = makron_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = makron_sight;
-	self->monsterinfo.checkattack = Makron_CheckAttack;
+	G_EnsureMonsterInfo(self)->stand = makron_stand;
+	G_EnsureMonsterInfo(self)->walk = makron_walk;
+	G_EnsureMonsterInfo(self)->run = makron_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = makron_attack;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = makron_sight;
+	G_EnsureMonsterInfo(self)->checkattack = Makron_CheckAttack;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &makron_move_sight;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &makron_move_sight;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -1183,7 +1183,7 @@ MakronSpawn(edict_t *self)
 	if (enemy)
 	{
 		FoundTarget(self);
-		VectorCopy(self->pos1, self->monsterinfo.last_sighting);
+		VectorCopy(self->pos1, G_EnsureMonsterInfo(self)->last_sighting);
 	}
 
 	if (enemy && visible(self, enemy))
@@ -1203,11 +1203,11 @@ MakronSpawn(edict_t *self)
 
 	self->groundentity = NULL;
 	self->s.origin[2] += 1;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	self->pain_debounce_time = level.time + 1;
 
-	self->monsterinfo.currentmove = &makron_move_sight;
+	G_EnsureMonsterInfo(self)->currentmove = &makron_move_sight;
 }
 
 /*
@@ -1230,7 +1230,7 @@ MakronToss(edict_t *self)
 	ent->target = self->target;
 	VectorCopy(self->s.origin, ent->s.origin);
 	VectorCopy(self->s.angles, ent->s.angles);
-	VectorCopy(self->monsterinfo.last_sighting, ent->pos1);
+	VectorCopy(G_MonsterInfo(self)->last_sighting, ent->pos1);
 
 	ent->enemy = self->enemy;
 	ent->oldenemy = self->oldenemy;
@@ -41,7 +41,7 @@ boss5_search(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_search1, 1, ATTN_NORM, 0);
 	}
@@ -130,7 +130,7 @@ boss5_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss5_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &boss5_move_stand;
 }
 
 static mframe_t boss5_frames_run[] = {
@@ -198,7 +198,7 @@ boss5_forward(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss5_move_forward;
+	G_EnsureMonsterInfo(self)->currentmove = &boss5_move_forward;
 }
 
 void
@@ -209,7 +209,7 @@ boss5_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss5_move_forward;
+	G_EnsureMonsterInfo(self)->currentmove = &boss5_move_forward;
 }
 
 void
@@ -220,13 +220,13 @@ boss5_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &boss5_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &boss5_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &boss5_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &boss5_move_run;
 	}
 }
 
@@ -530,18 +530,18 @@ boss5_reattack1(edict_t *self)
 
 	if (visible(self, self->enemy))
 	{
-		if (random() < 0.9)
+		if (G_Random(RAND_AI) < 0.9)
 		{
-			self->monsterinfo.currentmove = &boss5_move_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &boss5_move_attack1;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &boss5_move_end_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &boss5_move_end_attack1;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &boss5_move_end_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &boss5_move_end_attack1;
 	}
 }
 
@@ -567,7 +567,7 @@ boss5_pain(edict_t *self, edict_t *other /* unused */,
 	/* Lessen the chance of him going into his pain frames */
 	if (damage <= 25)
 	{
-		if (random() < 0.2)
+		if (G_Random(RAND_AI) < 0.2)
 		{
 			return;
 		}
@@ -588,17 +588,17 @@ boss5_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage <= 10)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &boss5_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &boss5_move_pain1;
 	}
 	else if (damage <= 25)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain3, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &boss5_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &boss5_move_pain2;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &boss5_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &boss5_move_pain3;
 	}
 }
 
@@ -695,18 +695,18 @@ boss5_attack(edict_t *self)
 
 	if (range <= 160)
 	{
-		self->monsterinfo.currentmove = &boss5_move_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &boss5_move_attack1;
 	}
 	else
 	{
 		/* fire rockets more often at distance */
-		if (random() < 0.3)
+		if (G_Random(RAND_AI) < 0.3)
 		{
-			self->monsterinfo.currentmove = &boss5_move_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &boss5_move_attack1;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &boss5_move_attack2;
+			G_EnsureMonsterInfo(self)->currentmove = &boss5_move_attack2;
 		}
 	}
 }
@@ -726,7 +726,7 @@ boss5_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -742,7 +742,7 @@ BossExplode2(edict_t *self)
 
 	self->think = BossExplode2;
 	VectorCopy(self->s.origin, org);
-	org[2] += 24 + (randk() & 15);
+	org[2] += 24 + (G_RandInt(RAND_AI) & 15);
 
 	switch (self->count++)
 	{
@@ -801,10 +801,10 @@ BossExplode2(edict_t *self)
 			return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_EXPLOSION1);
-	gi.WritePosition(org);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_EXPLOSION1);
+	G_WritePosition(org);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	self->nextthink = level.time + 0.1;
 }
@@ -823,7 +823,7 @@ boss5_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_NO;
 	self->count = 0;
-	self->monsterinfo.currentmove = &boss5_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &boss5_move_death;
 }
 
 /*
@@ -864,22 +864,22 @@ SP_monster_boss5(edict_t *self)
 
 	self->pain = boss5_pain;
 	self->die = boss5_die;
-	self->monsterinfo.stand = boss5_stand;
-	self->monsterinfo.walk = boss5_walk;
-	self->monsterinfo.run = boss5_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = boss5_attack;
-	self->monsterinfo.search = boss5_search;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = NULL;
-
-	gi.linkentity(self);
-
-	self->monsterinfo.currentmove = &boss5_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
-
-	self->monsterinfo.power_armor_type = POWER_ARMOR_SHIELD;
-	self->monsterinfo.power_armor_power = 400;
+	G_EnsureMonsterInfo(self)->stand = boss5_stand;
+	G_EnsureMonsterInfo(self)->walk = boss5_walk;
+	G_EnsureMonsterInfo(self)->run = boss5_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = boss5_attack;
+	G_EnsureMonsterInfo(self)->search = boss5_search;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = NULL;
+
+	G_LinkEntity(self);
+
+	G_EnsureMonsterInfo(self)->currentmove = &boss5_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
+
+	G_EnsureMonsterInfo(self)->power_armor_type = POWER_ARMOR_SHIELD;
+	G_EnsureMonsterInfo(self)->power_armor_power = 400;
 
 	walkmonster_start(self);
 }
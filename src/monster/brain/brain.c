@@ -62,7 +62,7 @@ brain_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("brain/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (G_RandInt(RAND_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -148,7 +148,7 @@ brain_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &brain_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &brain_move_stand;
 }
 
 /* IDLE */
@@ -206,11 +206,11 @@ brain_idle(edict_t *self)
 		return;
 	}
 
-	n = randk() & 3;
+	n = G_RandInt(RAND_AI) & 3;
 
 	if (n <= 1)
 	{
-		self->monsterinfo.currentmove = &brain_move_idle;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_idle;
 		gi.sound(self, CHAN_AUTO, sound_idle3, 1, ATTN_IDLE, 0);
 	}
 	else
@@ -252,7 +252,7 @@ brain_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &brain_move_walk1;
+	G_EnsureMonsterInfo(self)->currentmove = &brain_move_walk1;
 }
 
 static mframe_t brain_frames_defense[] = {
@@ -353,15 +353,15 @@ brain_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (G_MonsterInfo(self)->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -372,13 +372,13 @@ brain_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -390,10 +390,10 @@ brain_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t brain_frames_duck[] = {
@@ -423,7 +423,7 @@ brain_dodge(edict_t *self, edict_t *attacker, float eta)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (G_Random(RAND_AI) > 0.25)
 	{
 		return;
 	}
@@ -434,8 +434,8 @@ brain_dodge(edict_t *self, edict_t *attacker, float eta)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.5;
-	self->monsterinfo.currentmove = &brain_move_duck;
+	G_EnsureMonsterInfo(self)->pausetime = level.time + eta + 0.5;
+	G_EnsureMonsterInfo(self)->currentmove = &brain_move_duck;
 }
 
 static mframe_t brain_frames_death2[] = {
@@ -508,7 +508,7 @@ brain_hit_right(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->maxs[0], 8);
 
-	if (fire_hit(self, aim, (15 + (randk() % 5)), 40))
+	if (fire_hit(self, aim, (15 + (G_RandInt(RAND_AI) % 5)), 40))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_melee3, 1, ATTN_NORM, 0);
 	}
@@ -537,7 +537,7 @@ brain_hit_left(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], 8);
 
-	if (fire_hit(self, aim, (15 + (randk() % 5)), 40))
+	if (fire_hit(self, aim, (15 + (G_RandInt(RAND_AI) % 5)), 40))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_melee3, 1, ATTN_NORM, 0);
 	}
@@ -581,7 +581,7 @@ brain_chest_open(edict_t *self)
 	}
 
 	self->spawnflags &= ~65536;
-	self->monsterinfo.power_armor_type = POWER_ARMOR_NONE;
+	G_EnsureMonsterInfo(self)->power_armor_type = POWER_ARMOR_NONE;
 	gi.sound(self, CHAN_BODY, sound_chest_open, 1, ATTN_NORM, 0);
 }
 
@@ -597,7 +597,7 @@ brain_tentacle_attack(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, 0, 8);
 
-	if (fire_hit(self, aim, (10 + (randk() % 5)), -600) && (skill->value > SKILL_EASY))
+	if (fire_hit(self, aim, (10 + (G_RandInt(RAND_AI) % 5)), -600) && (skill->value > SKILL_EASY))
 	{
 		self->spawnflags |= 65536;
 	}
@@ -613,12 +613,12 @@ brain_chest_closed(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.power_armor_type = POWER_ARMOR_SCREEN;
+	G_EnsureMonsterInfo(self)->power_armor_type = POWER_ARMOR_SCREEN;
 
 	if (self->spawnflags & 65536)
 	{
 		self->spawnflags &= ~65536;
-		self->monsterinfo.currentmove = &brain_move_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_attack1;
 	}
 }
 
@@ -658,13 +658,13 @@ brain_melee(edict_t *self)
 		return;
 	}
 
-	if (random() <= 0.5)
+	if (G_Random(RAND_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &brain_move_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_attack1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &brain_move_attack2;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_attack2;
 	}
 }
 
@@ -732,7 +732,7 @@ brain_tounge_attack(edict_t *self)
 
 	VectorCopy(self->enemy->s.origin, end);
 
-	tr = gi.trace(start, NULL, NULL, end, self, MASK_SHOT);
+	tr = G_Trace(start, NULL, NULL, end, self, MASK_SHOT);
 
 	if (tr.ent != self->enemy)
 	{
@@ -742,12 +742,12 @@ brain_tounge_attack(edict_t *self)
 	damage = 5;
 	gi.sound(self, CHAN_WEAPON, sound_tentacles_retract, 1, ATTN_NORM, 0);
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_PARASITE_ATTACK);
-	gi.WriteShort(self - g_edicts);
-	gi.WritePosition(start);
-	gi.WritePosition(end);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_PARASITE_ATTACK);
+	G_WriteShort(self - g_edicts);
+	G_WritePosition(start);
+	G_WritePosition(end);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	VectorSubtract(start, end, dir);
 	T_Damage(self->enemy, self, self, dir, self->enemy->s.origin,
@@ -813,7 +813,7 @@ brain_laserbeam(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.8)
+	if (G_Random(RAND_AI) > 0.8)
 	{
 		gi.sound(self, CHAN_AUTO, gi.soundindex("misc/lasfly.wav"),
 				1, ATTN_STATIC, 0);
@@ -866,7 +866,7 @@ brain_laserbeam_reattack(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		if (visible(self, self->enemy))
 		{
@@ -936,24 +936,24 @@ brain_attack(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.8)
+	if (G_Random(RAND_AI) < 0.8)
 	{
 		r = range(self, self->enemy);
 
 		if (r == RANGE_NEAR)
 		{
-			if (random() < 0.5)
+			if (G_Random(RAND_AI) < 0.5)
 			{
-				self->monsterinfo.currentmove = &brain_move_attack3;
+				G_EnsureMonsterInfo(self)->currentmove = &brain_move_attack3;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &brain_move_attack4;
+				G_EnsureMonsterInfo(self)->currentmove = &brain_move_attack4;
 			}
 		}
 		else if (r > RANGE_NEAR)
 		{
-			self->monsterinfo.currentmove = &brain_move_attack4;
+			G_EnsureMonsterInfo(self)->currentmove = &brain_move_attack4;
 		}
 	}
 }
@@ -990,15 +990,15 @@ brain_run(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.power_armor_type = POWER_ARMOR_SCREEN;
+	G_EnsureMonsterInfo(self)->power_armor_type = POWER_ARMOR_SCREEN;
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &brain_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &brain_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_run;
 	}
 }
 
@@ -1030,22 +1030,22 @@ brain_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r < 0.33)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &brain_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_pain1;
 	}
 	else if (r < 0.66)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &brain_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_pain2;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &brain_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_pain3;
 	}
 }
 
@@ -1062,7 +1062,7 @@ brain_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -1077,7 +1077,7 @@ brain_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* u
 	}
 
 	self->s.effects = 0;
-	self->monsterinfo.power_armor_type = POWER_ARMOR_NONE;
+	G_EnsureMonsterInfo(self)->power_armor_type = POWER_ARMOR_NONE;
 
 	/* check for gib */
 	if (self->health <= self->gib_health)
@@ -1113,13 +1113,13 @@ brain_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* u
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	if (random() <= 0.5)
+	if (G_Random(RAND_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &brain_move_death1;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_death1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &brain_move_death2;
+		G_EnsureMonsterInfo(self)->currentmove = &brain_move_death2;
 	}
 }
 
@@ -1173,23 +1173,23 @@ SP_monster_brain(edict_t *self)
 	self->pain = brain_pain;
 	self->die = brain_die;
 
-	self->monsterinfo.stand = brain_stand;
-	self->monsterinfo.walk = brain_walk;
-	self->monsterinfo.run = brain_run;
-	self->monsterinfo.attack = brain_attack;
-	self->monsterinfo.dodge = brain_dodge;
-	self->monsterinfo.melee = brain_melee;
-	self->monsterinfo.sight = brain_sight;
-	self->monsterinfo.search = brain_search;
-	self->monsterinfo.idle = brain_idle;
+	G_EnsureMonsterInfo(self)->stand = brain_stand;
+	G_EnsureMonsterInfo(self)->walk = brain_walk;
+	G_EnsureMonsterInfo(self)->run = brain_run;
+	G_EnsureMonsterInfo(self)->attack = brain_attack;
+	G_EnsureMonsterInfo(self)->dodge = brain_dodge;
+	G_EnsureMonsterInfo(self)->melee = brain_melee;
+	G_EnsureMonsterInfo(self)->sight = brain_sight;
+	G_EnsureMonsterInfo(self)->search = brain_search;
+	G_EnsureMonsterInfo(self)->idle = brain_idle;
 
-	self->monsterinfo.power_armor_type = POWER_ARMOR_SCREEN;
-	self->monsterinfo.power_armor_power = 100;
+	G_EnsureMonsterInfo(self)->power_armor_type = POWER_ARMOR_SCREEN;
+	G_EnsureMonsterInfo(self)->power_armor_power = 100;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &brain_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &brain_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -66,7 +66,7 @@ chick_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("bitch/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (G_RandInt(RAND_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -85,7 +85,7 @@ ChickMoan(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_idle1, 1, ATTN_IDLE, 0);
 	}
@@ -144,14 +144,14 @@ chick_fidget(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
 		return;
 	}
 
-	if (random() <= 0.3)
+	if (G_Random(RAND_AI) <= 0.3)
 	{
-		self->monsterinfo.currentmove = &chick_move_fidget;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_fidget;
 	}
 }
 
@@ -204,7 +204,7 @@ chick_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_stand;
 }
 
 static mframe_t chick_frames_start_run[] = {
@@ -289,7 +289,7 @@ chick_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_walk;
 }
 
 void
@@ -300,20 +300,20 @@ chick_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &chick_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_stand;
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &chick_move_walk) ||
-		(self->monsterinfo.currentmove == &chick_move_start_run))
+	if ((G_MonsterInfo(self)->currentmove == &chick_move_walk) ||
+		(G_MonsterInfo(self)->currentmove == &chick_move_start_run))
 	{
-		self->monsterinfo.currentmove = &chick_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_run;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &chick_move_start_run;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_start_run;
 	}
 }
 
@@ -404,7 +404,7 @@ chick_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r < 0.33)
 	{
@@ -426,15 +426,15 @@ chick_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (damage <= 10)
 	{
-		self->monsterinfo.currentmove = &chick_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_pain1;
 	}
 	else if (damage <= 25)
 	{
-		self->monsterinfo.currentmove = &chick_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_pain2;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &chick_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_pain3;
 	}
 }
 
@@ -451,7 +451,7 @@ chick_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static void
@@ -568,16 +568,16 @@ chick_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	n = randk() % 2;
+	n = G_RandInt(RAND_AI) % 2;
 
 	if (n == 0)
 	{
-		self->monsterinfo.currentmove = &chick_move_death1;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_death1;
 		gi.sound(self, CHAN_VOICE, sound_death1, 1, ATTN_NORM, 0);
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &chick_move_death2;
+		G_EnsureMonsterInfo(self)->currentmove = &chick_move_death2;
 		gi.sound(self, CHAN_VOICE, sound_death2, 1, ATTN_NORM, 0);
 	}
 }
@@ -590,16 +590,16 @@ chick_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (G_MonsterInfo(self)->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.linkentity(self);
+	G_EnsureMonsterInfo(self)->pausetime = level.time + 1;
+	G_LinkEntity(self);
 }
 
 void
@@ -610,13 +610,13 @@ chick_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -628,10 +628,10 @@ chick_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t chick_frames_duck[] = {
@@ -660,7 +660,7 @@ chick_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (G_Random(RAND_AI) > 0.25)
 	{
 		return;
 	}
@@ -671,7 +671,7 @@ chick_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.currentmove = &chick_move_duck;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_duck;
 }
 
 void
@@ -686,7 +686,7 @@ ChickSlash(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], 10);
 	gi.sound(self, CHAN_WEAPON, sound_melee_swing, 1, ATTN_NORM, 0);
-	fire_hit(self, aim, (10 + (randk() % 6)), 100);
+	fire_hit(self, aim, (10 + (G_RandInt(RAND_AI) % 6)), 100);
 }
 
 void
@@ -822,16 +822,16 @@ chick_rerocket(edict_t *self)
 		{
 			if (visible(self, self->enemy))
 			{
-				if (random() <= 0.6)
+				if (G_Random(RAND_AI) <= 0.6)
 				{
-					self->monsterinfo.currentmove = &chick_move_attack1;
+					G_EnsureMonsterInfo(self)->currentmove = &chick_move_attack1;
 					return;
 				}
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &chick_move_end_attack1;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_end_attack1;
 }
 
 void
@@ -842,7 +842,7 @@ chick_attack1(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_attack1;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_attack1;
 }
 
 static mframe_t chick_frames_slash[] = {
@@ -892,20 +892,20 @@ chick_reslash(edict_t *self)
 	{
 		if (range(self, self->enemy) == RANGE_MELEE)
 		{
-			if (random() <= 0.9)
+			if (G_Random(RAND_AI) <= 0.9)
 			{
-				self->monsterinfo.currentmove = &chick_move_slash;
+				G_EnsureMonsterInfo(self)->currentmove = &chick_move_slash;
 				return;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &chick_move_end_slash;
+				G_EnsureMonsterInfo(self)->currentmove = &chick_move_end_slash;
 				return;
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &chick_move_end_slash;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_end_slash;
 }
 
 void
@@ -916,7 +916,7 @@ chick_slash(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_slash;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_slash;
 }
 
 static mframe_t chick_frames_start_slash[] = {
@@ -941,7 +941,7 @@ chick_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_start_slash;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_start_slash;
 }
 
 void
@@ -952,7 +952,7 @@ chick_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_start_attack1;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_start_attack1;
 }
 
 void
@@ -1017,19 +1017,19 @@ SP_monster_chick(edict_t *self)
 	self->pain = chick_pain;
 	self->die = chick_die;
 
-	self->monsterinfo.stand = chick_stand;
-	self->monsterinfo.walk = chick_walk;
-	self->monsterinfo.run = chick_run;
-	self->monsterinfo.dodge = chick_dodge;
-	self->monsterinfo.attack = chick_attack;
-	self->monsterinfo.melee = chick_melee;
-	self->monsterinfo.sight = chick_sight;
-	self->monsterinfo.search = chick_search;
+	G_EnsureMonsterInfo(self)->stand = chick_stand;
+	G_EnsureMonsterInfo(self)->walk = chick_walk;
+	G_EnsureMonsterInfo(self)->run = chick_run;
+	G_EnsureMonsterInfo(self)->dodge = chick_dodge;
+	G_EnsureMonsterInfo(self)->attack = chick_attack;
+	G_EnsureMonsterInfo(self)->melee = chick_melee;
+	G_EnsureMonsterInfo(self)->sight = chick_sight;
+	G_EnsureMonsterInfo(self)->search = chick_search;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &chick_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &chick_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
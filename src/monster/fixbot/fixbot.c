@@ -55,7 +55,7 @@ void ED_CallSpawn(edict_t *ent);
 float
 crand(void)
 {
-	return (randk() & 32767) * (2.0 / 32767) - 1;
+	return (G_RandInt(RAND_AI) & 32767) * (2.0 / 32767) - 1;
 }
 
 edict_t *
@@ -81,7 +81,7 @@ fixbot_FindDeadMonster(edict_t *self)
 			continue;
 		}
 
-		if (ent->monsterinfo.aiflags & AI_GOOD_GUY)
+		if (G_MonsterInfo(ent)->aiflags & AI_GOOD_GUY)
 		{
 			continue;
 		}
@@ -142,7 +142,7 @@ fixbot_search(edict_t *self)
 			self->oldenemy = self->enemy;
 			self->enemy = ent;
 			self->enemy->owner = self;
-			self->monsterinfo.aiflags |= AI_MEDIC;
+			G_EnsureMonsterInfo(self)->aiflags |= AI_MEDIC;
 			FoundTarget(self);
 			return 1;
 		}
@@ -202,20 +202,20 @@ landing_goal(edict_t *self)
 	ent = make_bot_goal(self);
 	VectorSet(ent->mins, -32, -32, -24);
 	VectorSet(ent->maxs, 32, 32, 24);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	AngleVectors(self->s.angles, forward, right, up);
 	VectorMA(self->s.origin, 32, forward, end);
 	VectorMA(self->s.origin, -8096, up, end);
 
-	tr = gi.trace(self->s.origin, ent->mins, ent->maxs,
+	tr = G_Trace(self->s.origin, ent->mins, ent->maxs,
 			end, self, MASK_MONSTERSOLID);
 
 	VectorCopy(tr.endpos, ent->s.origin);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	self->goalentity = self->enemy = ent;
-	self->monsterinfo.currentmove = &fixbot_move_landing;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_landing;
 }
 
 void
@@ -235,20 +235,20 @@ takeoff_goal(edict_t *self)
 
 	VectorSet(ent->mins, -32, -32, -24);
 	VectorSet(ent->maxs, 32, 32, 24);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	AngleVectors(self->s.angles, forward, right, up);
 	VectorMA(self->s.origin, 32, forward, end);
 	VectorMA(self->s.origin, 128, up, end);
 
-	tr = gi.trace(self->s.origin, ent->mins, ent->maxs,
+	tr = G_Trace(self->s.origin, ent->mins, ent->maxs,
 			end, self, MASK_MONSTERSOLID);
 
 	VectorCopy(tr.endpos, ent->s.origin);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	self->goalentity = self->enemy = ent;
-	self->monsterinfo.currentmove = &fixbot_move_takeoff;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_takeoff;
 }
 
 void
@@ -264,31 +264,31 @@ change_to_roam(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &fixbot_move_roamgoal;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_roamgoal;
 
 	if (self->spawnflags & 16)
 	{
 		landing_goal(self);
-		self->monsterinfo.currentmove = &fixbot_move_landing;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_landing;
 		self->spawnflags = 32;
 	}
 
 	if (self->spawnflags & 8)
 	{
 		takeoff_goal(self);
-		self->monsterinfo.currentmove = &fixbot_move_takeoff;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_takeoff;
 		self->spawnflags = 32;
 	}
 
 	if (self->spawnflags & 4)
 	{
-		self->monsterinfo.currentmove = &fixbot_move_roamgoal;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_roamgoal;
 		self->spawnflags = 32;
 	}
 
 	if (!self->spawnflags)
 	{
-		self->monsterinfo.currentmove = &fixbot_move_stand2;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand2;
 	}
 }
 
@@ -329,7 +329,7 @@ roam_goal(edict_t *self)
 		AngleVectors(dang, forward, NULL, NULL);
 		VectorMA(self->s.origin, 8192, forward, end);
 
-		tr = gi.trace(self->s.origin, NULL, NULL, end, self, MASK_SHOT);
+		tr = G_Trace(self->s.origin, NULL, NULL, end, self, MASK_SHOT);
 
 		VectorSubtract(self->s.origin, tr.endpos, vec);
 		len = VectorLength(vec);
@@ -343,11 +343,11 @@ roam_goal(edict_t *self)
 
 	ent = make_bot_goal(self);
 	VectorCopy(whichvec, ent->s.origin);
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	self->goalentity = self->enemy = ent;
 
-	self->monsterinfo.currentmove = &fixbot_move_turn;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_turn;
 }
 
 void
@@ -384,6 +384,7 @@ use_scanner(edict_t *self)
 			/* remove the old one */
 			if (strcmp(self->goalentity->classname, "bot_goal") == 0)
 			{
+				G_MarkEdictDirty(self->goalentity);
 				self->goalentity->nextthink = level.time + 0.1;
 				self->goalentity->think = G_FreeEdict;
 			}
@@ -400,7 +401,7 @@ use_scanner(edict_t *self)
 
 		if (VectorLength(vec) < 56)
 		{
-			self->monsterinfo.currentmove = &fixbot_move_weld_start;
+			G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_weld_start;
 			return;
 		}
 	}
@@ -410,11 +411,12 @@ use_scanner(edict_t *self)
 
 		if (self->goalentity->touch_debounce_time < level.time || VectorLength(vec) < 32)
 		{
+			G_MarkEdictDirty(self->goalentity);
 			self->goalentity->nextthink = level.time + 0.1;
 			self->goalentity->think = G_FreeEdict;
 			self->goalentity = self->enemy = NULL;
 
-			self->monsterinfo.currentmove = &fixbot_move_stand;
+			G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
 
 			return;
 		}
@@ -439,6 +441,7 @@ use_scanner(edict_t *self)
 
 		if (strcmp(self->goalentity->classname, "bot_goal") == 0)
 		{
+			G_MarkEdictDirty(self->goalentity);
 			self->goalentity->nextthink = level.time + 0.1;
 			self->goalentity->think = G_FreeEdict;
 			self->goalentity = self->enemy = NULL;
@@ -449,7 +452,7 @@ use_scanner(edict_t *self)
 			self->fly_sound_debounce_time = level.time + FIXBOT_WELD_GOAL_TIMEOUT;
 		}
 
-		self->monsterinfo.currentmove = &fixbot_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
 	}
 }
 
@@ -482,27 +485,27 @@ blastoff(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	hspread += (self->s.frame - FRAME_takeoff_01);
 	vspread += (self->s.frame - FRAME_takeoff_01);
 
-	tr = gi.trace(self->s.origin, NULL, NULL, start, self, MASK_SHOT);
+	tr = G_Trace(self->s.origin, NULL, NULL, start, self, MASK_SHOT);
 
 	if (!(tr.fraction < 1.0))
 	{
 		vectoangles(aimdir, dir);
 		AngleVectors(dir, forward, right, up);
 
-		r = crandom() * hspread;
-		u = crandom() * vspread;
+		r = G_CRandom(RAND_AI) * hspread;
+		u = G_CRandom(RAND_AI) * vspread;
 		VectorMA(start, 8192, forward, end);
 		VectorMA(end, r, right, end);
 		VectorMA(end, u, up, end);
 
-		if (gi.pointcontents(start) & MASK_WATER)
+		if (G_PointContents(start) & MASK_WATER)
 		{
 			water = true;
 			VectorCopy(start, water_start);
 			content_mask &= ~MASK_WATER;
 		}
 
-		tr = gi.trace(start, NULL, NULL, end, self, content_mask);
+		tr = G_Trace(start, NULL, NULL, end, self, content_mask);
 
 		/* see if we hit water */
 		if (tr.contents & MASK_WATER)
@@ -540,28 +543,28 @@ blastoff(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 
 				if (color != SPLASH_UNKNOWN)
 				{
-					gi.WriteByte(svc_temp_entity);
-					gi.WriteByte(TE_SPLASH);
-					gi.WriteByte(8);
-					gi.WritePosition(tr.endpos);
-					gi.WriteDir(tr.plane.normal);
-					gi.WriteByte(color);
-					gi.multicast(tr.endpos, MULTICAST_PVS);
+					G_WriteByte(svc_temp_entity);
+					G_WriteByte(TE_SPLASH);
+					G_WriteByte(8);
+					G_WritePosition(tr.endpos);
+					G_WriteDir(tr.plane.normal);
+					G_WriteByte(color);
+					G_Multicast(tr.endpos, MULTICAST_PVS);
 				}
 
 				/* change bullet's course when it enters water */
 				VectorSubtract(end, start, dir);
 				vectoangles(dir, dir);
 				AngleVectors(dir, forward, right, up);
-				r = crandom() * hspread * 2;
-				u = crandom() * vspread * 2;
+				r = G_CRandom(RAND_AI) * hspread * 2;
+				u = G_CRandom(RAND_AI) * vspread * 2;
 				VectorMA(water_start, 8192, forward, end);
 				VectorMA(end, r, right, end);
 				VectorMA(end, u, up, end);
 			}
 
 			/* re-trace ignoring water this time */
-			tr = gi.trace(water_start, NULL, NULL, end, self, MASK_SHOT);
+			tr = G_Trace(water_start, NULL, NULL, end, self, MASK_SHOT);
 		}
 	}
 
@@ -579,11 +582,11 @@ blastoff(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 			{
 				if (strncmp(tr.surface->name, "sky", 3) != 0)
 				{
-					gi.WriteByte(svc_temp_entity);
-					gi.WriteByte(te_impact);
-					gi.WritePosition(tr.endpos);
-					gi.WriteDir(tr.plane.normal);
-					gi.multicast(tr.endpos, MULTICAST_PVS);
+					G_WriteByte(svc_temp_entity);
+					G_WriteByte(te_impact);
+					G_WritePosition(tr.endpos);
+					G_WriteDir(tr.plane.normal);
+					G_Multicast(tr.endpos, MULTICAST_PVS);
 
 					if (self->client)
 					{
@@ -604,23 +607,23 @@ blastoff(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 		VectorNormalize(dir);
 		VectorMA(tr.endpos, -2, dir, pos);
 
-		if (gi.pointcontents(pos) & MASK_WATER)
+		if (G_PointContents(pos) & MASK_WATER)
 		{
 			VectorCopy(pos, tr.endpos);
 		}
 		else
 		{
-			tr = gi.trace(pos, NULL, NULL, water_start, tr.ent, MASK_WATER);
+			tr = G_Trace(pos, NULL, NULL, water_start, tr.ent, MASK_WATER);
 		}
 
 		VectorAdd(water_start, tr.endpos, pos);
 		VectorScale(pos, 0.5, pos);
 
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_BUBBLETRAIL);
-		gi.WritePosition(water_start);
-		gi.WritePosition(tr.endpos);
-		gi.multicast(pos, MULTICAST_PVS);
+		G_WriteByte(svc_temp_entity);
+		G_WriteByte(TE_BUBBLETRAIL);
+		G_WritePosition(water_start);
+		G_WritePosition(tr.endpos);
+		G_Multicast(pos, MULTICAST_PVS);
 	}
 }
 
@@ -645,9 +648,10 @@ fly_vertical(edict_t *self)
 	if ((self->s.frame == FRAME_landing_58) ||
 		(self->s.frame == FRAME_takeoff_16))
 	{
+		G_MarkEdictDirty(self->goalentity);
 		self->goalentity->nextthink = level.time + 0.1;
 		self->goalentity->think = G_FreeEdict;
-		self->monsterinfo.currentmove = &fixbot_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
 		self->goalentity = self->enemy = NULL;
 	}
 
@@ -683,9 +687,10 @@ fly_vertical2(edict_t *self)
 
 	if (len < 32)
 	{
+		G_MarkEdictDirty(self->goalentity);
 		self->goalentity->nextthink = level.time + 0.1;
 		self->goalentity->think = G_FreeEdict;
-		self->monsterinfo.currentmove = &fixbot_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
 		self->goalentity = self->enemy = NULL;
 	}
 }
@@ -893,7 +898,7 @@ ai_facing(edict_t *self, float dist)
 
 	if (infront(self, self->goalentity))
 	{
-		self->monsterinfo.currentmove = &fixbot_move_forward;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_forward;
 	}
 	else
 	{
@@ -922,7 +927,7 @@ go_roam(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &fixbot_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
 }
 
 /* takeoff */
@@ -1129,7 +1134,7 @@ check_telefrag(edict_t *self)
 	AngleVectors(self->enemy->s.angles, NULL, NULL, up);
 	VectorMA(self->enemy->s.origin, 48, up, end);
 
-	tr = gi.trace(self->enemy->s.origin, self->enemy->mins, self->enemy->maxs,
+	tr = G_Trace(self->enemy->s.origin, self->enemy->mins, self->enemy->maxs,
 			end, self, MASK_MONSTERSOLID);
 
 	if (tr.ent && tr.ent->takedamage)
@@ -1162,8 +1167,8 @@ fixbot_fire_laser(edict_t *self)
 	/* critter dun got blown up while bein' fixed */
 	if (self->enemy->health <= self->enemy->gib_health)
 	{
-		self->monsterinfo.currentmove = &fixbot_move_stand;
-		self->monsterinfo.aiflags &= ~AI_MEDIC;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_MEDIC;
 		return;
 	}
 
@@ -1195,7 +1200,7 @@ fixbot_fire_laser(edict_t *self)
 		if (check_telefrag(self))
 		{
 			self->enemy->spawnflags = 0;
-			self->enemy->monsterinfo.aiflags = 0;
+			G_EnsureMonsterInfo(self->enemy)->aiflags = 0;
 			self->enemy->target = NULL;
 			self->enemy->targetname = NULL;
 			self->enemy->combattarget = NULL;
@@ -1205,15 +1210,15 @@ fixbot_fire_laser(edict_t *self)
 			self->enemy->owner = NULL;
 			self->s.origin[2] += 1;
 
-			self->enemy->monsterinfo.aiflags &= ~AI_RESURRECTING;
+			G_EnsureMonsterInfo(self->enemy)->aiflags &= ~AI_RESURRECTING;
 
-			self->monsterinfo.currentmove = &fixbot_move_stand;
-			self->monsterinfo.aiflags &= ~AI_MEDIC;
+			G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_MEDIC;
 		}
 	}
 	else
 	{
-		self->enemy->monsterinfo.aiflags |= AI_RESURRECTING;
+		G_EnsureMonsterInfo(self->enemy)->aiflags |= AI_RESURRECTING;
 	}
 }
 
@@ -1289,14 +1294,14 @@ weldstate(edict_t *self)
 
 	if (self->s.frame == FRAME_weldstart_10)
 	{
-		self->monsterinfo.currentmove = &fixbot_move_weld;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_weld;
 	}
 	else if (self->s.frame == FRAME_weldmiddle_07)
 	{
 		if (self->goalentity->health < 0)
 		{
 			self->enemy->owner = NULL;
-			self->monsterinfo.currentmove = &fixbot_move_weld_end;
+			G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_weld_end;
 		}
 		else
 		{
@@ -1306,7 +1311,7 @@ weldstate(edict_t *self)
 	else
 	{
 		self->goalentity = self->enemy = NULL;
-		self->monsterinfo.currentmove = &fixbot_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
 	}
 }
 
@@ -1409,17 +1414,17 @@ fixbot_fire_welder(edict_t *self)
 	AngleVectors(self->s.angles, forward, right, up);
 	G_ProjectSource(self->s.origin, vec, forward, right, start);
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_WELDING_SPARKS);
-	gi.WriteByte(10);
-	gi.WritePosition(start);
-	gi.WriteDir(vec3_origin);
-	gi.WriteByte(0xe0 + (randk() & 7));
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_WELDING_SPARKS);
+	G_WriteByte(10);
+	G_WritePosition(start);
+	G_WriteDir(vec3_origin);
+	G_WriteByte(0xe0 + (G_RandInt(RAND_EFFECT) & 7));
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
-	if (random() > 0.8)
+	if (G_Random(RAND_AI) > 0.8)
 	{
-		r = random();
+		r = G_Random(RAND_AI);
 
 		if (r < 0.33)
 		{
@@ -1451,7 +1456,7 @@ fixbot_fire_blaster(edict_t *self)
 
 	if (!visible(self, self->enemy))
 	{
-		self->monsterinfo.currentmove = &fixbot_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_run;
 	}
 
 	AngleVectors(self->s.angles, forward, right, up);
@@ -1474,7 +1479,7 @@ fixbot_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &fixbot_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
 }
 
 void
@@ -1485,13 +1490,13 @@ fixbot_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &fixbot_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &fixbot_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_run;
 	}
 }
 
@@ -1513,12 +1518,12 @@ fixbot_walk(edict_t *self)
 
 		if (len < 32)
 		{
-			self->monsterinfo.currentmove = &fixbot_move_weld_start;
+			G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_weld_start;
 			return;
 		}
 	}
 
-	self->monsterinfo.currentmove = &fixbot_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_walk;
 }
 
 void
@@ -1529,7 +1534,7 @@ fixbot_start_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &fixbot_move_start_attack;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_start_attack;
 }
 
 void
@@ -1543,7 +1548,7 @@ fixbot_attack(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_MEDIC)
+	if (G_MonsterInfo(self)->aiflags & AI_MEDIC)
 	{
 		if (!visible(self, self->goalentity))
 		{
@@ -1559,12 +1564,12 @@ fixbot_attack(edict_t *self)
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &fixbot_move_laserattack;
+			G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_laserattack;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &fixbot_move_attack2;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_attack2;
 	}
 }
 
@@ -1587,15 +1592,15 @@ fixbot_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (damage <= 10)
 	{
-		self->monsterinfo.currentmove = &fixbot_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_pain3;
 	}
 	else if (damage <= 25)
 	{
-		self->monsterinfo.currentmove = &fixbot_move_painb;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_painb;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &fixbot_move_paina;
+		G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_paina;
 	}
 }
 
@@ -1612,7 +1617,7 @@ fixbot_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -1667,15 +1672,15 @@ SP_monster_fixbot(edict_t *self)
 	self->pain = fixbot_pain;
 	self->die = fixbot_die;
 
-	self->monsterinfo.stand = fixbot_stand;
-	self->monsterinfo.walk = fixbot_walk;
-	self->monsterinfo.run = fixbot_run;
-	self->monsterinfo.attack = fixbot_attack;
+	G_EnsureMonsterInfo(self)->stand = fixbot_stand;
+	G_EnsureMonsterInfo(self)->walk = fixbot_walk;
+	G_EnsureMonsterInfo(self)->run = fixbot_run;
+	G_EnsureMonsterInfo(self)->attack = fixbot_attack;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &fixbot_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &fixbot_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
@@ -52,7 +52,7 @@ flipper_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &flipper_move_stand;
 }
 
 static mframe_t flipper_frames_run[] = {
@@ -99,7 +99,7 @@ flipper_run_loop(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_run_loop;
+	G_EnsureMonsterInfo(self)->currentmove = &flipper_move_run_loop;
 }
 
 static mframe_t flipper_frames_run_start[] = {
@@ -126,7 +126,7 @@ flipper_run(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_run_start;
+	G_EnsureMonsterInfo(self)->currentmove = &flipper_move_run_start;
 }
 
 void
@@ -183,7 +183,7 @@ flipper_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &flipper_move_walk;
 }
 
 static mframe_t flipper_frames_start_run[] = {
@@ -208,7 +208,7 @@ flipper_start_run(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_start_run;
+	G_EnsureMonsterInfo(self)->currentmove = &flipper_move_start_run;
 }
 
 static mframe_t flipper_frames_pain2[] = {
@@ -304,7 +304,7 @@ flipper_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_attack;
+	G_EnsureMonsterInfo(self)->currentmove = &flipper_move_attack;
 }
 
 void
@@ -335,17 +335,17 @@ flipper_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	n = (randk() + 1) % 2;
+	n = (G_RandInt(RAND_AI) + 1) % 2;
 
 	if (n == 0)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flipper_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &flipper_move_pain1;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flipper_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &flipper_move_pain2;
 	}
 }
 
@@ -366,14 +366,14 @@ flipper_dead(edict_t *self)
 	p[1] = self->s.origin[1];
 	p[2] = self->s.origin[2] - 8;
 
-	tr = gi.trace(self->s.origin, self->mins, self->maxs, p, self, self->clipmask);
+	tr = G_Trace(self->s.origin, self->mins, self->maxs, p, self, self->clipmask);
 
 	self->mins[2] = tr.endpos[2] - self->s.origin[2];
 
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t flipper_frames_death[] = {
@@ -502,7 +502,7 @@ flipper_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /*
 	gi.sound(self, CHAN_VOICE, sound_death, 1, ATTN_NORM, 0);
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.currentmove = &flipper_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &flipper_move_death;
 }
 
 /*
@@ -544,18 +544,18 @@ SP_monster_flipper(edict_t *self)
 	self->pain = flipper_pain;
 	self->die = flipper_die;
 
-	self->monsterinfo.stand = flipper_stand;
-	self->monsterinfo.walk = flipper_walk;
-	self->monsterinfo.run = flipper_start_run;
-	self->monsterinfo.melee = flipper_melee;
-	self->monsterinfo.sight = flipper_sight;
-	self->monsterinfo.idle = flipper_idle;
-	self->monsterinfo.search = flipper_search;
+	G_EnsureMonsterInfo(self)->stand = flipper_stand;
+	G_EnsureMonsterInfo(self)->walk = flipper_walk;
+	G_EnsureMonsterInfo(self)->run = flipper_start_run;
+	G_EnsureMonsterInfo(self)->melee = flipper_melee;
+	G_EnsureMonsterInfo(self)->sight = flipper_sight;
+	G_EnsureMonsterInfo(self)->idle = flipper_idle;
+	G_EnsureMonsterInfo(self)->search = flipper_search;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &flipper_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &flipper_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	swimmonster_start(self);
 }
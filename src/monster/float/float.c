@@ -211,13 +211,13 @@ floater_stand(edict_t *self)
 		return;
 	}
 
-	if (random() <= 0.5)
+	if (G_Random(RAND_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &floater_move_stand1;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_stand1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &floater_move_stand2;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_stand2;
 	}
 }
 
@@ -576,13 +576,13 @@ floater_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &floater_move_stand1;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_stand1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &floater_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_run;
 	}
 }
 
@@ -594,7 +594,7 @@ floater_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &floater_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &floater_move_walk;
 }
 
 void
@@ -608,7 +608,7 @@ floater_wham(edict_t *self)
 	}
 
 	gi.sound(self, CHAN_WEAPON, sound_attack3, 1, ATTN_NORM, 0);
-	fire_hit(self, aim, 5 + randk() % 6, -50);
+	fire_hit(self, aim, 5 + G_RandInt(RAND_AI) % 6, -50);
 }
 
 void
@@ -632,19 +632,19 @@ floater_zap(edict_t *self)
 
 	gi.sound(self, CHAN_WEAPON, sound_attack2, 1, ATTN_NORM, 0);
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_SPLASH);
-	gi.WriteByte(32);
-	gi.WritePosition(origin);
-	gi.WriteDir(dir);
-	gi.WriteByte(1); /* sparks */
-	gi.multicast(origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_SPLASH);
+	G_WriteByte(32);
+	G_WritePosition(origin);
+	G_WriteDir(dir);
+	G_WriteByte(1); /* sparks */
+	G_Multicast(origin, MULTICAST_PVS);
 
 	if (range(self, self->enemy) == RANGE_MELEE && infront(self, self->enemy) &&
 			visible(self, self->enemy))
 	{
 		T_Damage(self->enemy, self, self, dir, self->enemy->s.origin,
-				vec3_origin, 5 + randk() % 6, -10, DAMAGE_ENERGY,
+				vec3_origin, 5 + G_RandInt(RAND_AI) % 6, -10, DAMAGE_ENERGY,
 				MOD_UNKNOWN);
 	}
 }
@@ -657,7 +657,7 @@ floater_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &floater_move_attack1;
+	G_EnsureMonsterInfo(self)->currentmove = &floater_move_attack1;
 }
 
 void
@@ -668,13 +668,13 @@ floater_melee(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &floater_move_attack3;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_attack3;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &floater_move_attack2;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_attack2;
 	}
 }
 
@@ -706,17 +706,17 @@ floater_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	n = (randk() + 1) % 3;
+	n = (G_RandInt(RAND_AI) + 1) % 3;
 
 	if (n == 0)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &floater_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_pain1;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &floater_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_pain2;
 	}
 }
 
@@ -733,7 +733,7 @@ floater_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -791,26 +791,26 @@ SP_monster_floater(edict_t *self)
 	self->pain = floater_pain;
 	self->die = floater_die;
 
-	self->monsterinfo.stand = floater_stand;
-	self->monsterinfo.walk = floater_walk;
-	self->monsterinfo.run = floater_run;
-	self->monsterinfo.attack = floater_attack;
-	self->monsterinfo.melee = floater_melee;
-	self->monsterinfo.sight = floater_sight;
-	self->monsterinfo.idle = floater_idle;
+	G_EnsureMonsterInfo(self)->stand = floater_stand;
+	G_EnsureMonsterInfo(self)->walk = floater_walk;
+	G_EnsureMonsterInfo(self)->run = floater_run;
+	G_EnsureMonsterInfo(self)->attack = floater_attack;
+	G_EnsureMonsterInfo(self)->melee = floater_melee;
+	G_EnsureMonsterInfo(self)->sight = floater_sight;
+	G_EnsureMonsterInfo(self)->idle = floater_idle;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	if (random() <= 0.5)
+	if (G_Random(RAND_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &floater_move_stand1;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_stand1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &floater_move_stand2;
+		G_EnsureMonsterInfo(self)->currentmove = &floater_move_stand2;
 	}
 
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
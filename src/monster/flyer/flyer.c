@@ -230,13 +230,13 @@ flyer_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &flyer_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &flyer_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_run;
 	}
 }
 
@@ -248,7 +248,7 @@ flyer_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_walk;
 }
 
 void
@@ -259,7 +259,7 @@ flyer_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_stand;
 }
 
 static mframe_t flyer_frames_start[] = {
@@ -303,7 +303,7 @@ flyer_stop(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_stop;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_stop;
 }
 
 void
@@ -314,7 +314,7 @@ flyer_start(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_start;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_start;
 }
 
 static mframe_t flyer_frames_rollright[] = {
@@ -625,7 +625,7 @@ flyer_loop_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_loop_melee;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_loop_melee;
 }
 
 void
@@ -636,7 +636,7 @@ flyer_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_attack2;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_attack2;
 }
 
 void
@@ -648,7 +648,7 @@ flyer_setstart(edict_t *self)
 	}
 
 	nextmove = ACTION_run;
-	self->monsterinfo.currentmove = &flyer_move_start;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_start;
 }
 
 void
@@ -661,15 +661,15 @@ flyer_nextmove(edict_t *self)
 
 	if (nextmove == ACTION_attack1)
 	{
-		self->monsterinfo.currentmove = &flyer_move_start_melee;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_start_melee;
 	}
 	else if (nextmove == ACTION_attack2)
 	{
-		self->monsterinfo.currentmove = &flyer_move_attack2;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_attack2;
 	}
 	else if (nextmove == ACTION_run)
 	{
-		self->monsterinfo.currentmove = &flyer_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_run;
 	}
 }
 
@@ -681,7 +681,7 @@ flyer_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_start_melee;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_start_melee;
 }
 
 void
@@ -694,18 +694,18 @@ flyer_check_melee(edict_t *self)
 
 	if (range(self, self->enemy) == RANGE_MELEE)
 	{
-		if (random() <= 0.8)
+		if (G_Random(RAND_AI) <= 0.8)
 		{
-			self->monsterinfo.currentmove = &flyer_move_loop_melee;
+			G_EnsureMonsterInfo(self)->currentmove = &flyer_move_loop_melee;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &flyer_move_end_melee;
+			G_EnsureMonsterInfo(self)->currentmove = &flyer_move_end_melee;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &flyer_move_end_melee;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_end_melee;
 	}
 }
 
@@ -737,22 +737,22 @@ flyer_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	n = randk() % 3;
+	n = G_RandInt(RAND_AI) % 3;
 
 	if (n == 0)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flyer_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_pain1;
 	}
 	else if (n == 1)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flyer_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_pain2;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flyer_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &flyer_move_pain3;
 	}
 }
 
@@ -811,18 +811,18 @@ SP_monster_flyer(edict_t *self)
 	self->pain = flyer_pain;
 	self->die = flyer_die;
 
-	self->monsterinfo.stand = flyer_stand;
-	self->monsterinfo.walk = flyer_walk;
-	self->monsterinfo.run = flyer_run;
-	self->monsterinfo.attack = flyer_attack;
-	self->monsterinfo.melee = flyer_melee;
-	self->monsterinfo.sight = flyer_sight;
-	self->monsterinfo.idle = flyer_idle;
+	G_EnsureMonsterInfo(self)->stand = flyer_stand;
+	G_EnsureMonsterInfo(self)->walk = flyer_walk;
+	G_EnsureMonsterInfo(self)->run = flyer_run;
+	G_EnsureMonsterInfo(self)->attack = flyer_attack;
+	G_EnsureMonsterInfo(self)->melee = flyer_melee;
+	G_EnsureMonsterInfo(self)->sight = flyer_sight;
+	G_EnsureMonsterInfo(self)->idle = flyer_idle;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &flyer_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &flyer_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
@@ -102,7 +102,7 @@ gekk_check_jump(edict_t *self)
 
 	if (distance > 100)
 	{
-		if (random() < 0.9)
+		if (G_Random(RAND_AI) < 0.9)
 		{
 			return false;
 		}
@@ -158,19 +158,19 @@ gekk_checkattack(edict_t *self)
 
 	if (gekk_check_melee(self))
 	{
-		self->monsterinfo.attack_state = AS_MELEE;
+		G_EnsureMonsterInfo(self)->attack_state = AS_MELEE;
 		return true;
 	}
 
 	if (gekk_check_jump(self))
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
+		G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
 		return true;
 	}
 
 	if (gekk_check_jump_close(self) && !self->waterlevel)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
+		G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
 		return true;
 	}
 
@@ -187,7 +187,7 @@ gekk_step(edict_t *self)
 		return;
 	}
 
-	n = (randk() + 1) % 3;
+	n = (G_RandInt(RAND_AI) + 1) % 3;
 
 	if (n == 0)
 	{
@@ -226,7 +226,7 @@ gekk_search(edict_t *self)
 
 	if (self->spawnflags & SPAWNFLAG_CHANT)
 	{
-		r = random();
+		r = G_Random(RAND_AI);
 
 		if (r < 0.33)
 		{
@@ -246,7 +246,7 @@ gekk_search(edict_t *self)
 		gi.sound(self, CHAN_VOICE, sound_search, 1, ATTN_NORM, 0);
 	}
 
-	self->health += 10 + (10 * random());
+	self->health += 10 + (10 * G_Random(RAND_AI));
 
 	if (self->health > self->max_health)
 	{
@@ -286,7 +286,7 @@ gekk_face(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gekk_move_run;
+	G_EnsureMonsterInfo(self)->currentmove = &gekk_move_run;
 }
 
 void
@@ -301,17 +301,17 @@ ai_stand2(edict_t *self, float dist)
 	{
 		ai_move(self, dist);
 
-		if (!(self->spawnflags & 1) && (self->monsterinfo.idle) &&
-			(level.time > self->monsterinfo.idle_time))
+		if (!(self->spawnflags & 1) && (G_MonsterInfo(self)->idle) &&
+			(level.time > G_MonsterInfo(self)->idle_time))
 		{
-			if (self->monsterinfo.idle_time)
+			if (G_MonsterInfo(self)->idle_time)
 			{
-				self->monsterinfo.idle(self);
-				self->monsterinfo.idle_time = level.time + 15 + random() * 15;
+				G_MonsterInfo(self)->idle(self);
+				G_EnsureMonsterInfo(self)->idle_time = level.time + 15 + G_Random(RAND_AI) * 15;
 			}
 			else
 			{
-				self->monsterinfo.idle_time = level.time + random() * 15;
+				G_EnsureMonsterInfo(self)->idle_time = level.time + G_Random(RAND_AI) * 15;
 			}
 		}
 	}
@@ -402,7 +402,7 @@ gekk_swim_loop(edict_t *self)
 	}
 
 	self->flags |= FL_SWIM;
-	self->monsterinfo.currentmove = &gekk_move_swim_loop;
+	G_EnsureMonsterInfo(self)->currentmove = &gekk_move_swim_loop;
 }
 
 static mframe_t gekk_frames_swim[] = {
@@ -478,7 +478,7 @@ gekk_swim(edict_t *self)
 		return;
 	}
 
-	if (!self->enemy->waterlevel && (random() > 0.7))
+	if (!self->enemy->waterlevel && (G_Random(RAND_AI) > 0.7))
 	{
 		water_to_land(self);
 	}
@@ -494,11 +494,11 @@ gekk_stand(edict_t *self)
 
 	if (self->waterlevel)
 	{
-		self->monsterinfo.currentmove = &gekk_move_standunderwater;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_standunderwater;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gekk_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_stand;
 	}
 }
 
@@ -510,9 +510,9 @@ gekk_idle_loop(edict_t *self)
 		return;
 	}
 
-	if ((random() > 0.75) && (self->health < self->max_health))
+	if ((G_Random(RAND_AI) > 0.75) && (self->health < self->max_health))
 	{
-		self->monsterinfo.nextframe = FRAME_idle_01;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_idle_01;
 	}
 }
 
@@ -578,11 +578,11 @@ gekk_idle(edict_t *self)
 
 	if (!self->waterlevel)
 	{
-		self->monsterinfo.currentmove = &gekk_move_idle;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_idle;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gekk_move_swim_start;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_swim_start;
 	}
 }
 
@@ -610,7 +610,7 @@ gekk_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gekk_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &gekk_move_walk;
 }
 
 void
@@ -623,11 +623,11 @@ gekk_run_start(edict_t *self)
 
 	if (self->waterlevel)
 	{
-		self->monsterinfo.currentmove = &gekk_move_swim_start;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_swim_start;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gekk_move_run_start;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_run_start;
 	}
 }
 
@@ -641,18 +641,18 @@ gekk_run(edict_t *self)
 
 	if (self->waterlevel)
 	{
-		self->monsterinfo.currentmove = &gekk_move_swim_start;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_swim_start;
 		return;
 	}
 	else
 	{
-		if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+		if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 		{
-			self->monsterinfo.currentmove = &gekk_move_stand;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_stand;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &gekk_move_run;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_run;
 		}
 	}
 }
@@ -697,7 +697,7 @@ gekk_hit_left(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], 8);
 
-	if (fire_hit(self, aim, (15 + (randk() % 5)), 100))
+	if (fire_hit(self, aim, (15 + (G_RandInt(RAND_AI) % 5)), 100))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_hit, 1, ATTN_NORM, 0);
 	}
@@ -719,7 +719,7 @@ gekk_hit_right(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->maxs[0], 8);
 
-	if (fire_hit(self, aim, (15 + (randk() % 5)), 100))
+	if (fire_hit(self, aim, (15 + (G_RandInt(RAND_AI) % 5)), 100))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_hit2, 1, ATTN_NORM, 0);
 	}
@@ -742,17 +742,17 @@ gekk_check_refire(edict_t *self)
 		return;
 	}
 
-	if (random() < (skill->value * 0.1))
+	if (G_Random(RAND_AI) < (skill->value * 0.1))
 	{
 		if (range(self, self->enemy) == RANGE_MELEE)
 		{
 			if (self->s.frame == FRAME_clawatk3_09)
 			{
-				self->monsterinfo.currentmove = &gekk_move_attack2;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack2;
 			}
 			else if (self->s.frame == FRAME_clawatk5_09)
 			{
-				self->monsterinfo.currentmove = &gekk_move_attack1;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack1;
 			}
 		}
 	}
@@ -827,9 +827,9 @@ fire_loogie(edict_t *self, vec3_t start, vec3_t dir, int damage, int speed)
 	loogie->nextthink = level.time + 2;
 	loogie->think = G_FreeEdict;
 	loogie->dmg = damage;
-	gi.linkentity(loogie);
+	G_LinkEntity(loogie);
 
-	tr = gi.trace(self->s.origin, NULL, NULL, loogie->s.origin,
+	tr = G_Trace(self->s.origin, NULL, NULL, loogie->s.origin,
 			loogie, MASK_SHOT);
 
 	if (tr.fraction < 1.0)
@@ -880,17 +880,17 @@ reloogie(edict_t *self)
 		return;
 	}
 
-	if ((random() > 0.8) && (self->health < self->max_health))
+	if ((G_Random(RAND_AI) > 0.8) && (self->health < self->max_health))
 	{
-		self->monsterinfo.currentmove = &gekk_move_idle2;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_idle2;
 		return;
 	}
 
 	if (self->enemy->health >= 0)
 	{
-		if ((random() > 0.7) && (range(self, self->enemy) == RANGE_NEAR))
+		if ((G_Random(RAND_AI) > 0.7) && (range(self, self->enemy) == RANGE_NEAR))
 		{
-			self->monsterinfo.currentmove = &gekk_move_spit;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_spit;
 		}
 	}
 }
@@ -1094,19 +1094,19 @@ gekk_melee(edict_t *self)
 
 	if (self->waterlevel)
 	{
-		self->monsterinfo.currentmove = &gekk_move_attack;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack;
 	}
 	else
 	{
-		r = random();
+		r = G_Random(RAND_AI);
 
 		if (r > 0.66)
 		{
-			self->monsterinfo.currentmove = &gekk_move_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack1;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &gekk_move_attack2;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack2;
 		}
 	}
 }
@@ -1137,7 +1137,7 @@ gekk_jump_touch(edict_t *self, edict_t *other, const cplane_t *plane /* unsued *
 			VectorCopy(self->velocity, normal);
 			VectorNormalize(normal);
 			VectorMA(self->s.origin, self->maxs[0], normal, point);
-			damage = 10 + 10 * random();
+			damage = 10 + 10 * G_Random(RAND_AI);
 			T_Damage(other, self, self, self->velocity, point,
 					normal, damage, damage, 0, MOD_GEKK);
 		}
@@ -1147,15 +1147,15 @@ gekk_jump_touch(edict_t *self, edict_t *other, const cplane_t *plane /* unsued *
 	{
 		if (self->groundentity)
 		{
-			self->monsterinfo.nextframe = FRAME_leapatk_11;
-			self->monsterinfo.aiflags &= ~AI_IGNORE_PAIN;
+			G_EnsureMonsterInfo(self)->nextframe = FRAME_leapatk_11;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_IGNORE_PAIN;
 			self->touch = NULL;
 		}
 
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_IGNORE_PAIN;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_IGNORE_PAIN;
 	self->touch = NULL;
 }
 
@@ -1186,8 +1186,8 @@ gekk_jump_takeoff(edict_t *self)
 	}
 
 	self->groundentity = NULL;
-	self->monsterinfo.aiflags |= AI_IGNORE_PAIN;
-	self->monsterinfo.attack_finished = level.time + 3;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_IGNORE_PAIN;
+	G_EnsureMonsterInfo(self)->attack_finished = level.time + 3;
 	self->touch = gekk_jump_touch;
 }
 
@@ -1217,8 +1217,8 @@ gekk_jump_takeoff2(edict_t *self)
 	}
 
 	self->groundentity = NULL;
-	self->monsterinfo.aiflags |= AI_IGNORE_PAIN;
-	self->monsterinfo.attack_finished = level.time + 3;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_IGNORE_PAIN;
+	G_EnsureMonsterInfo(self)->attack_finished = level.time + 3;
 	self->touch = gekk_jump_touch;
 }
 
@@ -1247,21 +1247,21 @@ gekk_check_landing(edict_t *self)
 	if (self->groundentity)
 	{
 		gi.sound(self, CHAN_WEAPON, sound_thud, 1, ATTN_NORM, 0);
-		self->monsterinfo.attack_finished = 0;
-		self->monsterinfo.aiflags &= ~AI_IGNORE_PAIN;
+		G_EnsureMonsterInfo(self)->attack_finished = 0;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_IGNORE_PAIN;
 
 		VectorClear(self->velocity);
 
 		return;
 	}
 
-	if (level.time > self->monsterinfo.attack_finished)
+	if (level.time > G_MonsterInfo(self)->attack_finished)
 	{
-		self->monsterinfo.nextframe = FRAME_leapatk_11;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_leapatk_11;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_leapatk_12;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_leapatk_12;
 	}
 }
 
@@ -1280,17 +1280,17 @@ gekk_jump(edict_t *self)
 	else
 	{
 		{
-			if ((random() > 0.5) && (range(self, self->enemy) >= RANGE_NEAR))
+			if ((G_Random(RAND_AI) > 0.5) && (range(self, self->enemy) >= RANGE_NEAR))
 			{
-				self->monsterinfo.currentmove = &gekk_move_spit;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_spit;
 			}
-			else if (random() > 0.8)
+			else if (G_Random(RAND_AI) > 0.8)
 			{
-				self->monsterinfo.currentmove = &gekk_move_spit;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_spit;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &gekk_move_leapatk;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_leapatk;
 			}
 		}
 	}
@@ -1400,19 +1400,19 @@ gekk_pain(edict_t *self, edict_t *other /* unused */,
 			self->flags |= FL_SWIM;
 		}
 
-		self->monsterinfo.currentmove = &gekk_move_pain;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_pain;
 	}
 	else
 	{
-		r = random();
+		r = G_Random(RAND_AI);
 
 		if (r > 0.5)
 		{
-			self->monsterinfo.currentmove = &gekk_move_pain1;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_pain1;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &gekk_move_pain2;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_pain2;
 		}
 	}
 }
@@ -1437,7 +1437,7 @@ gekk_dead(edict_t *self)
 		self->movetype = MOVETYPE_TOSS;
 		self->svflags |= SVF_DEADMONSTER;
 		self->nextthink = 0;
-		gi.linkentity(self);
+		G_LinkEntity(self);
 	}
 }
 
@@ -1474,7 +1474,7 @@ isgibfest(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.9)
+	if (G_Random(RAND_AI) > 0.9)
 	{
 		gekk_gibfest(self);
 	}
@@ -1658,23 +1658,23 @@ gekk_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* un
 
 	if (self->waterlevel)
 	{
-		self->monsterinfo.currentmove = &gekk_move_wdeath;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_wdeath;
 	}
 	else
 	{
-		r = random();
+		r = G_Random(RAND_AI);
 
 		if (r > 0.66)
 		{
-			self->monsterinfo.currentmove = &gekk_move_death1;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_death1;
 		}
 		else if (r > 0.33)
 		{
-			self->monsterinfo.currentmove = &gekk_move_death3;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_death3;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &gekk_move_death4;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_death4;
 		}
 	}
 }
@@ -1687,16 +1687,16 @@ gekk_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (G_MonsterInfo(self)->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.linkentity(self);
+	G_EnsureMonsterInfo(self)->pausetime = level.time + 1;
+	G_LinkEntity(self);
 }
 
 void
@@ -1707,10 +1707,10 @@ gekk_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -1721,13 +1721,13 @@ gekk_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -1787,7 +1787,7 @@ gekk_dodge(edict_t *self, edict_t *attacker, float eta)
 		return;
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r > 0.25)
 	{
@@ -1802,55 +1802,55 @@ gekk_dodge(edict_t *self, edict_t *attacker, float eta)
 
 	if (self->waterlevel)
 	{
-		self->monsterinfo.currentmove = &gekk_move_attack;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack;
 		return;
 	}
 
 	if (skill->value == SKILL_EASY)
 	{
-		r = random();
+		r = G_Random(RAND_AI);
 
 		if (r > 0.5)
 		{
-			self->monsterinfo.currentmove = &gekk_move_lduck;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_lduck;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &gekk_move_rduck;
+			G_EnsureMonsterInfo(self)->currentmove = &gekk_move_rduck;
 		}
 
 		return;
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.3;
-	r = random();
+	G_EnsureMonsterInfo(self)->pausetime = level.time + eta + 0.3;
+	r = G_Random(RAND_AI);
 
 	if (skill->value == SKILL_MEDIUM)
 	{
 		if (r > 0.33)
 		{
-			r = random();
+			r = G_Random(RAND_AI);
 
 			if (r > 0.5)
 			{
-				self->monsterinfo.currentmove = &gekk_move_lduck;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_lduck;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &gekk_move_rduck;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_rduck;
 			}
 		}
 		else
 		{
-			r = random();
+			r = G_Random(RAND_AI);
 
 			if (r > 0.66)
 			{
-				self->monsterinfo.currentmove = &gekk_move_attack1;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack1;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &gekk_move_attack2;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack2;
 			}
 		}
 
@@ -1861,43 +1861,43 @@ gekk_dodge(edict_t *self, edict_t *attacker, float eta)
 	{
 		if (r > 0.66)
 		{
-			r = random();
+			r = G_Random(RAND_AI);
 
 			if (r > 0.5)
 			{
-				self->monsterinfo.currentmove = &gekk_move_lduck;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_lduck;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &gekk_move_rduck;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_rduck;
 			}
 		}
 		else
 		{
-			r = random();
+			r = G_Random(RAND_AI);
 
 			if (r > 0.66)
 			{
-				self->monsterinfo.currentmove = &gekk_move_attack1;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack1;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &gekk_move_attack2;
+				G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack2;
 			}
 		}
 
 		return;
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r > 0.66)
 	{
-		self->monsterinfo.currentmove = &gekk_move_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gekk_move_attack2;
+		G_EnsureMonsterInfo(self)->currentmove = &gekk_move_attack2;
 	}
 }
 
@@ -1954,24 +1954,24 @@ SP_monster_gekk(edict_t *self)
 	self->pain = gekk_pain;
 	self->die = gekk_die;
 
-	self->monsterinfo.stand = gekk_stand;
+	G_EnsureMonsterInfo(self)->stand = gekk_stand;
 
-	self->monsterinfo.walk = gekk_walk;
-	self->monsterinfo.run = gekk_run_start;
-	self->monsterinfo.dodge = gekk_dodge;
-	self->monsterinfo.attack = gekk_jump;
-	self->monsterinfo.melee = gekk_melee;
-	self->monsterinfo.sight = gekk_sight;
+	G_EnsureMonsterInfo(self)->walk = gekk_walk;
+	G_EnsureMonsterInfo(self)->run = gekk_run_start;
+	G_EnsureMonsterInfo(self)->dodge = gekk_dodge;
+	G_EnsureMonsterInfo(self)->attack = gekk_jump;
+	G_EnsureMonsterInfo(self)->melee = gekk_melee;
+	G_EnsureMonsterInfo(self)->sight = gekk_sight;
 
-	self->monsterinfo.search = gekk_search;
-	self->monsterinfo.idle = gekk_idle;
-	self->monsterinfo.checkattack = gekk_checkattack;
+	G_EnsureMonsterInfo(self)->search = gekk_search;
+	G_EnsureMonsterInfo(self)->idle = gekk_idle;
+	G_EnsureMonsterInfo(self)->checkattack = gekk_checkattack;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &gekk_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &gekk_move_stand;
 
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 	walkmonster_start(self);
 }
 
@@ -1987,7 +1987,7 @@ water_to_land(edict_t *self)
 	self->yaw_speed = 20;
 	self->viewheight = 25;
 
-	self->monsterinfo.currentmove = &gekk_move_leapatk2;
+	G_EnsureMonsterInfo(self)->currentmove = &gekk_move_leapatk2;
 
 	VectorSet(self->mins, -24, -24, -24);
 	VectorSet(self->maxs, 24, 24, 24);
@@ -2005,7 +2005,7 @@ land_to_water(edict_t *self)
 	self->yaw_speed = 10;
 	self->viewheight = 10;
 
-	self->monsterinfo.currentmove = &gekk_move_swim_start;
+	G_EnsureMonsterInfo(self)->currentmove = &gekk_move_swim_start;
 
 	VectorSet(self->mins, -24, -24, -24);
 	VectorSet(self->maxs, 24, 24, 16);
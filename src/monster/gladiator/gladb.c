@@ -88,7 +88,7 @@ gladb_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladb_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &gladb_move_stand;
 }
 
 static mframe_t gladb_frames_walk[] = {
@@ -125,7 +125,7 @@ gladb_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladb_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &gladb_move_walk;
 }
 
 static mframe_t gladb_frames_run[] = {
@@ -152,13 +152,13 @@ gladb_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &gladb_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &gladb_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gladb_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &gladb_move_run;
 	}
 }
 
@@ -174,7 +174,7 @@ GladbMelee(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], -4);
 
-	if (fire_hit(self, aim, (20 + (randk() % 5)), 300))
+	if (fire_hit(self, aim, (20 + (G_RandInt(RAND_AI) % 5)), 300))
 	{
 		gi.sound(self, CHAN_AUTO, sound_cleaver_hit, 1, ATTN_NORM, 0);
 	}
@@ -219,7 +219,7 @@ gladb_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladb_move_attack_melee;
+	G_EnsureMonsterInfo(self)->currentmove = &gladb_move_attack_melee;
 }
 
 void
@@ -293,7 +293,7 @@ gladb_attack(edict_t *self)
 	   but not for stand-ground ones since players can
 	   abuse it by standing still inside this range
 	*/
-	if (!(self->monsterinfo.aiflags & AI_STAND_GROUND))
+	if (!(G_MonsterInfo(self)->aiflags & AI_STAND_GROUND))
 	{
 		VectorSubtract(self->s.origin, self->enemy->s.origin, v);
 		range = VectorLength(v);
@@ -308,7 +308,7 @@ gladb_attack(edict_t *self)
 	gi.sound(self, CHAN_WEAPON, sound_gun, 1, ATTN_NORM, 0);
 	VectorCopy(self->enemy->s.origin, self->pos1); /* save for aiming the shot */
 	self->pos1[2] += self->enemy->viewheight;
-	self->monsterinfo.currentmove = &gladb_move_attack_gun;
+	G_EnsureMonsterInfo(self)->currentmove = &gladb_move_attack_gun;
 }
 
 static mframe_t gladb_frames_pain[] = {
@@ -360,9 +360,9 @@ gladb_pain(edict_t *self, edict_t *other /* unused */,
 	if (level.time < self->pain_debounce_time)
 	{
 		if ((self->velocity[2] > 100) &&
-			(self->monsterinfo.currentmove == &gladb_move_pain))
+			(G_MonsterInfo(self)->currentmove == &gladb_move_pain))
 		{
-			self->monsterinfo.currentmove = &gladb_move_pain_air;
+			G_EnsureMonsterInfo(self)->currentmove = &gladb_move_pain_air;
 		}
 
 		return;
@@ -370,7 +370,7 @@ gladb_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
@@ -381,11 +381,11 @@ gladb_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &gladb_move_pain_air;
+		G_EnsureMonsterInfo(self)->currentmove = &gladb_move_pain_air;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gladb_move_pain;
+		G_EnsureMonsterInfo(self)->currentmove = &gladb_move_pain;
 	}
 }
 
@@ -402,7 +402,7 @@ gladb_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t gladb_frames_death[] = {
@@ -479,7 +479,7 @@ gladb_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	self->monsterinfo.currentmove = &gladb_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &gladb_move_death;
 }
 
 /*
@@ -519,22 +519,22 @@ SP_monster_gladb(edict_t *self)
 	self->pain = gladb_pain;
 	self->die = gladb_die;
 
-	self->monsterinfo.stand = gladb_stand;
-	self->monsterinfo.walk = gladb_walk;
-	self->monsterinfo.run = gladb_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = gladb_attack;
-	self->monsterinfo.melee = gladb_melee;
-	self->monsterinfo.sight = gladb_sight;
-	self->monsterinfo.idle = gladb_idle;
-	self->monsterinfo.search = gladb_search;
-
-	gi.linkentity(self);
-	self->monsterinfo.currentmove = &gladb_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
-
-	self->monsterinfo.power_armor_type = POWER_ARMOR_SHIELD;
-	self->monsterinfo.power_armor_power = 400;
+	G_EnsureMonsterInfo(self)->stand = gladb_stand;
+	G_EnsureMonsterInfo(self)->walk = gladb_walk;
+	G_EnsureMonsterInfo(self)->run = gladb_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = gladb_attack;
+	G_EnsureMonsterInfo(self)->melee = gladb_melee;
+	G_EnsureMonsterInfo(self)->sight = gladb_sight;
+	G_EnsureMonsterInfo(self)->idle = gladb_idle;
+	G_EnsureMonsterInfo(self)->search = gladb_search;
+
+	G_LinkEntity(self);
+	G_EnsureMonsterInfo(self)->currentmove = &gladb_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
+
+	G_EnsureMonsterInfo(self)->power_armor_type = POWER_ARMOR_SHIELD;
+	G_EnsureMonsterInfo(self)->power_armor_power = 400;
 
 	walkmonster_start(self);
 }
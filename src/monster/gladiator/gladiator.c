@@ -54,7 +54,7 @@ gladiator_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("gladiator/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (G_RandInt(RAND_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -135,7 +135,7 @@ gladiator_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladiator_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_stand;
 }
 
 static mframe_t gladiator_frames_walk[] = {
@@ -173,7 +173,7 @@ gladiator_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladiator_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_walk;
 }
 
 static mframe_t gladiator_frames_run[] = {
@@ -201,13 +201,13 @@ gladiator_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &gladiator_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gladiator_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_run;
 	}
 }
 
@@ -223,7 +223,7 @@ GaldiatorMelee(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], -4);
 
-	if (fire_hit(self, aim, (20 + (randk() % 5)), 300))
+	if (fire_hit(self, aim, (20 + (G_RandInt(RAND_AI) % 5)), 300))
 	{
 		gi.sound(self, CHAN_AUTO, sound_cleaver_hit, 1, ATTN_NORM, 0);
 	}
@@ -269,7 +269,7 @@ gladiator_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladiator_move_attack_melee;
+	G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_attack_melee;
 }
 
 void
@@ -330,7 +330,7 @@ gladiator_attack(edict_t *self)
 	   but not for stand-ground ones since players can
 	   abuse it by standing still inside this range
 	*/
-	if (!(self->monsterinfo.aiflags & AI_STAND_GROUND))
+	if (!(G_MonsterInfo(self)->aiflags & AI_STAND_GROUND))
 	{
 		VectorSubtract(self->s.origin, self->enemy->s.origin, v);
 		range = VectorLength(v);
@@ -345,7 +345,7 @@ gladiator_attack(edict_t *self)
 	gi.sound(self, CHAN_WEAPON, sound_gun, 1, ATTN_NORM, 0);
 	VectorCopy(self->enemy->s.origin, self->pos1); /* save for aiming the shot */
 	self->pos1[2] += self->enemy->viewheight;
-	self->monsterinfo.currentmove = &gladiator_move_attack_gun;
+	G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_attack_gun;
 }
 
 static mframe_t gladiator_frames_pain[] = {
@@ -400,9 +400,9 @@ gladiator_pain(edict_t *self, edict_t *other /* unused */,
 	if (level.time < self->pain_debounce_time)
 	{
 		if ((self->velocity[2] > 100) &&
-			(self->monsterinfo.currentmove == &gladiator_move_pain))
+			(G_MonsterInfo(self)->currentmove == &gladiator_move_pain))
 		{
-			self->monsterinfo.currentmove = &gladiator_move_pain_air;
+			G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_pain_air;
 		}
 
 		return;
@@ -410,7 +410,7 @@ gladiator_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
@@ -426,11 +426,11 @@ gladiator_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &gladiator_move_pain_air;
+		G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_pain_air;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gladiator_move_pain;
+		G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_pain;
 	}
 }
 
@@ -447,7 +447,7 @@ gladiator_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t gladiator_frames_death[] = {
@@ -529,7 +529,7 @@ gladiator_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	self->monsterinfo.currentmove = &gladiator_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_death;
 }
 
 /*
@@ -578,19 +578,19 @@ SP_monster_gladiator(edict_t *self)
 	self->pain = gladiator_pain;
 	self->die = gladiator_die;
 
-	self->monsterinfo.stand = gladiator_stand;
-	self->monsterinfo.walk = gladiator_walk;
-	self->monsterinfo.run = gladiator_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = gladiator_attack;
-	self->monsterinfo.melee = gladiator_melee;
-	self->monsterinfo.sight = gladiator_sight;
-	self->monsterinfo.idle = gladiator_idle;
-	self->monsterinfo.search = gladiator_search;
-
-	gi.linkentity(self);
-	self->monsterinfo.currentmove = &gladiator_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->stand = gladiator_stand;
+	G_EnsureMonsterInfo(self)->walk = gladiator_walk;
+	G_EnsureMonsterInfo(self)->run = gladiator_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = gladiator_attack;
+	G_EnsureMonsterInfo(self)->melee = gladiator_melee;
+	G_EnsureMonsterInfo(self)->sight = gladiator_sight;
+	G_EnsureMonsterInfo(self)->idle = gladiator_idle;
+	G_EnsureMonsterInfo(self)->search = gladiator_search;
+
+	G_LinkEntity(self);
+	G_EnsureMonsterInfo(self)->currentmove = &gladiator_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -57,7 +57,7 @@ gunner_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("gunner/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (G_RandInt(RAND_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -178,14 +178,14 @@ gunner_fidget(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
 		return;
 	}
 
-	if (random() <= 0.05)
+	if (G_Random(RAND_AI) <= 0.05)
 	{
-		self->monsterinfo.currentmove = &gunner_move_fidget;
+		G_EnsureMonsterInfo(self)->currentmove = &gunner_move_fidget;
 	}
 }
 
@@ -240,7 +240,7 @@ gunner_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &gunner_move_stand;
 }
 
 static mframe_t gunner_frames_walk[] = {
@@ -275,7 +275,7 @@ gunner_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &gunner_move_walk;
 }
 
 static mframe_t gunner_frames_run[] = {
@@ -305,13 +305,13 @@ gunner_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &gunner_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &gunner_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gunner_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &gunner_move_run;
 	}
 }
 
@@ -340,7 +340,7 @@ gunner_runandshoot(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_runandshoot;
+	G_EnsureMonsterInfo(self)->currentmove = &gunner_move_runandshoot;
 }
 
 static mframe_t gunner_frames_pain3[] = {
@@ -428,7 +428,7 @@ gunner_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	if (randk() & 1)
+	if (G_RandInt(RAND_AI) & 1)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain, 1, ATTN_NORM, 0);
 	}
@@ -444,15 +444,15 @@ gunner_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (damage <= 10)
 	{
-		self->monsterinfo.currentmove = &gunner_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &gunner_move_pain3;
 	}
 	else if (damage <= 25)
 	{
-		self->monsterinfo.currentmove = &gunner_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &gunner_move_pain2;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gunner_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &gunner_move_pain1;
 	}
 }
 
@@ -469,7 +469,7 @@ gunner_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t gunner_frames_death[] = {
@@ -538,7 +538,7 @@ gunner_die(edict_t *self, edict_t *inflictor /* unused */,
 	gi.sound(self, CHAN_VOICE, sound_death, 1, ATTN_NORM, 0);
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.currentmove = &gunner_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &gunner_move_death;
 }
 
 void
@@ -549,16 +549,16 @@ gunner_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (G_MonsterInfo(self)->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
 
 	if (skill->value >= SKILL_HARD)
 	{
-		if (random() > 0.5)
+		if (G_Random(RAND_AI) > 0.5)
 		{
 			GunnerGrenade(self);
 		}
@@ -566,8 +566,8 @@ gunner_duck_down(edict_t *self)
 
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.linkentity(self);
+	G_EnsureMonsterInfo(self)->pausetime = level.time + 1;
+	G_LinkEntity(self);
 }
 
 void
@@ -578,13 +578,13 @@ gunner_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -596,10 +596,10 @@ gunner_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t gunner_frames_duck[] = {
@@ -629,7 +629,7 @@ gunner_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (G_Random(RAND_AI) > 0.25)
 	{
 		return;
 	}
@@ -640,7 +640,7 @@ gunner_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_duck;
+	G_EnsureMonsterInfo(self)->currentmove = &gunner_move_duck;
 }
 
 void
@@ -821,17 +821,17 @@ gunner_attack(edict_t *self)
 
 	if (range(self, self->enemy) == RANGE_MELEE)
 	{
-		self->monsterinfo.currentmove = &gunner_move_attack_chain;
+		G_EnsureMonsterInfo(self)->currentmove = &gunner_move_attack_chain;
 	}
 	else
 	{
-		if (random() <= 0.5)
+		if (G_Random(RAND_AI) <= 0.5)
 		{
-			self->monsterinfo.currentmove = &gunner_move_attack_grenade;
+			G_EnsureMonsterInfo(self)->currentmove = &gunner_move_attack_grenade;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &gunner_move_attack_chain;
+			G_EnsureMonsterInfo(self)->currentmove = &gunner_move_attack_chain;
 		}
 	}
 }
@@ -844,7 +844,7 @@ gunner_fire_chain(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_fire_chain;
+	G_EnsureMonsterInfo(self)->currentmove = &gunner_move_fire_chain;
 }
 
 void
@@ -859,15 +859,15 @@ gunner_refire_chain(edict_t *self)
 	{
 		if (visible(self, self->enemy))
 		{
-			if (random() <= 0.5)
+			if (G_Random(RAND_AI) <= 0.5)
 			{
-				self->monsterinfo.currentmove = &gunner_move_fire_chain;
+				G_EnsureMonsterInfo(self)->currentmove = &gunner_move_fire_chain;
 				return;
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_endfire_chain;
+	G_EnsureMonsterInfo(self)->currentmove = &gunner_move_endfire_chain;
 }
 
 /*
@@ -916,19 +916,19 @@ SP_monster_gunner(edict_t *self)
 	self->pain = gunner_pain;
 	self->die = gunner_die;
 
-	self->monsterinfo.stand = gunner_stand;
-	self->monsterinfo.walk = gunner_walk;
-	self->monsterinfo.run = gunner_run;
-	self->monsterinfo.dodge = gunner_dodge;
-	self->monsterinfo.attack = gunner_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = gunner_sight;
-	self->monsterinfo.search = gunner_search;
+	G_EnsureMonsterInfo(self)->stand = gunner_stand;
+	G_EnsureMonsterInfo(self)->walk = gunner_walk;
+	G_EnsureMonsterInfo(self)->run = gunner_run;
+	G_EnsureMonsterInfo(self)->dodge = gunner_dodge;
+	G_EnsureMonsterInfo(self)->attack = gunner_attack;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = gunner_sight;
+	G_EnsureMonsterInfo(self)->search = gunner_search;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &gunner_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &gunner_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
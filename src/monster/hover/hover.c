@@ -44,7 +44,7 @@ hover_search(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_search1, 1, ATTN_NORM, 0);
 	}
@@ -501,15 +501,15 @@ hover_reattack(edict_t *self)
 	{
 		if (visible(self, self->enemy))
 		{
-			if (random() <= 0.6)
+			if (G_Random(RAND_AI) <= 0.6)
 			{
-				self->monsterinfo.currentmove = &hover_move_attack1;
+				G_EnsureMonsterInfo(self)->currentmove = &hover_move_attack1;
 				return;
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &hover_move_end_attack;
+	G_EnsureMonsterInfo(self)->currentmove = &hover_move_end_attack;
 }
 
 void
@@ -554,7 +554,7 @@ hover_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &hover_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &hover_move_stand;
 }
 
 void
@@ -565,13 +565,13 @@ hover_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &hover_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &hover_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &hover_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &hover_move_run;
 	}
 }
 
@@ -583,7 +583,7 @@ hover_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &hover_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &hover_move_walk;
 }
 
 void
@@ -594,7 +594,7 @@ hover_start_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &hover_move_start_attack;
+	G_EnsureMonsterInfo(self)->currentmove = &hover_move_start_attack;
 }
 
 void
@@ -605,7 +605,7 @@ hover_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &hover_move_attack1;
+	G_EnsureMonsterInfo(self)->currentmove = &hover_move_attack1;
 }
 
 void
@@ -636,21 +636,21 @@ hover_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (damage <= 25)
 	{
-		if (random() < 0.5)
+		if (G_Random(RAND_AI) < 0.5)
 		{
 			gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-			self->monsterinfo.currentmove = &hover_move_pain3;
+			G_EnsureMonsterInfo(self)->currentmove = &hover_move_pain3;
 		}
 		else
 		{
 			gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-			self->monsterinfo.currentmove = &hover_move_pain2;
+			G_EnsureMonsterInfo(self)->currentmove = &hover_move_pain2;
 		}
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &hover_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &hover_move_pain1;
 	}
 }
 
@@ -685,7 +685,7 @@ hover_dead(edict_t *self)
 	self->think = hover_deadthink;
 	self->nextthink = level.time + FRAMETIME;
 	self->timestamp = level.time + 15;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -726,7 +726,7 @@ hover_die(edict_t *self, edict_t *inflictor /* unused */,
 	}
 
 	/* regular death */
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_death1, 1, ATTN_NORM, 0);
 	}
@@ -737,7 +737,7 @@ hover_die(edict_t *self, edict_t *inflictor /* unused */,
 
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.currentmove = &hover_move_death1;
+	G_EnsureMonsterInfo(self)->currentmove = &hover_move_death1;
 }
 
 /*
@@ -782,17 +782,17 @@ SP_monster_hover(edict_t *self)
 	self->pain = hover_pain;
 	self->die = hover_die;
 
-	self->monsterinfo.stand = hover_stand;
-	self->monsterinfo.walk = hover_walk;
-	self->monsterinfo.run = hover_run;
-	self->monsterinfo.attack = hover_start_attack;
-	self->monsterinfo.sight = hover_sight;
-	self->monsterinfo.search = hover_search;
+	G_EnsureMonsterInfo(self)->stand = hover_stand;
+	G_EnsureMonsterInfo(self)->walk = hover_walk;
+	G_EnsureMonsterInfo(self)->run = hover_run;
+	G_EnsureMonsterInfo(self)->attack = hover_start_attack;
+	G_EnsureMonsterInfo(self)->sight = hover_sight;
+	G_EnsureMonsterInfo(self)->search = hover_search;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &hover_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &hover_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
@@ -58,7 +58,7 @@ infantry_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("infantry/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (G_RandInt(RAND_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -110,7 +110,7 @@ infantry_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &infantry_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &infantry_move_stand;
 }
 
 static mframe_t infantry_frames_fidget[] = {
@@ -181,7 +181,7 @@ infantry_fidget(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &infantry_move_fidget;
+	G_EnsureMonsterInfo(self)->currentmove = &infantry_move_fidget;
 	gi.sound(self, CHAN_VOICE, sound_idle, 1, ATTN_IDLE, 0);
 }
 
@@ -227,7 +227,7 @@ infantry_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &infantry_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &infantry_move_walk;
 }
 
 static mframe_t infantry_frames_run[] = {
@@ -257,13 +257,13 @@ infantry_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &infantry_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &infantry_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_run;
 	}
 }
 
@@ -337,16 +337,16 @@ infantry_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	n = randk() % 2;
+	n = G_RandInt(RAND_AI) % 2;
 
 	if (n == 0)
 	{
-		self->monsterinfo.currentmove = &infantry_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_pain1;
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &infantry_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_pain2;
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
 	}
 }
@@ -438,7 +438,7 @@ infantry_dead(edict_t *self)
 	VectorSet(self->maxs, 16, 16, -8);
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	M_FlyCheck(self);
 }
@@ -576,21 +576,21 @@ infantry_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->takedamage = DAMAGE_YES;
 	self->s.skinnum = 1; /* switch to bloody skin */
 
-	n = randk() % 3;
+	n = G_RandInt(RAND_AI) % 3;
 
 	if (n == 0)
 	{
-		self->monsterinfo.currentmove = &infantry_move_death1;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_death1;
 		gi.sound(self, CHAN_VOICE, sound_die2, 1, ATTN_NORM, 0);
 	}
 	else if (n == 1)
 	{
-		self->monsterinfo.currentmove = &infantry_move_death2;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_death2;
 		gi.sound(self, CHAN_VOICE, sound_die1, 1, ATTN_NORM, 0);
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &infantry_move_death3;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_death3;
 		gi.sound(self, CHAN_VOICE, sound_die2, 1, ATTN_NORM, 0);
 	}
 }
@@ -603,16 +603,16 @@ infantry_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (G_MonsterInfo(self)->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.linkentity(self);
+	G_EnsureMonsterInfo(self)->pausetime = level.time + 1;
+	G_LinkEntity(self);
 }
 
 void
@@ -623,13 +623,13 @@ infantry_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -641,10 +641,10 @@ infantry_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t infantry_frames_duck[] = {
@@ -671,7 +671,7 @@ infantry_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (G_Random(RAND_AI) > 0.25)
 	{
 		return;
 	}
@@ -682,7 +682,7 @@ infantry_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.currentmove = &infantry_move_duck;
+	G_EnsureMonsterInfo(self)->currentmove = &infantry_move_duck;
 }
 
 void
@@ -695,8 +695,8 @@ infantry_set_firetime(edict_t *self)
 		return;
 	}
 
-	n = (randk() & 15) + 5;
-	self->monsterinfo.pausetime = level.time + n * FRAMETIME;
+	n = (G_RandInt(RAND_AI) & 15) + 5;
+	G_EnsureMonsterInfo(self)->pausetime = level.time + n * FRAMETIME;
 }
 
 void
@@ -720,13 +720,13 @@ infantry_fire(edict_t *self)
 
 	InfantryMachineGun(self);
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -779,7 +779,7 @@ infantry_smack(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, 0, 0);
 
-	if (fire_hit(self, aim, (5 + (randk() % 5)), 50))
+	if (fire_hit(self, aim, (5 + (G_RandInt(RAND_AI) % 5)), 50))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_punch_hit, 1, ATTN_NORM, 0);
 	}
@@ -814,11 +814,11 @@ infantry_attack(edict_t *self)
 
 	if (range(self, self->enemy) == RANGE_MELEE)
 	{
-		self->monsterinfo.currentmove = &infantry_move_attack2;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_attack2;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &infantry_move_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &infantry_move_attack1;
 	}
 }
 
@@ -871,20 +871,20 @@ SP_monster_infantry(edict_t *self)
 	self->pain = infantry_pain;
 	self->die = infantry_die;
 
-	self->monsterinfo.stand = infantry_stand;
-	self->monsterinfo.walk = infantry_walk;
-	self->monsterinfo.run = infantry_run;
-	self->monsterinfo.dodge = infantry_dodge;
-	self->monsterinfo.attack = infantry_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = infantry_sight;
-	self->monsterinfo.idle = infantry_fidget;
-	self->monsterinfo.search = infantry_search;
+	G_EnsureMonsterInfo(self)->stand = infantry_stand;
+	G_EnsureMonsterInfo(self)->walk = infantry_walk;
+	G_EnsureMonsterInfo(self)->run = infantry_run;
+	G_EnsureMonsterInfo(self)->dodge = infantry_dodge;
+	G_EnsureMonsterInfo(self)->attack = infantry_attack;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = infantry_sight;
+	G_EnsureMonsterInfo(self)->idle = infantry_fidget;
+	G_EnsureMonsterInfo(self)->search = infantry_search;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &infantry_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &infantry_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
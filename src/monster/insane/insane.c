@@ -64,7 +64,7 @@ insane_footstep(edict_t *self)
 	}
 
 	int     i;
-	i = randk() % 4;
+	i = G_RandInt(RAND_AI) % 4;
 
 	if (i == 0)
 	{
@@ -138,7 +138,7 @@ insane_scream(edict_t *self)
 		return;
 	}
 
-	gi.sound(self, CHAN_VOICE, sound_scream[randk() % 8], 1, ATTN_IDLE, 0);
+	gi.sound(self, CHAN_VOICE, sound_scream[G_RandInt(RAND_AI) % 8], 1, ATTN_IDLE, 0);
 }
 
 static mframe_t insane_frames_stand_normal[] = {
@@ -624,13 +624,13 @@ insane_cross(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.8)
+	if (G_Random(RAND_AI) < 0.8)
 	{
-		self->monsterinfo.currentmove = &insane_move_cross;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_cross;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_struggle_cross;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_struggle_cross;
 	}
 }
 
@@ -646,23 +646,23 @@ insane_walk(edict_t *self)
 	{
 		if (self->s.frame == FRAME_cr_pain10)
 		{
-			self->monsterinfo.currentmove = &insane_move_down;
+			G_EnsureMonsterInfo(self)->currentmove = &insane_move_down;
 			return;
 		}
 	}
 
 	if (self->spawnflags & 4)
 	{
-		self->monsterinfo.currentmove = &insane_move_crawl;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_crawl;
 	}
 	else
-	if (random() <= 0.5)
+	if (G_Random(RAND_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &insane_move_walk_normal;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_walk_normal;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_walk_insane;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_walk_insane;
 	}
 }
 
@@ -678,23 +678,23 @@ insane_run(edict_t *self)
 	{
 		if (self->s.frame == FRAME_cr_pain10)
 		{
-			self->monsterinfo.currentmove = &insane_move_down;
+			G_EnsureMonsterInfo(self)->currentmove = &insane_move_down;
 			return;
 		}
 	}
 
 	if (self->spawnflags & 4) /* Crawling? */
 	{
-		self->monsterinfo.currentmove = &insane_move_runcrawl;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_runcrawl;
 	}
 	else
-	if (random() <= 0.5) /* Else, mix it up */
+	if (G_Random(RAND_AI) <= 0.5) /* Else, mix it up */
 	{
-		self->monsterinfo.currentmove = &insane_move_run_normal;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_run_normal;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_run_insane;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_run_insane;
 	}
 }
 
@@ -716,7 +716,7 @@ insane_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	r = 1 + (randk() & 1);
+	r = 1 + (G_RandInt(RAND_AI) & 1);
 
 	if (self->health < 25)
 	{
@@ -749,7 +749,7 @@ insane_pain(edict_t *self, edict_t *other /* unused */,
 	/* Don't go into pain frames if crucified. */
 	if (self->spawnflags & SPAWNFLAG_CRUSIFIED)
 	{
-		self->monsterinfo.currentmove = &insane_move_struggle_cross;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_struggle_cross;
 		return;
 	}
 
@@ -758,11 +758,11 @@ insane_pain(edict_t *self, edict_t *other /* unused */,
 		((self->s.frame >= FRAME_stand99) &&
 		 (self->s.frame <= FRAME_stand160)))
 	{
-		self->monsterinfo.currentmove = &insane_move_crawl_pain;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_crawl_pain;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_stand_pain;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_stand_pain;
 	}
 }
 
@@ -774,7 +774,7 @@ insane_onground(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &insane_move_down;
+	G_EnsureMonsterInfo(self)->currentmove = &insane_move_down;
 }
 
 void
@@ -790,15 +790,15 @@ insane_checkdown(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.3)
+	if (G_Random(RAND_AI) < 0.3)
 	{
-		if (random() < 0.5)
+		if (G_Random(RAND_AI) < 0.5)
 		{
-			self->monsterinfo.currentmove = &insane_move_uptodown;
+			G_EnsureMonsterInfo(self)->currentmove = &insane_move_uptodown;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &insane_move_jumpdown;
+			G_EnsureMonsterInfo(self)->currentmove = &insane_move_jumpdown;
 		}
 	}
 }
@@ -817,9 +817,9 @@ insane_checkup(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &insane_move_downtoup;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_downtoup;
 	}
 }
 
@@ -833,22 +833,22 @@ insane_stand(edict_t *self)
 
 	if (self->spawnflags & SPAWNFLAG_CRUSIFIED) /* If crucified */
 	{
-		self->monsterinfo.currentmove = &insane_move_cross;
-		self->monsterinfo.aiflags |= AI_STAND_GROUND;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_cross;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_STAND_GROUND;
 	}
 	/* If Hold_Ground and Crawl are set */
 	else if ((self->spawnflags & 4) && (self->spawnflags & 16))
 	{
-		self->monsterinfo.currentmove = &insane_move_down;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_down;
 	}
 	else
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &insane_move_stand_normal;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_stand_normal;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_stand_insane;
+		G_EnsureMonsterInfo(self)->currentmove = &insane_move_stand_insane;
 	}
 }
 
@@ -873,7 +873,7 @@ insane_dead(edict_t *self)
 
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -916,7 +916,7 @@ insane_die(edict_t *self, edict_t *inflictor /* unused */,
 	}
 
 	gi.sound(self, CHAN_VOICE, gi.soundindex(va("player/male/death%i.wav",
-							(randk() % 4) + 1)), 1, ATTN_IDLE, 0);
+							(G_RandInt(RAND_AI) % 4) + 1)), 1, ATTN_IDLE, 0);
 
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
@@ -932,11 +932,11 @@ insane_die(edict_t *self, edict_t *inflictor /* unused */,
 			((self->s.frame >= FRAME_stand99) &&
 			 (self->s.frame <= FRAME_stand160)))
 		{
-			self->monsterinfo.currentmove = &insane_move_crawl_death;
+			G_EnsureMonsterInfo(self)->currentmove = &insane_move_crawl_death;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &insane_move_stand_death;
+			G_EnsureMonsterInfo(self)->currentmove = &insane_move_stand_death;
 		}
 	}
 }
@@ -991,25 +991,25 @@ SP_misc_insane(edict_t *self)
 	self->pain = insane_pain;
 	self->die = insane_die;
 
-	self->monsterinfo.stand = insane_stand;
-	self->monsterinfo.walk = insane_walk;
-	self->monsterinfo.run = insane_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = NULL;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = NULL;
-	self->monsterinfo.aiflags |= AI_GOOD_GUY;
+	G_EnsureMonsterInfo(self)->stand = insane_stand;
+	G_EnsureMonsterInfo(self)->walk = insane_walk;
+	G_EnsureMonsterInfo(self)->run = insane_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = NULL;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = NULL;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_GOOD_GUY;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	if (self->spawnflags & 16) /* Stand Ground */
 	{
-		self->monsterinfo.aiflags |= AI_STAND_GROUND;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_STAND_GROUND;
 	}
 
-	self->monsterinfo.currentmove = &insane_move_stand_normal;
+	G_EnsureMonsterInfo(self)->currentmove = &insane_move_stand_normal;
 
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	if (self->spawnflags & SPAWNFLAG_CRUSIFIED) /* Crucified ? */
 	{
@@ -1021,6 +1021,6 @@ SP_misc_insane(edict_t *self)
 	else
 	{
 		walkmonster_start(self);
-		self->s.skinnum = randk() % 3;
+		self->s.skinnum = G_RandInt(RAND_AI) % 3;
 	}
 }
@@ -56,7 +56,7 @@ medic_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("medic/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (G_RandInt(RAND_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -89,7 +89,7 @@ medic_FindDeadMonster(edict_t *self)
 			continue;
 		}
 
-		if (ent->monsterinfo.aiflags & AI_GOOD_GUY)
+		if (G_MonsterInfo(ent)->aiflags & AI_GOOD_GUY)
 		{
 			continue;
 		}
@@ -149,7 +149,7 @@ medic_idle(edict_t *self)
 	{
 		self->enemy = ent;
 		self->enemy->owner = self;
-		self->monsterinfo.aiflags |= AI_MEDIC;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_MEDIC;
 		FoundTarget(self);
 	}
 }
@@ -175,7 +175,7 @@ medic_search(edict_t *self)
 			self->oldenemy = self->enemy;
 			self->enemy = ent;
 			self->enemy->owner = self;
-			self->monsterinfo.aiflags |= AI_MEDIC;
+			G_EnsureMonsterInfo(self)->aiflags |= AI_MEDIC;
 			FoundTarget(self);
 		}
 	}
@@ -301,7 +301,7 @@ medic_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &medic_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &medic_move_stand;
 }
 
 static mframe_t medic_frames_walk[] = {
@@ -335,7 +335,7 @@ medic_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &medic_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &medic_move_walk;
 }
 
 static mframe_t medic_frames_run[] = {
@@ -363,7 +363,7 @@ medic_run(edict_t *self)
 		return;
 	}
 
-	if (!(self->monsterinfo.aiflags & AI_MEDIC))
+	if (!(G_MonsterInfo(self)->aiflags & AI_MEDIC))
 	{
 		edict_t *ent;
 
@@ -374,19 +374,19 @@ medic_run(edict_t *self)
 			self->oldenemy = self->enemy;
 			self->enemy = ent;
 			self->enemy->owner = self;
-			self->monsterinfo.aiflags |= AI_MEDIC;
+			G_EnsureMonsterInfo(self)->aiflags |= AI_MEDIC;
 			FoundTarget(self);
 			return;
 		}
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &medic_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &medic_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &medic_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &medic_move_run;
 	}
 }
 
@@ -461,14 +461,14 @@ medic_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &medic_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &medic_move_pain1;
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &medic_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &medic_move_pain2;
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
 	}
 }
@@ -527,7 +527,7 @@ medic_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t medic_frames_death[] = {
@@ -622,7 +622,7 @@ medic_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	self->monsterinfo.currentmove = &medic_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &medic_move_death;
 }
 
 void
@@ -633,16 +633,16 @@ medic_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (G_MonsterInfo(self)->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.linkentity(self);
+	G_EnsureMonsterInfo(self)->pausetime = level.time + 1;
+	G_LinkEntity(self);
 }
 
 void
@@ -653,13 +653,13 @@ medic_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -671,10 +671,10 @@ medic_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t medic_frames_duck[] = {
@@ -712,7 +712,7 @@ medic_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (G_Random(RAND_AI) > 0.25)
 	{
 		return;
 	}
@@ -723,7 +723,7 @@ medic_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.currentmove = &medic_move_duck;
+	G_EnsureMonsterInfo(self)->currentmove = &medic_move_duck;
 }
 
 static mframe_t medic_frames_attackHyperBlaster[] = {
@@ -763,9 +763,9 @@ medic_continue(edict_t *self)
 
 	if (visible(self, self->enemy))
 	{
-		if (random() <= 0.95)
+		if (G_Random(RAND_AI) <= 0.95)
 		{
-			self->monsterinfo.currentmove = &medic_move_attackHyperBlaster;
+			G_EnsureMonsterInfo(self)->currentmove = &medic_move_attackHyperBlaster;
 		}
 	}
 }
@@ -862,7 +862,7 @@ medic_cable_attack(edict_t *self)
 		return;
 	}
 
-	tr = gi.trace(start, NULL, NULL, self->enemy->s.origin, self, MASK_SHOT);
+	tr = G_Trace(start, NULL, NULL, self->enemy->s.origin, self, MASK_SHOT);
 
 	if ((tr.fraction != 1.0) && (tr.ent != self->enemy))
 	{
@@ -872,12 +872,12 @@ medic_cable_attack(edict_t *self)
 	if (self->s.frame == FRAME_attack43)
 	{
 		gi.sound(self->enemy, CHAN_AUTO, sound_hook_hit, 1, ATTN_NORM, 0);
-		self->enemy->monsterinfo.aiflags |= AI_RESURRECTING;
+		G_EnsureMonsterInfo(self->enemy)->aiflags |= AI_RESURRECTING;
 	}
 	else if (self->s.frame == FRAME_attack50)
 	{
 		self->enemy->spawnflags = 0;
-		self->enemy->monsterinfo.aiflags = 0;
+		G_EnsureMonsterInfo(self->enemy)->aiflags = 0;
 		self->enemy->target = NULL;
 		self->enemy->targetname = NULL;
 		self->enemy->combattarget = NULL;
@@ -892,7 +892,7 @@ medic_cable_attack(edict_t *self)
 			self->enemy->think(self->enemy);
 		}
 
-		self->enemy->monsterinfo.aiflags |= AI_RESURRECTING;
+		G_EnsureMonsterInfo(self->enemy)->aiflags |= AI_RESURRECTING;
 
 		if (self->oldenemy && self->oldenemy->client)
 		{
@@ -915,12 +915,12 @@ medic_cable_attack(edict_t *self)
 	VectorCopy(self->enemy->s.origin, end);
 	end[2] = self->enemy->absmin[2] + self->enemy->size[2] / 2;
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_MEDIC_CABLE_ATTACK);
-	gi.WriteShort(self - g_edicts);
-	gi.WritePosition(start);
-	gi.WritePosition(end);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_MEDIC_CABLE_ATTACK);
+	G_WriteShort(self - g_edicts);
+	G_WritePosition(start);
+	G_WritePosition(end);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 }
 
 void
@@ -932,7 +932,7 @@ medic_hook_retract(edict_t *self)
 	}
 
 	gi.sound(self, CHAN_WEAPON, sound_hook_retract, 1, ATTN_NORM, 0);
-	self->enemy->monsterinfo.aiflags &= ~AI_RESURRECTING;
+	G_EnsureMonsterInfo(self->enemy)->aiflags &= ~AI_RESURRECTING;
 }
 
 static mframe_t medic_frames_attackCable[] = {
@@ -982,13 +982,13 @@ medic_attack(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_MEDIC)
+	if (G_MonsterInfo(self)->aiflags & AI_MEDIC)
 	{
-		self->monsterinfo.currentmove = &medic_move_attackCable;
+		G_EnsureMonsterInfo(self)->currentmove = &medic_move_attackCable;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &medic_move_attackBlaster;
+		G_EnsureMonsterInfo(self)->currentmove = &medic_move_attackBlaster;
 	}
 }
 
@@ -1000,7 +1000,7 @@ medic_checkattack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_MEDIC)
+	if (G_MonsterInfo(self)->aiflags & AI_MEDIC)
 	{
 		medic_attack(self);
 		return true;
@@ -1057,21 +1057,21 @@ SP_monster_medic(edict_t *self)
 	self->pain = medic_pain;
 	self->die = medic_die;
 
-	self->monsterinfo.stand = medic_stand;
-	self->monsterinfo.walk = medic_walk;
-	self->monsterinfo.run = medic_run;
-	self->monsterinfo.dodge = medic_dodge;
-	self->monsterinfo.attack = medic_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = medic_sight;
-	self->monsterinfo.idle = medic_idle;
-	self->monsterinfo.search = medic_search;
-	self->monsterinfo.checkattack = medic_checkattack;
-
-	gi.linkentity(self);
-
-	self->monsterinfo.currentmove = &medic_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->stand = medic_stand;
+	G_EnsureMonsterInfo(self)->walk = medic_walk;
+	G_EnsureMonsterInfo(self)->run = medic_run;
+	G_EnsureMonsterInfo(self)->dodge = medic_dodge;
+	G_EnsureMonsterInfo(self)->attack = medic_attack;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = medic_sight;
+	G_EnsureMonsterInfo(self)->idle = medic_idle;
+	G_EnsureMonsterInfo(self)->search = medic_search;
+	G_EnsureMonsterInfo(self)->checkattack = medic_checkattack;
+
+	G_LinkEntity(self);
+
+	G_EnsureMonsterInfo(self)->currentmove = &medic_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -43,7 +43,7 @@ M_CheckBottom(edict_t *ent)
 			start[0] = x ? maxs[0] : mins[0];
 			start[1] = y ? maxs[1] : mins[1];
 
-			if (gi.pointcontents(start) != CONTENTS_SOLID)
+			if (G_PointContents(start) != CONTENTS_SOLID)
 			{
 				goto realcheck;
 			}
@@ -60,7 +60,7 @@ realcheck:
 	start[0] = stop[0] = (mins[0] + maxs[0]) * 0.5;
 	start[1] = stop[1] = (mins[1] + maxs[1]) * 0.5;
 	stop[2] = start[2] - 2 * STEPSIZE;
-	trace = gi.trace(start, vec3_origin, vec3_origin,
+	trace = G_Trace(start, vec3_origin, vec3_origin,
 			stop, ent, MASK_MONSTERSOLID);
 
 	if (trace.fraction == 1.0)
@@ -78,7 +78,7 @@ realcheck:
 			start[0] = stop[0] = x ? maxs[0] : mins[0];
 			start[1] = stop[1] = y ? maxs[1] : mins[1];
 
-			trace = gi.trace(start, vec3_origin, vec3_origin,
+			trace = G_Trace(start, vec3_origin, vec3_origin,
 					stop, ent, MASK_MONSTERSOLID);
 
 			if ((trace.fraction != 1.0) && (trace.endpos[2] > bottom))
@@ -216,7 +216,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 				}
 			}
 
-			trace = gi.trace(ent->s.origin, ent->mins, ent->maxs,
+			trace = G_Trace(ent->s.origin, ent->mins, ent->maxs,
 					neworg, ent, MASK_MONSTERSOLID);
 
 			/* fly monsters don't enter water voluntarily */
@@ -227,7 +227,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 					test[0] = trace.endpos[0];
 					test[1] = trace.endpos[1];
 					test[2] = trace.endpos[2] + ent->mins[2] + 1;
-					contents = gi.pointcontents(test);
+					contents = G_PointContents(test);
 
 					if (contents & MASK_WATER)
 					{
@@ -244,7 +244,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 					test[0] = trace.endpos[0];
 					test[1] = trace.endpos[1];
 					test[2] = trace.endpos[2] + ent->mins[2] + 1;
-					contents = gi.pointcontents(test);
+					contents = G_PointContents(test);
 
 					if (!(contents & MASK_WATER))
 					{
@@ -259,7 +259,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 
 				if (relink)
 				{
-					gi.linkentity(ent);
+					G_LinkEntity(ent);
 					G_TouchTriggers(ent);
 				}
 
@@ -276,7 +276,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 	}
 
 	/* push down from a step height above the wished position */
-	if (!(ent->monsterinfo.aiflags & AI_NOSTEP))
+	if (!(G_MonsterInfo(ent)->aiflags & AI_NOSTEP))
 	{
 		stepsize = STEPSIZE;
 	}
@@ -289,7 +289,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 	VectorCopy(neworg, end);
 	end[2] -= stepsize * 2;
 
-	trace = gi.trace(neworg, ent->mins, ent->maxs, end, ent, MASK_MONSTERSOLID);
+	trace = G_Trace(neworg, ent->mins, ent->maxs, end, ent, MASK_MONSTERSOLID);
 
 	if (trace.allsolid)
 	{
@@ -299,7 +299,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 	if (trace.startsolid)
 	{
 		neworg[2] -= stepsize;
-		trace = gi.trace(neworg, ent->mins, ent->maxs,
+		trace = G_Trace(neworg, ent->mins, ent->maxs,
 				end, ent, MASK_MONSTERSOLID);
 
 		if (trace.allsolid || trace.startsolid)
@@ -314,7 +314,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 		test[0] = trace.endpos[0];
 		test[1] = trace.endpos[1];
 		test[2] = trace.endpos[2] + ent->mins[2] + 1;
-		contents = gi.pointcontents(test);
+		contents = G_PointContents(test);
 
 		if (contents & MASK_WATER)
 		{
@@ -331,7 +331,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 
 			if (relink)
 			{
-				gi.linkentity(ent);
+				G_LinkEntity(ent);
 				G_TouchTriggers(ent);
 			}
 
@@ -354,7 +354,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 			   correct */
 			if (relink)
 			{
-				gi.linkentity(ent);
+				G_LinkEntity(ent);
 				G_TouchTriggers(ent);
 			}
 
@@ -376,7 +376,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 	/* the move is ok */
 	if (relink)
 	{
-		gi.linkentity(ent);
+		G_LinkEntity(ent);
 		G_TouchTriggers(ent);
 	}
 
@@ -478,12 +478,12 @@ SV_StepDirection(edict_t *ent, float yaw, float dist)
 			VectorCopy(oldorigin, ent->s.origin);
 		}
 
-		gi.linkentity(ent);
+		G_LinkEntity(ent);
 		G_TouchTriggers(ent);
 		return true;
 	}
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 	G_TouchTriggers(ent);
 	return false;
 }
@@ -562,7 +562,7 @@ SV_NewChaseDir(edict_t *actor, edict_t *enemy, float dist)
 	}
 
 	/* try other directions */
-	if (((randk() & 3) & 1) || (fabsf(deltay) > fabsf(deltax)))
+	if (((G_RandInt(RAND_AI) & 3) & 1) || (fabsf(deltay) > fabsf(deltax)))
 	{
 		tdir = d[1];
 		d[1] = d[2];
@@ -587,7 +587,7 @@ SV_NewChaseDir(edict_t *actor, edict_t *enemy, float dist)
 		return;
 	}
 
-	if (randk() & 1) /*randomly determine direction of search*/
+	if (G_RandInt(RAND_AI) & 1) /*randomly determine direction of search*/
 	{
 		for (tdir = 0; tdir <= 315; tdir += 45)
 		{
@@ -674,7 +674,7 @@ M_MoveToGoal(edict_t *ent, float dist)
 	}
 
 	/* bump around... */
-	if (((randk() & 3) == 1) || !SV_StepDirection(ent, ent->ideal_yaw, dist))
+	if (((G_RandInt(RAND_AI) & 3) == 1) || !SV_StepDirection(ent, ent->ideal_yaw, dist))
 	{
 		if (ent->inuse)
 		{
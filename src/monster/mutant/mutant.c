@@ -34,7 +34,7 @@ mutant_step(edict_t *self)
 		return;
 	}
 
-	n = (randk() + 1) % 3;
+	n = (G_RandInt(RAND_AI) + 1) % 3;
 
 	if (n == 0)
 	{
@@ -157,7 +157,7 @@ mutant_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &mutant_move_stand;
 }
 
 void
@@ -168,9 +168,9 @@ mutant_idle_loop(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.75)
+	if (G_Random(RAND_AI) < 0.75)
 	{
-		self->monsterinfo.nextframe = FRAME_stand155;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_stand155;
 	}
 }
 
@@ -205,7 +205,7 @@ mutant_idle(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_idle;
+	G_EnsureMonsterInfo(self)->currentmove = &mutant_move_idle;
 	gi.sound(self, CHAN_VOICE, sound_idle, 1, ATTN_IDLE, 0);
 }
 
@@ -239,7 +239,7 @@ mutant_walk_loop(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &mutant_move_walk;
 }
 
 static mframe_t mutant_frames_start_walk[] = {
@@ -264,7 +264,7 @@ mutant_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_start_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &mutant_move_start_walk;
 }
 
 static mframe_t mutant_frames_run[] = {
@@ -291,13 +291,13 @@ mutant_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &mutant_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &mutant_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &mutant_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &mutant_move_run;
 	}
 }
 
@@ -313,7 +313,7 @@ mutant_hit_left(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], 8);
 
-	if (fire_hit(self, aim, (10 + (randk() % 5)), 100))
+	if (fire_hit(self, aim, (10 + (G_RandInt(RAND_AI) % 5)), 100))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_hit, 1, ATTN_NORM, 0);
 	}
@@ -335,7 +335,7 @@ mutant_hit_right(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->maxs[0], 8);
 
-	if (fire_hit(self, aim, (10 + (randk() % 5)), 100))
+	if (fire_hit(self, aim, (10 + (G_RandInt(RAND_AI) % 5)), 100))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_hit2, 1, ATTN_NORM, 0);
 	}
@@ -358,9 +358,9 @@ mutant_check_refire(edict_t *self)
 		return;
 	}
 
-	if (((skill->value == SKILL_HARDPLUS) && (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+	if (((skill->value == SKILL_HARDPLUS) && (G_Random(RAND_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attack09;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attack09;
 	}
 }
 
@@ -389,7 +389,7 @@ mutant_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_attack;
+	G_EnsureMonsterInfo(self)->currentmove = &mutant_move_attack;
 }
 void
 mutant_jump_touch(edict_t *self, edict_t *other,
@@ -417,7 +417,7 @@ mutant_jump_touch(edict_t *self, edict_t *other,
 			VectorCopy(self->velocity, normal);
 			VectorNormalize(normal);
 			VectorMA(self->s.origin, self->maxs[0], normal, point);
-			damage = 40 + 10 * random();
+			damage = 40 + 10 * G_Random(RAND_AI);
 			T_Damage(other, self, self, self->velocity, point,
 					normal, damage, damage, 0, MOD_UNKNOWN);
 		}
@@ -427,7 +427,7 @@ mutant_jump_touch(edict_t *self, edict_t *other,
 	{
 		if (self->groundentity)
 		{
-			self->monsterinfo.nextframe = FRAME_attack02;
+			G_EnsureMonsterInfo(self)->nextframe = FRAME_attack02;
 			self->touch = NULL;
 		}
 
@@ -453,8 +453,8 @@ mutant_jump_takeoff(edict_t *self)
 	VectorScale(forward, 600, self->velocity);
 	self->velocity[2] = 250;
 	self->groundentity = NULL;
-	self->monsterinfo.aiflags |= AI_DUCKED;
-	self->monsterinfo.attack_finished = level.time + 3;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->attack_finished = level.time + 3;
 	self->touch = mutant_jump_touch;
 }
 
@@ -469,18 +469,18 @@ mutant_check_landing(edict_t *self)
 	if (self->groundentity)
 	{
 		gi.sound(self, CHAN_WEAPON, sound_thud, 1, ATTN_NORM, 0);
-		self->monsterinfo.attack_finished = 0;
-		self->monsterinfo.aiflags &= ~AI_DUCKED;
+		G_EnsureMonsterInfo(self)->attack_finished = 0;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 		return;
 	}
 
-	if (level.time > self->monsterinfo.attack_finished)
+	if (level.time > G_MonsterInfo(self)->attack_finished)
 	{
-		self->monsterinfo.nextframe = FRAME_attack02;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attack02;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_attack05;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attack05;
 	}
 }
 
@@ -510,7 +510,7 @@ mutant_jump(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_jump;
+	G_EnsureMonsterInfo(self)->currentmove = &mutant_move_jump;
 }
 
 qboolean
@@ -562,7 +562,7 @@ mutant_check_jump(edict_t *self)
 
 	if (distance > 100)
 	{
-		if (random() < 0.9)
+		if (G_Random(RAND_AI) < 0.9)
 		{
 			return false;
 		}
@@ -586,13 +586,13 @@ mutant_checkattack(edict_t *self)
 
 	if (mutant_check_melee(self))
 	{
-		self->monsterinfo.attack_state = AS_MELEE;
+		G_EnsureMonsterInfo(self)->attack_state = AS_MELEE;
 		return true;
 	}
 
 	if (mutant_check_jump(self))
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
+		G_EnsureMonsterInfo(self)->attack_state = AS_MISSILE;
 		return true;
 	}
 
@@ -679,22 +679,22 @@ mutant_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r < 0.33)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &mutant_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &mutant_move_pain1;
 	}
 	else if (r < 0.66)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &mutant_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &mutant_move_pain2;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &mutant_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &mutant_move_pain3;
 	}
 }
 
@@ -710,7 +710,7 @@ mutant_dead(edict_t *self)
 	VectorSet(self->maxs, 16, 16, -8);
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
 	M_FlyCheck(self);
 }
@@ -795,13 +795,13 @@ mutant_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->takedamage = DAMAGE_YES;
 	self->s.skinnum = 1;
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &mutant_move_death1;
+		G_EnsureMonsterInfo(self)->currentmove = &mutant_move_death1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &mutant_move_death2;
+		G_EnsureMonsterInfo(self)->currentmove = &mutant_move_death2;
 	}
 }
 
@@ -849,21 +849,21 @@ SP_monster_mutant(edict_t *self)
 	self->pain = mutant_pain;
 	self->die = mutant_die;
 
-	self->monsterinfo.stand = mutant_stand;
-	self->monsterinfo.walk = mutant_walk;
-	self->monsterinfo.run = mutant_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = mutant_jump;
-	self->monsterinfo.melee = mutant_melee;
-	self->monsterinfo.sight = mutant_sight;
-	self->monsterinfo.search = mutant_search;
-	self->monsterinfo.idle = mutant_idle;
-	self->monsterinfo.checkattack = mutant_checkattack;
+	G_EnsureMonsterInfo(self)->stand = mutant_stand;
+	G_EnsureMonsterInfo(self)->walk = mutant_walk;
+	G_EnsureMonsterInfo(self)->run = mutant_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = mutant_jump;
+	G_EnsureMonsterInfo(self)->melee = mutant_melee;
+	G_EnsureMonsterInfo(self)->sight = mutant_sight;
+	G_EnsureMonsterInfo(self)->search = mutant_search;
+	G_EnsureMonsterInfo(self)->idle = mutant_idle;
+	G_EnsureMonsterInfo(self)->checkattack = mutant_checkattack;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &mutant_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &mutant_move_stand;
 
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 	walkmonster_start(self);
 }
@@ -182,7 +182,7 @@ parasite_end_fidget(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_end_fidget;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_end_fidget;
 }
 
 void
@@ -193,7 +193,7 @@ parasite_do_fidget(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_fidget;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_fidget;
 }
 
 void
@@ -204,13 +204,13 @@ parasite_refidget(edict_t *self)
 		return;
 	}
 
-	if (random() <= 0.8)
+	if (G_Random(RAND_AI) <= 0.8)
 	{
-		self->monsterinfo.currentmove = &parasite_move_fidget;
+		G_EnsureMonsterInfo(self)->currentmove = &parasite_move_fidget;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &parasite_move_end_fidget;
+		G_EnsureMonsterInfo(self)->currentmove = &parasite_move_end_fidget;
 	}
 }
 
@@ -222,7 +222,7 @@ parasite_idle(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_start_fidget;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_start_fidget;
 }
 
 static mframe_t parasite_frames_stand[] = {
@@ -261,7 +261,7 @@ parasite_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_stand;
 }
 
 static mframe_t parasite_frames_run[] = {
@@ -320,13 +320,13 @@ parasite_start_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &parasite_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &parasite_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &parasite_move_start_run;
+		G_EnsureMonsterInfo(self)->currentmove = &parasite_move_start_run;
 	}
 }
 
@@ -338,13 +338,13 @@ parasite_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &parasite_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &parasite_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &parasite_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &parasite_move_run;
 	}
 }
 
@@ -404,7 +404,7 @@ parasite_start_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_start_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_start_walk;
 }
 
 void
@@ -415,7 +415,7 @@ parasite_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_walk;
 }
 
 static mframe_t parasite_frames_pain1[] = {
@@ -466,7 +466,7 @@ parasite_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
@@ -475,7 +475,7 @@ parasite_pain(edict_t *self, edict_t *other /* unused */,
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_pain1;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_pain1;
 }
 
 qboolean
@@ -542,7 +542,7 @@ parasite_drain_attack(edict_t *self)
 
 	VectorCopy(self->enemy->s.origin, end);
 
-	tr = gi.trace(start, NULL, NULL, end, self, MASK_SHOT);
+	tr = G_Trace(start, NULL, NULL, end, self, MASK_SHOT);
 
 	if (tr.ent != self->enemy)
 	{
@@ -564,12 +564,12 @@ parasite_drain_attack(edict_t *self)
 		damage = 2;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_PARASITE_ATTACK);
-	gi.WriteShort(self - g_edicts);
-	gi.WritePosition(start);
-	gi.WritePosition(end);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_PARASITE_ATTACK);
+	G_WriteShort(self - g_edicts);
+	G_WritePosition(start);
+	G_WritePosition(end);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	VectorSubtract(start, end, dir);
 	T_Damage(self->enemy, self, self, dir, self->enemy->s.origin, vec3_origin,
@@ -656,7 +656,7 @@ parasite_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_drain;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_drain;
 }
 
 void
@@ -672,7 +672,7 @@ parasite_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t parasite_frames_death[] = {
@@ -737,7 +737,7 @@ parasite_die(edict_t *self, edict_t *inflictor /* unused */,
 	gi.sound(self, CHAN_VOICE, sound_die, 1, ATTN_NORM, 0);
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.currentmove = &parasite_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_death;
 }
 
 /*
@@ -783,18 +783,18 @@ SP_monster_parasite(edict_t *self)
 	self->pain = parasite_pain;
 	self->die = parasite_die;
 
-	self->monsterinfo.stand = parasite_stand;
-	self->monsterinfo.walk = parasite_start_walk;
-	self->monsterinfo.run = parasite_start_run;
-	self->monsterinfo.attack = parasite_attack;
-	self->monsterinfo.sight = parasite_sight;
-	self->monsterinfo.idle = parasite_idle;
-	self->monsterinfo.search = parasite_search;
+	G_EnsureMonsterInfo(self)->stand = parasite_stand;
+	G_EnsureMonsterInfo(self)->walk = parasite_start_walk;
+	G_EnsureMonsterInfo(self)->run = parasite_start_run;
+	G_EnsureMonsterInfo(self)->attack = parasite_attack;
+	G_EnsureMonsterInfo(self)->sight = parasite_sight;
+	G_EnsureMonsterInfo(self)->idle = parasite_idle;
+	G_EnsureMonsterInfo(self)->search = parasite_search;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &parasite_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &parasite_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
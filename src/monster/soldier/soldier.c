@@ -68,7 +68,7 @@ soldier_footstep(edict_t *self)
 	}
 
 	int i;
-	i = randk() % 4;
+	i = G_RandInt(RAND_AI) % 4;
 
 	if (i == 0)
 	{
@@ -97,7 +97,7 @@ soldier_idle(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.8)
+	if (G_Random(RAND_AI) > 0.8)
 	{
 		gi.sound(self, CHAN_VOICE, sound_idle, 1, ATTN_IDLE, 0);
 	}
@@ -225,14 +225,14 @@ soldier_stand(edict_t *self)
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &soldier_move_stand3) ||
-		(random() < 0.8))
+	if ((G_MonsterInfo(self)->currentmove == &soldier_move_stand3) ||
+		(G_Random(RAND_AI) < 0.8))
 	{
-		self->monsterinfo.currentmove = &soldier_move_stand1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_stand1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_stand3;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_stand3;
 	}
 }
 
@@ -244,9 +244,9 @@ soldier_walk1_random(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.1)
+	if (G_Random(RAND_AI) > 0.1)
 	{
-		self->monsterinfo.nextframe = FRAME_walk101;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_walk101;
 	}
 }
 
@@ -323,13 +323,13 @@ soldier_walk(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &soldier_move_walk1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_walk1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_walk2;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_walk2;
 	}
 }
 
@@ -371,21 +371,21 @@ soldier_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &soldier_move_stand1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_stand1;
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &soldier_move_walk1) ||
-		(self->monsterinfo.currentmove == &soldier_move_walk2) ||
-		(self->monsterinfo.currentmove == &soldier_move_start_run))
+	if ((G_MonsterInfo(self)->currentmove == &soldier_move_walk1) ||
+		(G_MonsterInfo(self)->currentmove == &soldier_move_walk2) ||
+		(G_MonsterInfo(self)->currentmove == &soldier_move_start_run))
 	{
-		self->monsterinfo.currentmove = &soldier_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_run;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_start_run;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_start_run;
 	}
 }
 
@@ -500,11 +500,11 @@ soldier_pain(edict_t *self, edict_t *other /* unused */,
 	if (level.time < self->pain_debounce_time)
 	{
 		if ((self->velocity[2] > 100) &&
-			((self->monsterinfo.currentmove == &soldier_move_pain1) ||
-			 (self->monsterinfo.currentmove == &soldier_move_pain2) ||
-			 (self->monsterinfo.currentmove == &soldier_move_pain3)))
+			((G_MonsterInfo(self)->currentmove == &soldier_move_pain1) ||
+			 (G_MonsterInfo(self)->currentmove == &soldier_move_pain2) ||
+			 (G_MonsterInfo(self)->currentmove == &soldier_move_pain3)))
 		{
-			self->monsterinfo.currentmove = &soldier_move_pain4;
+			G_EnsureMonsterInfo(self)->currentmove = &soldier_move_pain4;
 		}
 
 		return;
@@ -529,7 +529,7 @@ soldier_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &soldier_move_pain4;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_pain4;
 		return;
 	}
 
@@ -538,19 +538,19 @@ soldier_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r < 0.33)
 	{
-		self->monsterinfo.currentmove = &soldier_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_pain1;
 	}
 	else if (r < 0.66)
 	{
-		self->monsterinfo.currentmove = &soldier_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_pain2;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_pain3;
 	}
 }
 
@@ -635,8 +635,8 @@ soldier_fire(edict_t *self, int flash_number)
 		vectoangles(aim, dir);
 		AngleVectors(dir, forward, right, up);
 
-		r = crandom() * 1000;
-		u = crandom() * 500;
+		r = G_CRandom(RAND_AI) * 1000;
+		u = G_CRandom(RAND_AI) * 500;
 		VectorMA(start, 8192, forward, end);
 		VectorMA(end, r, right, end);
 		VectorMA(end, u, up, end);
@@ -657,21 +657,21 @@ soldier_fire(edict_t *self, int flash_number)
 	}
 	else
 	{
-		if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
+		if (!(G_MonsterInfo(self)->aiflags & AI_HOLD_FRAME))
 		{
-			self->monsterinfo.pausetime = level.time + (3 + randk() % 8) * FRAMETIME;
+			G_EnsureMonsterInfo(self)->pausetime = level.time + (3 + G_RandInt(RAND_AI) % 8) * FRAMETIME;
 		}
 
 		monster_fire_bullet(self, start, aim, 2, 4, DEFAULT_BULLET_HSPREAD,
 				DEFAULT_BULLET_VSPREAD, flash_index);
 
-		if (level.time >= self->monsterinfo.pausetime)
+		if (level.time >= G_MonsterInfo(self)->pausetime)
 		{
-			self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 		}
 		else
 		{
-			self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+			G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 		}
 	}
 }
@@ -706,13 +706,13 @@ soldier_attack1_refire1(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (G_Random(RAND_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak102;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak102;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_attak110;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak110;
 	}
 }
 
@@ -735,9 +735,9 @@ soldier_attack1_refire2(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (G_Random(RAND_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak102;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak102;
 	}
 }
 
@@ -799,13 +799,13 @@ soldier_attack2_refire1(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (G_Random(RAND_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak204;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak204;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_attak216;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak216;
 	}
 }
 
@@ -833,9 +833,9 @@ soldier_attack2_refire2(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (G_Random(RAND_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak204;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak204;
 	}
 }
 
@@ -876,16 +876,16 @@ soldier_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (G_MonsterInfo(self)->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.linkentity(self);
+	G_EnsureMonsterInfo(self)->pausetime = level.time + 1;
+	G_LinkEntity(self);
 }
 
 void
@@ -896,10 +896,10 @@ soldier_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -922,9 +922,9 @@ soldier_attack3_refire(edict_t *self)
 		return;
 	}
 
-	if ((level.time + 0.4) < self->monsterinfo.pausetime)
+	if ((level.time + 0.4) < G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.nextframe = FRAME_attak303;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak303;
 	}
 }
 
@@ -1007,7 +1007,7 @@ soldier_attack6_refire(edict_t *self)
 
 	if (skill->value == SKILL_HARDPLUS)
 	{
-		self->monsterinfo.nextframe = FRAME_runs03;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_runs03;
 	}
 }
 
@@ -1046,18 +1046,18 @@ soldier_attack(edict_t *self)
 
 	if (self->s.skinnum < 4)
 	{
-		if (random() < 0.5)
+		if (G_Random(RAND_AI) < 0.5)
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &soldier_move_attack1;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack2;
+			G_EnsureMonsterInfo(self)->currentmove = &soldier_move_attack2;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_attack4;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_attack4;
 	}
 }
 
@@ -1069,7 +1069,7 @@ soldier_sight(edict_t *self, edict_t *other /* unused */)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_sight1, 1, ATTN_NORM, 0);
 	}
@@ -1080,9 +1080,9 @@ soldier_sight(edict_t *self, edict_t *other /* unused */)
 
 	if ((skill->value > SKILL_EASY) && (range(self, self->enemy) >= RANGE_MID))
 	{
-		if (random() > 0.5)
+		if (G_Random(RAND_AI) > 0.5)
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack6;
+			G_EnsureMonsterInfo(self)->currentmove = &soldier_move_attack6;
 		}
 	}
 }
@@ -1095,13 +1095,13 @@ soldier_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -1131,7 +1131,7 @@ soldier_dodge(edict_t *self, edict_t *attacker, float eta)
 		return;
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r > 0.25)
 	{
@@ -1146,22 +1146,22 @@ soldier_dodge(edict_t *self, edict_t *attacker, float eta)
 
 	if (skill->value == SKILL_EASY)
 	{
-		self->monsterinfo.currentmove = &soldier_move_duck;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_duck;
 		return;
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.3;
-	r = random();
+	G_EnsureMonsterInfo(self)->pausetime = level.time + eta + 0.3;
+	r = G_Random(RAND_AI);
 
 	if (skill->value == SKILL_MEDIUM)
 	{
 		if (r > 0.33)
 		{
-			self->monsterinfo.currentmove = &soldier_move_duck;
+			G_EnsureMonsterInfo(self)->currentmove = &soldier_move_duck;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack3;
+			G_EnsureMonsterInfo(self)->currentmove = &soldier_move_attack3;
 		}
 
 		return;
@@ -1171,17 +1171,17 @@ soldier_dodge(edict_t *self, edict_t *attacker, float eta)
 	{
 		if (r > 0.66)
 		{
-			self->monsterinfo.currentmove = &soldier_move_duck;
+			G_EnsureMonsterInfo(self)->currentmove = &soldier_move_duck;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack3;
+			G_EnsureMonsterInfo(self)->currentmove = &soldier_move_attack3;
 		}
 
 		return;
 	}
 
-	self->monsterinfo.currentmove = &soldier_move_attack3;
+	G_EnsureMonsterInfo(self)->currentmove = &soldier_move_attack3;
 }
 
 void
@@ -1219,7 +1219,7 @@ soldier_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t soldier_frames_death1[] = {
@@ -1565,31 +1565,31 @@ soldier_die(edict_t *self, edict_t *inflictor /* unused */,
 	if (fabs((self->s.origin[2] + self->viewheight) - point[2]) <= 4)
 	{
 		/* head shot */
-		self->monsterinfo.currentmove = &soldier_move_death3;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_death3;
 		return;
 	}
 
-	n = randk() % 5;
+	n = G_RandInt(RAND_AI) % 5;
 
 	if (n == 0)
 	{
-		self->monsterinfo.currentmove = &soldier_move_death1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_death1;
 	}
 	else if (n == 1)
 	{
-		self->monsterinfo.currentmove = &soldier_move_death2;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_death2;
 	}
 	else if (n == 2)
 	{
-		self->monsterinfo.currentmove = &soldier_move_death4;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_death4;
 	}
 	else if (n == 3)
 	{
-		self->monsterinfo.currentmove = &soldier_move_death5;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_death5;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_death6;
+		G_EnsureMonsterInfo(self)->currentmove = &soldier_move_death6;
 	}
 }
 
@@ -1609,7 +1609,7 @@ SP_monster_soldier_x(edict_t *self)
 	sound_step4 = 0;
 
 	self->s.modelindex = gi.modelindex("models/monsters/soldier/tris.md2");
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 	VectorSet(self->mins, -16, -16, -24);
 	VectorSet(self->maxs, 16, 16, 32);
 	self->movetype = MOVETYPE_STEP;
@@ -1625,17 +1625,17 @@ SP_monster_soldier_x(edict_t *self)
 	self->pain = soldier_pain;
 	self->die = soldier_die;
 
-	self->monsterinfo.stand = soldier_stand;
-	self->monsterinfo.walk = soldier_walk;
-	self->monsterinfo.run = soldier_run;
-	self->monsterinfo.dodge = soldier_dodge;
-	self->monsterinfo.attack = soldier_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = soldier_sight;
+	G_EnsureMonsterInfo(self)->stand = soldier_stand;
+	G_EnsureMonsterInfo(self)->walk = soldier_walk;
+	G_EnsureMonsterInfo(self)->run = soldier_run;
+	G_EnsureMonsterInfo(self)->dodge = soldier_dodge;
+	G_EnsureMonsterInfo(self)->attack = soldier_attack;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = soldier_sight;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.stand(self);
+	G_MonsterInfo(self)->stand(self);
 
 	walkmonster_start(self);
 }
@@ -1749,7 +1749,7 @@ soldierh_idle(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.8)
+	if (G_Random(RAND_AI) > 0.8)
 	{
 		gi.sound(self, CHAN_VOICE, sound_idle, 1, ATTN_IDLE, 0);
 	}
@@ -1875,13 +1875,13 @@ soldierh_stand(edict_t *self)
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &soldierh_move_stand3) || (random() < 0.8))
+	if ((G_MonsterInfo(self)->currentmove == &soldierh_move_stand3) || (G_Random(RAND_AI) < 0.8))
 	{
-		self->monsterinfo.currentmove = &soldierh_move_stand1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_stand1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldierh_move_stand3;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_stand3;
 	}
 }
 
@@ -1893,9 +1893,9 @@ soldierh_walk1_random(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.1)
+	if (G_Random(RAND_AI) > 0.1)
 	{
-		self->monsterinfo.nextframe = FRAME_walk101;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_walk101;
 	}
 }
 
@@ -1970,13 +1970,13 @@ soldierh_walk(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_walk1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_walk1;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldierh_move_walk2;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_walk2;
 	}
 }
 
@@ -2016,21 +2016,21 @@ soldierh_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_stand1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_stand1;
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &soldierh_move_walk1) ||
-		(self->monsterinfo.currentmove == &soldierh_move_walk2) ||
-		(self->monsterinfo.currentmove == &soldierh_move_start_run))
+	if ((G_MonsterInfo(self)->currentmove == &soldierh_move_walk1) ||
+		(G_MonsterInfo(self)->currentmove == &soldierh_move_walk2) ||
+		(G_MonsterInfo(self)->currentmove == &soldierh_move_start_run))
 	{
-		self->monsterinfo.currentmove = &soldierh_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_run;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldierh_move_start_run;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_start_run;
 	}
 }
 
@@ -2141,11 +2141,11 @@ soldierh_pain(edict_t *self, edict_t *other /* unused */,
 	if (level.time < self->pain_debounce_time)
 	{
 		if ((self->velocity[2] > 100) &&
-			((self->monsterinfo.currentmove == &soldierh_move_pain1) ||
-		(self->monsterinfo.currentmove == &soldierh_move_pain2) ||
-		(self->monsterinfo.currentmove == &soldierh_move_pain3)))
+			((G_MonsterInfo(self)->currentmove == &soldierh_move_pain1) ||
+		(G_MonsterInfo(self)->currentmove == &soldierh_move_pain2) ||
+		(G_MonsterInfo(self)->currentmove == &soldierh_move_pain3)))
 		{
-			self->monsterinfo.currentmove = &soldierh_move_pain4;
+			G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_pain4;
 		}
 
 		return;
@@ -2170,7 +2170,7 @@ soldierh_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_pain4;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_pain4;
 		return;
 	}
 
@@ -2179,19 +2179,19 @@ soldierh_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r < 0.33)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_pain1;
 	}
 	else if (r < 0.66)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_pain2;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldierh_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_pain3;
 	}
 }
 
@@ -2209,7 +2209,7 @@ soldierh_laserbeam(edict_t *self, int flash_index)
 		return;
 	}
 
-	if (random() > 0.8)
+	if (G_Random(RAND_AI) > 0.8)
 	{
 		gi.sound(self, CHAN_AUTO, gi.soundindex("misc/lasfly.wav"), 1, ATTN_STATIC, 0);
 	}
@@ -2294,8 +2294,8 @@ soldierh_fire(edict_t *self, int flash_number)
 		vectoangles(aim, dir);
 		AngleVectors(dir, forward, right, up);
 
-		r = crandom() * 100;
-		u = crandom() * 50;
+		r = G_CRandom(RAND_AI) * 100;
+		u = G_CRandom(RAND_AI) * 50;
 		VectorMA(start, 8192, forward, end);
 		VectorMA(end, r, right, end);
 		VectorMA(end, u, up, end);
@@ -2316,20 +2316,20 @@ soldierh_fire(edict_t *self, int flash_number)
 	}
 	else
 	{
-		if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
+		if (!(G_MonsterInfo(self)->aiflags & AI_HOLD_FRAME))
 		{
-			self->monsterinfo.pausetime = level.time + (3 + randk() % 8) * FRAMETIME;
+			G_EnsureMonsterInfo(self)->pausetime = level.time + (3 + G_RandInt(RAND_AI) % 8) * FRAMETIME;
 		}
 
 		soldierh_laserbeam(self, flash_index);
 
-		if (level.time >= self->monsterinfo.pausetime)
+		if (level.time >= G_MonsterInfo(self)->pausetime)
 		{
-			self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 		}
 		else
 		{
-			self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+			G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 		}
 	}
 }
@@ -2348,7 +2348,7 @@ soldierh_hyper_refire1(edict_t *self)
 	}
 	else if (self->s.skinnum < 4)
 	{
-		if (random() < 0.7)
+		if (G_Random(RAND_AI) < 0.7)
 		{
 			self->s.frame = FRAME_attak103;
 		}
@@ -2406,13 +2406,13 @@ soldierh_attack1_refire1(edict_t *self)
 		return;
 	}
 
-	if (((skill->value == SKILL_HARDPLUS) && (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+	if (((skill->value == SKILL_HARDPLUS) && (G_Random(RAND_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak102;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak102;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_attak110;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak110;
 	}
 }
 
@@ -2434,9 +2434,9 @@ soldierh_attack1_refire2(edict_t *self)
 		return;
 	}
 
-	if (((skill->value == SKILL_HARDPLUS) && (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+	if (((skill->value == SKILL_HARDPLUS) && (G_Random(RAND_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak102;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak102;
 	}
 }
 
@@ -2498,7 +2498,7 @@ soldierh_hyper_refire2(edict_t *self)
 	}
 	else if (self->s.skinnum < 4)
 	{
-		if (random() < 0.7)
+		if (G_Random(RAND_AI) < 0.7)
 		{
 			self->s.frame = FRAME_attak205;
 		}
@@ -2556,13 +2556,13 @@ soldierh_attack2_refire1(edict_t *self)
 		return;
 	}
 
-	if (((skill->value == SKILL_HARDPLUS) && (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+	if (((skill->value == SKILL_HARDPLUS) && (G_Random(RAND_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak204;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak204;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_attak216;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak216;
 	}
 }
 
@@ -2585,10 +2585,10 @@ soldierh_attack2_refire2(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) ||
+		 (G_Random(RAND_AI) < 0.5)) ||
 		((range(self, self->enemy) == RANGE_MELEE) && (self->s.skinnum < 4)))
 	{
-		self->monsterinfo.nextframe = FRAME_attak204;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak204;
 	}
 }
 
@@ -2628,16 +2628,16 @@ soldierh_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (G_MonsterInfo(self)->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.linkentity(self);
+	G_EnsureMonsterInfo(self)->pausetime = level.time + 1;
+	G_LinkEntity(self);
 }
 
 void
@@ -2648,10 +2648,10 @@ soldierh_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	G_EnsureMonsterInfo(self)->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -2674,9 +2674,9 @@ soldierh_attack3_refire(edict_t *self)
 		return;
 	}
 
-	if ((level.time + 0.4) < self->monsterinfo.pausetime)
+	if ((level.time + 0.4) < G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.nextframe = FRAME_attak303;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_attak303;
 	}
 }
 
@@ -2757,7 +2757,7 @@ soldierh_attack6_refire(edict_t *self)
 
 	if (skill->value == SKILL_HARDPLUS)
 	{
-		self->monsterinfo.nextframe = FRAME_runs03;
+		G_EnsureMonsterInfo(self)->nextframe = FRAME_runs03;
 	}
 }
 
@@ -2795,18 +2795,18 @@ soldierh_attack(edict_t *self)
 
 	if (self->s.skinnum < 4)
 	{
-		if (random() < 0.5)
+		if (G_Random(RAND_AI) < 0.5)
 		{
-			self->monsterinfo.currentmove = &soldierh_move_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_attack1;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldierh_move_attack2;
+			G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_attack2;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldierh_move_attack4;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_attack4;
 	}
 }
 
@@ -2818,7 +2818,7 @@ soldierh_sight(edict_t *self, edict_t *other /* unused */)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_sight1, 1, ATTN_NORM, 0);
 	}
@@ -2829,15 +2829,15 @@ soldierh_sight(edict_t *self, edict_t *other /* unused */)
 
 	if ((skill->value > SKILL_EASY) && (range(self, self->enemy) >= RANGE_MID))
 	{
-		if (random() > 0.5)
+		if (G_Random(RAND_AI) > 0.5)
 		{
 			if (self->s.skinnum < 4)
 			{
-				self->monsterinfo.currentmove = &soldierh_move_attack6;
+				G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_attack6;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &soldierh_move_attack4;
+				G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_attack4;
 			}
 		}
 	}
@@ -2851,13 +2851,13 @@ soldierh_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= G_MonsterInfo(self)->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -2886,7 +2886,7 @@ soldierh_dodge(edict_t *self, edict_t *attacker, float eta)
 		return;
 	}
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (r > 0.25)
 	{
@@ -2900,22 +2900,22 @@ soldierh_dodge(edict_t *self, edict_t *attacker, float eta)
 
 	if (skill->value == SKILL_EASY)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_duck;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_duck;
 		return;
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.3;
-	r = random();
+	G_EnsureMonsterInfo(self)->pausetime = level.time + eta + 0.3;
+	r = G_Random(RAND_AI);
 
 	if (skill->value == SKILL_MEDIUM)
 	{
 		if (r > 0.33)
 		{
-			self->monsterinfo.currentmove = &soldierh_move_duck;
+			G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_duck;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldierh_move_attack3;
+			G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_attack3;
 		}
 
 		return;
@@ -2925,17 +2925,17 @@ soldierh_dodge(edict_t *self, edict_t *attacker, float eta)
 	{
 		if (r > 0.66)
 		{
-			self->monsterinfo.currentmove = &soldierh_move_duck;
+			G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_duck;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldierh_move_attack3;
+			G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_attack3;
 		}
 
 		return;
 	}
 
-	self->monsterinfo.currentmove = &soldierh_move_attack3;
+	G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_attack3;
 }
 
 void
@@ -2981,7 +2981,7 @@ soldierh_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t soldierh_frames_death1[] = {
@@ -3318,31 +3318,31 @@ soldierh_die(edict_t *self, edict_t *inflictor /* unused */,
 	if (fabs((self->s.origin[2] + self->viewheight) - point[2]) <= 4)
 	{
 		/* head shot */
-		self->monsterinfo.currentmove = &soldierh_move_death3;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_death3;
 		return;
 	}
 
-	n = (self->s.skinnum < 4) ? (randk() % 5) : (1 + (randk() % 4));
+	n = (self->s.skinnum < 4) ? (G_RandInt(RAND_AI) % 5) : (1 + (G_RandInt(RAND_AI) % 4));
 
 	if (n == 0)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_death1;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_death1;
 	}
 	else if (n == 1)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_death2;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_death2;
 	}
 	else if (n == 2)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_death4;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_death4;
 	}
 	else if (n == 3)
 	{
-		self->monsterinfo.currentmove = &soldierh_move_death5;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_death5;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldierh_move_death6;
+		G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_death6;
 	}
 }
 
@@ -3362,7 +3362,7 @@ SP_monster_soldier_h(edict_t *self)
 	sound_step4 = 0;
 
 	self->s.modelindex = gi.modelindex("models/monsters/soldierh/tris.md2");
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 	VectorSet(self->mins, -16, -16, -24);
 	VectorSet(self->maxs, 16, 16, 32);
 	self->movetype = MOVETYPE_STEP;
@@ -3378,18 +3378,18 @@ SP_monster_soldier_h(edict_t *self)
 	self->pain = soldierh_pain;
 	self->die = soldierh_die;
 
-	self->monsterinfo.stand = soldierh_stand;
-	self->monsterinfo.walk = soldierh_walk;
-	self->monsterinfo.run = soldierh_run;
-	self->monsterinfo.dodge = soldierh_dodge;
-	self->monsterinfo.attack = soldierh_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = soldierh_sight;
+	G_EnsureMonsterInfo(self)->stand = soldierh_stand;
+	G_EnsureMonsterInfo(self)->walk = soldierh_walk;
+	G_EnsureMonsterInfo(self)->run = soldierh_run;
+	G_EnsureMonsterInfo(self)->dodge = soldierh_dodge;
+	G_EnsureMonsterInfo(self)->attack = soldierh_attack;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = soldierh_sight;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	/* self->monsterinfo.stand (self); */
-	self->monsterinfo.currentmove = &soldierh_move_stand3;
+	/* G_MonsterInfo(self)->stand (self); */
+	G_EnsureMonsterInfo(self)->currentmove = &soldierh_move_stand3;
 
 	walkmonster_start(self);
 }
@@ -42,7 +42,7 @@ supertank_search(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (G_Random(RAND_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_search1, 1, ATTN_NORM, 0);
 	}
@@ -130,7 +130,7 @@ supertank_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &supertank_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &supertank_move_stand;
 }
 
 static mframe_t supertank_frames_run[] = {
@@ -197,7 +197,7 @@ supertank_forward(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &supertank_move_forward;
+	G_EnsureMonsterInfo(self)->currentmove = &supertank_move_forward;
 }
 
 void
@@ -208,7 +208,7 @@ supertank_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &supertank_move_forward;
+	G_EnsureMonsterInfo(self)->currentmove = &supertank_move_forward;
 }
 
 void
@@ -219,13 +219,13 @@ supertank_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &supertank_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &supertank_move_stand;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &supertank_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &supertank_move_run;
 	}
 }
 
@@ -529,18 +529,18 @@ supertank_reattack1(edict_t *self)
 
 	if (visible(self, self->enemy))
 	{
-		if (random() < 0.9)
+		if (G_Random(RAND_AI) < 0.9)
 		{
-			self->monsterinfo.currentmove = &supertank_move_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &supertank_move_attack1;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &supertank_move_end_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &supertank_move_end_attack1;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &supertank_move_end_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &supertank_move_end_attack1;
 	}
 }
 
@@ -566,7 +566,7 @@ supertank_pain(edict_t *self, edict_t *other /* unused */,
 	/* Lessen the chance of him going into his pain frames */
 	if (damage <= 25)
 	{
-		if (random() < 0.2)
+		if (G_Random(RAND_AI) < 0.2)
 		{
 			return;
 		}
@@ -592,17 +592,17 @@ supertank_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage <= 10)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &supertank_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &supertank_move_pain1;
 	}
 	else if (damage <= 25)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain3, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &supertank_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &supertank_move_pain2;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &supertank_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &supertank_move_pain3;
 	}
 }
 
@@ -698,18 +698,18 @@ supertank_attack(edict_t *self)
 
 	if (range <= 160)
 	{
-		self->monsterinfo.currentmove = &supertank_move_attack1;
+		G_EnsureMonsterInfo(self)->currentmove = &supertank_move_attack1;
 	}
 	else
 	{
 		/* fire rockets more often at distance */
-		if (random() < 0.3)
+		if (G_Random(RAND_AI) < 0.3)
 		{
-			self->monsterinfo.currentmove = &supertank_move_attack1;
+			G_EnsureMonsterInfo(self)->currentmove = &supertank_move_attack1;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &supertank_move_attack2;
+			G_EnsureMonsterInfo(self)->currentmove = &supertank_move_attack2;
 		}
 	}
 }
@@ -727,7 +727,7 @@ supertank_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 void
@@ -743,7 +743,7 @@ BossExplode(edict_t *self)
 
 	self->think = BossExplode;
 	VectorCopy(self->s.origin, org);
-	org[2] += 24 + (randk() & 15);
+	org[2] += 24 + (G_RandInt(RAND_AI) & 15);
 
 	switch (self->count++)
 	{
@@ -798,10 +798,10 @@ BossExplode(edict_t *self)
 			return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_EXPLOSION1);
-	gi.WritePosition(org);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_temp_entity);
+	G_WriteByte(TE_EXPLOSION1);
+	G_WritePosition(org);
+	G_Multicast(self->s.origin, MULTICAST_PVS);
 
 	self->nextthink = level.time + 0.1;
 }
@@ -820,7 +820,7 @@ supertank_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_NO;
 	self->count = 0;
-	self->monsterinfo.currentmove = &supertank_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &supertank_move_death;
 }
 
 /*
@@ -861,24 +861,24 @@ SP_monster_supertank(edict_t *self)
 
 	self->pain = supertank_pain;
 	self->die = supertank_die;
-	self->monsterinfo.stand = supertank_stand;
-	self->monsterinfo.walk = supertank_walk;
-	self->monsterinfo.run = supertank_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = supertank_attack;
-	self->monsterinfo.search = supertank_search;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = NULL;
+	G_EnsureMonsterInfo(self)->stand = supertank_stand;
+	G_EnsureMonsterInfo(self)->walk = supertank_walk;
+	G_EnsureMonsterInfo(self)->run = supertank_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = supertank_attack;
+	G_EnsureMonsterInfo(self)->search = supertank_search;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = NULL;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 
-	self->monsterinfo.currentmove = &supertank_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->currentmove = &supertank_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	if (self->spawnflags & 8)
 	{
-		self->monsterinfo.power_armor_type = POWER_ARMOR_SHIELD;
-		self->monsterinfo.power_armor_power = 400;
+		G_EnsureMonsterInfo(self)->power_armor_type = POWER_ARMOR_SHIELD;
+		G_EnsureMonsterInfo(self)->power_armor_power = 400;
 	}
 
 	walkmonster_start(self);
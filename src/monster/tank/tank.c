@@ -126,7 +126,7 @@ tank_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &tank_move_stand;
+	G_EnsureMonsterInfo(self)->currentmove = &tank_move_stand;
 }
 
 static mframe_t tank_frames_start_walk[] = {
@@ -192,7 +192,7 @@ tank_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &tank_move_walk;
+	G_EnsureMonsterInfo(self)->currentmove = &tank_move_walk;
 }
 
 static mframe_t tank_frames_start_run[] = {
@@ -260,27 +260,27 @@ tank_run(edict_t *self)
 
 	if (self->enemy && self->enemy->client)
 	{
-		self->monsterinfo.aiflags |= AI_BRUTAL;
+		G_EnsureMonsterInfo(self)->aiflags |= AI_BRUTAL;
 	}
 	else
 	{
-		self->monsterinfo.aiflags &= ~AI_BRUTAL;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_BRUTAL;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (G_MonsterInfo(self)->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &tank_move_stand;
+		G_EnsureMonsterInfo(self)->currentmove = &tank_move_stand;
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &tank_move_walk) ||
-		(self->monsterinfo.currentmove == &tank_move_start_run))
+	if ((G_MonsterInfo(self)->currentmove == &tank_move_walk) ||
+		(G_MonsterInfo(self)->currentmove == &tank_move_start_run))
 	{
-		self->monsterinfo.currentmove = &tank_move_run;
+		G_EnsureMonsterInfo(self)->currentmove = &tank_move_run;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &tank_move_start_run;
+		G_EnsureMonsterInfo(self)->currentmove = &tank_move_start_run;
 	}
 }
 
@@ -365,7 +365,7 @@ tank_pain(edict_t *self, edict_t *other /* other */,
 
 	if (damage <= 30)
 	{
-		if (random() > 0.2)
+		if (G_Random(RAND_AI) > 0.2)
 		{
 			return;
 		}
@@ -397,15 +397,15 @@ tank_pain(edict_t *self, edict_t *other /* other */,
 
 	if (damage <= 30)
 	{
-		self->monsterinfo.currentmove = &tank_move_pain1;
+		G_EnsureMonsterInfo(self)->currentmove = &tank_move_pain1;
 	}
 	else if (damage <= 60)
 	{
-		self->monsterinfo.currentmove = &tank_move_pain2;
+		G_EnsureMonsterInfo(self)->currentmove = &tank_move_pain2;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &tank_move_pain3;
+		G_EnsureMonsterInfo(self)->currentmove = &tank_move_pain3;
 	}
 }
 
@@ -619,16 +619,16 @@ tank_reattack_blaster(edict_t *self)
 		{
 			if (self->enemy->health > 0)
 			{
-				if (random() <= 0.6)
+				if (G_Random(RAND_AI) <= 0.6)
 				{
-					self->monsterinfo.currentmove = &tank_move_reattack_blast;
+					G_EnsureMonsterInfo(self)->currentmove = &tank_move_reattack_blast;
 					return;
 				}
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &tank_move_attack_post_blast;
+	G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_post_blast;
 }
 
 void
@@ -827,16 +827,16 @@ tank_refire_rocket(edict_t *self)
 		{
 			if (visible(self, self->enemy))
 			{
-				if (random() <= 0.4)
+				if (G_Random(RAND_AI) <= 0.4)
 				{
-					self->monsterinfo.currentmove = &tank_move_attack_fire_rocket;
+					G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_fire_rocket;
 					return;
 				}
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &tank_move_attack_post_rocket;
+	G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_post_rocket;
 }
 
 void
@@ -847,7 +847,7 @@ tank_doattack_rocket(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &tank_move_attack_fire_rocket;
+	G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_fire_rocket;
 }
 
 void
@@ -864,52 +864,52 @@ tank_attack(edict_t *self)
 
 	if (self->enemy->health < 0)
 	{
-		self->monsterinfo.currentmove = &tank_move_attack_strike;
-		self->monsterinfo.aiflags &= ~AI_BRUTAL;
+		G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_strike;
+		G_EnsureMonsterInfo(self)->aiflags &= ~AI_BRUTAL;
 		return;
 	}
 
 	VectorSubtract(self->enemy->s.origin, self->s.origin, vec);
 	range = VectorLength(vec);
 
-	r = random();
+	r = G_Random(RAND_AI);
 
 	if (range <= 125)
 	{
 		if (r < 0.4)
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_chain;
+			G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_chain;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_blast;
+			G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_blast;
 		}
 	}
 	else if (range <= 250)
 	{
 		if (r < 0.5)
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_chain;
+			G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_chain;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_blast;
+			G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_blast;
 		}
 	}
 	else
 	{
 		if (r < 0.33)
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_chain;
+			G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_chain;
 		}
 		else if (r < 0.66)
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_pre_rocket;
+			G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_pre_rocket;
 			self->pain_debounce_time = level.time + 5.0;    /* no pain for a while */
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_blast;
+			G_EnsureMonsterInfo(self)->currentmove = &tank_move_attack_blast;
 		}
 	}
 }
@@ -927,7 +927,7 @@ tank_dead(edict_t *self)
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
 	self->nextthink = 0;
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 static mframe_t tank_frames_death1[] = {
@@ -1015,7 +1015,7 @@ tank_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	self->monsterinfo.currentmove = &tank_move_death;
+	G_EnsureMonsterInfo(self)->currentmove = &tank_move_death;
 }
 
 /*
@@ -1074,19 +1074,19 @@ SP_monster_tank(edict_t *self)
 
 	self->pain = tank_pain;
 	self->die = tank_die;
-	self->monsterinfo.stand = tank_stand;
-	self->monsterinfo.walk = tank_walk;
-	self->monsterinfo.run = tank_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = tank_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = tank_sight;
-	self->monsterinfo.idle = tank_idle;
-
-	gi.linkentity(self);
-
-	self->monsterinfo.currentmove = &tank_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	G_EnsureMonsterInfo(self)->stand = tank_stand;
+	G_EnsureMonsterInfo(self)->walk = tank_walk;
+	G_EnsureMonsterInfo(self)->run = tank_run;
+	G_EnsureMonsterInfo(self)->dodge = NULL;
+	G_EnsureMonsterInfo(self)->attack = tank_attack;
+	G_EnsureMonsterInfo(self)->melee = NULL;
+	G_EnsureMonsterInfo(self)->sight = tank_sight;
+	G_EnsureMonsterInfo(self)->idle = tank_idle;
+
+	G_LinkEntity(self);
+
+	G_EnsureMonsterInfo(self)->currentmove = &tank_move_stand;
+	G_EnsureMonsterInfo(self)->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 
@@ -212,6 +212,9 @@ ClientObituary(edict_t *self, edict_t *inflictor /* unused */,
 		return;
 	}
 
+	/* scores may change below */
+	InvalidateScoreboard();
+
 	if (coop->value && attacker && attacker->client)
 	{
 		meansOfDeath |= MOD_FRIENDLY_FIRE;
@@ -539,7 +542,7 @@ TossClientWeapon(edict_t *self)
 	if (quad)
 	{
 		self->client->v_angle[YAW] += spread;
-		drop = Drop_Item(self, FindItemByClassname("item_quad"));
+		drop = Drop_Item(self, ITEM_BY_ID(IT_QUAD));
 		self->client->v_angle[YAW] -= spread;
 		drop->spawnflags |= DROPPED_PLAYER_ITEM;
 
@@ -552,7 +555,7 @@ TossClientWeapon(edict_t *self)
 	if (quadfire)
 	{
 		self->client->v_angle[YAW] += spread;
-		drop = Drop_Item(self, FindItemByClassname("item_quadfire"));
+		drop = Drop_Item(self, ITEM_BY_ID(IT_QUADFIRE));
 		self->client->v_angle[YAW] -= spread;
 		drop->spawnflags |= DROPPED_PLAYER_ITEM;
 
@@ -678,7 +681,7 @@ player_die(edict_t *self, edict_t *inflictor, edict_t *attacker,
 	if (self->health < -40)
 	{
 		/* gib (sound is played at end of server frame) */
-		self->sounds = gi.soundindex("misc/udeath.wav");
+		self->sounds = G_SoundIndex(SND_UDEATH);
 
 		for (n = 0; n < 4; n++)
 		{
@@ -729,15 +732,14 @@ player_die(edict_t *self, edict_t *inflictor, edict_t *attacker,
 			/* sound is played at end of server frame */
 			if (!self->sounds)
 			{
-				self->sounds = gi.soundindex(va("*death%i.wav",
-								(randk() % 4) + 1));
+				self->sounds = G_SoundIndex(SND_DEATH1 + (G_RandInt(RAND_EFFECT) % 4));
 			}
 		}
 	}
 
 	self->deadflag = DEAD_DEAD;
 
-	gi.linkentity(self);
+	G_LinkEntity(self);
 }
 
 /* ======================================================================= */
@@ -759,7 +761,7 @@ InitClientPersistant(gclient_t *client)
 
 	memset(&client->pers, 0, sizeof(client->pers));
 
-	item = FindItem("Blaster");
+	item = ITEM_BY_ID(IT_WEAPON_BLASTER);
 	client->pers.selected_item = ITEM_INDEX(item);
 	client->pers.inventory[client->pers.selected_item] = 1;
 
@@ -842,6 +844,7 @@ FetchClientEntData(edict_t *ent)
 	if (coop->value)
 	{
 		ent->client->resp.score = ent->client->pers.score;
+		InvalidateScoreboard();
 	}
 }
 
@@ -941,7 +944,7 @@ SelectRandomDeathmatchSpawnPoint(void)
 		count -= 2;
 	}
 
-	selection = randk() % count;
+	selection = G_RandInt(RAND_SPAWN) % count;
 
 	spot = NULL;
 
@@ -1220,8 +1223,7 @@ body_die(edict_t *self, edict_t *inflictor /* unused */,
 
 	if (self->health < -40)
 	{
-		gi.sound(self, CHAN_BODY, gi.soundindex(
-						"misc/udeath.wav"), 1, ATTN_NORM, 0);
+		gi.sound(self, CHAN_BODY, G_SoundIndex(SND_UDEATH), 1, ATTN_NORM, 0);
 
 		for (n = 0; n < 4; n++)
 		{
@@ -1268,7 +1270,8 @@ CopyToBodyQue(edict_t *ent)
 	body->die = body_die;
 	body->takedamage = DAMAGE_YES;
 
-	gi.linkentity(body);
+	G_LinkEntity(body);
+	G_MarkEdictDirty(body);
 }
 
 void
@@ -1331,11 +1334,11 @@ spectator_respawn(edict_t *ent)
 			strcmp(spectator_password->string, "none") &&
 			strcmp(spectator_password->string, value))
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Spectator password incorrect.\n");
+			G_CPrintf(ent, PRINT_HIGH, "Spectator password incorrect.\n");
 			ent->client->pers.spectator = false;
-			gi.WriteByte(svc_stufftext);
-			gi.WriteString("spectator 0\n");
-			gi.unicast(ent, true);
+			G_WriteByte(svc_stufftext);
+			G_WriteString("spectator 0\n");
+			G_Unicast(ent, true);
 			return;
 		}
 
@@ -1350,13 +1353,13 @@ spectator_respawn(edict_t *ent)
 
 		if (numspec >= maxspectators->value)
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Server spectator limit is full.");
+			G_CPrintf(ent, PRINT_HIGH, "Server spectator limit is full.");
 			ent->client->pers.spectator = false;
 
 			/* reset his spectator var */
-			gi.WriteByte(svc_stufftext);
-			gi.WriteString("spectator 0\n");
-			gi.unicast(ent, true);
+			G_WriteByte(svc_stufftext);
+			G_WriteString("spectator 0\n");
+			G_Unicast(ent, true);
 			return;
 		}
 	}
@@ -1369,17 +1372,18 @@ spectator_respawn(edict_t *ent)
 		if (*password->string && strcmp(password->string, "none") &&
 			strcmp(password->string, value))
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Password incorrect.\n");
+			G_CPrintf(ent, PRINT_HIGH, "Password incorrect.\n");
 			ent->client->pers.spectator = true;
-			gi.WriteByte(svc_stufftext);
-			gi.WriteString("spectator 1\n");
-			gi.unicast(ent, true);
+			G_WriteByte(svc_stufftext);
+			G_WriteString("spectator 1\n");
+			G_Unicast(ent, true);
 			return;
 		}
 	}
 
 	/* clear score on respawn */
 	ent->client->pers.score = ent->client->resp.score = 0;
+	InvalidateScoreboard();
 
 	ent->svflags &= ~SVF_NOCLIENT;
 	PutClientInServer(ent);
@@ -1388,10 +1392,10 @@ spectator_respawn(edict_t *ent)
 	if (!ent->client->pers.spectator)
 	{
 		/* send effect */
-		gi.WriteByte(svc_muzzleflash);
-		gi.WriteShort(ent - g_edicts);
-		gi.WriteByte(MZ_LOGIN);
-		gi.multicast(ent->s.origin, MULTICAST_PVS);
+		G_WriteByte(svc_muzzleflash);
+		G_WriteShort(ent - g_edicts);
+		G_WriteByte(MZ_LOGIN);
+		G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 		/* hold in place briefly */
 		ent->client->ps.pmove.pm_flags = PMF_TIME_TELEPORT;
@@ -1579,7 +1583,7 @@ PutClientInServer(edict_t *ent)
 		ent->solid = SOLID_NOT;
 		ent->svflags |= SVF_NOCLIENT;
 		ent->client->ps.gunindex = 0;
-		gi.linkentity(ent);
+		G_LinkEntity(ent);
 		return;
 	}
 	else
@@ -1587,12 +1591,17 @@ PutClientInServer(edict_t *ent)
 		client->resp.spectator = false;
 	}
 
+	InvalidateScoreboard();
+
 	if (!KillBox(ent))
 	{
 		/* could't spawn in? */
 	}
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
+
+	/* don't rewind into the previous life */
+	G_ResetLagHistory(ent);
 
 	/* force the current weapon up */
 	client->newweapon = client->pers.weapon;
@@ -1626,10 +1635,10 @@ ClientBeginDeathmatch(edict_t *ent)
 	else
 	{
 		/* send effect */
-		gi.WriteByte(svc_muzzleflash);
-		gi.WriteShort(ent - g_edicts);
-		gi.WriteByte(MZ_LOGIN);
-		gi.multicast(ent->s.origin, MULTICAST_PVS);
+		G_WriteByte(svc_muzzleflash);
+		G_WriteShort(ent - g_edicts);
+		G_WriteByte(MZ_LOGIN);
+		G_Multicast(ent->s.origin, MULTICAST_PVS);
 	}
 
 	gi.bprintf(PRINT_HIGH, "%s entered the game\n", ent->client->pers.netname);
@@ -1654,6 +1663,8 @@ ClientBegin(edict_t *ent)
 
 	ent->client = game.clients + (ent - g_edicts - 1);
 
+	G_RecordBegin(ent);
+
 	if (deathmatch->value)
 	{
 		ClientBeginDeathmatch(ent);
@@ -1694,10 +1705,10 @@ ClientBegin(edict_t *ent)
 		/* send effect if in a multiplayer game */
 		if (game.maxclients > 1)
 		{
-			gi.WriteByte(svc_muzzleflash);
-			gi.WriteShort(ent - g_edicts);
-			gi.WriteByte(MZ_LOGIN);
-			gi.multicast(ent->s.origin, MULTICAST_PVS);
+			G_WriteByte(svc_muzzleflash);
+			G_WriteShort(ent - g_edicts);
+			G_WriteByte(MZ_LOGIN);
+			G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 			gi.bprintf(PRINT_HIGH, "%s entered the game\n",
 					ent->client->pers.netname);
@@ -1724,6 +1735,8 @@ ClientUserinfoChanged(edict_t *ent, char *userinfo)
 		return;
 	}
 
+	G_RecordUserinfo(ent, userinfo);
+
 	/* check for malformed or illegal info strings */
 	if (!Info_Validate(userinfo))
 	{
@@ -1804,6 +1817,13 @@ ClientConnect(edict_t *ent, char *userinfo)
 		return false;
 	}
 
+	/* the replayed clients own the slots */
+	if (G_ReplayRejects())
+	{
+		Info_SetValueForKey(userinfo, "rejmsg", "Server is running a replay.");
+		return false;
+	}
+
 	/* check to see if they are on the banned IP list */
 	value = Info_ValueForKey(userinfo, "ip");
 
@@ -1859,8 +1879,12 @@ ClientConnect(edict_t *ent, char *userinfo)
 		}
 	}
 
-	/* they can connect */
+	/* they can connect, rejected
+	   clients aren't recorded */
+	G_RecordConnect(ent, userinfo);
+
 	ent->client = game.clients + (ent - g_edicts - 1);
+	G_ResetCommandLimits(ent);
 
 	/* if there is already a body waiting for us (a loadgame),
 	   just take it, otherwise spawn one from scratch */
@@ -1906,13 +1930,15 @@ ClientDisconnect(edict_t *ent)
 		return;
 	}
 
+	G_RecordDisconnect(ent);
+
 	gi.bprintf(PRINT_HIGH, "%s disconnected\n", ent->client->pers.netname);
 
 	/* send effect */
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte(MZ_LOGOUT);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte(MZ_LOGOUT);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	gi.unlinkentity(ent);
 	ent->s.modelindex = 0;
@@ -1938,11 +1964,11 @@ PM_trace(vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end)
 {
 	if (pm_passent->health > 0)
 	{
-		return gi.trace(start, mins, maxs, end, pm_passent, MASK_PLAYERSOLID);
+		return G_Trace(start, mins, maxs, end, pm_passent, MASK_PLAYERSOLID);
 	}
 	else
 	{
-		return gi.trace(start, mins, maxs, end, pm_passent, MASK_DEADSOLID);
+		return G_Trace(start, mins, maxs, end, pm_passent, MASK_DEADSOLID);
 	}
 }
 
@@ -1997,6 +2023,8 @@ ClientThink(edict_t *ent, usercmd_t *ucmd)
 		return;
 	}
 
+	G_RecordThink(ent, ucmd);
+
 	level.current_entity = ent;
 	client = ent->client;
 
@@ -2089,8 +2117,7 @@ ClientThink(edict_t *ent, usercmd_t *ucmd)
 		if (ent->groundentity && !pm.groundentity && (pm.cmd.upmove >= 10) &&
 			(pm.waterlevel == 0))
 		{
-			gi.sound(ent, CHAN_VOICE, gi.soundindex(
-							"*jump1.wav"), 1, ATTN_NORM, 0);
+			gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_JUMP1), 1, ATTN_NORM, 0);
 			PlayerNoise(ent, ent->s.origin, PNOISE_SELF);
 		}
 
@@ -2116,7 +2143,7 @@ ClientThink(edict_t *ent, usercmd_t *ucmd)
 			VectorCopy(pm.viewangles, client->ps.viewangles);
 		}
 
-		gi.linkentity(ent);
+		G_LinkEntity(ent);
 
 		if (ent->movetype != MOVETYPE_NOCLIP)
 		{
@@ -2146,6 +2173,7 @@ ClientThink(edict_t *ent, usercmd_t *ucmd)
 				continue;
 			}
 
+			G_MarkEdictDirty(other);
 			other->touch(other, ent, NULL, NULL);
 		}
 	}
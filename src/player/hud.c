@@ -69,14 +69,14 @@ MoveClientToIntermission(edict_t *ent)
 	ent->s.sound = 0;
 	ent->solid = SOLID_NOT;
 
-	gi.linkentity(ent);
+	G_LinkEntity(ent);
 
 	/* add the layout */
 
 	if (deathmatch->value || coop->value)
 	{
 		DeathmatchScoreboardMessage(ent, NULL);
-		gi.unicast(ent, true);
+		G_Unicast(ent, true);
 	}
 }
 
@@ -175,7 +175,7 @@ BeginIntermission(const edict_t *targ)
 	else
 	{
 		/* chose one of four spots */
-		i = randk() & 3;
+		i = G_RandInt(RAND_SPAWN) & 3;
 
 		while (i--)
 		{
@@ -207,82 +207,187 @@ BeginIntermission(const edict_t *targ)
 	}
 }
 
-void
-DeathmatchScoreboardMessage(const edict_t *ent, const edict_t *killer)
+/*
+ * The scoreboard layout is the same for every viewer except
+ * for the dogtags. The clients are kept in score order and
+ * the layout entries are cached. Both are checked once per
+ * frame, or earlier if a score changed, and only rebuilt if
+ * a score, ping or the set of players changed.
+ */
+#define SCOREBOARD_ENTRIES 12
+
+typedef struct
 {
-	char entry[1024];
-	char string[1400];
-	size_t stringlength;
-	int i;
-	int sorted[MAX_CLIENTS];
-	int sortedscores[MAX_CLIENTS];
+	qboolean active;
+	int score;
+	int ping;
+	int minutes;
+} scoreinfo_t;
+
+static struct
+{
+	int framenum;
+	qboolean dirty;
+	scoreinfo_t info[MAX_CLIENTS];
+	int ranked[MAX_CLIENTS]; /* client numbers in score order */
 	int total;
+	char entries[SCOREBOARD_ENTRIES][64];
+	size_t entrylen[SCOREBOARD_ENTRIES];
+	int numentries;
+} scoreboard;
 
-	if (!ent) /* killer can be NULL */
+void
+InvalidateScoreboard(void)
+{
+	scoreboard.dirty = true;
+}
+
+static qboolean
+ScoreboardBefore(int a, int b)
+{
+	if (scoreboard.info[a].score != scoreboard.info[b].score)
+	{
+		return scoreboard.info[a].score > scoreboard.info[b].score;
+	}
+
+	return a < b;
+}
+
+static void
+UpdateScoreboard(void)
+{
+	qboolean players, scores, layout;
+	scoreinfo_t *info;
+	gclient_t *cl;
+	int i, j, k, x, y;
+
+	if (!scoreboard.dirty && (scoreboard.framenum == level.framenum))
 	{
 		return;
 	}
 
-	/* sort the clients by score */
-	total = 0;
+	scoreboard.dirty = false;
+	scoreboard.framenum = level.framenum;
+
+	players = scores = layout = false;
 
 	for (i = 0; i < game.maxclients; i++)
 	{
-		int k, j, score;
-		const edict_t *cl_ent;
-
-		cl_ent = g_edicts + 1 + i;
+		info = &scoreboard.info[i];
+		cl = &game.clients[i];
 
-		if (!cl_ent->inuse || game.clients[i].resp.spectator)
+		if (!g_edicts[1 + i].inuse || cl->resp.spectator)
 		{
+			if (info->active)
+			{
+				info->active = false;
+				players = true;
+			}
+
 			continue;
 		}
 
-		score = game.clients[i].resp.score;
+		if (!info->active)
+		{
+			info->active = true;
+			players = true;
+		}
+
+		if (info->score != cl->resp.score)
+		{
+			info->score = cl->resp.score;
+			scores = true;
+		}
+
+		if ((info->ping != cl->ping) ||
+			(info->minutes != (level.framenum - cl->resp.enterframe) / 600))
+		{
+			info->ping = cl->ping;
+			info->minutes = (level.framenum - cl->resp.enterframe) / 600;
+			layout = true;
+		}
+	}
 
-		for (j = 0; j < total; j++)
+	if (players)
+	{
+		scoreboard.total = 0;
+
+		for (i = 0; i < game.maxclients; i++)
 		{
-			if (score > sortedscores[j])
+			if (scoreboard.info[i].active)
 			{
-				break;
+				scoreboard.ranked[scoreboard.total++] = i;
 			}
 		}
+	}
 
-		for (k = total; k > j; k--)
+	if (players || scores)
+	{
+		/* the order is almost always kept, so
+		   insertion sort is close to linear */
+		for (i = 1; i < scoreboard.total; i++)
 		{
-			sorted[k] = sorted[k - 1];
-			sortedscores[k] = sortedscores[k - 1];
+			k = scoreboard.ranked[i];
+
+			for (j = i; j > 0 && ScoreboardBefore(k, scoreboard.ranked[j - 1]); j--)
+			{
+				scoreboard.ranked[j] = scoreboard.ranked[j - 1];
+			}
+
+			scoreboard.ranked[j] = k;
 		}
+	}
+	else if (!layout)
+	{
+		return;
+	}
+
+	scoreboard.numentries = (scoreboard.total > SCOREBOARD_ENTRIES) ?
+		SCOREBOARD_ENTRIES : scoreboard.total;
+
+	for (i = 0; i < scoreboard.numentries; i++)
+	{
+		info = &scoreboard.info[scoreboard.ranked[i]];
 
-		sorted[j] = i;
-		sortedscores[j] = score;
-		total++;
+		x = (i >= 6) ? 160 : 0;
+		y = 32 + 32 * (i % 6);
+
+		Com_sprintf(scoreboard.entries[i], sizeof(scoreboard.entries[i]),
+				"client %i %i %i %i %i %i ",
+				x, y, scoreboard.ranked[i], info->score, info->ping,
+				info->minutes);
+		scoreboard.entrylen[i] = strlen(scoreboard.entries[i]);
+	}
+}
+
+void
+DeathmatchScoreboardMessage(const edict_t *ent, const edict_t *killer)
+{
+	char entry[64];
+	char string[1400];
+	size_t stringlength;
+	int i;
+
+	if (!ent) /* killer can be NULL */
+	{
+		return;
 	}
 
+	UpdateScoreboard();
+
 	/* print level name and exit rules */
 	string[0] = 0;
 
 	stringlength = strlen(string);
 
 	/* add the clients in sorted order */
-	if (total > 12)
-	{
-		total = 12;
-	}
-
-	for (i = 0; i < total; i++)
+	for (i = 0; i < scoreboard.numentries; i++)
 	{
 		char *tag;
-		int x, y;
 		size_t j;
-		gclient_t *cl;
 		const edict_t *cl_ent;
 
-		cl = &game.clients[sorted[i]];
-		cl_ent = g_edicts + 1 + sorted[i];
-
-		x = (i >= 6) ? 160 : 0;
-		y = 32 + 32 * (i % 6);
+		cl_ent = g_edicts + 1 + scoreboard.ranked[i];
 
 		/* add a dogtag */
 		if (cl_ent == ent)
@@ -300,8 +405,8 @@ DeathmatchScoreboardMessage(const edict_t *ent, const edict_t *killer)
 
 		if (tag)
 		{
-			Com_sprintf(entry, sizeof(entry),
-					"xv %i yv %i picn %s ", x + 32, y, tag);
+			Com_sprintf(entry, sizeof(entry), "xv %i yv %i picn %s ",
+					((i >= 6) ? 160 : 0) + 32, 32 + 32 * (i % 6), tag);
 			j = strlen(entry);
 
 			if (stringlength + j > 1024)
@@ -314,23 +419,19 @@ DeathmatchScoreboardMessage(const edict_t *ent, const edict_t *killer)
 		}
 
 		/* send the layout */
-		Com_sprintf(entry, sizeof(entry),
-				"client %i %i %i %i %i %i ",
-				x, y, sorted[i], cl->resp.score, cl->ping,
-				(level.framenum - cl->resp.enterframe) / 600);
-		j = strlen(entry);
+		j = scoreboard.entrylen[i];
 
 		if (stringlength + j > 1024)
 		{
 			break;
 		}
 
-		strcpy(string + stringlength, entry);
+		memcpy(string + stringlength, scoreboard.entries[i], j + 1);
 		stringlength += j;
 	}
 
-	gi.WriteByte(svc_layout);
-	gi.WriteString(string);
+	G_WriteByte(svc_layout);
+	G_WriteString(string);
 }
 
 void
@@ -378,8 +479,8 @@ HelpComputerMessage(edict_t *ent)
 			level.found_goals, level.total_goals,
 			level.found_secrets, level.total_secrets);
 
-	gi.WriteByte(svc_layout);
-	gi.WriteString(string);
+	G_WriteByte(svc_layout);
+	G_WriteString(string);
 }
 
 void
@@ -392,22 +493,75 @@ InventoryMessage(edict_t *ent)
 		return;
 	}
 
-	gi.WriteByte(svc_inventory);
+	G_WriteByte(svc_inventory);
 
 	for (i = 0; i < MAX_ITEMS; i++)
 	{
-		gi.WriteShort(ent->client->pers.inventory[i]);
+		G_WriteShort(ent->client->pers.inventory[i]);
 	}
 }
 
 /* ======================================================================= */
 
+/*
+ * The stats are set by worker threads at the end of
+ * the frame. Anything that needs the engine (an icon
+ * that isn't cached yet, the power armor running
+ * out) makes the client's stats being redone in the
+ * main thread afterwards.
+ */
+static qboolean stats_deferred[MAX_CLIENTS];
+
 static void
-G_SetStats_SelectedItem(gclient_t *cl)
+G_DeferStats(const edict_t *ent)
+{
+	stats_deferred[ent - g_edicts - 1] = true;
+}
+
+/*
+ * True if the stats of ent must be set again
+ * outside of the worker threads, clears the flag.
+ */
+qboolean
+G_StatsDeferred(const edict_t *ent)
+{
+	qboolean deferred;
+
+	deferred = stats_deferred[ent - g_edicts - 1];
+	stats_deferred[ent - g_edicts - 1] = false;
+
+	return deferred;
+}
+
+static int
+G_StatImage(const edict_t *ent, const char *name)
 {
+	int index;
+
+	if (!G_InParallel())
+	{
+		return G_ImageIndexByName(name);
+	}
+
+	index = G_FindImageIndex(name);
+
+	if (index < 0)
+	{
+		G_DeferStats(ent);
+		return 0;
+	}
+
+	return index;
+}
+
+static void
+G_SetStats_SelectedItem(const edict_t *ent)
+{
+	gclient_t *cl;
 	const gitem_t *it;
 	int si;
 
+	cl = ent->client;
 	si = cl->pers.selected_item;
 	it = GetItemByIndex(si);
 
@@ -418,7 +572,7 @@ G_SetStats_SelectedItem(gclient_t *cl)
 
 	cl->ps.stats[STAT_SELECTED_ITEM] = si;
 	cl->ps.stats[STAT_SELECTED_ICON] = (it && it->icon) ?
-		gi.imageindex(it->icon) : 0;
+		G_StatImage(ent, it->icon) : 0;
 }
 
 void
@@ -446,7 +600,7 @@ G_SetStats(edict_t *ent)
 	else
 	{
 		item = &itemlist[ent->client->ammo_index];
-		ent->client->ps.stats[STAT_AMMO_ICON] = gi.imageindex(item->icon);
+		ent->client->ps.stats[STAT_AMMO_ICON] = G_StatImage(ent, item->icon);
 		ent->client->ps.stats[STAT_AMMO] =
 			ent->client->pers.inventory[ent->client->ammo_index];
 	}
@@ -458,14 +612,19 @@ G_SetStats(edict_t *ent)
 
 	if (power_armor_type)
 	{
-		cells = ent->client->pers.inventory[ITEM_INDEX(FindItem("cells"))];
+		cells = ent->client->pers.inventory[IT_AMMO_CELLS];
 
 		if (cells == 0)
 		{
+			if (G_InParallel())
+			{
+				G_DeferStats(ent);
+				return;
+			}
+
 			/* ran out of cells for power armor */
 			ent->flags &= ~FL_POWER_ARMOR;
-			gi.sound(ent, CHAN_ITEM, gi.soundindex(
-							"misc/power2.wav"), 1, ATTN_NORM, 0);
+			gi.sound(ent, CHAN_ITEM, G_SoundIndex(SND_POWER2), 1, ATTN_NORM, 0);
 			power_armor_type = 0;
 		}
 	}
@@ -475,13 +634,13 @@ G_SetStats(edict_t *ent)
 	if (power_armor_type && (!index || (level.framenum & 8)))
 	{
 		/* flash between power armor and other armor icon */
-		ent->client->ps.stats[STAT_ARMOR_ICON] = gi.imageindex("i_powershield");
+		ent->client->ps.stats[STAT_ARMOR_ICON] = G_StatImage(ent, "i_powershield");
 		ent->client->ps.stats[STAT_ARMOR] = cells;
 	}
 	else if (index)
 	{
 		item = GetItemByIndex(index);
-		ent->client->ps.stats[STAT_ARMOR_ICON] = gi.imageindex(item->icon);
+		ent->client->ps.stats[STAT_ARMOR_ICON] = G_StatImage(ent, item->icon);
 		ent->client->ps.stats[STAT_ARMOR] = ent->client->pers.inventory[index];
 	}
 	else
@@ -500,32 +659,32 @@ G_SetStats(edict_t *ent)
 	/* timers */
 	if (ent->client->quad_framenum > level.framenum)
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_quad");
+		ent->client->ps.stats[STAT_TIMER_ICON] = G_StatImage(ent, "p_quad");
 		ent->client->ps.stats[STAT_TIMER] =
 			(ent->client->quad_framenum - level.framenum) / 10;
 	}
 	else if (ent->client->quadfire_framenum > level.framenum)
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_quadfire");
+		ent->client->ps.stats[STAT_TIMER_ICON] = G_StatImage(ent, "p_quadfire");
 		ent->client->ps.stats[STAT_TIMER] = (ent->client->quadfire_framenum
 				- level.framenum) / 10;
 	}
 	else if (ent->client->invincible_framenum > level.framenum)
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex(
+		ent->client->ps.stats[STAT_TIMER_ICON] = G_StatImage(ent,
 				"p_invulnerability");
 		ent->client->ps.stats[STAT_TIMER] =
 			(ent->client->invincible_framenum - level.framenum) / 10;
 	}
 	else if (ent->client->enviro_framenum > level.framenum)
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_envirosuit");
+		ent->client->ps.stats[STAT_TIMER_ICON] = G_StatImage(ent, "p_envirosuit");
 		ent->client->ps.stats[STAT_TIMER] =
 			(ent->client->enviro_framenum - level.framenum) / 10;
 	}
 	else if (ent->client->breather_framenum > level.framenum)
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_rebreather");
+		ent->client->ps.stats[STAT_TIMER_ICON] = G_StatImage(ent, "p_rebreather");
 		ent->client->ps.stats[STAT_TIMER] =
 			(ent->client->breather_framenum - level.framenum) / 10;
 	}
@@ -536,7 +695,7 @@ G_SetStats(edict_t *ent)
 	}
 
 	/* selected item */
-	G_SetStats_SelectedItem(ent->client);
+	G_SetStats_SelectedItem(ent);
 
 	/* layouts */
 	ent->client->ps.stats[STAT_LAYOUTS] = 0;
@@ -573,18 +732,15 @@ G_SetStats(edict_t *ent)
 	/* help icon / current weapon if not shown */
 	if (ent->client->pers.helpchanged && (level.framenum & 8))
 	{
-		ent->client->ps.stats[STAT_HELPICON] = gi.imageindex("i_help");
+		ent->client->ps.stats[STAT_HELPICON] = G_StatImage(ent, "i_help");
 	}
 	else if (((ent->client->pers.hand == CENTER_HANDED) ||
 			  (ent->client->ps.fov > 91)) &&
 			 ent->client->pers.weapon)
 	{
-		cvar_t *gun;
-		gun = gi.cvar("cl_gun", "2", 0);
-
-		if (gun->value != 2)
+		if (cl_gun->value != 2)
 		{
-			ent->client->ps.stats[STAT_HELPICON] = gi.imageindex(
+			ent->client->ps.stats[STAT_HELPICON] = G_StatImage(ent,
 					ent->client->pers.weapon->icon);
 		}
 		else
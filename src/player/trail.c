@@ -95,7 +95,7 @@ PlayerTrail_PickFirst(edict_t *self)
 
 	for (marker = trail_head, n = TRAIL_LENGTH; n; n--)
 	{
-		if (trail[marker]->timestamp <= self->monsterinfo.trail_time)
+		if (trail[marker]->timestamp <= G_MonsterInfo(self)->trail_time)
 		{
 			marker = NEXT(marker);
 		}
@@ -136,7 +136,7 @@ PlayerTrail_PickNext(edict_t *self)
 
 	for (marker = trail_head, n = TRAIL_LENGTH; n; n--)
 	{
-		if (trail[marker]->timestamp <= self->monsterinfo.trail_time)
+		if (trail[marker]->timestamp <= G_MonsterInfo(self)->trail_time)
 		{
 			marker = NEXT(marker);
 		}
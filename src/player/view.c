@@ -27,15 +27,32 @@
 #include "../header/local.h"
 #include "../monster/misc/player.h"
 
-static edict_t *current_player;
-static gclient_t *current_client;
+/* The end of frame work is split into three parts. The first
+   and the last run in the main thread and do everything that
+   needs the engine or touches other entities. The middle part
+   only does math on the client's own state and is spread over
+   the worker threads, see P_EndServerFrames(). */
+typedef struct
+{
+	qboolean active; /* false during the intermission */
+
+	vec3_t forward, right, up;
+	float xyspeed;
 
-static vec3_t forward, right, up;
-static float xyspeed;
+	float bobmove;
+	int bobcycle; /* odd cycles are right foot going forward */
+	float bobfracsin; /* sin(bobfrac*M_PI) */
 
-static float bobmove;
-static int bobcycle; /* odd cycles are right foot going forward */
-static float bobfracsin; /* sin(bobfrac*M_PI) */
+	float blend[4]; /* view blend without the contents */
+	int powerupsound; /* gsound_t of a fading powerup or -1 */
+} viewstate_t;
+
+static viewstate_t view_states[MAX_CLIENTS];
+
+/* set in the main thread parts */
+static edict_t *current_player;
+static gclient_t *current_client;
+static viewstate_t *current_view;
 
 float
 SV_CalcRoll(vec3_t angles, vec3_t velocity)
@@ -44,7 +61,7 @@ SV_CalcRoll(vec3_t angles, vec3_t velocity)
 	float side;
 	float value;
 
-	side = DotProduct(velocity, right);
+	side = DotProduct(velocity, current_view->right);
 	sign = side < 0 ? -1 : 1;
 	side = fabs(side);
 
@@ -63,19 +80,15 @@ SV_CalcRoll(vec3_t angles, vec3_t velocity)
 }
 
 /*
- * Handles color blends and view kicks
+ * Handles pain animations and sounds, the color
+ * blends and view kicks are done by P_DamageBlend()
  */
 void
 P_DamageFeedback(edict_t *player)
 {
 	gclient_t *client;
-	float side;
-	float realcount, count, kick;
-	vec3_t v;
+	int count;
 	int r, l;
-	static vec3_t power_color = {0.0, 1.0, 0.0};
-	static vec3_t acolor = {1.0, 1.0, 1.0};
-	static vec3_t bcolor = {1.0, 0.0, 0.0};
 
 	if (!player)
 	{
@@ -148,20 +161,13 @@ P_DamageFeedback(edict_t *player)
 		}
 	}
 
-	realcount = count;
-
-	if (count < 10)
-	{
-		count = 10; /* always make a visible effect */
-	}
-
 	/* play an apropriate pain sound */
 	if ((level.time > player->pain_debounce_time) &&
 		!(player->flags & FL_GODMODE) &&
 		(client->invincible_framenum <= level.framenum) &&
 		player->health > 0)
 	{
-		r = 1 + (randk() & 1);
+		r = 1 + (G_RandInt(RAND_EFFECT) & 1);
 		player->pain_debounce_time = level.time + 0.7;
 
 		if (player->health < 25)
@@ -181,8 +187,42 @@ P_DamageFeedback(edict_t *player)
 			l = 100;
 		}
 
-		gi.sound(player, CHAN_VOICE, gi.soundindex(va("*pain%i_%i.wav",
-								l, r)), 1, ATTN_NORM, 0);
+		gi.sound(player, CHAN_VOICE, G_SoundIndex(SND_PAIN25_1 +
+					(l / 25 - 1) * 2 + (r - 1)), 1, ATTN_NORM, 0);
+	}
+}
+
+/*
+ * Handles color blends and view kicks,
+ * safe to call from a worker thread
+ */
+static void
+P_DamageBlend(edict_t *player, const viewstate_t *vs)
+{
+	gclient_t *client;
+	float side;
+	float realcount, count, kick;
+	vec3_t v;
+	static const vec3_t power_color = {0.0, 1.0, 0.0};
+	static const vec3_t acolor = {1.0, 1.0, 1.0};
+	static const vec3_t bcolor = {1.0, 0.0, 0.0};
+
+	client = player->client;
+
+	/* total points of damage shot at the player this frame */
+	count =
+		(client->damage_blood + client->damage_armor + client->damage_parmor);
+
+	if (count == 0)
+	{
+		return; /* didn't take any damage */
+	}
+
+	realcount = count;
+
+	if (count < 10)
+	{
+		count = 10; /* always make a visible effect */
 	}
 
 	/* the total alpha of the blend is always proportional to count */
@@ -244,10 +284,10 @@ P_DamageFeedback(edict_t *player)
 		VectorSubtract(client->damage_from, player->s.origin, v);
 		VectorNormalize(v);
 
-		side = DotProduct(v, right);
+		side = DotProduct(v, vs->right);
 		client->v_dmg_roll = kick * side * 0.3;
 
-		side = -DotProduct(v, forward);
+		side = -DotProduct(v, vs->forward);
 		client->v_dmg_pitch = kick * side * 0.3;
 
 		client->v_dmg_time = level.time + DAMAGE_TIME;
@@ -270,7 +310,7 @@ P_DamageFeedback(edict_t *player)
  * damage = deltavelocity*deltavelocity  * 0.0001
  */
 void
-SV_CalcViewOffset(edict_t *ent)
+SV_CalcViewOffset(edict_t *ent, const viewstate_t *vs)
 {
 	float *angles;
 	float bob;
@@ -319,14 +359,14 @@ SV_CalcViewOffset(edict_t *ent)
 		angles[PITCH] += ratio * ent->client->fall_value;
 
 		/* add angles based on velocity */
-		delta = DotProduct(ent->velocity, forward);
+		delta = DotProduct(ent->velocity, vs->forward);
 		angles[PITCH] += delta * run_pitch->value;
 
-		delta = DotProduct(ent->velocity, right);
+		delta = DotProduct(ent->velocity, vs->right);
 		angles[ROLL] += delta * run_roll->value;
 
 		/* add angles based on bob */
-		delta = bobfracsin * bob_pitch->value * xyspeed;
+		delta = vs->bobfracsin * bob_pitch->value * vs->xyspeed;
 
 		if (ent->client->ps.pmove.pm_flags & PMF_DUCKED)
 		{
@@ -334,14 +374,14 @@ SV_CalcViewOffset(edict_t *ent)
 		}
 
 		angles[PITCH] += delta;
-		delta = bobfracsin * bob_roll->value * xyspeed;
+		delta = vs->bobfracsin * bob_roll->value * vs->xyspeed;
 
 		if (ent->client->ps.pmove.pm_flags & PMF_DUCKED)
 		{
 			delta *= 6; /* crouching */
 		}
 
-		if (bobcycle & 1)
+		if (vs->bobcycle & 1)
 		{
 			delta = -delta;
 		}
@@ -366,7 +406,7 @@ SV_CalcViewOffset(edict_t *ent)
 	v[2] -= ratio * ent->client->fall_value * 0.4;
 
 	/* add bob height */
-	bob = bobfracsin * xyspeed * bob_up->value;
+	bob = vs->bobfracsin * vs->xyspeed * bob_up->value;
 
 	if (bob > 6)
 	{
@@ -412,7 +452,7 @@ SV_CalcViewOffset(edict_t *ent)
 }
 
 void
-SV_CalcGunOffset(edict_t *ent)
+SV_CalcGunOffset(edict_t *ent, const viewstate_t *vs)
 {
 	int i;
 	float delta;
@@ -423,16 +463,16 @@ SV_CalcGunOffset(edict_t *ent)
 	}
 
 	/* gun angles from bobbing */
-	ent->client->ps.gunangles[ROLL] = xyspeed * bobfracsin * 0.005;
-	ent->client->ps.gunangles[YAW] = xyspeed * bobfracsin * 0.01;
+	ent->client->ps.gunangles[ROLL] = vs->xyspeed * vs->bobfracsin * 0.005;
+	ent->client->ps.gunangles[YAW] = vs->xyspeed * vs->bobfracsin * 0.01;
 
-	if (bobcycle & 1)
+	if (vs->bobcycle & 1)
 	{
 		ent->client->ps.gunangles[ROLL] = -ent->client->ps.gunangles[ROLL];
 		ent->client->ps.gunangles[YAW] = -ent->client->ps.gunangles[YAW];
 	}
 
-	ent->client->ps.gunangles[PITCH] = xyspeed * bobfracsin * 0.005;
+	ent->client->ps.gunangles[PITCH] = vs->xyspeed * vs->bobfracsin * 0.005;
 
 	/* gun angles from delta movement */
 	for (i = 0; i < 3; i++)
@@ -473,9 +513,9 @@ SV_CalcGunOffset(edict_t *ent)
 	/* gun_x / gun_y / gun_z are development tools */
 	for (i = 0; i < 3; i++)
 	{
-		ent->client->ps.gunoffset[i] += forward[i] * (gun_y->value);
-		ent->client->ps.gunoffset[i] += right[i] * gun_x->value;
-		ent->client->ps.gunoffset[i] += up[i] * (-gun_z->value);
+		ent->client->ps.gunoffset[i] += vs->forward[i] * (gun_y->value);
+		ent->client->ps.gunoffset[i] += vs->right[i] * gun_x->value;
+		ent->client->ps.gunoffset[i] += vs->up[i] * (-gun_z->value);
 	}
 }
 
@@ -503,46 +543,18 @@ SV_AddBlend(float r, float g, float b, float a, float *v_blend)
 	v_blend[3] = a2;
 }
 
-void
-SV_CalcBlend(edict_t *ent)
+/*
+ * Blends for powerups, damage and bonuses. They're
+ * kept apart from the contents blend, which needs
+ * the engine, see SV_CalcContentsBlend().
+ */
+static void
+SV_CalcBlend(edict_t *ent, viewstate_t *vs)
 {
-	int contents;
-	vec3_t vieworg;
 	int remaining;
 
-	if (!ent)
-	{
-		return;
-	}
-
-	ent->client->ps.blend[0] = ent->client->ps.blend[1] =
-		ent->client->ps.blend[2] = ent->client->ps.blend[3] = 0;
-
-	/* add for contents */
-	VectorAdd(ent->s.origin, ent->client->ps.viewoffset, vieworg);
-	contents = gi.pointcontents(vieworg);
-
-	if (contents & (CONTENTS_LAVA | CONTENTS_SLIME | CONTENTS_WATER))
-	{
-		ent->client->ps.rdflags |= RDF_UNDERWATER;
-	}
-	else
-	{
-		ent->client->ps.rdflags &= ~RDF_UNDERWATER;
-	}
-
-	if (contents & (CONTENTS_SOLID | CONTENTS_LAVA))
-	{
-		SV_AddBlend(1.0, 0.3, 0.0, 0.6, ent->client->ps.blend);
-	}
-	else if (contents & CONTENTS_SLIME)
-	{
-		SV_AddBlend(0.0, 0.1, 0.05, 0.6, ent->client->ps.blend);
-	}
-	else if (contents & CONTENTS_WATER)
-	{
-		SV_AddBlend(0.5, 0.3, 0.2, 0.4, ent->client->ps.blend);
-	}
+	vs->blend[0] = vs->blend[1] = vs->blend[2] = vs->blend[3] = 0;
+	vs->powerupsound = -1;
 
 	/* add for powerups */
 	if (ent->client->quad_framenum > level.framenum)
@@ -551,13 +563,12 @@ SV_CalcBlend(edict_t *ent)
 
 		if (remaining == 30) /* beginning to fade */
 		{
-			gi.sound(ent, CHAN_ITEM, gi.soundindex(
-							"items/damage2.wav"), 1, ATTN_NORM, 0);
+			vs->powerupsound = SND_DAMAGE2;
 		}
 
 		if ((remaining > 30) || (remaining & 4))
 		{
-			SV_AddBlend(0, 0, 1, 0.08, ent->client->ps.blend);
+			SV_AddBlend(0, 0, 1, 0.08, vs->blend);
 		}
 	}
 	else if (ent->client->quadfire_framenum > level.framenum)
@@ -566,13 +577,12 @@ SV_CalcBlend(edict_t *ent)
 
 		if (remaining == 30) /* beginning to fade */
 		{
-			gi.sound(ent, CHAN_ITEM, gi.soundindex("items/quadfire2.wav"),
-					1, ATTN_NORM, 0);
+			vs->powerupsound = SND_QUADFIRE2;
 		}
 
 		if ((remaining > 30) || (remaining & 4))
 		{
-			SV_AddBlend(1, 0.2, 0.5, 0.08, ent->client->ps.blend);
+			SV_AddBlend(1, 0.2, 0.5, 0.08, vs->blend);
 		}
 	}
 	else if (ent->client->invincible_framenum > level.framenum)
@@ -581,13 +591,12 @@ SV_CalcBlend(edict_t *ent)
 
 		if (remaining == 30) /* beginning to fade */
 		{
-			gi.sound(ent, CHAN_ITEM, gi.soundindex(
-							"items/protect2.wav"), 1, ATTN_NORM, 0);
+			vs->powerupsound = SND_PROTECT2;
 		}
 
 		if ((remaining > 30) || (remaining & 4))
 		{
-			SV_AddBlend(1, 1, 0, 0.08, ent->client->ps.blend);
+			SV_AddBlend(1, 1, 0, 0.08, vs->blend);
 		}
 	}
 	else if (ent->client->enviro_framenum > level.framenum)
@@ -596,13 +605,12 @@ SV_CalcBlend(edict_t *ent)
 
 		if (remaining == 30) /* beginning to fade */
 		{
-			gi.sound(ent, CHAN_ITEM, gi.soundindex(
-							"items/airout.wav"), 1, ATTN_NORM, 0);
+			vs->powerupsound = SND_AIROUT;
 		}
 
 		if ((remaining > 30) || (remaining & 4))
 		{
-			SV_AddBlend(0, 1, 0, 0.08, ent->client->ps.blend);
+			SV_AddBlend(0, 1, 0, 0.08, vs->blend);
 		}
 	}
 	else if (ent->client->breather_framenum > level.framenum)
@@ -611,13 +619,12 @@ SV_CalcBlend(edict_t *ent)
 
 		if (remaining == 30) /* beginning to fade */
 		{
-			gi.sound(ent, CHAN_ITEM, gi.soundindex(
-							"items/airout.wav"), 1, ATTN_NORM, 0);
+			vs->powerupsound = SND_AIROUT;
 		}
 
 		if ((remaining > 30) || (remaining & 4))
 		{
-			SV_AddBlend(0.4, 1, 0.4, 0.04, ent->client->ps.blend);
+			SV_AddBlend(0.4, 1, 0.4, 0.04, vs->blend);
 		}
 	}
 
@@ -628,13 +635,12 @@ SV_CalcBlend(edict_t *ent)
 				ent->client->damage_blend[1],
 				ent->client->damage_blend[2],
 				ent->client->damage_alpha,
-				ent->client->ps.blend);
+				vs->blend);
 	}
 
 	if (ent->client->bonus_alpha > 0)
 	{
-		SV_AddBlend(0.85, 0.7, 0.3, ent->client->bonus_alpha,
-				ent->client->ps.blend);
+		SV_AddBlend(0.85, 0.7, 0.3, ent->client->bonus_alpha, vs->blend);
 	}
 
 	/* drop the damage value */
@@ -654,6 +660,58 @@ SV_CalcBlend(edict_t *ent)
 	}
 }
 
+/*
+ * Determines the eye contents and puts their blend
+ * over the one from SV_CalcBlend(). Blending is
+ * associative, so this gives the same result as
+ * adding all of them in order. Must be after the
+ * view offset, so the eye position is accurate.
+ */
+static void
+SV_CalcContentsBlend(edict_t *ent, const viewstate_t *vs)
+{
+	int contents;
+	vec3_t vieworg;
+
+	ent->client->ps.blend[0] = ent->client->ps.blend[1] =
+		ent->client->ps.blend[2] = ent->client->ps.blend[3] = 0;
+
+	/* add for contents */
+	VectorAdd(ent->s.origin, ent->client->ps.viewoffset, vieworg);
+	contents = G_PointContents(vieworg);
+
+	if (contents & (CONTENTS_LAVA | CONTENTS_SLIME | CONTENTS_WATER))
+	{
+		ent->client->ps.rdflags |= RDF_UNDERWATER;
+	}
+	else
+	{
+		ent->client->ps.rdflags &= ~RDF_UNDERWATER;
+	}
+
+	if (contents & (CONTENTS_SOLID | CONTENTS_LAVA))
+	{
+		SV_AddBlend(1.0, 0.3, 0.0, 0.6, ent->client->ps.blend);
+	}
+	else if (contents & CONTENTS_SLIME)
+	{
+		SV_AddBlend(0.0, 0.1, 0.05, 0.6, ent->client->ps.blend);
+	}
+	else if (contents & CONTENTS_WATER)
+	{
+		SV_AddBlend(0.5, 0.3, 0.2, 0.4, ent->client->ps.blend);
+	}
+
+	SV_AddBlend(vs->blend[0], vs->blend[1], vs->blend[2], vs->blend[3],
+			ent->client->ps.blend);
+
+	if (vs->powerupsound >= 0)
+	{
+		gi.sound(ent, CHAN_ITEM, G_SoundIndex(vs->powerupsound),
+				1, ATTN_NORM, 0);
+	}
+}
+
 void
 P_FallingDamage(edict_t *ent)
 {
@@ -794,17 +852,17 @@ P_WorldEffects(void)
 		if (current_player->watertype & CONTENTS_LAVA)
 		{
 			gi.sound(current_player, CHAN_BODY,
-					gi.soundindex("player/lava_in.wav"), 1, ATTN_NORM, 0);
+					G_SoundIndex(SND_LAVA_IN), 1, ATTN_NORM, 0);
 		}
 		else if (current_player->watertype & CONTENTS_SLIME)
 		{
 			gi.sound(current_player, CHAN_BODY,
-					gi.soundindex("player/watr_in.wav"), 1, ATTN_NORM, 0);
+					G_SoundIndex(SND_WATR_IN), 1, ATTN_NORM, 0);
 		}
 		else if (current_player->watertype & CONTENTS_WATER)
 		{
 			gi.sound(current_player, CHAN_BODY,
-					gi.soundindex("player/watr_in.wav"), 1, ATTN_NORM, 0);
+					G_SoundIndex(SND_WATR_IN), 1, ATTN_NORM, 0);
 		}
 
 		current_player->flags |= FL_INWATER;
@@ -817,16 +875,14 @@ P_WorldEffects(void)
 	if (old_waterlevel && !waterlevel)
 	{
 		PlayerNoise(current_player, current_player->s.origin, PNOISE_SELF);
-		gi.sound(current_player, CHAN_BODY, gi.soundindex(
-						"player/watr_out.wav"), 1, ATTN_NORM, 0);
+		gi.sound(current_player, CHAN_BODY, G_SoundIndex(SND_WATR_OUT), 1, ATTN_NORM, 0);
 		current_player->flags &= ~FL_INWATER;
 	}
 
 	/* check for head just going under moove^^water */
 	if ((old_waterlevel != 3) && (waterlevel == 3))
 	{
-		gi.sound(current_player, CHAN_BODY, gi.soundindex(
-						"player/watr_un.wav"), 1, ATTN_NORM, 0);
+		gi.sound(current_player, CHAN_BODY, G_SoundIndex(SND_WATR_UN), 1, ATTN_NORM, 0);
 	}
 
 	/* check for head just coming out of water */
@@ -836,14 +892,14 @@ P_WorldEffects(void)
 		{
 			/* gasp for air */
 			gi.sound(current_player, CHAN_VOICE,
-					gi.soundindex("player/gasp1.wav"), 1, ATTN_NORM, 0);
+					G_SoundIndex(SND_GASP1), 1, ATTN_NORM, 0);
 			PlayerNoise(current_player, current_player->s.origin, PNOISE_SELF);
 		}
 		else if (current_player->air_finished < level.time + 11)
 		{
 			/* just break surface */
 			gi.sound(current_player, CHAN_VOICE,
-					gi.soundindex("player/gasp2.wav"), 1, ATTN_NORM, 0);
+					G_SoundIndex(SND_GASP2), 1, ATTN_NORM, 0);
 		}
 	}
 
@@ -861,12 +917,12 @@ P_WorldEffects(void)
 				if (!current_client->breather_sound)
 				{
 					gi.sound(current_player, CHAN_AUTO,
-							gi.soundindex("player/u_breath1.wav"), 1, ATTN_NORM, 0);
+							G_SoundIndex(SND_U_BREATH1), 1, ATTN_NORM, 0);
 				}
 				else
 				{
 					gi.sound(current_player, CHAN_AUTO,
-							gi.soundindex("player/u_breath2.wav"), 1, ATTN_NORM, 0);
+							G_SoundIndex(SND_U_BREATH2), 1, ATTN_NORM, 0);
 				}
 
 				current_client->breather_sound ^= 1;
@@ -896,17 +952,17 @@ P_WorldEffects(void)
 				if (current_player->health <= current_player->dmg)
 				{
 					gi.sound(current_player, CHAN_VOICE,
-							gi.soundindex("player/drown1.wav"), 1, ATTN_NORM, 0);
+							G_SoundIndex(SND_DROWN1), 1, ATTN_NORM, 0);
 				}
-				else if (randk() & 1)
+				else if (G_RandInt(RAND_EFFECT) & 1)
 				{
 					gi.sound(current_player, CHAN_VOICE,
-							gi.soundindex("*gurp1.wav"), 1, ATTN_NORM, 0);
+							G_SoundIndex(SND_GURP1), 1, ATTN_NORM, 0);
 				}
 				else
 				{
 					gi.sound(current_player, CHAN_VOICE,
-							gi.soundindex("*gurp2.wav"), 1, ATTN_NORM, 0);
+							G_SoundIndex(SND_GURP2), 1, ATTN_NORM, 0);
 				}
 
 				current_player->pain_debounce_time = level.time;
@@ -935,15 +991,15 @@ P_WorldEffects(void)
 				(current_client->invincible_framenum < level.framenum) &&
 				!(current_player->flags & FL_GODMODE))
 			{
-				if (randk() & 1)
+				if (G_RandInt(RAND_EFFECT) & 1)
 				{
 					gi.sound(current_player, CHAN_VOICE,
-							gi.soundindex("player/burn1.wav"), 1, ATTN_NORM, 0);
+							G_SoundIndex(SND_BURN1), 1, ATTN_NORM, 0);
 				}
 				else
 				{
 					gi.sound(current_player, CHAN_VOICE,
-							gi.soundindex("player/burn2.wav"), 1, ATTN_NORM, 0);
+							G_SoundIndex(SND_BURN2), 1, ATTN_NORM, 0);
 				}
 
 				current_player->pain_debounce_time = level.time + 1;
@@ -1068,9 +1124,10 @@ G_SetClientEvent(edict_t *ent)
 
 	if (g_footsteps->value == 1)
 	{
-		if (ent->groundentity && (xyspeed > 225))
+		if (ent->groundentity && (current_view->xyspeed > 225))
 		{
-			if ((int)(current_client->bobtime + bobmove) != bobcycle)
+			if ((int)(current_client->bobtime + current_view->bobmove) !=
+				current_view->bobcycle)
 			{
 				ent->s.event = EV_FOOTSTEP;
 			}
@@ -1080,7 +1137,8 @@ G_SetClientEvent(edict_t *ent)
 	{
 		if (ent->groundentity)
 		{
-			if ((int)(current_client->bobtime + bobmove) != bobcycle)
+			if ((int)(current_client->bobtime + current_view->bobmove) !=
+				current_view->bobcycle)
 			{
 				ent->s.event = EV_FOOTSTEP;
 			}
@@ -1088,7 +1146,8 @@ G_SetClientEvent(edict_t *ent)
 	}
 	else if (g_footsteps->value >= 3)
 	{
-		if ((int)(current_client->bobtime + bobmove) != bobcycle)
+		if ((int)(current_client->bobtime + current_view->bobmove) !=
+				current_view->bobcycle)
 		{
 			ent->s.event = EV_FOOTSTEP;
 		}
@@ -1116,8 +1175,7 @@ G_SetClientSound(edict_t *ent)
 		(ent->client->pers.helpchanged <= 3) && !(level.framenum & 63))
 	{
 		ent->client->pers.helpchanged++;
-		gi.sound(ent, CHAN_VOICE, gi.soundindex(
-						"misc/pc_up.wav"), 1, ATTN_STATIC, 0);
+		gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_PC_UP), 1, ATTN_STATIC, 0);
 	}
 
 	if (ent->client->pers.weapon)
@@ -1135,15 +1193,15 @@ G_SetClientSound(edict_t *ent)
 	}
 	else if (strcmp(weap, "weapon_railgun") == 0)
 	{
-		ent->s.sound = gi.soundindex("weapons/rg_hum.wav");
+		ent->s.sound = G_SoundIndex(SND_RG_HUM);
 	}
 	else if (strcmp(weap, "weapon_bfg") == 0)
 	{
-		ent->s.sound = gi.soundindex("weapons/bfg_hum.wav");
+		ent->s.sound = G_SoundIndex(SND_BFG_HUM);
 	}
 	else if (strcmp(weap, "weapon_phalanx") == 0)
 	{
-		ent->s.sound = gi.soundindex("weapons/phaloop.wav");
+		ent->s.sound = G_SoundIndex(SND_PHALOOP);
 	}
 	else if (ent->client->weapon_sound)
 	{
@@ -1182,7 +1240,7 @@ G_SetClientFrame(edict_t *ent)
 		duck = false;
 	}
 
-	if (xyspeed)
+	if (current_view->xyspeed)
 	{
 		run = true;
 	}
@@ -1289,22 +1347,22 @@ newanim:
 }
 
 /*
- * Called for each player at the end of
- * the server frame and right after spawning
+ * First part of the end of frame, runs in the main
+ * thread. Returns false if nothing more is to be
+ * done for this player.
  */
-void
-ClientEndServerFrame(edict_t *ent)
+static qboolean
+P_ViewPrepare(edict_t *ent)
 {
+	viewstate_t *vs;
 	float bobtime;
 	int i;
 
-	if (!ent)
-	{
-		return;
-	}
-
 	current_player = ent;
 	current_client = ent->client;
+	current_view = vs = &view_states[ent - g_edicts - 1];
+
+	vs->active = false;
 
 	/* If the origin or velocity have changed since ClientThink(),
 	   update the pmove values. This will happen when the client
@@ -1324,10 +1382,10 @@ ClientEndServerFrame(edict_t *ent)
 		current_client->ps.blend[3] = 0;
 		current_client->ps.fov = 90;
 		G_SetStats(ent);
-		return;
+		return false;
 	}
 
-	AngleVectors(ent->client->v_angle, forward, right, up);
+	AngleVectors(ent->client->v_angle, vs->forward, vs->right, vs->up);
 
 	/* burn from lava, etc */
 	P_WorldEffects();
@@ -1349,41 +1407,41 @@ ClientEndServerFrame(edict_t *ent)
 
 	/* calculate speed and cycle to be used for
 	   all cyclic walking effects */
-	xyspeed = sqrt(
+	vs->xyspeed = sqrt(
 			ent->velocity[0] * ent->velocity[0] + ent->velocity[1] *
 			ent->velocity[1]);
 
-	if (xyspeed < 5)
+	if (vs->xyspeed < 5)
 	{
-		bobmove = 0;
+		vs->bobmove = 0;
 		current_client->bobtime = 0; /* start at beginning of cycle again */
 	}
 	else if (ent->groundentity)
 	{
 		/* so bobbing only cycles when on ground */
-		if (xyspeed > 210)
+		if (vs->xyspeed > 210)
 		{
-			bobmove = 0.25;
+			vs->bobmove = 0.25;
 		}
-		else if (xyspeed > 100)
+		else if (vs->xyspeed > 100)
 		{
-			bobmove = 0.125;
+			vs->bobmove = 0.125;
 		}
 		else
 		{
-			bobmove = 0.0625;
+			vs->bobmove = 0.0625;
 		}
 	}
 
-	bobtime = (current_client->bobtime += bobmove);
+	bobtime = (current_client->bobtime += vs->bobmove);
 
 	if (current_client->ps.pmove.pm_flags & PMF_DUCKED)
 	{
 		bobtime *= 4;
 	}
 
-	bobcycle = (int)bobtime;
-	bobfracsin = fabs(sin(bobtime * M_PI));
+	vs->bobcycle = (int)bobtime;
+	vs->bobfracsin = fabs(sin(bobtime * M_PI));
 
 	/* detect hitting the floor */
 	P_FallingDamage(ent);
@@ -1391,16 +1449,38 @@ ClientEndServerFrame(edict_t *ent)
 	/* apply all the damage taken this frame */
 	P_DamageFeedback(ent);
 
+	vs->active = true;
+
+	return true;
+}
+
+/*
+ * Second part, only touches the player's own
+ * state and may run in a worker thread.
+ */
+static void
+P_ViewCompute(edict_t *ent)
+{
+	viewstate_t *vs;
+
+	vs = &view_states[ent - g_edicts - 1];
+
+	if (!vs->active)
+	{
+		return;
+	}
+
+	/* the blend and kicks of the damage taken */
+	P_DamageBlend(ent, vs);
+
 	/* determine the view offsets */
-	SV_CalcViewOffset(ent);
+	SV_CalcViewOffset(ent, vs);
 
 	/* determine the gun offsets */
-	SV_CalcGunOffset(ent);
+	SV_CalcGunOffset(ent, vs);
 
-	/* determine the full screen color blend
-	   must be after viewoffset, so eye contents
-	   can be accurately determined */
-	SV_CalcBlend(ent);
+	/* determine the full screen color blend */
+	SV_CalcBlend(ent, vs);
 
 	/* chase cam stuff */
 	if (ent->client->resp.spectator)
@@ -1411,6 +1491,43 @@ ClientEndServerFrame(edict_t *ent)
 	{
 		G_SetStats(ent);
 	}
+}
+
+static void
+P_ViewComputeJob(int index)
+{
+	P_ViewCompute(g_edicts + 1 + index);
+}
+
+/*
+ * Last part, runs in the main thread again.
+ */
+static void
+P_ViewFinish(edict_t *ent)
+{
+	current_player = ent;
+	current_client = ent->client;
+	current_view = &view_states[ent - g_edicts - 1];
+
+	if (!current_view->active)
+	{
+		return;
+	}
+
+	SV_CalcContentsBlend(ent, current_view);
+
+	/* the stats needed the engine */
+	if (G_StatsDeferred(ent))
+	{
+		if (ent->client->resp.spectator)
+		{
+			G_SetSpectatorStats(ent);
+		}
+		else
+		{
+			G_SetStats(ent);
+		}
+	}
 
 	G_CheckChaseStats(ent);
 
@@ -1435,7 +1552,7 @@ ClientEndServerFrame(edict_t *ent)
 		if (ent->client->showscores)
 		{
 			DeathmatchScoreboardMessage(ent, ent->enemy);
-			gi.unicast(ent, false);
+			G_Unicast(ent, false);
 		}
 
 		/* if the help computer is up, update it */
@@ -1443,7 +1560,7 @@ ClientEndServerFrame(edict_t *ent)
 		{
 			ent->client->pers.helpchanged = 0;
 			HelpComputerMessage(ent);
-			gi.unicast(ent, false);
+			G_Unicast(ent, false);
 		}
 	}
 
@@ -1451,6 +1568,79 @@ ClientEndServerFrame(edict_t *ent)
 	if (ent->client->showinventory)
 	{
 		InventoryMessage(ent);
-		gi.unicast(ent, false);
+		G_Unicast(ent, false);
+	}
+}
+
+/*
+ * Called for each player at the end of
+ * the server frame and right after spawning
+ */
+void
+ClientEndServerFrame(edict_t *ent)
+{
+	if (!ent)
+	{
+		return;
+	}
+
+	if (!P_ViewPrepare(ent))
+	{
+		return;
+	}
+
+	P_ViewCompute(ent);
+	P_ViewFinish(ent);
+}
+
+/*
+ * Ends the frame for all players. With g_threads the
+ * middle part runs on the worker threads, the first
+ * and the last part are done for all players in turn.
+ */
+void
+P_EndServerFrames(void)
+{
+	edict_t *ent;
+	int i;
+
+	if (!g_threads->value)
+	{
+		for (i = 0; i < game.maxclients; i++)
+		{
+			ent = g_edicts + 1 + i;
+
+			if (ent->inuse && ent->client)
+			{
+				G_SpanBegin("ClientEndServerFrame", ent);
+				ClientEndServerFrame(ent);
+				G_SpanEnd();
+			}
+		}
+
+		return;
+	}
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		ent = g_edicts + 1 + i;
+		view_states[i].active = false;
+
+		if (ent->inuse && ent->client)
+		{
+			P_ViewPrepare(ent);
+		}
+	}
+
+	G_RunParallel(P_ViewComputeJob, game.maxclients);
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		ent = g_edicts + 1 + i;
+
+		if (ent->inuse && ent->client)
+		{
+			P_ViewFinish(ent);
+		}
 	}
 }
@@ -83,7 +83,7 @@ P_ProjectSource(edict_t *ent, vec3_t distance,
 		VectorSet(start, ent->s.origin[0], ent->s.origin[1], ent->s.origin[2] + ent->viewheight);
 		VectorMA(start, 8192, forward, end);
 
-		trace_t	tr = gi.trace(start, NULL, NULL, end, ent, MASK_SHOT);
+		trace_t	tr = G_Trace(start, NULL, NULL, end, ent, MASK_SHOT);
 		if (tr.fraction < 1)
 		{
 			VectorSubtract(tr.endpos, result, forward);
@@ -267,7 +267,7 @@ PlayerNoise(edict_t *who, vec3_t where, int type)
 	VectorSubtract(where, noise->maxs, noise->absmin);
 	VectorAdd(where, noise->maxs, noise->absmax);
 	noise->last_sound_time = level.time;
-	gi.linkentity(noise);
+	G_LinkEntity(noise);
 }
 
 qboolean
@@ -335,7 +335,7 @@ Pickup_Weapon(edict_t *ent, edict_t *other)
 
 	if ((other->client->pers.weapon != ent->item) &&
 		(other->client->pers.inventory[index] == 1) &&
-		(!deathmatch->value || (other->client->pers.weapon == FindItem("blaster"))))
+		(!deathmatch->value || (other->client->pers.weapon == ITEM_BY_ID(IT_WEAPON_BLASTER))))
 	{
 		other->client->newweapon = ent->item;
 	}
@@ -416,56 +416,56 @@ ChangeWeapon(edict_t *ent)
 void
 NoAmmoWeaponChange(edict_t *ent)
 {
-	if (ent->client->pers.inventory[ITEM_INDEX(FindItem("slugs"))] &&
-		ent->client->pers.inventory[ITEM_INDEX(FindItem("railgun"))])
+	if (ent->client->pers.inventory[IT_AMMO_SLUGS] &&
+		ent->client->pers.inventory[IT_WEAPON_RAILGUN])
 	{
-		ent->client->newweapon = FindItem("railgun");
+		ent->client->newweapon = ITEM_BY_ID(IT_WEAPON_RAILGUN);
 		return;
 	}
 
-	if (ent->client->pers.inventory[ITEM_INDEX(FindItem("cells"))] > 1 &&
-		ent->client->pers.inventory[ITEM_INDEX(FindItem("ionripper"))])
+	if (ent->client->pers.inventory[IT_AMMO_CELLS] > 1 &&
+		ent->client->pers.inventory[IT_WEAPON_BOOMER])
 	{
-		ent->client->newweapon = FindItem("ionripper");
+		ent->client->newweapon = ITEM_BY_ID(IT_WEAPON_BOOMER);
 		return;
 	}
 
-	if (ent->client->pers.inventory[ITEM_INDEX(FindItem("cells"))] &&
-		ent->client->pers.inventory[ITEM_INDEX(FindItem("hyperblaster"))])
+	if (ent->client->pers.inventory[IT_AMMO_CELLS] &&
+		ent->client->pers.inventory[IT_WEAPON_HYPERBLASTER])
 	{
-		ent->client->newweapon = FindItem("hyperblaster");
+		ent->client->newweapon = ITEM_BY_ID(IT_WEAPON_HYPERBLASTER);
 		return;
 	}
 
-	if (ent->client->pers.inventory[ITEM_INDEX(FindItem("bullets"))] &&
-		ent->client->pers.inventory[ITEM_INDEX(FindItem("chaingun"))])
+	if (ent->client->pers.inventory[IT_AMMO_BULLETS] &&
+		ent->client->pers.inventory[IT_WEAPON_CHAINGUN])
 	{
-		ent->client->newweapon = FindItem("chaingun");
+		ent->client->newweapon = ITEM_BY_ID(IT_WEAPON_CHAINGUN);
 		return;
 	}
 
-	if (ent->client->pers.inventory[ITEM_INDEX(FindItem("bullets"))] &&
-		ent->client->pers.inventory[ITEM_INDEX(FindItem("machinegun"))])
+	if (ent->client->pers.inventory[IT_AMMO_BULLETS] &&
+		ent->client->pers.inventory[IT_WEAPON_MACHINEGUN])
 	{
-		ent->client->newweapon = FindItem("machinegun");
+		ent->client->newweapon = ITEM_BY_ID(IT_WEAPON_MACHINEGUN);
 		return;
 	}
 
-	if ((ent->client->pers.inventory[ITEM_INDEX(FindItem("shells"))] > 1) &&
-		ent->client->pers.inventory[ITEM_INDEX(FindItem("super shotgun"))])
+	if ((ent->client->pers.inventory[IT_AMMO_SHELLS] > 1) &&
+		ent->client->pers.inventory[IT_WEAPON_SUPERSHOTGUN])
 	{
-		ent->client->newweapon = FindItem("super shotgun");
+		ent->client->newweapon = ITEM_BY_ID(IT_WEAPON_SUPERSHOTGUN);
 		return;
 	}
 
-	if (ent->client->pers.inventory[ITEM_INDEX(FindItem("shells"))] &&
-		ent->client->pers.inventory[ITEM_INDEX(FindItem("shotgun"))])
+	if (ent->client->pers.inventory[IT_AMMO_SHELLS] &&
+		ent->client->pers.inventory[IT_WEAPON_SHOTGUN])
 	{
-		ent->client->newweapon = FindItem("shotgun");
+		ent->client->newweapon = ITEM_BY_ID(IT_WEAPON_SHOTGUN);
 		return;
 	}
 
-	ent->client->newweapon = FindItem("blaster");
+	ent->client->newweapon = ITEM_BY_ID(IT_WEAPON_BLASTER);
 }
 
 /*
@@ -557,14 +557,14 @@ Use_Weapon(edict_t *ent, const gitem_t *item)
 
 		if (!ent->client->pers.inventory[ammo_index])
 		{
-			gi.cprintf(ent, PRINT_HIGH, "No %s for %s.\n",
+			G_CPrintf(ent, PRINT_HIGH, "No %s for %s.\n",
 					ammo_item->pickup_name, item->pickup_name);
 			return;
 		}
 
 		if (ent->client->pers.inventory[ammo_index] < item->quantity)
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Not enough %s for %s.\n",
+			G_CPrintf(ent, PRINT_HIGH, "Not enough %s for %s.\n",
 					ammo_item->pickup_name, item->pickup_name);
 			return;
 		}
@@ -591,12 +591,12 @@ Use_Weapon2(edict_t *ent, const gitem_t *item)
 	{
 		if (item == ent->client->pers.weapon)
 		{
-			item = FindItem("Ionripper");
+			item = ITEM_BY_ID(IT_WEAPON_BOOMER);
 			index = ITEM_INDEX(item);
 
 			if (!ent->client->pers.inventory[index])
 			{
-				item = FindItem("HyperBlaster");
+				item = ITEM_BY_ID(IT_WEAPON_HYPERBLASTER);
 			}
 		}
 	}
@@ -608,29 +608,29 @@ Use_Weapon2(edict_t *ent, const gitem_t *item)
 
 		if (!ent->client->pers.inventory[ammo_index])
 		{
-			nextitem = FindItem("Phalanx");
+			nextitem = ITEM_BY_ID(IT_WEAPON_PHALANX);
 			ammo_item = FindItem(nextitem->ammo);
 			ammo_index = ITEM_INDEX(ammo_item);
 
 			if (ent->client->pers.inventory[ammo_index])
 			{
-				item = FindItem("Phalanx");
+				item = ITEM_BY_ID(IT_WEAPON_PHALANX);
 				index = ITEM_INDEX(item);
 
 				if (!ent->client->pers.inventory[index])
 				{
-					item = FindItem("Railgun");
+					item = ITEM_BY_ID(IT_WEAPON_RAILGUN);
 				}
 			}
 		}
 		else if (item == ent->client->pers.weapon)
 		{
-			item = FindItem("Phalanx");
+			item = ITEM_BY_ID(IT_WEAPON_PHALANX);
 			index = ITEM_INDEX(item);
 
 			if (!ent->client->pers.inventory[index])
 			{
-				item = FindItem("Railgun");
+				item = ITEM_BY_ID(IT_WEAPON_RAILGUN);
 			}
 		}
 	}
@@ -648,7 +648,7 @@ Use_Weapon2(edict_t *ent, const gitem_t *item)
 
 		if (!ent->client->pers.inventory[ammo_index] && !g_select_empty->value)
 		{
-			gi.cprintf(ent, PRINT_HIGH, "No %s for %s.\n",
+			G_CPrintf(ent, PRINT_HIGH, "No %s for %s.\n",
 					ammo_item->pickup_name, item->pickup_name);
 			return;
 		}
@@ -680,7 +680,7 @@ Drop_Weapon(edict_t *ent, const gitem_t *item)
 		 (item == ent->client->newweapon)) &&
 		(ent->client->pers.inventory[index] == 1))
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Can't drop current weapon\n");
+		G_CPrintf(ent, PRINT_HIGH, "Can't drop current weapon\n");
 		return;
 	}
 
@@ -792,8 +792,7 @@ Weapon_Generic(edict_t *ent, int FRAME_ACTIVATE_LAST, int FRAME_FIRE_LAST,
 			{
 				if (level.time >= ent->pain_debounce_time)
 				{
-					gi.sound(ent, CHAN_VOICE, gi.soundindex(
-								"weapons/noammo.wav"), 1, ATTN_NORM, 0);
+					gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_NOAMMO), 1, ATTN_NORM, 0);
 					ent->pain_debounce_time = level.time + 1;
 				}
 
@@ -814,7 +813,7 @@ Weapon_Generic(edict_t *ent, int FRAME_ACTIVATE_LAST, int FRAME_FIRE_LAST,
 				{
 					if (ent->client->ps.gunframe == pause_frames[n])
 					{
-						if (randk() & 15)
+						if (G_RandInt(RAND_WEAPON) & 15)
 						{
 							return;
 						}
@@ -835,8 +834,7 @@ Weapon_Generic(edict_t *ent, int FRAME_ACTIVATE_LAST, int FRAME_FIRE_LAST,
 			{
 				if (ent->client->quad_framenum > level.framenum)
 				{
-					gi.sound(ent, CHAN_ITEM, gi.soundindex(
-								"items/damage3.wav"), 1, ATTN_NORM, 0);
+					gi.sound(ent, CHAN_ITEM, G_SoundIndex(SND_DAMAGE3), 1, ATTN_NORM, 0);
 				}
 
 				fire(ent);
@@ -882,8 +880,7 @@ weapon_grenade_fire(edict_t *ent, qboolean held)
 	{
 		damage *= 4;
 
-		gi.sound(ent, CHAN_ITEM, gi.soundindex(
-				"items/damage3.wav"), 1, ATTN_NORM, 0);
+		gi.sound(ent, CHAN_ITEM, G_SoundIndex(SND_DAMAGE3), 1, ATTN_NORM, 0);
 	}
 
 	VectorSet(offset, 8, 8, ent->viewheight - 8);
@@ -964,8 +961,7 @@ Weapon_Grenade(edict_t *ent)
 			{
 				if (level.time >= ent->pain_debounce_time)
 				{
-					gi.sound(ent, CHAN_VOICE, gi.soundindex(
-								"weapons/noammo.wav"), 1, ATTN_NORM, 0);
+					gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_NOAMMO), 1, ATTN_NORM, 0);
 					ent->pain_debounce_time = level.time + 1;
 				}
 
@@ -980,7 +976,7 @@ Weapon_Grenade(edict_t *ent)
 			(ent->client->ps.gunframe == 39) ||
 			(ent->client->ps.gunframe == 48))
 		{
-			if (randk() & 15)
+			if (G_RandInt(RAND_WEAPON) & 15)
 			{
 				return;
 			}
@@ -998,8 +994,7 @@ Weapon_Grenade(edict_t *ent)
 	{
 		if (ent->client->ps.gunframe == 5)
 		{
-			gi.sound(ent, CHAN_WEAPON, gi.soundindex(
-							"weapons/hgrena1b.wav"), 1, ATTN_NORM, 0);
+			gi.sound(ent, CHAN_WEAPON, G_SoundIndex(SND_HGRENA1B), 1, ATTN_NORM, 0);
 		}
 
 		if (ent->client->ps.gunframe == 11)
@@ -1007,8 +1002,7 @@ Weapon_Grenade(edict_t *ent)
 			if (!ent->client->grenade_time)
 			{
 				ent->client->grenade_time = level.time + GRENADE_TIMER + 0.2;
-				ent->client->weapon_sound = gi.soundindex(
-						"weapons/hgrenc1b.wav");
+				ent->client->weapon_sound = G_SoundIndex(SND_HGRENC1B);
 			}
 
 			/* they waited too long, detonate it in their hand */
@@ -1095,10 +1089,10 @@ weapon_grenadelauncher_fire(edict_t *ent)
 
 	fire_grenade(ent, start, forward, damage, 600, 2.5, radius);
 
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte(MZ_GRENADE | is_silenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte(MZ_GRENADE | is_silenced);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	ent->client->ps.gunframe++;
 
@@ -1144,7 +1138,7 @@ Weapon_RocketLauncher_Fire(edict_t *ent)
 		return;
 	}
 
-	damage = 100 + (int)(random() * 20.0);
+	damage = 100 + (int)(G_Random(RAND_WEAPON) * 20.0);
 	radius_damage = 120;
 	damage_radius = 120;
 
@@ -1164,10 +1158,10 @@ Weapon_RocketLauncher_Fire(edict_t *ent)
 	fire_rocket(ent, start, forward, damage, 650, damage_radius, radius_damage);
 
 	/* send muzzle flash */
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte(MZ_ROCKET | is_silenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte(MZ_ROCKET | is_silenced);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	ent->client->ps.gunframe++;
 
@@ -1233,19 +1227,19 @@ Blaster_Fire(edict_t *ent, vec3_t g_offset, int damage,
 	fire_blaster(ent, start, forward, damage, 1000, effect, hyper);
 
 	/* send muzzle flash */
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
 
 	if (hyper)
 	{
-		gi.WriteByte(MZ_HYPERBLASTER | is_silenced);
+		G_WriteByte(MZ_HYPERBLASTER | is_silenced);
 	}
 	else
 	{
-		gi.WriteByte(MZ_BLASTER | is_silenced);
+		G_WriteByte(MZ_BLASTER | is_silenced);
 	}
 
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	PlayerNoise(ent, start, PNOISE_WEAPON);
 }
@@ -1307,7 +1301,7 @@ Weapon_HyperBlaster_Fire(edict_t *ent)
 		return;
 	}
 
-	ent->client->weapon_sound = gi.soundindex("weapons/hyprbl1a.wav");
+	ent->client->weapon_sound = G_SoundIndex(SND_HYPRBL1A);
 
 	if (!(ent->client->buttons & BUTTON_ATTACK))
 	{
@@ -1319,8 +1313,7 @@ Weapon_HyperBlaster_Fire(edict_t *ent)
 		{
 			if (level.time >= ent->pain_debounce_time)
 			{
-				gi.sound(ent, CHAN_VOICE, gi.soundindex(
-							"weapons/noammo.wav"), 1, ATTN_NORM, 0);
+				gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_NOAMMO), 1, ATTN_NORM, 0);
 				ent->pain_debounce_time = level.time + 1;
 			}
 
@@ -1384,8 +1377,7 @@ Weapon_HyperBlaster_Fire(edict_t *ent)
 
 	if (ent->client->ps.gunframe == 12)
 	{
-		gi.sound(ent, CHAN_AUTO, gi.soundindex(
-						"weapons/hyprbd1a.wav"), 1, ATTN_NORM, 0);
+		gi.sound(ent, CHAN_AUTO, G_SoundIndex(SND_HYPRBD1A), 1, ATTN_NORM, 0);
 		ent->client->weapon_sound = 0;
 	}
 }
@@ -1453,8 +1445,7 @@ Machinegun_Fire(edict_t *ent)
 
 		if (level.time >= ent->pain_debounce_time)
 		{
-			gi.sound(ent, CHAN_VOICE, gi.soundindex(
-						"weapons/noammo.wav"), 1, ATTN_NORM, 0);
+			gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_NOAMMO), 1, ATTN_NORM, 0);
 			ent->pain_debounce_time = level.time + 1;
 		}
 
@@ -1470,11 +1461,11 @@ Machinegun_Fire(edict_t *ent)
 
 	for (i = 1; i < 3; i++)
 	{
-		ent->client->kick_origin[i] = crandom() * 0.35;
-		ent->client->kick_angles[i] = crandom() * 0.7;
+		ent->client->kick_origin[i] = G_CRandom(RAND_WEAPON) * 0.35;
+		ent->client->kick_angles[i] = G_CRandom(RAND_WEAPON) * 0.7;
 	}
 
-	ent->client->kick_origin[0] = crandom() * 0.35;
+	ent->client->kick_origin[0] = G_CRandom(RAND_WEAPON) * 0.35;
 	ent->client->kick_angles[0] = ent->client->machinegun_shots * -1.5;
 
 	/* raise the gun as it is firing */
@@ -1496,10 +1487,10 @@ Machinegun_Fire(edict_t *ent)
 	fire_bullet(ent, start, forward, damage, kick, DEFAULT_BULLET_HSPREAD,
 			DEFAULT_BULLET_VSPREAD, MOD_MACHINEGUN);
 
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte(MZ_MACHINEGUN | is_silenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte(MZ_MACHINEGUN | is_silenced);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	PlayerNoise(ent, start, PNOISE_WEAPON);
 
@@ -1512,12 +1503,12 @@ Machinegun_Fire(edict_t *ent)
 
 	if (ent->client->ps.pmove.pm_flags & PMF_DUCKED)
 	{
-		ent->s.frame = FRAME_crattak1 - (int)(random() + 0.25);
+		ent->s.frame = FRAME_crattak1 - (int)(G_Random(RAND_WEAPON) + 0.25);
 		ent->client->anim_end = FRAME_crattak9;
 	}
 	else
 	{
-		ent->s.frame = FRAME_attack1 - (int)(random() + 0.25);
+		ent->s.frame = FRAME_attack1 - (int)(G_Random(RAND_WEAPON) + 0.25);
 		ent->client->anim_end = FRAME_attack8;
 	}
 }
@@ -1571,8 +1562,7 @@ Chaingun_Fire(edict_t *ent)
 
 	if (ent->client->ps.gunframe == 5)
 	{
-		gi.sound(ent, CHAN_AUTO, gi.soundindex(
-					"weapons/chngnu1a.wav"), 1, ATTN_IDLE, 0);
+		gi.sound(ent, CHAN_AUTO, G_SoundIndex(SND_CHNGNU1A), 1, ATTN_IDLE, 0);
 	}
 
 	if ((ent->client->ps.gunframe == 14) &&
@@ -1596,12 +1586,11 @@ Chaingun_Fire(edict_t *ent)
 	if (ent->client->ps.gunframe == 22)
 	{
 		ent->client->weapon_sound = 0;
-		gi.sound(ent, CHAN_AUTO, gi.soundindex(
-					"weapons/chngnd1a.wav"), 1, ATTN_IDLE, 0);
+		gi.sound(ent, CHAN_AUTO, G_SoundIndex(SND_CHNGND1A), 1, ATTN_IDLE, 0);
 	}
 	else
 	{
-		ent->client->weapon_sound = gi.soundindex("weapons/chngnl1a.wav");
+		ent->client->weapon_sound = G_SoundIndex(SND_CHNGNL1A);
 	}
 
 	ent->client->anim_priority = ANIM_ATTACK;
@@ -1646,8 +1635,7 @@ Chaingun_Fire(edict_t *ent)
 	{
 		if (level.time >= ent->pain_debounce_time)
 		{
-			gi.sound(ent, CHAN_VOICE, gi.soundindex(
-							"weapons/noammo.wav"), 1, ATTN_NORM, 0);
+			gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_NOAMMO), 1, ATTN_NORM, 0);
 			ent->pain_debounce_time = level.time + 1;
 		}
 
@@ -1663,16 +1651,16 @@ Chaingun_Fire(edict_t *ent)
 
 	for (i = 0; i < 3; i++)
 	{
-		ent->client->kick_origin[i] = crandom() * 0.35;
-		ent->client->kick_angles[i] = crandom() * 0.7;
+		ent->client->kick_origin[i] = G_CRandom(RAND_WEAPON) * 0.35;
+		ent->client->kick_angles[i] = G_CRandom(RAND_WEAPON) * 0.7;
 	}
 
 	for (i = 0; i < shots; i++)
 	{
 		/* get start / end positions */
 		AngleVectors(ent->client->v_angle, forward, right, up);
-		r = 7 + crandom() * 4;
-		u = crandom() * 4;
+		r = 7 + G_CRandom(RAND_WEAPON) * 4;
+		u = G_CRandom(RAND_WEAPON) * 4;
 		VectorSet(offset, 0, r, u + ent->viewheight - 8);
 		P_ProjectSource(ent, offset,
 				forward, right, start);
@@ -1683,10 +1671,10 @@ Chaingun_Fire(edict_t *ent)
 	}
 
 	/* send muzzle flash */
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte((MZ_CHAINGUN1 + shots - 1) | is_silenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte((MZ_CHAINGUN1 + shots - 1) | is_silenced);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	PlayerNoise(ent, start, PNOISE_WEAPON);
 
@@ -1758,10 +1746,10 @@ weapon_shotgun_fire(edict_t *ent)
 			500, DEFAULT_SHOTGUN_COUNT, MOD_SHOTGUN);
 
 	/* send muzzle flash */
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte(MZ_SHOTGUN | is_silenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte(MZ_SHOTGUN | is_silenced);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	ent->client->ps.gunframe++;
 	PlayerNoise(ent, start, PNOISE_WEAPON);
@@ -1861,10 +1849,10 @@ weapon_supershotgun_fire(edict_t *ent)
 			DEFAULT_SSHOTGUN_COUNT / 2, MOD_SSHOTGUN);
 
 	/* send muzzle flash */
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte(MZ_SSHOTGUN | is_silenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte(MZ_SSHOTGUN | is_silenced);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	ent->client->ps.gunframe++;
 	PlayerNoise(ent, start, PNOISE_WEAPON);
@@ -1942,10 +1930,10 @@ weapon_railgun_fire(edict_t *ent)
 	fire_rail(ent, start, forward, damage, kick);
 
 	/* send muzzle flash */
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte(MZ_RAILGUN | is_silenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte(MZ_RAILGUN | is_silenced);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	ent->client->ps.gunframe++;
 	PlayerNoise(ent, start, PNOISE_WEAPON);
@@ -2005,10 +1993,10 @@ weapon_bfg_fire(edict_t *ent)
 	if (ent->client->ps.gunframe == 9)
 	{
 		/* send muzzle flash */
-		gi.WriteByte(svc_muzzleflash);
-		gi.WriteShort(ent - g_edicts);
-		gi.WriteByte(MZ_BFG | is_silenced);
-		gi.multicast(ent->s.origin, MULTICAST_PVS);
+		G_WriteByte(svc_muzzleflash);
+		G_WriteShort(ent - g_edicts);
+		G_WriteByte(MZ_BFG | is_silenced);
+		G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 		ent->client->ps.gunframe++;
 
@@ -2035,7 +2023,7 @@ weapon_bfg_fire(edict_t *ent)
 
 	/* make a big pitch kick with an inverse fall */
 	ent->client->v_dmg_pitch = -40;
-	ent->client->v_dmg_roll = crandom() * 8;
+	ent->client->v_dmg_roll = G_CRandom(RAND_WEAPON) * 8;
 	ent->client->v_dmg_time = level.time + DAMAGE_TIME;
 
 	VectorSet(offset, 8, 8, ent->viewheight - 8);
@@ -2107,7 +2095,7 @@ weapon_ionripper_fire(edict_t *ent)
 	}
 
 	VectorCopy(ent->client->v_angle, tempang);
-	tempang[YAW] += crandom();
+	tempang[YAW] += G_CRandom(RAND_WEAPON);
 
 	AngleVectors(tempang, forward, right, NULL);
 
@@ -2121,10 +2109,10 @@ weapon_ionripper_fire(edict_t *ent)
 	fire_ionripper(ent, start, forward, damage, 500, EF_IONRIPPER);
 
 	/* send muzzle flash */
-	gi.WriteByte(svc_muzzleflash);
-	gi.WriteShort(ent - g_edicts);
-	gi.WriteByte(MZ_IONRIPPER | is_silenced);
-	gi.multicast(ent->s.origin, MULTICAST_PVS);
+	G_WriteByte(svc_muzzleflash);
+	G_WriteShort(ent - g_edicts);
+	G_WriteByte(MZ_IONRIPPER | is_silenced);
+	G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 	ent->client->ps.gunframe++;
 	PlayerNoise(ent, start, PNOISE_WEAPON);
@@ -2180,7 +2168,7 @@ weapon_phalanx_fire(edict_t *ent)
 		return;
 	}
 
-	damage = 70 + (int)(random() * 10.0);
+	damage = 70 + (int)(G_Random(RAND_WEAPON) * 10.0);
 	radius_damage = 120;
 	damage_radius = 120;
 
@@ -2249,10 +2237,10 @@ weapon_phalanx_fire(edict_t *ent)
 				damage_radius, radius_damage);
 
 		/* send muzzle flash */
-		gi.WriteByte(svc_muzzleflash);
-		gi.WriteShort(ent - g_edicts);
-		gi.WriteByte(MZ_PHALANX | is_silenced);
-		gi.multicast(ent->s.origin, MULTICAST_PVS);
+		G_WriteByte(svc_muzzleflash);
+		G_WriteShort(ent - g_edicts);
+		G_WriteByte(MZ_PHALANX | is_silenced);
+		G_Multicast(ent->s.origin, MULTICAST_PVS);
 
 		PlayerNoise(ent, start, PNOISE_WEAPON);
 	}
@@ -2357,7 +2345,7 @@ Weapon_Trap(edict_t *ent)
 			{
 				if (level.time >= ent->pain_debounce_time)
 				{
-					gi.sound(ent, CHAN_VOICE, gi.soundindex("weapons/noammo.wav"),
+					gi.sound(ent, CHAN_VOICE, G_SoundIndex(SND_NOAMMO),
 							1, ATTN_NORM, 0);
 					ent->pain_debounce_time = level.time + 1;
 				}
@@ -2373,7 +2361,7 @@ Weapon_Trap(edict_t *ent)
 			(ent->client->ps.gunframe == 39) ||
 			(ent->client->ps.gunframe == 48))
 		{
-			if (randk() & 15)
+			if (G_RandInt(RAND_WEAPON) & 15)
 			{
 				return;
 			}
@@ -2391,7 +2379,7 @@ Weapon_Trap(edict_t *ent)
 	{
 		if (ent->client->ps.gunframe == 5)
 		{
-			gi.sound(ent, CHAN_WEAPON, gi.soundindex("weapons/trapcock.wav"),
+			gi.sound(ent, CHAN_WEAPON, G_SoundIndex(SND_TRAPCOCK),
 					1, ATTN_NORM, 0);
 		}
 
@@ -2400,7 +2388,7 @@ Weapon_Trap(edict_t *ent)
 			if (!ent->client->grenade_time)
 			{
 				ent->client->grenade_time = level.time + GRENADE_TIMER + 0.2;
-				ent->client->weapon_sound = gi.soundindex("weapons/traploop.wav");
+				ent->client->weapon_sound = G_SoundIndex(SND_TRAPLOOP);
 			}
 
 			/* they waited too long, detonate it in their hand */
@@ -64,6 +64,9 @@
  * system and architecture are in the hands of the user.
  */
 
+#include <ctype.h>
+#include <stddef.h>
+
 #include "../header/local.h"
 #include "savegame.h"
 /*
@@ -71,7 +74,7 @@
  * load older savegames. This should be bumped if the files
  * in tables/ are changed, otherwise strange things may happen.
  */
-#define SAVEGAMEVER "YQ2-5"
+#define SAVEGAMEVER "YQ2-6"
 
 #ifndef BUILD_DATE
 #define BUILD_DATE __DATE__
@@ -160,6 +163,25 @@ static const field_t stfields[] = {
 	#include "tables/stfields.h"
 };
 
+/*
+ * On disk an edict still carries its moveinfo_t
+ * and monsterinfo_t inline, like it did before
+ * they were moved into pools. This keeps the
+ * format and older savegames compatible.
+ */
+typedef struct
+{
+	byte head[offsetof(edict_t, moveinfo)];
+	moveinfo_t moveinfo;
+	monsterinfo_t monsterinfo;
+	int orders;
+} savedict_t;
+
+#define SAVEOFS(x) (size_t)&(((savedict_t *)NULL)->x)
+
+YQ2_STATIC_ASSERT(offsetof(savedict_t, moveinfo) == offsetof(edict_t, moveinfo),
+		"savedict_t head doesn't match edict_t");
+
 /*
  * Entity fields to be saved
  */
@@ -172,17 +194,17 @@ static const fplist_entry_t fpentries_ent[] =
 	{FOFS(touch), &fnlist_touch},
 	{FOFS(use), &fnlist_use},
 	{FOFS(blocked), &fnlist_blocked},
-	{FOFS(monsterinfo.sight), &fnlist_mi_sight},
-	{FOFS(monsterinfo.search), &fnlist_mi_search},
-	{FOFS(monsterinfo.stand), &fnlist_mi_stand},
-	{FOFS(monsterinfo.idle), &fnlist_mi_idle},
-	{FOFS(monsterinfo.walk), &fnlist_mi_walk},
-	{FOFS(monsterinfo.run), &fnlist_mi_run},
-	{FOFS(monsterinfo.melee), &fnlist_mi_melee},
-	{FOFS(monsterinfo.attack), &fnlist_mi_attack},
-	{FOFS(monsterinfo.checkattack), &fnlist_mi_checkattack},
-	{FOFS(monsterinfo.dodge), &fnlist_mi_dodge},
-	{FOFS(moveinfo.endfunc), &fnlist_mv_end}
+	{SAVEOFS(monsterinfo.sight), &fnlist_mi_sight},
+	{SAVEOFS(monsterinfo.search), &fnlist_mi_search},
+	{SAVEOFS(monsterinfo.stand), &fnlist_mi_stand},
+	{SAVEOFS(monsterinfo.idle), &fnlist_mi_idle},
+	{SAVEOFS(monsterinfo.walk), &fnlist_mi_walk},
+	{SAVEOFS(monsterinfo.run), &fnlist_mi_run},
+	{SAVEOFS(monsterinfo.melee), &fnlist_mi_melee},
+	{SAVEOFS(monsterinfo.attack), &fnlist_mi_attack},
+	{SAVEOFS(monsterinfo.checkattack), &fnlist_mi_checkattack},
+	{SAVEOFS(monsterinfo.dodge), &fnlist_mi_dodge},
+	{SAVEOFS(moveinfo.endfunc), &fnlist_mv_end}
 };
 static const fptrList_t fplist_ent =
 {
@@ -196,7 +218,7 @@ static const structdef_t sd_ent =
 {
 	entfields, ARREND(entfields),
 	&fplist_ent,
-	sizeof(edict_t)
+	sizeof(savedict_t)
 };
 
 /*
@@ -240,23 +262,79 @@ static const structdef_t sd_game =
 /* TODO: Replace %u with YQ2_COM_PRIdS later */
 
 static void
-sg_fread(void *dest, size_t n, FILE *f)
+sg_fread(void *dest, size_t n, saveread_t *f)
 {
-	if (fread(dest, n, 1, f) != 1)
+	if (n > f->size - f->pos)
 	{
-		fclose(f);
 		gi.error("Error reading %u bytes from save file", (unsigned int)n);
+		return;
+	}
+
+	memcpy(dest, f->data + f->pos, n);
+	f->pos += n;
+}
+
+/* like sg_fread(), but returns false at the end of the data */
+static qboolean
+sg_tryread(void *dest, size_t n, saveread_t *f)
+{
+	if (n > f->size - f->pos)
+	{
+		return false;
 	}
+
+	sg_fread(dest, n, f);
+
+	return true;
 }
 
+/* the file being loaded, freed by the next load
+   if the previous one was aborted by gi.error() */
+static savebuf_t sg_loadbuf;
+
+/*
+ * Reads a whole savegame file into memory.
+ */
 static void
-sg_fwrite(const void *src, size_t n, FILE *f)
+sg_fload(saveread_t *f, const char *filename)
 {
-	if (fwrite(src, n, 1, f) != 1)
+	byte chunk[16384];
+	FILE *file;
+	size_t n;
+
+	SaveBuf_Free(&sg_loadbuf);
+
+	file = Q_fopen(filename, "rb");
+
+	if (!file)
 	{
-		fclose(f);
-		gi.error("Error writing %u bytes to save file", (unsigned int)n);
+		gi.error("Couldn't open %s", filename);
+		return;
+	}
+
+	while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+	{
+		SaveBuf_Write(&sg_loadbuf, chunk, n);
 	}
+
+	fclose(file);
+
+	f->data = sg_loadbuf.data;
+	f->size = sg_loadbuf.size;
+	f->pos = 0;
+}
+
+static void
+sg_fclose(saveread_t *f)
+{
+	SaveBuf_Free(&sg_loadbuf);
+	memset(f, 0, sizeof(*f));
+}
+
+static void
+sg_fwrite(const void *src, size_t n, savebuf_t *sb)
+{
+	SaveBuf_Write(sb, src, n);
 }
 
 const field_t *
@@ -291,6 +369,160 @@ FindSpawnfield(const char *key)
 	return NULL;
 }
 
+/*
+ * The spawn fields (spawn_temp_t first, then edict_t)
+ * in a perfect hash table: the seed is chosen so that
+ * every name gets its own slot and a lookup is one
+ * hash and one compare.
+ */
+#define SPAWNFIELD_MINSIZE 256
+
+typedef struct
+{
+	const field_t *field;
+	qboolean spawntemp;
+} spawnslot_t;
+
+static spawnslot_t *spawnfield_slots;
+static unsigned int spawnfield_mask;
+static unsigned int spawnfield_seed;
+
+static unsigned int
+SpawnFieldHash(const char *key, size_t len, unsigned int seed)
+{
+	unsigned int hash;
+	size_t i;
+
+	hash = 2166136261u ^ seed;
+
+	for (i = 0; i < len; i++)
+	{
+		hash = (hash ^ (byte)tolower((byte)key[i])) * 16777619u;
+	}
+
+	return hash ^ (hash >> 15);
+}
+
+static qboolean
+SpawnFieldInsert(const field_t *f, qboolean spawntemp)
+{
+	spawnslot_t *slot;
+
+	slot = &spawnfield_slots[SpawnFieldHash(f->name, strlen(f->name),
+			spawnfield_seed) & spawnfield_mask];
+
+	if (slot->field)
+	{
+		/* the first field of a name wins, like
+		   in FindSpawntempField / FindSpawnfield */
+		return !Q_strcasecmp(slot->field->name, f->name);
+	}
+
+	slot->field = f;
+	slot->spawntemp = spawntemp;
+
+	return true;
+}
+
+static qboolean
+SpawnFieldsBuild(void)
+{
+	const field_t *f;
+
+	memset(spawnfield_slots, 0, (spawnfield_mask + 1) * sizeof(spawnslot_t));
+
+	for (f = stfields; f < ARREND(stfields); f++)
+	{
+		if (!SpawnFieldInsert(f, true))
+		{
+			return false;
+		}
+	}
+
+	for (f = entfields; f < ARREND(entfields); f++)
+	{
+		if (!(f->flags & FFL_NOSPAWN) && !SpawnFieldInsert(f, false))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void
+InitSpawnFields(void)
+{
+	unsigned int size;
+
+	for (size = SPAWNFIELD_MINSIZE; ; size *= 2)
+	{
+		spawnfield_slots = gi.TagMalloc(size * sizeof(spawnslot_t), TAG_GAME);
+		spawnfield_mask = size - 1;
+
+		for (spawnfield_seed = 0; spawnfield_seed < 4096; spawnfield_seed++)
+		{
+			if (SpawnFieldsBuild())
+			{
+				return;
+			}
+		}
+
+		gi.TagFree(spawnfield_slots);
+	}
+}
+
+/*
+ * Looks up a spawn field by a key that
+ * doesn't need to be null terminated.
+ */
+const field_t *
+FindSpawnFieldSpan(const char *key, size_t len, qboolean *spawntemp)
+{
+	const spawnslot_t *slot;
+
+	slot = &spawnfield_slots[SpawnFieldHash(key, len, spawnfield_seed) &
+		spawnfield_mask];
+
+	if (!slot->field || Q_strncasecmp(slot->field->name, key, (int)len) ||
+		slot->field->name[len])
+	{
+		return NULL;
+	}
+
+	*spawntemp = slot->spawntemp;
+
+	return slot->field;
+}
+
+/*
+ * Enumerates the spawn_temp_t fields followed by
+ * the edict_t fields, NULL after the last one.
+ */
+const field_t *
+GetSpawnField(int index, qboolean *spawntemp)
+{
+	int num;
+
+	num = (int)(ARREND(stfields) - stfields);
+
+	if ((index >= 0) && (index < num))
+	{
+		*spawntemp = true;
+		return &stfields[index];
+	}
+
+	index -= num;
+
+	if ((index >= 0) && (index < (int)(ARREND(entfields) - entfields)))
+	{
+		*spawntemp = false;
+		return &entfields[index];
+	}
+
+	return NULL;
+}
+
 static void
 InitAllocations(void)
 {
@@ -318,6 +550,11 @@ InitAllocations(void)
 
 	game.clients = gi.TagMalloc (num_c * sizeof(game.clients[0]), TAG_GAME);
 	game.maxclients = num_c;
+
+	G_InitEdictGenerations();
+	G_InitLagCompensation();
+	G_InitEdictMirror();
+	InitSpawnFields();
 }
 
 /*
@@ -334,10 +571,21 @@ InitGame(void)
 	gun_x = gi.cvar("gun_x", "0", 0);
 	gun_y = gi.cvar("gun_y", "0", 0);
 	gun_z = gi.cvar("gun_z", "0", 0);
+	cl_gun = gi.cvar("cl_gun", "2", 0);
 	sv_rollspeed = gi.cvar("sv_rollspeed", "200", 0);
 	sv_rollangle = gi.cvar("sv_rollangle", "2", 0);
 	sv_maxvelocity = gi.cvar("sv_maxvelocity", "2000", 0);
 	sv_gravity = gi.cvar("sv_gravity", "800", 0);
+	g_lagcomp = gi.cvar("g_lagcomp", "0", CVAR_ARCHIVE);
+	g_debug_edicts = gi.cvar("g_debug_edicts", "0", 0);
+	g_async_save = gi.cvar("g_async_save", "0", CVAR_ARCHIVE);
+	g_delta_saves = gi.cvar("g_delta_saves", "1", CVAR_ARCHIVE);
+	g_entcache = gi.cvar("g_entcache", "0", CVAR_ARCHIVE);
+	g_threads = gi.cvar("g_threads", "0", CVAR_ARCHIVE);
+	g_callstats = gi.cvar("g_callstats", "0", 0);
+	g_netstats = gi.cvar("g_netstats", "0", 0);
+	g_flightrec = gi.cvar("g_flightrec", "0", 0);
+	g_flightrec_frames = gi.cvar("g_flightrec_frames", "20", 0);
 
 	/* noset vars */
 	dedicated = gi.cvar("dedicated", "0", CVAR_NOSET);
@@ -366,6 +614,7 @@ InitGame(void)
 	spectator_password = gi.cvar("spectator_password", "", CVAR_USERINFO);
 	needpass = gi.cvar("needpass", "0", CVAR_SERVERINFO);
 	filterban = gi.cvar("filterban", "1", 0);
+	filterbanlist = gi.cvar("filterbanlist", "banlist.txt", 0);
 	g_select_empty = gi.cvar("g_select_empty", "0", CVAR_ARCHIVE);
 	run_pitch = gi.cvar("run_pitch", "0.002", 0);
 	run_roll = gi.cvar("run_roll", "0.005", 0);
@@ -377,6 +626,7 @@ InitGame(void)
 	flood_msgs = gi.cvar("flood_msgs", "4", 0);
 	flood_persecond = gi.cvar("flood_persecond", "4", 0);
 	flood_waitdelay = gi.cvar("flood_waitdelay", "10", 0);
+	g_cmd_ratelimit = gi.cvar("g_cmd_ratelimit", "1", 0);
 
 	/* dm map list */
 	sv_maplist = gi.cvar("sv_maplist", "", 0);
@@ -393,6 +643,9 @@ InitGame(void)
 
 	/* initialize entities and clients arrays */
 	InitAllocations();
+
+	/* load the ban list */
+	SV_InitIPFilters();
 }
 
 /* ========================================================= */
@@ -571,7 +824,7 @@ GetMmoveLength(const mmove_t *mm)
  * below this block into files.
  */
 static void
-WriteField1(FILE *f, const field_t *field, void *base, const fptrList_t *fpl)
+WriteField1(savebuf_t *f, const field_t *field, void *base, const fptrList_t *fpl)
 {
 	void *p;
 	size_t len;
@@ -634,13 +887,12 @@ WriteField1(FILE *f, const field_t *field, void *base, const fptrList_t *fpl)
 			*(int *)p = GetMmoveLength(*(mmove_t **)p);
 			break;
 		default:
-			fclose(f);
 			gi.error("%s: unknown field type", __func__);
 	}
 }
 
 static void
-WriteFunction(FILE *f, const byte *fn, const functionList_t *fnl)
+WriteFunction(savebuf_t *f, const byte *fn, const functionList_t *fnl)
 {
 	const fnlist_entry_t *fne;
 
@@ -659,7 +911,7 @@ WriteFunction(FILE *f, const byte *fn, const functionList_t *fnl)
 }
 
 static void
-WriteMmove(FILE *f, const mmove_t *mm)
+WriteMmove(savebuf_t *f, const mmove_t *mm)
 {
 	const mmoveList_t *mmove;
 
@@ -678,7 +930,7 @@ WriteMmove(FILE *f, const mmove_t *mm)
 }
 
 static void
-WriteField2(FILE *f, const field_t *field, const void *base, const fptrList_t *fpl)
+WriteField2(savebuf_t *f, const field_t *field, const void *base, const fptrList_t *fpl)
 {
 	const void *p;
 
@@ -709,7 +961,7 @@ WriteField2(FILE *f, const field_t *field, const void *base, const fptrList_t *f
 }
 
 static void
-WriteStruct(FILE *f, const void *base, void *temp, const structdef_t *sd)
+WriteStruct(savebuf_t *f, const void *base, void *temp, const structdef_t *sd)
 {
 	const field_t *field;
 
@@ -732,7 +984,7 @@ WriteStruct(FILE *f, const void *base, void *temp, const structdef_t *sd)
 
 /* int because that is how it's stored in the file */
 static void
-ReadStringToBuf(FILE *f, int len, char *out, size_t out_sz)
+ReadStringToBuf(saveread_t *f, int len, char *out, size_t out_sz)
 {
 	*out = 0;
 
@@ -743,14 +995,12 @@ ReadStringToBuf(FILE *f, int len, char *out, size_t out_sz)
 
 	if (len < 0)
 	{
-		fclose(f);
 		gi.error("%s: string length < 0", __func__);
 		return;
 	}
 
 	if (len >= (int)out_sz)
 	{
-		fclose(f);
 		gi.error("%s: string is too long for buffer: %i > %i ",
 				__func__, len, (int)out_sz);
 		return;
@@ -762,7 +1012,7 @@ ReadStringToBuf(FILE *f, int len, char *out, size_t out_sz)
 
 /* int because that is how it's stored in the file */
 static char *
-ReadString(FILE *f, int len, int tag)
+ReadString(saveread_t *f, int len, int tag)
 {
 	char *s;
 
@@ -773,7 +1023,6 @@ ReadString(FILE *f, int len, int tag)
 
 	if (len < 0)
 	{
-		fclose(f);
 		gi.error("%s: string length < 0", __func__);
 		return NULL;
 	}
@@ -781,7 +1030,6 @@ ReadString(FILE *f, int len, int tag)
 	s = gi.TagMalloc(len + 1, tag);
 	if (!s)
 	{
-		fclose(f);
 		gi.error("%s: can't allocate memory for string", __func__);
 		return NULL;
 	}
@@ -792,8 +1040,27 @@ ReadString(FILE *f, int len, int tag)
 	return s;
 }
 
+/* level strings are shared, see G_InternString() */
+static char *
+ReadLevelString(saveread_t *f, int len)
+{
+	char *s, *interned;
+
+	s = ReadString(f, len, TAG_LEVEL);
+
+	if (!s)
+	{
+		return NULL;
+	}
+
+	interned = G_InternString(s);
+	gi.TagFree(s);
+
+	return interned;
+}
+
 static byte *
-ReadFunction(FILE *f, int len, const functionList_t *fnl)
+ReadFunction(saveread_t *f, int len, const functionList_t *fnl)
 {
 	char funcStr[128];
 	byte *fn;
@@ -816,7 +1083,7 @@ ReadFunction(FILE *f, int len, const functionList_t *fnl)
 }
 
 static mmove_t *
-ReadMmove(FILE *f, int len)
+ReadMmove(saveread_t *f, int len)
 {
 	char mmoveStr[128];
 	mmove_t *mm;
@@ -846,7 +1113,7 @@ ReadMmove(FILE *f, int len)
  * below
  */
 static void
-ReadField(FILE *f, const field_t *field, void *base, const fptrList_t *fpl)
+ReadField(saveread_t *f, const field_t *field, void *base, const fptrList_t *fpl)
 {
 	void *p;
 	int len;
@@ -865,7 +1132,7 @@ ReadField(FILE *f, const field_t *field, void *base, const fptrList_t *fpl)
 
 		case F_LSTRING:
 			len = *(int *)p;
-			*(char **)p = ReadString(f, len, TAG_LEVEL);
+			*(char **)p = ReadLevelString(f, len);
 			break;
 		case F_EDICT:
 			index = *(int *)p;
@@ -891,13 +1158,12 @@ ReadField(FILE *f, const field_t *field, void *base, const fptrList_t *fpl)
 			*(mmove_t **)p = ReadMmove(f, *(int *)p);
 			break;
 		default:
-			fclose(f);
 			gi.error("%s: unknown field type", __func__);
 	}
 }
 
 static void
-ReadStruct(FILE *f, void *base, const structdef_t *sd, short save_ver)
+ReadStruct(saveread_t *f, void *base, const structdef_t *sd, short save_ver)
 {
 	const field_t *field;
 
@@ -918,7 +1184,7 @@ ReadStruct(FILE *f, void *base, const structdef_t *sd, short save_ver)
  * Write the client struct into a file.
  */
 static void
-WriteClient(FILE *f, const gclient_t *client)
+WriteClient(savebuf_t *f, const gclient_t *client)
 {
 	gclient_t temp;
 
@@ -950,7 +1216,7 @@ SanitizeClientStruct(gclient_t *cl)
 }
 
 static void
-ReadClient(FILE *f, gclient_t *client, short save_ver)
+ReadClient(saveread_t *f, gclient_t *client, short save_ver)
 {
 	ReadStruct(f, client, &sd_client, save_ver);
 	SanitizeClientStruct(client);
@@ -974,7 +1240,7 @@ ReadClient(FILE *f, gclient_t *client, short save_ver)
  * - help computer info
  */
 static void
-WriteSaveHeader(FILE *f)
+WriteSaveHeader(savebuf_t *f)
 {
 	savegameHeader_t sv;
 
@@ -989,7 +1255,7 @@ WriteSaveHeader(FILE *f)
 }
 
 static void
-WriteGameLocals(FILE *f, qboolean autosave)
+WriteGameLocals(savebuf_t *f, qboolean autosave)
 {
 	game_locals_t temp;
 
@@ -1007,7 +1273,8 @@ WriteGameLocals(FILE *f, qboolean autosave)
 void
 WriteGame(const char *filename, qboolean autosave)
 {
-	FILE *f;
+	randk_stream_t streams[RAND_NUMSTREAMS];
+	savebuf_t sb;
 	int i;
 
 	if (!autosave)
@@ -1015,23 +1282,25 @@ WriteGame(const char *filename, qboolean autosave)
 		SaveClientData();
 	}
 
-	f = Q_fopen(filename, "wb");
-
-	if (!f)
-	{
-		gi.error("%s: Couldn't open %s", __func__, filename);
-		return;
-	}
+	memset(&sb, 0, sizeof(sb));
 
-	WriteSaveHeader(f);
-	WriteGameLocals(f, autosave);
+	WriteSaveHeader(&sb);
+	WriteGameLocals(&sb, autosave);
 
 	for (i = 0; i < game.maxclients; i++)
 	{
-		WriteClient(f, &game.clients[i]);
+		WriteClient(&sb, &game.clients[i]);
 	}
 
-	fclose(f);
+	/* a loaded game goes on with the same
+	   random numbers, since YQ2-6 */
+	G_SaveRandomState(streams);
+	sg_fwrite(streams, sizeof(streams), &sb);
+
+	/* the engine copies the savegame right after
+	   this returns, so this one is never deferred
+	   and waits for a pending level write */
+	SV_SaveToFile(&sb, filename, 0);
 }
 
 /*
@@ -1053,6 +1322,7 @@ GetSaveVersion(const char *ver)
 		{"YQ2-3", 3},
 		{"YQ2-4", 4},
 		{"YQ2-5", 5},
+		{"YQ2-6", 6},
 	};
 
 	for (i=0; i < ARRLEN(version_mappings); ++i)
@@ -1149,21 +1419,20 @@ SanitizeGameStruct(void)
 void
 ReadGame(const char *filename)
 {
+	randk_stream_t streams[RAND_NUMSTREAMS];
 	savegameHeader_t sv;
-	FILE *f;
+	saveread_t file, *f;
 	int i;
 	const char *errmsg;
 	short save_ver;
 
-	gi.FreeTags(TAG_GAME);
+	/* a level may still be written in the background */
+	SV_WaitForSaves();
 
-	f = Q_fopen(filename, "rb");
+	gi.FreeTags(TAG_GAME);
 
-	if (!f)
-	{
-		gi.error("%s: Couldn't open %s", __func__, filename);
-		return;
-	}
+	f = &file;
+	sg_fload(f, filename);
 
 	/* Sanity checks */
 	sg_fread(&sv, sizeof(sv), f);
@@ -1176,7 +1445,7 @@ ReadGame(const char *filename)
 	errmsg = CheckSaveCompatibility(&sv, save_ver);
 	if (errmsg)
 	{
-		fclose(f);
+		sg_fclose(f);
 		gi.error("%s", errmsg);
 		return;
 	}
@@ -1192,7 +1461,17 @@ ReadGame(const char *filename)
 		ReadClient(f, &game.clients[i], save_ver);
 	}
 
-	fclose(f);
+	if (save_ver >= 6)
+	{
+		sg_fread(streams, sizeof(streams), f);
+		G_LoadRandomState(streams);
+	}
+	else
+	{
+		G_SeedRandomTime();
+	}
+
+	sg_fclose(f);
 }
 
 /* ========================================================== */
@@ -1203,15 +1482,30 @@ ReadGame(const char *filename)
  * WriteLevel.
  */
 static void
-WriteEdict(FILE *f, const edict_t *ent)
+WriteEdict(savebuf_t *f, const edict_t *ent)
 {
-	edict_t temp;
+	savedict_t base, temp;
+
+	memset(&base, 0, sizeof(base));
+	memcpy(base.head, ent, sizeof(base.head));
+
+	if (ent->moveinfo)
+	{
+		base.moveinfo = *ent->moveinfo;
+	}
+
+	if (ent->monsterinfo)
+	{
+		base.monsterinfo = *ent->monsterinfo;
+	}
+
+	base.orders = ent->orders;
 
 	/* all of the ints, floats, and vectors stay as they are */
-	temp = *ent;
-	temp.client = NULL;
+	temp = base;
+	memset(temp.head + offsetof(edict_t, client), 0, sizeof(ent->client));
 
-	WriteStruct(f, ent, &temp, &sd_ent);
+	WriteStruct(f, &base, &temp, &sd_ent);
 }
 
 /*
@@ -1220,7 +1514,7 @@ WriteEdict(FILE *f, const edict_t *ent)
  * Called by WriteLevel.
  */
 static void
-WriteLevelLocals(FILE *f)
+WriteLevelLocals(savebuf_t *f)
 {
 	level_locals_t temp;
 
@@ -1230,6 +1524,105 @@ WriteLevelLocals(FILE *f)
 	WriteStruct(f, &level, &temp, &sd_level);
 }
 
+/*
+ * Level files can be saved incrementally. The first
+ * save of a level visit writes all edicts, later saves
+ * append a delta segment with the level locals and only
+ * those edicts that were changed, spawned or freed since
+ * the previous save:
+ *
+ *  full:  size, level, { entnum, edict } ..., -1, TAIL, id
+ *  delta: DELTA, length, level, { entnum, edict | -(entnum + 2) } ...,
+ *         -1, TAIL, id
+ *
+ * Every write ends with a random id. The next save only
+ * appends if the file still ends with it, so a file that
+ * was replaced by the engine (e.g. by loading a savegame)
+ * is rewritten in full. Once the deltas outgrow the base,
+ * the file is compacted by writing it in full again.
+ */
+#define LEVEL_DELTA_MAGIC 0x544c4544 /* "DELT" */
+#define LEVEL_TAIL_MAGIC 0x4c494154  /* "TAIL" */
+
+static struct
+{
+	char filename[MAX_OSPATH];
+	savebuf_t *records; /* last saved state of each edict */
+	int numrecords;
+	long filesize;      /* expected size of the file */
+	long basesize;      /* size of the last full write */
+	int id;
+	qboolean valid;
+} level_base;
+
+/*
+ * Forgets what was written for the current level,
+ * the next save of the level will be a full one.
+ */
+void
+G_ResetLevelSaveBase(void)
+{
+	int i;
+
+	for (i = 0; i < level_base.numrecords; i++)
+	{
+		SaveBuf_Free(&level_base.records[i]);
+	}
+
+	free(level_base.records);
+	memset(&level_base, 0, sizeof(level_base));
+}
+
+/*
+ * True if the file on disk is still
+ * the one we wrote last time.
+ */
+static qboolean
+LevelBaseMatches(const char *filename)
+{
+	FILE *f;
+	long size;
+	int id;
+
+	if (!level_base.valid || strcmp(level_base.filename, filename))
+	{
+		return false;
+	}
+
+	if (level_base.filesize > 2 * level_base.basesize)
+	{
+		return false;
+	}
+
+	f = Q_fopen(filename, "rb");
+
+	if (!f)
+	{
+		return false;
+	}
+
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+
+	if ((size != level_base.filesize) ||
+		(fseek(f, size - (long)sizeof(id), SEEK_SET) != 0) ||
+		(fread(&id, sizeof(id), 1, f) != 1))
+	{
+		fclose(f);
+		return false;
+	}
+
+	fclose(f);
+
+	return id == level_base.id;
+}
+
+static qboolean
+RecordsEqual(const savebuf_t *a, const savebuf_t *b)
+{
+	return (a->size == b->size) && !memcmp(a->data, b->data, a->size);
+}
+
 /*
  * Writes the current level
  * into a file.
@@ -1237,43 +1630,134 @@ WriteLevelLocals(FILE *f)
 void
 WriteLevel(const char *filename)
 {
-	int i;
+	int i, num, lenofs;
 	edict_t *ent;
-	FILE *f;
+	savebuf_t sb, rec, *f;
+	qboolean delta, keep;
 
-	f = Q_fopen(filename, "wb");
+	/* the previous write must be on
+	   disk before it can be checked */
+	SV_WaitForSaves();
 
-	if (!f)
+	keep = g_delta_saves->value != 0;
+	delta = keep && LevelBaseMatches(filename);
+
+	if (!delta)
 	{
-		gi.error("%s: Couldn't open %s", __func__, filename);
-		return;
+		G_ResetLevelSaveBase();
 	}
 
-	/* write out edict size for checking */
-	i = sizeof(edict_t);
-	sg_fwrite(&i, sizeof(i), f);
+	if (keep && !level_base.records)
+	{
+		level_base.numrecords = game.maxentities;
+		level_base.records = calloc(game.maxentities, sizeof(savebuf_t));
+
+		if (!level_base.records)
+		{
+			gi.error("%s: can't allocate the save base", __func__);
+			return;
+		}
+	}
+
+	memset(&sb, 0, sizeof(sb));
+	f = &sb;
+	lenofs = 0;
+
+	if (delta)
+	{
+		i = LEVEL_DELTA_MAGIC;
+		sg_fwrite(&i, sizeof(i), f);
+
+		/* patched below */
+		lenofs = sb.size;
+		sg_fwrite(&i, sizeof(i), f);
+	}
+	else
+	{
+		/* write out edict size for checking */
+		i = sizeof(savedict_t);
+		sg_fwrite(&i, sizeof(i), f);
+	}
 
 	/* write out level_locals_t */
 	WriteLevelLocals(f);
 
 	/* write out all the entities */
-	for (i = 0; i < globals.num_edicts; i++)
+	num = keep ? level_base.numrecords : globals.num_edicts;
+
+	for (i = 0; i < num; i++)
 	{
 		ent = &g_edicts[i];
 
-		if (!ent->inuse)
+		if ((i >= globals.num_edicts) || !ent->inuse)
 		{
+			if (keep && level_base.records[i].data)
+			{
+				int freed = -(i + 2);
+
+				if (delta)
+				{
+					sg_fwrite(&freed, sizeof(freed), f);
+				}
+
+				SaveBuf_Free(&level_base.records[i]);
+			}
+
+			continue;
+		}
+
+		memset(&rec, 0, sizeof(rec));
+		WriteEdict(&rec, ent);
+
+		if (delta && RecordsEqual(&rec, &level_base.records[i]))
+		{
+			SaveBuf_Free(&rec);
 			continue;
 		}
 
 		sg_fwrite(&i, sizeof(i), f);
-		WriteEdict(f, ent);
+		sg_fwrite(rec.data, rec.size, f);
+
+		if (keep)
+		{
+			SaveBuf_Free(&level_base.records[i]);
+			level_base.records[i] = rec;
+		}
+		else
+		{
+			SaveBuf_Free(&rec);
+		}
 	}
 
 	i = -1;
 	sg_fwrite(&i, sizeof(i), f);
 
-	fclose(f);
+	i = LEVEL_TAIL_MAGIC;
+	sg_fwrite(&i, sizeof(i), f);
+
+	level_base.id = (int)(Q_Microseconds() ^ (level_base.id * 16777619u) ^ randk());
+	sg_fwrite(&level_base.id, sizeof(level_base.id), f);
+
+	if (delta)
+	{
+		i = (int)(sb.size - lenofs - sizeof(i));
+		memcpy(sb.data + lenofs, &i, sizeof(i));
+
+		level_base.filesize += (long)sb.size;
+	}
+	else
+	{
+		level_base.filesize = (long)sb.size;
+		level_base.basesize = (long)sb.size;
+	}
+
+	if (keep)
+	{
+		Q_strlcpy(level_base.filename, filename, sizeof(level_base.filename));
+		level_base.valid = true;
+	}
+
+	SV_SaveToFile(f, filename, SAVE_ASYNC | (delta ? SAVE_APPEND : 0));
 }
 
 /* ========================================================== */
@@ -1298,66 +1782,60 @@ SanitizeLevelStruct(void)
 }
 
 static void
-ReadLevelLocals(FILE *f)
+ReadLevelLocals(saveread_t *f)
 {
 	ReadStruct(f, &level, &sd_level, 0);
 	SanitizeLevelStruct();
 }
 
 /*
- * Reads a level back into the memory.
- * SpawnEntities were already called
- * in the same way when the level was
- * saved. All world links were cleared
- * before this function was called. When
- * this function is called, no clients
- * are connected to the server.
+ * Reads an edict and moves its moveinfo_t
+ * and monsterinfo_t into the pools if
+ * they were used.
  */
-void
-ReadLevel(const char *filename)
+static void
+ReadEdict(saveread_t *f, edict_t *ent)
 {
-	int entnum;
-	FILE *f;
-	int i;
-	edict_t *ent;
+	static const moveinfo_t nomoveinfo;
+	static const monsterinfo_t nomonsterinfo;
+	savedict_t disk;
 
-	f = Q_fopen(filename, "rb");
+	ReadStruct(f, &disk, &sd_ent, 0);
 
-	if (!f)
+	memcpy(ent, disk.head, sizeof(disk.head));
+	ent->moveinfo = NULL;
+	ent->monsterinfo = NULL;
+	ent->orders = disk.orders;
+
+	if (memcmp(&disk.moveinfo, &nomoveinfo, sizeof(nomoveinfo)))
 	{
-		gi.error("%s: Couldn't open %s", __func__, filename);
-		return;
+		*G_AllocMoveInfo(ent) = disk.moveinfo;
 	}
 
-	/* free any dynamic memory allocated by
-	   loading the level base state */
-	gi.FreeTags(TAG_LEVEL);
-
-	/* wipe all the entities */
-	memset(g_edicts, 0, game.maxentities * sizeof(g_edicts[0]));
-	globals.num_edicts = maxclients->value + 1;
-
-	/* check edict size */
-	sg_fread(&i, sizeof(i), f);
-
-	if (i != sizeof(edict_t))
+	if (memcmp(&disk.monsterinfo, &nomonsterinfo, sizeof(nomonsterinfo)))
 	{
-		fclose(f);
-		gi.error("%s: mismatched edict size", __func__);
-		return;
+		*G_AllocMonsterInfo(ent) = disk.monsterinfo;
 	}
+}
 
-	/* load the level locals */
-	ReadLevelLocals(f);
+/*
+ * Reads edict records up to the -1 terminator. Records
+ * in delta segments replace edicts read before, negative
+ * entnums free them.
+ */
+static void
+ReadLevelEdicts(saveread_t *f, qboolean delta)
+{
+	int entnum;
+	edict_t *ent;
 
-	/* load all the entities */
 	while (1)
 	{
 		sg_fread(&entnum, sizeof(entnum), f);
 
-		if ((entnum < -1) || (entnum >= game.maxentities))
+		if ((entnum < (delta ? -(game.maxentities + 1) : -1)) ||
+			(entnum >= game.maxentities))
 		{
-			fclose(f);
 			gi.error("%s: entnum out of bounds: %d", __func__, entnum);
 		}
 
@@ -1366,13 +1844,31 @@ ReadLevel(const char *filename)
 			break;
 		}
 
-		if (entnum >= globals.num_edicts)
+		if (entnum < -1)
+		{
+			ent = G_ExtendEdicts(-entnum - 2);
+
+			if (ent->inuse)
+			{
+				gi.unlinkentity(ent);
+				G_ReleaseEdictInfo(ent);
+				memset(ent, 0, sizeof(*ent));
+				ent->s.number = ent - g_edicts;
+			}
+
+			continue;
+		}
+
+		ent = G_ExtendEdicts(entnum);
+
+		if (ent->inuse)
 		{
-			globals.num_edicts = entnum + 1;
+			gi.unlinkentity(ent);
+			G_ReleaseEdictInfo(ent);
+			memset(ent, 0, sizeof(*ent));
 		}
 
-		ent = &g_edicts[entnum];
-		ReadStruct(f, ent, &sd_ent, 0);
+		ReadEdict(f, ent);
 
 		/* sanitize certain field values */
 		ent->client = NULL;
@@ -1386,10 +1882,106 @@ ReadLevel(const char *filename)
 
 		/* let the server rebuild world links for this ent */
 		memset(&ent->area, 0, sizeof(ent->area));
-		gi.linkentity(ent);
+		G_LinkEntity(ent);
 	}
+}
 
-	fclose(f);
+/*
+ * Applies the delta segments appended after the base
+ * state. A segment cut short by a crash while it was
+ * appended is ignored, together with everything after it.
+ */
+static void
+ReadLevelDeltas(saveread_t *f)
+{
+	int magic, len, id;
+
+	/* files written before deltas existed end here */
+	if (!sg_tryread(&magic, sizeof(magic), f) ||
+		(magic != LEVEL_TAIL_MAGIC) ||
+		!sg_tryread(&id, sizeof(id), f))
+	{
+		return;
+	}
+
+	while (1)
+	{
+		if (!sg_tryread(&magic, sizeof(magic), f) ||
+			(magic != LEVEL_DELTA_MAGIC) ||
+			!sg_tryread(&len, sizeof(len), f) ||
+			(len <= 0) || ((size_t)len > f->size - f->pos))
+		{
+			return;
+		}
+
+		ReadLevelLocals(f);
+		ReadLevelEdicts(f, true);
+
+		sg_fread(&magic, sizeof(magic), f);
+		sg_fread(&id, sizeof(id), f);
+
+		if (magic != LEVEL_TAIL_MAGIC)
+		{
+			gi.error("%s: corrupted level delta", __func__);
+		}
+	}
+}
+
+/*
+ * Reads a level back into the memory.
+ * SpawnEntities were already called
+ * in the same way when the level was
+ * saved. All world links were cleared
+ * before this function was called. When
+ * this function is called, no clients
+ * are connected to the server.
+ */
+void
+ReadLevel(const char *filename)
+{
+	saveread_t file, *f;
+	int i;
+	edict_t *ent;
+
+	/* the level may still be written in the background */
+	SV_WaitForSaves();
+	G_ResetLevelSaveBase();
+
+	f = &file;
+	sg_fload(f, filename);
+
+	/* free any dynamic memory allocated by
+	   loading the level base state */
+	gi.FreeTags(TAG_LEVEL);
+	G_FlightClear();
+	G_ResetEdictPools();
+	G_ResetStrings();
+
+	/* the server restored the configstrings
+	   from the savegame, forget cached indexes */
+	G_ResetIndexes();
+
+	/* wipe all the entities */
+	G_ResetEdicts();
+
+	/* check edict size */
+	sg_fread(&i, sizeof(i), f);
+
+	if (i != sizeof(savedict_t))
+	{
+		sg_fclose(f);
+		gi.error("%s: mismatched edict size", __func__);
+		return;
+	}
+
+	/* load the level locals */
+	ReadLevelLocals(f);
+
+	/* load all the entities */
+	ReadLevelEdicts(f, false);
+	ReadLevelDeltas(f);
+
+	sg_fclose(f);
 
 	/* mark all clients as unconnected */
 	for (i = 0; i < maxclients->value; i++)
@@ -1418,4 +2010,229 @@ ReadLevel(const char *filename)
 			}
 		}
 	}
+
+	G_ResetEdictMirror();
+}
+
+/* ========================================================== */
+
+/*
+ * Snapshots hold the complete game state (game and level
+ * locals, clients and edicts) in memory. They use the same
+ * serialization as the savegames, but never touch the disk
+ * and can be restored while the level keeps running.
+ */
+struct snapshot_s
+{
+	savebuf_t buf;
+	char mapname[MAX_QPATH];
+	int maxclients;
+	int maxentities;
+	qboolean connected[MAX_CLIENTS];
+	randk_stream_t rand[RAND_NUMSTREAMS];
+};
+
+static snapshot_t *sv_snapshot; /* sv snapshot / sv rollback */
+
+snapshot_t *
+G_SnapshotCreate(void)
+{
+	snapshot_t *snap;
+	savebuf_t *f;
+	edict_t *ent;
+	int i;
+
+	snap = calloc(1, sizeof(*snap));
+
+	if (!snap)
+	{
+		gi.error("%s: can't allocate snapshot", __func__);
+		return NULL;
+	}
+
+	Q_strlcpy(snap->mapname, level.mapname, sizeof(snap->mapname));
+	snap->maxclients = game.maxclients;
+	snap->maxentities = game.maxentities;
+	G_SaveRandomState(snap->rand);
+
+	f = &snap->buf;
+
+	WriteGameLocals(f, game.autosaved);
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		snap->connected[i] = game.clients[i].pers.connected;
+		WriteClient(f, &game.clients[i]);
+	}
+
+	WriteLevelLocals(f);
+
+	for (i = 0; i < globals.num_edicts; i++)
+	{
+		ent = &g_edicts[i];
+
+		if (!ent->inuse)
+		{
+			continue;
+		}
+
+		sg_fwrite(&i, sizeof(i), f);
+		WriteEdict(f, ent);
+	}
+
+	i = -1;
+	sg_fwrite(&i, sizeof(i), f);
+
+	return snap;
+}
+
+void
+G_SnapshotFree(snapshot_t *snap)
+{
+	if (!snap)
+	{
+		return;
+	}
+
+	SaveBuf_Free(&snap->buf);
+	free(snap);
+}
+
+/*
+ * Puts the game back into the state it was in when
+ * the snapshot was taken. Only works on the same map
+ * and with the same clients connected, since the
+ * server side of the clients isn't part of it.
+ */
+qboolean
+G_SnapshotRestore(const snapshot_t *snap)
+{
+	saveread_t file, *f;
+	game_locals_t saved;
+	edict_t *ent;
+	short save_ver;
+	int i;
+
+	if (!snap || strcmp(snap->mapname, level.mapname) ||
+		(snap->maxclients != game.maxclients) ||
+		(snap->maxentities != game.maxentities))
+	{
+		return false;
+	}
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		if (snap->connected[i] != game.clients[i].pers.connected)
+		{
+			return false;
+		}
+	}
+
+	/* take the current level out of the world */
+	for (i = 0; i < globals.num_edicts; i++)
+	{
+		ent = &g_edicts[i];
+
+		if (ent->inuse)
+		{
+			gi.unlinkentity(ent);
+			G_ReleaseEdictInfo(ent);
+		}
+	}
+
+	f = &file;
+	f->data = snap->buf.data;
+	f->size = snap->buf.size;
+	f->pos = 0;
+
+	save_ver = GetSaveVersion(SAVEGAMEVER);
+
+	saved = game;
+	ReadStruct(f, &game, &sd_game, save_ver);
+	SanitizeGameStruct();
+	game.clients = saved.clients;
+	game.maxclients = saved.maxclients;
+	game.maxentities = saved.maxentities;
+	game.num_items = saved.num_items;
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		ReadClient(f, &game.clients[i], save_ver);
+	}
+
+	G_ResetEdicts();
+
+	ReadLevelLocals(f);
+	ReadLevelEdicts(f, false);
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		g_edicts[i + 1].client = game.clients + i;
+	}
+
+	G_ResetEdictMirror();
+	G_ResetLagHistory(NULL);
+	G_LoadRandomState(snap->rand);
+
+	/* the cached scores are from after the snapshot */
+	InvalidateScoreboard();
+
+	return true;
+}
+
+/*
+ * sv snapshot
+ *
+ * Keeps a snapshot of the
+ * game state in memory.
+ */
+void
+SVCmd_Snapshot_f(void)
+{
+	long long start;
+
+	start = Q_Microseconds();
+
+	G_SnapshotFree(sv_snapshot);
+	sv_snapshot = G_SnapshotCreate();
+
+	gi.cprintf(NULL, PRINT_HIGH, "Snapshot of %s taken, %u bytes in %.3f ms\n",
+			level.mapname, (unsigned int)sv_snapshot->buf.size,
+			(Q_Microseconds() - start) / 1000.0);
+}
+
+/*
+ * sv rollback
+ *
+ * Restores the snapshot
+ * taken by sv snapshot.
+ */
+void
+SVCmd_Rollback_f(void)
+{
+	long long start;
+
+	start = Q_Microseconds();
+
+	if (!G_SnapshotRestore(sv_snapshot))
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "No snapshot of this level.\n");
+		return;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "Rolled back to the snapshot in %.3f ms\n",
+			(Q_Microseconds() - start) / 1000.0);
+}
+
+/*
+ * Called by ShutdownGame().
+ */
+void
+SV_ShutdownSaves(void)
+{
+	SV_FinishSaves();
+	G_ResetLevelSaveBase();
+
+	G_SnapshotFree(sv_snapshot);
+	sv_snapshot = NULL;
 }
@@ -91,4 +91,34 @@ typedef struct
     char arch[32];
 } savegameHeader_t;
 
+/*
+ * Growing memory buffer
+ * savegames are written to
+ */
+typedef struct
+{
+	byte *data;
+	size_t size;
+	size_t maxsize;
+} savebuf_t;
+
+/*
+ * Savegame being read
+ */
+typedef struct
+{
+	const byte *data;
+	size_t size;
+	size_t pos;
+} saveread_t;
+
+/* SV_SaveToFile() flags */
+#define SAVE_ASYNC 1  /* may be written in the background */
+#define SAVE_APPEND 2 /* append to the file instead of replacing it */
+
+/* savewriter.c */
+void SaveBuf_Write(savebuf_t *sb, const void *src, size_t n);
+void SaveBuf_Free(savebuf_t *sb);
+void SV_SaveToFile(savebuf_t *sb, const char *filename, int flags);
+
 #endif /* SAVEGAME_LOCAL_H */
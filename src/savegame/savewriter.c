@@ -0,0 +1,296 @@
+/*
+ * =======================================================================
+ *
+ * Savegame output. Savegames are serialized into a memory
+ * buffer which is then written to a temporary file and renamed
+ * over the real one, so a crash never leaves a half written
+ * savegame behind. With g_async_save the file is written by a
+ * background thread and the server keeps running meanwhile.
+ *
+ * Only one write is in flight at any time. Everything that
+ * reads or copies savegames must call SV_WaitForSaves() first.
+ * The game waits in ReadGame(), ReadLevel(), WriteGame() and
+ * SpawnEntities(), so a write never outlives the map change or
+ * save that queued it and the engine never copies or wipes the
+ * save directories while a write is pending. A failed write is
+ * raised as an error there.
+ *
+ * =======================================================================
+ */
+
+#include <errno.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "../header/local.h"
+#include "savegame.h"
+
+#define SAVEBUF_CHUNK 65536
+
+typedef struct
+{
+	savebuf_t buf;
+	char filename[MAX_OSPATH];
+	char tmpname[MAX_OSPATH];
+
+	qboolean append;
+
+	char error[256];
+} savejob_t;
+
+static savejob_t save_job;
+static qboolean save_pending;
+
+#ifdef _WIN32
+static HANDLE save_thread;
+#else
+static pthread_t save_thread;
+#endif
+
+/* ========================================================= */
+
+void
+SaveBuf_Write(savebuf_t *sb, const void *src, size_t n)
+{
+	size_t newsize;
+	byte *data;
+
+	if (sb->size + n > sb->maxsize)
+	{
+		newsize = sb->maxsize ? sb->maxsize : SAVEBUF_CHUNK;
+
+		while (sb->size + n > newsize)
+		{
+			newsize *= 2;
+		}
+
+		/* plain malloc(), the buffer may be freed by the writer thread */
+		data = realloc(sb->data, newsize);
+
+		if (!data)
+		{
+			gi.error("%s: can't allocate %u bytes", __func__,
+					(unsigned int)newsize);
+			return;
+		}
+
+		sb->data = data;
+		sb->maxsize = newsize;
+	}
+
+	memcpy(sb->data + sb->size, src, n);
+	sb->size += n;
+}
+
+void
+SaveBuf_Free(savebuf_t *sb)
+{
+	free(sb->data);
+	memset(sb, 0, sizeof(*sb));
+}
+
+/* ========================================================= */
+
+/*
+ * Appending is not atomic, the reader
+ * must cope with a truncated tail.
+ */
+static void
+SaveJob_Append(savejob_t *job)
+{
+	FILE *f;
+
+	f = Q_fopen(job->filename, "ab");
+
+	if (!f)
+	{
+		Com_sprintf(job->error, sizeof(job->error), "Couldn't open %s",
+				job->filename);
+		return;
+	}
+
+	if ((fwrite(job->buf.data, job->buf.size, 1, f) != 1) || (fflush(f) != 0))
+	{
+		Com_sprintf(job->error, sizeof(job->error),
+				"Error appending %u bytes to %s",
+				(unsigned int)job->buf.size, job->filename);
+	}
+
+	fclose(f);
+}
+
+/*
+ * Writes the buffer to the temporary file and renames it
+ * over the target. Runs in the writer thread in async mode,
+ * so it must not call into the engine. Errors are stored in
+ * the job and reported by the main thread.
+ */
+static void
+SaveJob_Run(savejob_t *job)
+{
+	FILE *f;
+
+	if (job->append)
+	{
+		SaveJob_Append(job);
+		return;
+	}
+
+	f = Q_fopen(job->tmpname, "wb");
+
+	if (!f)
+	{
+		Com_sprintf(job->error, sizeof(job->error), "Couldn't open %s",
+				job->tmpname);
+		return;
+	}
+
+	if ((fwrite(job->buf.data, job->buf.size, 1, f) != 1) || (fflush(f) != 0))
+	{
+		fclose(f);
+		remove(job->tmpname);
+		Com_sprintf(job->error, sizeof(job->error),
+				"Error writing %u bytes to %s",
+				(unsigned int)job->buf.size, job->tmpname);
+		return;
+	}
+
+	fclose(f);
+
+	if (!Q_rename(job->tmpname, job->filename))
+	{
+		remove(job->tmpname);
+		Com_sprintf(job->error, sizeof(job->error), "Couldn't rename %s to %s",
+				job->tmpname, job->filename);
+	}
+}
+
+#ifdef _WIN32
+static DWORD WINAPI
+SaveThread(LPVOID arg)
+{
+	SaveJob_Run(arg);
+	return 0;
+}
+#else
+static void *
+SaveThread(void *arg)
+{
+	SaveJob_Run(arg);
+	return NULL;
+}
+#endif
+
+static qboolean
+SaveThread_Start(void)
+{
+#ifdef _WIN32
+	save_thread = CreateThread(NULL, 0, SaveThread, &save_job, 0, NULL);
+	return save_thread != NULL;
+#else
+	return pthread_create(&save_thread, NULL, SaveThread, &save_job) == 0;
+#endif
+}
+
+static void
+SaveThread_Join(void)
+{
+#ifdef _WIN32
+	WaitForSingleObject(save_thread, INFINITE);
+	CloseHandle(save_thread);
+	save_thread = NULL;
+#else
+	pthread_join(save_thread, NULL);
+#endif
+}
+
+/* ========================================================= */
+
+/* Joins the pending write, false if it failed. */
+static qboolean
+SaveThread_Finish(void)
+{
+	SaveThread_Join();
+	save_pending = false;
+
+	SaveBuf_Free(&save_job.buf);
+
+	return !save_job.error[0];
+}
+
+/*
+ * Blocks until the pending background write (if any)
+ * is on disk. A failed write stops the game like it
+ * does when writing synchronously, otherwise the engine
+ * would copy a missing or stale file into the slot.
+ */
+void
+SV_WaitForSaves(void)
+{
+	char error[sizeof(save_job.error)];
+
+	if (!save_pending || SaveThread_Finish())
+	{
+		return;
+	}
+
+	Q_strlcpy(error, save_job.error, sizeof(error));
+	save_job.error[0] = '\0';
+
+	gi.error("%s", error);
+}
+
+/*
+ * Like SV_WaitForSaves(), but a failed write
+ * is only reported. For the shutdown, which
+ * must not raise an error.
+ */
+void
+SV_FinishSaves(void)
+{
+	if (save_pending && !SaveThread_Finish())
+	{
+		gi.dprintf("WARNING: %s\n", save_job.error);
+	}
+}
+
+/*
+ * Writes the serialized savegame to filename and frees
+ * the buffer. The write is done in the background if
+ * SAVE_ASYNC is set and g_async_save allows it.
+ */
+void
+SV_SaveToFile(savebuf_t *sb, const char *filename, int flags)
+{
+	savejob_t *job;
+
+	SV_WaitForSaves();
+
+	job = &save_job;
+	memset(job, 0, sizeof(*job));
+
+	job->buf = *sb;
+	memset(sb, 0, sizeof(*sb));
+
+	Q_strlcpy(job->filename, filename, sizeof(job->filename));
+	Com_sprintf(job->tmpname, sizeof(job->tmpname), "%s.tmp", filename);
+	job->append = (flags & SAVE_APPEND) != 0;
+
+	if ((flags & SAVE_ASYNC) && g_async_save->value && SaveThread_Start())
+	{
+		save_pending = true;
+		return;
+	}
+
+	SaveJob_Run(job);
+	SaveBuf_Free(&job->buf);
+
+	if (job->error[0])
+	{
+		gi.error("%s", job->error);
+	}
+}
@@ -58,16 +58,16 @@
 {"use", FOFS(use), F_FUNCTION, FFL_NOSPAWN},
 {"pain", FOFS(pain), F_FUNCTION, FFL_NOSPAWN},
 {"die", FOFS(die), F_FUNCTION, FFL_NOSPAWN},
-{"stand", FOFS(monsterinfo.stand), F_FUNCTION, FFL_NOSPAWN},
-{"idle", FOFS(monsterinfo.idle), F_FUNCTION, FFL_NOSPAWN},
-{"search", FOFS(monsterinfo.search), F_FUNCTION, FFL_NOSPAWN},
-{"walk", FOFS(monsterinfo.walk), F_FUNCTION, FFL_NOSPAWN},
-{"run", FOFS(monsterinfo.run), F_FUNCTION, FFL_NOSPAWN},
-{"dodge", FOFS(monsterinfo.dodge), F_FUNCTION, FFL_NOSPAWN},
-{"attack", FOFS(monsterinfo.attack), F_FUNCTION, FFL_NOSPAWN},
-{"melee", FOFS(monsterinfo.melee), F_FUNCTION, FFL_NOSPAWN},
-{"sight", FOFS(monsterinfo.sight), F_FUNCTION, FFL_NOSPAWN},
-{"checkattack", FOFS(monsterinfo.checkattack), F_FUNCTION, FFL_NOSPAWN},
-{"currentmove", FOFS(monsterinfo.currentmove), F_MMOVE, FFL_NOSPAWN},
-{"endfunc", FOFS(moveinfo.endfunc), F_FUNCTION, FFL_NOSPAWN},
+{"stand", SAVEOFS(monsterinfo.stand), F_FUNCTION, FFL_NOSPAWN},
+{"idle", SAVEOFS(monsterinfo.idle), F_FUNCTION, FFL_NOSPAWN},
+{"search", SAVEOFS(monsterinfo.search), F_FUNCTION, FFL_NOSPAWN},
+{"walk", SAVEOFS(monsterinfo.walk), F_FUNCTION, FFL_NOSPAWN},
+{"run", SAVEOFS(monsterinfo.run), F_FUNCTION, FFL_NOSPAWN},
+{"dodge", SAVEOFS(monsterinfo.dodge), F_FUNCTION, FFL_NOSPAWN},
+{"attack", SAVEOFS(monsterinfo.attack), F_FUNCTION, FFL_NOSPAWN},
+{"melee", SAVEOFS(monsterinfo.melee), F_FUNCTION, FFL_NOSPAWN},
+{"sight", SAVEOFS(monsterinfo.sight), F_FUNCTION, FFL_NOSPAWN},
+{"checkattack", SAVEOFS(monsterinfo.checkattack), F_FUNCTION, FFL_NOSPAWN},
+{"currentmove", SAVEOFS(monsterinfo.currentmove), F_MMOVE, FFL_NOSPAWN},
+{"endfunc", SAVEOFS(moveinfo.endfunc), F_FUNCTION, FFL_NOSPAWN},
 {"item", FOFS(item), F_ITEM},
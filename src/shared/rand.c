@@ -15,6 +15,8 @@
 
 #include <stdint.h>
 
+#include "../header/shared.h"
+
 #define QSIZE 0x200000
 #define CNG (cng = 6906969069ULL * cng + 13579)
 #define XS (xs ^= (xs << 13), xs ^= (xs >> 17), xs ^= (xs << 43))
@@ -95,3 +97,47 @@ randk_seed(void)
 	}
 }
 
+/* ========================================================= */
+
+/*
+ * Independent, seedable streams (PCG32 by Melissa
+ * O'Neill). Every stream has its own 16 bytes of
+ * state, so consumers don't perturb each other.
+ */
+
+#define PCG_MULT 6364136223846793005ULL
+
+/*
+ * Generate a pseudorandom
+ * integer >0 from a stream.
+ */
+int
+randk_stream(randk_stream_t *rs)
+{
+	uint64_t old;
+	uint32_t xorshifted, rot, r;
+
+	old = rs->state;
+	rs->state = old * PCG_MULT + rs->inc;
+
+	xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+	rot = (uint32_t)(old >> 59);
+	r = (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+
+	return (int)(r >> 1);
+}
+
+/*
+ * Seeds a stream. Streams with the same seed
+ * but different ids yield unrelated sequences.
+ */
+void
+randk_stream_seed(randk_stream_t *rs, unsigned long long seed,
+		unsigned long long id)
+{
+	rs->state = 0;
+	rs->inc = (id << 1) | 1;
+	randk_stream(rs);
+	rs->state += seed;
+	randk_stream(rs);
+}
@@ -1436,6 +1436,20 @@ FILE *Q_fopen(const char *file, const char *mode)
 
 	return NULL;
 }
+
+qboolean Q_rename(const char *from, const char *to)
+{
+	WCHAR wfrom[MAX_OSPATH];
+	WCHAR wto[MAX_OSPATH];
+
+	if ((MultiByteToWideChar(CP_UTF8, 0, from, -1, wfrom, MAX_OSPATH) <= 0) ||
+		(MultiByteToWideChar(CP_UTF8, 0, to, -1, wto, MAX_OSPATH) <= 0))
+	{
+		return false;
+	}
+
+	return MoveFileExW(wfrom, wto, MOVEFILE_REPLACE_EXISTING) != 0;
+}
 #else
 #include <sys/stat.h>
 #include <errno.h>
@@ -1451,8 +1465,51 @@ FILE *Q_fopen(const char *file, const char *mode)
 	}
 	return fopen(file, mode);
 }
+
+qboolean Q_rename(const char *from, const char *to)
+{
+	return rename(from, to) == 0;
+}
 #endif
 
+/*
+ * Monotonic clocks, only useful
+ * for measuring intervals.
+ */
+#ifdef _WIN32
+long long Q_Nanoseconds(void)
+{
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER count;
+
+	if (!freq.QuadPart)
+	{
+		QueryPerformanceFrequency(&freq);
+	}
+
+	QueryPerformanceCounter(&count);
+
+	/* split up, count * 1000000000 overflows after a few days */
+	return (count.QuadPart / freq.QuadPart) * 1000000000 +
+		(count.QuadPart % freq.QuadPart) * 1000000000 / freq.QuadPart;
+}
+#else
+#include <time.h>
+long long Q_Nanoseconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (long long)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+
+long long Q_Microseconds(void)
+{
+	return Q_Nanoseconds() / 1000;
+}
+
 int
 Q_sort_stricmp(const void *s1, const void *s2)
 {